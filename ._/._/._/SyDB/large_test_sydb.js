@@ -18,7 +18,7 @@ async function extractCFile() {
     
     try {
         // Base64 encoded C file content
-        const base64Content = `I2luY2x1ZGUgPHN0ZGlvLmg+CiNpbmNsdWRlIDxzdGRsaWIuaD4KI2luY2x1ZGUgPHN0cmluZy5oPgojaW5jbHVkZSA8dW5pc3RkLmg+CiNpbmNsdWRlIDxzeXMvdGltZS5oPgojaW5jbHVkZSA8dGltZS5oPgojaW5jbHVkZSA8ZGlyZW50Lmg+CiNpbmNsdWRlIDxzeXMvc3RhdC5oPgojaW5jbHVkZSA8ZmNudGwuaD4KI2luY2x1ZGUgPHN5cy9zb2NrZXQuaD4KI2luY2x1ZGUgPG5ldGluZXQvaW4uaD4KI2luY2x1ZGUgPGFycGEvaW5ldC5oPgojaW5jbHVkZSA8bmV0ZGIuaD4KI2luY2x1ZGUgPGVycm5vLmg+CiNpbmNsdWRlIDxjdHlwZS5oPgoKI2RlZmluZSBSRUQgICAgICJcMDMzWzE7MzFtIgojZGVmaW5lIEdSRUVOICAgIlwwMzNbMTszMm0iCiNkZWZpbmUgWUVMTE9XICAiXDAzM1sxOzMzbSIKI2RlZmluZSBCTFVFICAgICJcMDMzWzE7MzRtIgojZGVmaW5lIE1BR0VOVEEgIlwwMzNbMTszNW0iCiNkZWZpbmUgQ1lBTiAgICAiXDAzM1sxOzM2bSIKI2RlZmluZSBXSElURSAgICJcMDMzWzE7MzdtIgojZGVmaW5lIEdSQVkgICAgIlwwMzNbMTs5MG0iCiNkZWZpbmUgUkVTRVQgICAiXDAzM1swbSIKCnR5cGVkZWYgc3RydWN0IHsKICAgIGNoYXIgZGVzY3JpcHRpb25bNTEyXTsKICAgIGNoYXIgY29tbWFuZFsxMDI0XTsKICAgIGNoYXIgdmVyaWZpY2F0aW9uX2NvbW1hbmRbMTAyNF07CiAgICBjaGFyIGV4cGVjdGVkX291dHB1dFsxMDI0XTsKICAgIGludCBzdWNjZXNzOwogICAgaW50IHZlcmlmaWNhdGlvbl9zdWNjZXNzOwogICAgbG9uZyBsb25nIGR1cmF0aW9uX21zOwogICAgY2hhciBkZXRhaWxzWzEwMjRdOwogICAgY2hhciB2ZXJib3NlX291dHB1dFs0MDk2XTsKfSBUZXN0Q2FzZTsKCmNoYXIgY2xpX2NvbW1hbmRbMzJdID0gIi4vc3lkYiI7CmludCB0ZXN0X21vZGUgPSAwOwpjaGFyIHNlcnZlcl91cmxbMjU2XSA9ICJodHRwOi8vbG9jYWxob3N0OjgwODAiOwppbnQgdmVyYm9zZV9tb2RlID0gMDsKCnR5cGVkZWYgc3RydWN0IHsKICAgIGludCBzdGF0dXNfY29kZTsKICAgIGNoYXIqIGJvZHk7CiAgICBzaXplX3QgYm9keV9sZW5ndGg7Cn0gSHR0cFJlc3BvbnNlOwoKSHR0cFJlc3BvbnNlKiBodHRwX3JlcXVlc3QoY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiB1cmwsIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGNvbnRlbnRfdHlwZSk7CnZvaWQgaHR0cF9yZXNwb25zZV9mcmVlKEh0dHBSZXNwb25zZSogcmVzcG9uc2UpOwppbnQgaHR0cF90ZXN0X2VuZHBvaW50KGNvbnN0IGNoYXIqIGRlc2NyaXB0aW9uLCBjb25zdCBjaGFyKiBtZXRob2QsIGNvbnN0IGNoYXIqIGVuZHBvaW50LCAKICAgICAgICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGV4cGVjdGVkX3BhdHRlcm4sIGludCBjaGVja19zdWNjZXNzX29ubHksIGxvbmcgbG9uZyogZHVyYXRpb24pOwppbnQgdmVyaWZ5X2h0dHBfcmVzcG9uc2UoY29uc3QgSHR0cFJlc3BvbnNlKiByZXNwb25zZSwgY29uc3QgY2hhciogZXhwZWN0ZWRfcGF0dGVybiwgaW50IGNoZWNrX3N1Y2Nlc3Nfb25seSk7CmNoYXIqIGV4dHJhY3RfanNvbl9maWVsZChjb25zdCBjaGFyKiBqc29uLCBjb25zdCBjaGFyKiBmaWVsZCk7Cgpsb25nIGxvbmcgZ2V0X2N1cnJlbnRfdGltZV9tcygpOwppbnQgZmlsZV9leGlzdHMoY29uc3QgY2hhciAqcGF0aCk7CmludCBjb3VudF9maWxlc19pbl9kaXJlY3RvcnkoY29uc3QgY2hhciAqcGF0aCk7CmludCBjb3VudF9pbnN0YW5jZXNfaW5fY29sbGVjdGlvbihjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbik7CmNoYXIqIGdldF9sYXN0X2luc2VydGVkX2lkKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKTsKaW50IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSk7CmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmVfdmVyYm9zZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSwgY2hhciAqdmVyYm9zZV9vdXRwdXQsIHNpemVfdCB2ZXJib3NlX3NpemUpOwppbnQgdmVyaWZ5X2RhdGFiYXNlX3N0cnVjdHVyZShjb25zdCBjaGFyICpkYXRhYmFzZSk7CmludCB2ZXJpZnlfY29sbGVjdGlvbl9zdHJ1Y3R1cmUoY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pOwppbnQgdmVyaWZ5X3NjaGVtYV9jb250ZW50KGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uLCBjb25zdCBjaGFyICpleHBlY3RlZF9maWVsZHMpOwppbnQgZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKFRlc3RDYXNlICp0ZXN0KTsKdm9pZCBydW5fc2VjdXJpdHlfdGVzdHMoKTsKdm9pZCBydW5fZGF0YV9pbnRlZ3JpdHlfdGVzdHMoKTsKdm9pZCBydW5fcGVyZm9ybWFuY2VfdGVzdCgpOwp2b2lkIHJ1bl9lZGdlX2Nhc2VfdGVzdHMoKTsKdm9pZCBydW5fY29tcHJlaGVuc2l2ZV92ZXJpZmljYXRpb24oKTsKCmxvbmcgbG9uZyBnZXRfY3VycmVudF90aW1lX21zKCkgewogICAgc3RydWN0IHRpbWV2YWwgdHY7CiAgICBnZXR0aW1lb2ZkYXkoJnR2LCBOVUxMKTsKICAgIHJldHVybiAobG9uZyBsb25nKXR2LnR2X3NlYyAqIDEwMDAgKyB0di50dl91c2VjIC8gMTAwMDsKfQoKaW50IGZpbGVfZXhpc3RzKGNvbnN0IGNoYXIgKnBhdGgpIHsKICAgIHN0cnVjdCBzdGF0IHN0OwogICAgcmV0dXJuIHN0YXQocGF0aCwgJnN0KSA9PSAwOwp9CgppbnQgY291bnRfZmlsZXNfaW5fZGlyZWN0b3J5KGNvbnN0IGNoYXIgKnBhdGgpIHsKICAgIERJUiAqZGlyID0gb3BlbmRpcihwYXRoKTsKICAgIGlmICghZGlyKSByZXR1cm4gLTE7CiAgICAKICAgIGludCBjb3VudCA9IDA7CiAgICBzdHJ1Y3QgZGlyZW50ICplbnRyeTsKICAgIHdoaWxlICgoZW50cnkgPSByZWFkZGlyKGRpcikpICE9IE5VTEwpIHsKICAgICAgICBpZiAoc3RyY21wKGVudHJ5LT5kX25hbWUsICIuIikgIT0gMCAmJiBzdHJjbXAoZW50cnktPmRfbmFtZSwgIi4uIikgIT0gMCkgewogICAgICAgICAgICBjb3VudCsrOwogICAgICAgIH0KICAgIH0KICAgIGNsb3NlZGlyKGRpcik7CiAgICByZXR1cm4gY291bnQ7Cn0KCmludCBjb3VudF9pbnN0YW5jZXNfaW5fY29sbGVjdGlvbihjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbikgewogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICIlcyBsaXN0ICVzICVzIDI+L2Rldi9udWxsIHwgd2MgLWwiLCBjbGlfY29tbWFuZCwgZGF0YWJhc2UsIGNvbGxlY3Rpb24pOwogICAgCiAgICBGSUxFICpmcCA9IHBvcGVuKGNvbW1hbmQsICJyIik7CiAgICBpZiAoIWZwKSByZXR1cm4gLTE7CiAgICAKICAgIGludCBjb3VudCA9IDA7CiAgICBjaGFyIGJ1ZmZlcls2NF07CiAgICBpZiAoZmdldHMoYnVmZmVyLCBzaXplb2YoYnVmZmVyKSwgZnApKSB7CiAgICAgICAgY291bnQgPSBhdG9pKGJ1ZmZlcik7CiAgICB9CiAgICBwY2xvc2UoZnApOwogICAgCiAgICByZXR1cm4gY291bnQ7Cn0KCmNoYXIqIGdldF9sYXN0X2luc2VydGVkX2lkKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKSB7CiAgICBjaGFyIGNvbW1hbmRbNTEyXTsKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgIiVzIGxpc3QgJXMgJXMgMj4vZGV2L251bGwgfCB0YWlsIC0xIiwgY2xpX2NvbW1hbmQsIGRhdGFiYXNlLCBjb2xsZWN0aW9uKTsKICAgIAogICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgaWYgKCFmcCkgcmV0dXJuIE5VTEw7CiAgICAKICAgIHN0YXRpYyBjaGFyIGlkWzY0XTsKICAgIGlmIChmZ2V0cyhpZCwgc2l6ZW9mKGlkKSwgZnApKSB7CiAgICAgICAgY2hhciAqaWRfc3RhcnQgPSBzdHJzdHIoaWQsICJcIl9pZFwiOlwiIik7CiAgICAgICAgaWYgKGlkX3N0YXJ0KSB7CiAgICAgICAgICAgIGlkX3N0YXJ0ICs9IDc7CiAgICAgICAgICAgIGNoYXIgKmlkX2VuZCA9IHN0cmNocihpZF9zdGFydCwgJyInKTsKICAgICAgICAgICAgaWYgKGlkX2VuZCkgewogICAgICAgICAgICAgICAgKmlkX2VuZCA9ICdcMCc7CiAgICAgICAgICAgICAgICBzdHJuY3B5KGlkLCBpZF9zdGFydCwgc2l6ZW9mKGlkKSAtIDEpOwogICAgICAgICAgICAgICAgcGNsb3NlKGZwKTsKICAgICAgICAgICAgICAgIHJldHVybiBpZDsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0KICAgIHBjbG9zZShmcCk7CiAgICByZXR1cm4gTlVMTDsKfQoKaW50IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSkgewogICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgaWYgKCFmcCkgcmV0dXJuIC0xOwogICAgCiAgICBvdXRwdXRbMF0gPSAnXDAnOwogICAgaWYgKGZnZXRzKG91dHB1dCwgb3V0cHV0X3NpemUsIGZwKSkgewogICAgICAgIG91dHB1dFtzdHJjc3BuKG91dHB1dCwgIlxuIildID0gJ1wwJzsKICAgIH0KICAgIHBjbG9zZShmcCk7CiAgICByZXR1cm4gMDsKfQoKaW50IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZV92ZXJib3NlKGNvbnN0IGNoYXIgKmNvbW1hbmQsIGNoYXIgKm91dHB1dCwgc2l6ZV90IG91dHB1dF9zaXplLCBjaGFyICp2ZXJib3NlX291dHB1dCwgc2l6ZV90IHZlcmJvc2Vfc2l6ZSkgewogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gRVhFQ1VUSU9OIERFVEFJTFNcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgdG8gZXhlY3V0ZTpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgJXNcbiIgUkVTRVQsIGNvbW1hbmQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgc3RydWN0dXJlIGFuYWx5c2lzOlxuIiBSRVNFVCk7CiAgICAgICAgCiAgICAgICAgaWYgKHN0cnN0cihjb21tYW5kLCAiZ3JlcCIpKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ29udGFpbnMgZ3JlcCBjb21tYW5kIC0gZXhpdCBjb2RlcyAwLzEgYXJlIG5vcm1hbFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIGlmIChzdHJzdHIoY29tbWFuZCwgInwiKSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbnRhaW5zIHBpcGUocykgLSBjb21wb3VuZCBjb21tYW5kXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgaWYgKHN0cnN0cihjb21tYW5kLCAiMj4mMSIpKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU1RERVJSIHJlZGlyZWN0ZWQgdG8gU1RET1VUXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENSSVRJQ0FMIEVSUk9SOiBwb3BlbigpIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFBvc3NpYmxlIGNhdXNlczpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gU2hlbGwgbm90IGF2YWlsYWJsZVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBNZW1vcnkgZXhoYXVzdGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFRvbyBtYW55IG9wZW4gZmlsZSBkZXNjcmlwdG9yc1xuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIHJldHVybiAtMTsKICAgIH0KICAgIAogICAgb3V0cHV0WzBdID0gJ1wwJzsKICAgIHZlcmJvc2Vfb3V0cHV0WzBdID0gJ1wwJzsKICAgIAogICAgY2hhciBidWZmZXJbMTAyNF07CiAgICBzaXplX3QgdG90YWxfdmVyYm9zZV9zaXplID0gMDsKICAgIGludCBsaW5lX2NvdW50ID0gMDsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgb3V0cHV0IHN0cmVhbTpcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICB3aGlsZSAoZmdldHMoYnVmZmVyLCBzaXplb2YoYnVmZmVyKSwgZnApKSB7CiAgICAgICAgYnVmZmVyW3N0cmNzcG4oYnVmZmVyLCAiXG4iKV0gPSAnXDAnOwogICAgICAgIGxpbmVfY291bnQrKzsKICAgICAgICAKICAgICAgICBpZiAob3V0cHV0WzBdID09ICdcMCcpIHsKICAgICAgICAgICAgc3RybmNweShvdXRwdXQsIGJ1ZmZlciwgb3V0cHV0X3NpemUgLSAxKTsKICAgICAgICAgICAgb3V0cHV0W291dHB1dF9zaXplIC0gMV0gPSAnXDAnOwogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIExpbmUgJWQgKGZpcnN0IGxpbmUgY2FwdHVyZWQgYXMgb3V0cHV0KTogJXNcbiIgUkVTRVQsIGxpbmVfY291bnQsIGJ1ZmZlcik7CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIExpbmUgJWQ6ICVzXG4iIFJFU0VULCBsaW5lX2NvdW50LCBidWZmZXIpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh0b3RhbF92ZXJib3NlX3NpemUgKyBzdHJsZW4oYnVmZmVyKSA8IHZlcmJvc2Vfc2l6ZSAtIDEpIHsKICAgICAgICAgICAgc3RyY2F0KHZlcmJvc2Vfb3V0cHV0LCBidWZmZXIpOwogICAgICAgICAgICBzdHJjYXQodmVyYm9zZV9vdXRwdXQsICJcbiIpOwogICAgICAgICAgICB0b3RhbF92ZXJib3NlX3NpemUgKz0gc3RybGVuKGJ1ZmZlcikgKyAxOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaW50IHN0YXR1cyA9IHBjbG9zZShmcCk7CiAgICAKICAgIGludCByZXN1bHQ7CiAgICBpZiAoV0lGRVhJVEVEKHN0YXR1cykpIHsKICAgICAgICBpbnQgZXhpdF9jb2RlID0gV0VYSVRTVEFUVVMoc3RhdHVzKTsKICAgICAgICBpZiAoc3Ryc3RyKGNvbW1hbmQsICJncmVwIikgIT0gTlVMTCkgewogICAgICAgICAgICByZXN1bHQgPSAoZXhpdF9jb2RlID09IDAgfHwgZXhpdF9jb2RlID09IDEpID8gMCA6IC0xOwogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHJlc3VsdCA9IChleGl0X2NvZGUgPT0gMCkgPyAwIDogLTE7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ29tbWFuZCBleGl0ZWQgbm9ybWFsbHlcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4aXQgY29kZTogJWRcbiIgUkVTRVQsIGV4aXRfY29kZSk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUHJvY2VzcyBpbnRlcnByZXRhdGlvbjogJXNcbiIgUkVTRVQsIChyZXN1bHQgPT0gMCkgPyAiU1VDQ0VTUyIgOiAiRkFJTFVSRSIpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHN0cnN0cihjb21tYW5kLCAiZ3JlcCIpKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEdyZXAtc3BlY2lmaWMgaW50ZXJwcmV0YXRpb246XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICBFeGl0IGNvZGUgJWQgPSBwYXR0ZXJuICVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgICAgICAgICBleGl0X2NvZGUsIAogICAgICAgICAgICAgICAgICAgICAgIGV4aXRfY29kZSA9PSAwID8gIkZPVU5EIiA6IGV4aXRfY29kZSA9PSAxID8gIk5PVCBGT1VORCAobm9ybWFsKSIgOiAiRVJST1IiKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0gZWxzZSBpZiAoV0lGU0lHTkFMRUQoc3RhdHVzKSkgewogICAgICAgIHJlc3VsdCA9IC0xOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgaW50IHNpZyA9IFdURVJNU0lHKHN0YXR1cyk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENvbW1hbmQgdGVybWluYXRlZCBieSBzaWduYWxcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFNpZ25hbCBudW1iZXI6ICVkXG4iIFJFU0VULCBzaWcpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFNpZ25hbCBuYW1lOiAlc1xuIiBSRVNFVCwgc3Ryc2lnbmFsKHNpZykpOwogICAgICAgIH0KICAgIH0gZWxzZSBpZiAoV0lGU1RPUFBFRChzdGF0dXMpKSB7CiAgICAgICAgcmVzdWx0ID0gLTE7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDb21tYW5kIHN0b3BwZWQgYnkgc2lnbmFsXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTdG9wIHNpZ25hbDogJWRcbiIgUkVTRVQsIFdTVE9QU0lHKHN0YXR1cykpOwogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgcmVzdWx0ID0gLTE7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDb21tYW5kIGRpZCBub3QgZXhpdCBub3JtYWxseVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmF3IHN0YXR1czogJWRcbiIgUkVTRVQsIHN0YXR1cyk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRXhlY3V0aW9uIHN1bW1hcnk6XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFRvdGFsIGxpbmVzIG91dHB1dDogJWRcbiIgUkVTRVQsIGxpbmVfY291bnQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRmlyc3QgbGluZSBjYXB0dXJlZDogXCIlc1wiXG4iIFJFU0VULCBvdXRwdXRbMF0gIT0gJ1wwJyA/IG91dHB1dCA6ICIoZW1wdHkpIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUb3RhbCB2ZXJib3NlIG91dHB1dCBsZW5ndGg6ICV6dSBieXRlc1xuIiBSRVNFVCwgdG90YWxfdmVyYm9zZV9zaXplKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEZpbmFsIHJlc3VsdCBjb2RlOiAlZCAoJXMpXG4iIFJFU0VULCByZXN1bHQsIHJlc3VsdCA9PSAwID8gIlNVQ0NFU1MiIDogIkZBSUxVUkUiKTsKICAgIH0KICAgIAogICAgcmV0dXJuIHJlc3VsdDsKfQoKaW50IHZlcmlmeV9kYXRhYmFzZV9zdHJ1Y3R1cmUoY29uc3QgY2hhciAqZGF0YWJhc2UpIHsKICAgIGNoYXIgcGF0aFs1MTJdOwogICAgc25wcmludGYocGF0aCwgc2l6ZW9mKHBhdGgpLCAiL3RtcC9zeWRiX3Rlc3QvJXMiLCBkYXRhYmFzZSk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdIERBVEFCQVNFIFNUUlVDVFVSRSBWRVJJRklDQVRJT05cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRGF0YWJhc2U6ICVzXG4iIFJFU0VULCBkYXRhYmFzZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICB9CiAgICAKICAgIGlmICghZmlsZV9leGlzdHMocGF0aCkpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICAgIERhdGFiYXNlIGRpcmVjdG9yeSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDaGVja2VkIHBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGdWxsIGRpcmVjdG9yeSBjb250ZW50cyBvZiAvdG1wL3N5ZGJfdGVzdC86XG4iIFJFU0VUKTsKICAgICAgICAgICAgc3lzdGVtKCJscyAtbGEgL3RtcC9zeWRiX3Rlc3QvIDI+L2Rldi9udWxsIHwgd2hpbGUgcmVhZCBsaW5lOyBkbyBlY2hvIFwiICAgICAgJGxpbmVcIjsgZG9uZSIpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEN1cnJlbnQgd29ya2luZyBkaXJlY3Rvcnk6ICIgUkVTRVQpOwogICAgICAgICAgICBzeXN0ZW0oInB3ZCIpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEVudmlyb25tZW50IHZhcmlhYmxlIFNZREJfQkFTRV9ESVI6ICVzXG4iIFJFU0VULCBnZXRlbnYoIlNZREJfQkFTRV9ESVIiKSk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIERhdGFiYXNlIGRpcmVjdG9yeSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgc3RydWN0IHN0YXQgc3Q7CiAgICBpZiAoc3RhdChwYXRoLCAmc3QpICE9IDApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICAgIHN0YXQoKSBjYWxsIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIGVycm5vOiAlZCAoJXMpXG4iIFJFU0VULCBlcnJubywgc3RyZXJyb3IoZXJybm8pKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgQ2Fubm90IGFjY2VzcyBkYXRhYmFzZSBkaXJlY3RvcnlcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBpZiAoIVNfSVNESVIoc3Quc3RfbW9kZSkpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICAgIFBhdGggZXhpc3RzIGJ1dCBpcyBub3QgYSBkaXJlY3RvcnlcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaWxlIHR5cGU6ICIpOwogICAgICAgICAgICBpZiAoU19JU1JFRyhzdC5zdF9tb2RlKSkgcHJpbnRmKCJSZWd1bGFyIGZpbGVcbiIgUkVTRVQpOwogICAgICAgICAgICBlbHNlIGlmIChTX0lTTE5LKHN0LnN0X21vZGUpKSBwcmludGYoIlN5bWJvbGljIGxpbmtcbiIgUkVTRVQpOwogICAgICAgICAgICBlbHNlIHByaW50ZigiT3RoZXIgKG1vZGU6ICVvKVxuIiBSRVNFVCwgc3Quc3RfbW9kZSAmIFNfSUZNVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGVybWlzc2lvbnM6ICVvXG4iIFJFU0VULCBzdC5zdF9tb2RlICYgMDc3Nyk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIERhdGFiYXNlIHBhdGggaXMgbm90IGEgZGlyZWN0b3J5XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gU1VDQ0VTUyBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkVFTiAiICAgIERhdGFiYXNlIGRpcmVjdG9yeSBleGlzdHMgYW5kIGlzIHZhbGlkXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFBlcm1pc3Npb25zOiAlb1xuIiBSRVNFVCwgc3Quc3RfbW9kZSAmIDA3NzcpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgU2l6ZTogJWxkIGJ5dGVzXG4iIFJFU0VULCBzdC5zdF9zaXplKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIExhc3QgbW9kaWZpZWQ6ICVzIiwgY3RpbWUoJnN0LnN0X210aW1lKSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb250ZW50cyBvZiBkYXRhYmFzZSBkaXJlY3Rvcnk6XG4iIFJFU0VUKTsKICAgICAgICBjaGFyIGxzX2NtZFs1MTJdOwogICAgICAgIHNucHJpbnRmKGxzX2NtZCwgc2l6ZW9mKGxzX2NtZCksICJscyAtbGEgXCIlc1wiIDI+L2Rldi9udWxsIiwgcGF0aCk7CiAgICAgICAgc3lzdGVtKGxzX2NtZCk7CiAgICB9CiAgICBwcmludGYoR1JFRU4gIiAg4pyTIERhdGFiYXNlIGRpcmVjdG9yeSBleGlzdHMgYW5kIGlzIHZhbGlkXG4iIFJFU0VUKTsKICAgIHJldHVybiAxOwp9CgppbnQgdmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKSB7CiAgICBjaGFyIHBhdGhbNTEyXTsKICAgIHNucHJpbnRmKHBhdGgsIHNpemVvZihwYXRoKSwgIi90bXAvc3lkYl90ZXN0LyVzLyVzIiwgZGF0YWJhc2UsIGNvbGxlY3Rpb24pOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSBDT0xMRUNUSU9OIFNUUlVDVFVSRSBWRVJJRklDQVRJT05cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRGF0YWJhc2U6ICVzXG4iIFJFU0VULCBkYXRhYmFzZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb2xsZWN0aW9uOiAlc1xuIiBSRVNFVCwgY29sbGVjdGlvbik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICB9CiAgICAKICAgIGlmICghZmlsZV9leGlzdHMocGF0aCkpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICAgIENvbGxlY3Rpb24gZGlyZWN0b3J5IGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENoZWNrZWQgcGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhcmVudCBkaXJlY3RvcnkgY29udGVudHM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgY2hhciBwYXJlbnRfcGF0aFs1MTJdOwogICAgICAgICAgICBzbnByaW50ZihwYXJlbnRfcGF0aCwgc2l6ZW9mKHBhcmVudF9wYXRoKSwgIi90bXAvc3lkYl90ZXN0LyVzIiwgZGF0YWJhc2UpOwogICAgICAgICAgICBjaGFyIGxzX2NtZFs1MTJdOwogICAgICAgICAgICBzbnByaW50Zihsc19jbWQsIHNpemVvZihsc19jbWQpLCAibHMgLWxhIFwiJXNcIiAyPi9kZXYvbnVsbCIsIHBhcmVudF9wYXRoKTsKICAgICAgICAgICAgc3lzdGVtKGxzX2NtZCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIENvbGxlY3Rpb24gZGlyZWN0b3J5IGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBjaGFyIHNjaGVtYV9wYXRoWzUxMl07CiAgICBzbnByaW50ZihzY2hlbWFfcGF0aCwgc2l6ZW9mKHNjaGVtYV9wYXRoKSwgIiVzL3NjaGVtYS50eHQiLCBwYXRoKTsKICAgIGlmICghZmlsZV9leGlzdHMoc2NoZW1hX3BhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBTY2hlbWEgZmlsZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBzY2hlbWEgcGF0aDogJXNcbiIgUkVTRVQsIHNjaGVtYV9wYXRoKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb2xsZWN0aW9uIGRpcmVjdG9yeSBjb250ZW50czpcbiIgUkVTRVQpOwogICAgICAgICAgICBjaGFyIGxzX2NtZFs1MTJdOwogICAgICAgICAgICBzbnByaW50Zihsc19jbWQsIHNpemVvZihsc19jbWQpLCAibHMgLWxhIFwiJXNcIiAyPi9kZXYvbnVsbCIsIHBhdGgpOwogICAgICAgICAgICBzeXN0ZW0obHNfY21kKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMb29raW5nIGZvciBmaWxlcyBtYXRjaGluZyAnKnNjaGVtYSonOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHNucHJpbnRmKGxzX2NtZCwgc2l6ZW9mKGxzX2NtZCksICJscyAtbGEgXCIlc1wiIDI+L2Rldi9udWxsIHwgZ3JlcCAtaSBzY2hlbWEiLCBwYXRoKTsKICAgICAgICAgICAgc3lzdGVtKGxzX2NtZCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIFNjaGVtYSBmaWxlIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBjaGFyIGRhdGFfcGF0aFs1MTJdOwogICAgc25wcmludGYoZGF0YV9wYXRoLCBzaXplb2YoZGF0YV9wYXRoKSwgIiVzL2RhdGEuc3lkYiIsIHBhdGgpOwogICAgaWYgKCFmaWxlX2V4aXN0cyhkYXRhX3BhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBEYXRhIGZpbGUgZG9lc24ndCBleGlzdFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgZGF0YSBwYXRoOiAlc1xuIiBSRVNFVCwgZGF0YV9wYXRoKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb2xsZWN0aW9uIGRpcmVjdG9yeSBjb250ZW50czpcbiIgUkVTRVQpOwogICAgICAgICAgICBjaGFyIGxzX2NtZFs1MTJdOwogICAgICAgICAgICBzbnByaW50Zihsc19jbWQsIHNpemVvZihsc19jbWQpLCAibHMgLWxhIFwiJXNcIiAyPi9kZXYvbnVsbCIsIHBhdGgpOwogICAgICAgICAgICBzeXN0ZW0obHNfY21kKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMb29raW5nIGZvciBmaWxlcyBtYXRjaGluZyAnKmRhdGEqJzpcbiIgUkVTRVQpOwogICAgICAgICAgICBzbnByaW50Zihsc19jbWQsIHNpemVvZihsc19jbWQpLCAibHMgLWxhIFwiJXNcIiAyPi9kZXYvbnVsbCB8IGdyZXAgLWkgZGF0YSIsIHBhdGgpOwogICAgICAgICAgICBzeXN0ZW0obHNfY21kKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgRGF0YSBmaWxlIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBTVUNDRVNTIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgICAgQ29sbGVjdGlvbiBzdHJ1Y3R1cmUgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29sbGVjdGlvbiBwYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTY2hlbWEgZmlsZTogJXNcbiIgUkVTRVQsIHNjaGVtYV9wYXRoKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIERhdGEgZmlsZTogJXNcbiIgUkVTRVQsIGRhdGFfcGF0aCk7CiAgICAgICAgCiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTY2hlbWEgZmlsZSBjb250ZW50IChmaXJzdCAyMCBsaW5lcyk6XG4iIFJFU0VUKTsKICAgICAgICBjaGFyIGNhdF9jbWRbNTEyXTsKICAgICAgICBzbnByaW50ZihjYXRfY21kLCBzaXplb2YoY2F0X2NtZCksICJoZWFkIC0yMCBcIiVzXCIgMj4vZGV2L251bGwiLCBzY2hlbWFfcGF0aCk7CiAgICAgICAgc3lzdGVtKGNhdF9jbWQpOwogICAgICAgIAogICAgICAgIHN0cnVjdCBzdGF0IGRhdGFfc3RhdDsKICAgICAgICBpZiAoc3RhdChkYXRhX3BhdGgsICZkYXRhX3N0YXQpID09IDApIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBEYXRhIGZpbGUgc2l6ZTogJWxkIGJ5dGVzXG4iIFJFU0VULCBkYXRhX3N0YXQuc3Rfc2l6ZSk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRGF0YSBmaWxlIGxhc3QgbW9kaWZpZWQ6ICVzIiwgY3RpbWUoJmRhdGFfc3RhdC5zdF9tdGltZSkpOwogICAgICAgIH0KICAgIH0KICAgIHByaW50ZihHUkVFTiAiICDinJMgQ29sbGVjdGlvbiBzdHJ1Y3R1cmUgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgcmV0dXJuIDE7Cn0KCmludCB2ZXJpZnlfc2NoZW1hX2NvbnRlbnQoY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24sIGNvbnN0IGNoYXIgKmV4cGVjdGVkX2ZpZWxkcykgewogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICIlcyBzY2hlbWEgJXMgJXMiLCBjbGlfY29tbWFuZCwgZGF0YWJhc2UsIGNvbGxlY3Rpb24pOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSBTQ0hFTUEgQ09OVEVOVCBWRVJJRklDQVRJT05cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRGF0YWJhc2U6ICVzXG4iIFJFU0VULCBkYXRhYmFzZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb2xsZWN0aW9uOiAlc1xuIiBSRVNFVCwgY29sbGVjdGlvbik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb21tYW5kIHRvIGV4ZWN1dGU6ICVzXG4iIFJFU0VULCBjb21tYW5kKTsKICAgICAgICBpZiAoZXhwZWN0ZWRfZmllbGRzICYmIGV4cGVjdGVkX2ZpZWxkc1swXSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIGZpZWxkcyB0byBmaW5kOiAlc1xuIiBSRVNFVCwgZXhwZWN0ZWRfZmllbGRzKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGNoYXIgb3V0cHV0WzEwMjRdOwogICAgY2hhciB2ZXJib3NlX291dHB1dFs0MDk2XTsKICAgIGludCByZXN1bHQ7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICByZXN1bHQgPSBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmVfdmVyYm9zZShjb21tYW5kLCBvdXRwdXQsIHNpemVvZihvdXRwdXQpLCB2ZXJib3NlX291dHB1dCwgc2l6ZW9mKHZlcmJvc2Vfb3V0cHV0KSk7CiAgICB9IGVsc2UgewogICAgICAgIHJlc3VsdCA9IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZShjb21tYW5kLCBvdXRwdXQsIHNpemVvZihvdXRwdXQpKTsKICAgIH0KICAgIAogICAgaWYgKHJlc3VsdCAhPSAwKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBDb21tYW5kIGV4ZWN1dGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbW1hbmQ6ICVzXG4iIFJFU0VULCBjb21tYW5kKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXR1cm4gY29kZTogJWRcbiIgUkVTRVQsIHJlc3VsdCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmF3IG91dHB1dDogJXNcbiIgUkVTRVQsIG91dHB1dCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUG9zc2libGUgaXNzdWVzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICAtIERhdGFiYXNlIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBDb2xsZWN0aW9uIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBTY2hlbWEgY29tbWFuZCBzeW50YXggZXJyb3JcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBDb3VsZCBub3QgcmVhZCBzY2hlbWFcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU0NIRU1BIE9VVFBVVCBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgUmF3IG91dHB1dDogXCIlc1wiXG4iIFJFU0VULCBvdXRwdXQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgT3V0cHV0IGxlbmd0aDogJXp1IGNoYXJhY3RlcnNcbiIgUkVTRVQsIHN0cmxlbihvdXRwdXQpKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIExvb2tpbmcgZm9yICdGaWVsZCcgaW4gb3V0cHV0OiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgIHN0cnN0cihvdXRwdXQsICJGaWVsZCIpID8gIkZPVU5EIiA6ICJOT1QgRk9VTkQiKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIExvb2tpbmcgZm9yICdUeXBlJyBpbiBvdXRwdXQ6ICVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgc3Ryc3RyKG91dHB1dCwgIlR5cGUiKSA/ICJGT1VORCIgOiAiTk9UIEZPVU5EIik7CiAgICB9CiAgICAKICAgIGlmIChzdHJzdHIob3V0cHV0LCAiRmllbGQiKSA9PSBOVUxMIHx8IHN0cnN0cihvdXRwdXQsICJUeXBlIikgPT0gTlVMTCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgICAgU2NoZW1hIG91dHB1dCBmb3JtYXQgaW5jb3JyZWN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCB0byBmaW5kIGJvdGggJ0ZpZWxkJyBhbmQgJ1R5cGUnIGluIG91dHB1dFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQWN0dWFsIG91dHB1dCByZWNlaXZlZDpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gQkVHSU4gT1VUUFVUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZigiJXNcbiIsIG91dHB1dCk7CiAgICAgICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBFTkQgT1VUUFVUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2hhcmFjdGVyLWJ5LWNoYXJhY3RlciBhbmFseXNpczpcbiIgUkVTRVQpOwogICAgICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IChpbnQpc3RybGVuKG91dHB1dCkgJiYgaSA8IDEwMDsgaSsrKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgWyUzZF0gMHglMDJ4ICclYydcbiIgUkVTRVQsIGksICh1bnNpZ25lZCBjaGFyKW91dHB1dFtpXSwgCiAgICAgICAgICAgICAgICAgICAgICAgb3V0cHV0W2ldID49IDMyICYmIG91dHB1dFtpXSA8PSAxMjYgPyBvdXRwdXRbaV0gOiAnLicpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIFNjaGVtYSBvdXRwdXQgZm9ybWF0IGluY29ycmVjdFxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFNVQ0NFU1MgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JFRU4gIiAgICBTY2hlbWEgY29udGVudCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGdWxsIHNjaGVtYSBvdXRwdXQ6XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gQkVHSU4gU0NIRU1BIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgaWYgKHZlcmJvc2Vfb3V0cHV0WzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgcHJpbnRmKCIlcyIsIHZlcmJvc2Vfb3V0cHV0KTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBwcmludGYoIiVzXG4iLCBvdXRwdXQpOwogICAgICAgIH0KICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIFNDSEVNQSAtLS1cbiIgUkVTRVQpOwogICAgICAgIAogICAgICAgIGlmIChleHBlY3RlZF9maWVsZHMgJiYgZXhwZWN0ZWRfZmllbGRzWzBdKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU2VhcmNoaW5nIGZvciBleHBlY3RlZCBmaWVsZHM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgY2hhciAqdG9rZW47CiAgICAgICAgICAgIGNoYXIgZmllbGRzX2NvcHlbMTAyNF07CiAgICAgICAgICAgIHN0cm5jcHkoZmllbGRzX2NvcHksIGV4cGVjdGVkX2ZpZWxkcywgc2l6ZW9mKGZpZWxkc19jb3B5KSk7CiAgICAgICAgICAgIHRva2VuID0gc3RydG9rKGZpZWxkc19jb3B5LCAiLCIpOwogICAgICAgICAgICB3aGlsZSAodG9rZW4gIT0gTlVMTCkgewogICAgICAgICAgICAgICAgY2hhciAqZm91bmQgPSBzdHJzdHIob3V0cHV0LCB0b2tlbik7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgRmllbGQgJyVzJzogJXNcbiIgUkVTRVQsIHRva2VuLCAKICAgICAgICAgICAgICAgICAgICAgICBmb3VuZCA/ICJGT1VORCIgOiAiTk9UIEZPVU5EIik7CiAgICAgICAgICAgICAgICB0b2tlbiA9IHN0cnRvayhOVUxMLCAiLCIpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgfQogICAgcHJpbnRmKEdSRUVOICIgIOKckyBTY2hlbWEgY29udGVudCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICByZXR1cm4gMTsKfQoKaW50IGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbihUZXN0Q2FzZSAqdGVzdCkgewogICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCB0ZXN0LT5kZXNjcmlwdGlvbik7CiAgICBmZmx1c2goc3Rkb3V0KTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFRFU1QgRVhFQ1VUSU9OIERFVEFJTFNcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVGVzdCBEZXNjcmlwdGlvbjogJXNcbiIgUkVTRVQsIHRlc3QtPmRlc2NyaXB0aW9uKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE1haW4gQ29tbWFuZDogJXNcbiIgUkVTRVQsIHRlc3QtPmNvbW1hbmQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVmVyaWZpY2F0aW9uIENvbW1hbmQ6ICVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgdGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmRbMF0gPyB0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZCA6ICIobm9uZSkiKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIE91dHB1dCBQYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIAogICAgICAgICAgICAgICB0ZXN0LT5leHBlY3RlZF9vdXRwdXRbMF0gPyB0ZXN0LT5leHBlY3RlZF9vdXRwdXQgOiAiKGFueSkiKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFN0YXJ0IFRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIHN0YXJ0X3RpbWUpOwogICAgfQogICAgCiAgICBpbnQgcmVzdWx0ID0gc3lzdGVtKHRlc3QtPmNvbW1hbmQpOwogICAgbG9uZyBsb25nIGVuZF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICB0ZXN0LT5kdXJhdGlvbl9tcyA9IGVuZF90aW1lIC0gc3RhcnRfdGltZTsKICAgIHRlc3QtPnN1Y2Nlc3MgPSAocmVzdWx0ID09IDApOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSBNQUlOIENPTU1BTkQgRVhFQ1VUSU9OIFJFU1VMVFNcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29tbWFuZDogJXNcbiIgUkVTRVQsIHRlc3QtPmNvbW1hbmQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgUmF3IGV4aXQgY29kZTogJWRcbiIgUkVTRVQsIHJlc3VsdCk7CiAgICAgICAgCiAgICAgICAgaWYgKFdJRkVYSVRFRChyZXN1bHQpKSB7CiAgICAgICAgICAgIGludCBleGl0X3N0YXR1cyA9IFdFWElUU1RBVFVTKHJlc3VsdCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTm9ybWFsIGV4aXQgd2l0aCBzdGF0dXM6ICVkXG4iIFJFU0VULCBleGl0X3N0YXR1cyk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgSW50ZXJwcmV0YXRpb246ICVzXG4iIFJFU0VULCBleGl0X3N0YXR1cyA9PSAwID8gIlNVQ0NFU1MiIDogIkZBSUxVUkUiKTsKICAgICAgICB9IGVsc2UgaWYgKFdJRlNJR05BTEVEKHJlc3VsdCkpIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUZXJtaW5hdGVkIGJ5IHNpZ25hbDogJWRcbiIgUkVTRVQsIFdURVJNU0lHKHJlc3VsdCkpOwogICAgICAgIH0gZWxzZSBpZiAoV0lGU1RPUFBFRChyZXN1bHQpKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU3RvcHBlZCBieSBzaWduYWw6ICVkXG4iIFJFU0VULCBXU1RPUFNJRyhyZXN1bHQpKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeGVjdXRpb24gdGltZTogJWxsZCBtc1xuIiBSRVNFVCwgdGVzdC0+ZHVyYXRpb25fbXMpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVGVzdCBzdWNjZXNzIGZsYWc6ICVzXG4iIFJFU0VULCB0ZXN0LT5zdWNjZXNzID8gIlRSVUUiIDogIkZBTFNFIik7CiAgICB9CiAgICAKICAgIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID0gMTsKICAgIGlmICh0ZXN0LT5zdWNjZXNzICYmIHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kWzBdICE9ICdcMCcpIHsKICAgICAgICBjaGFyIHZlcmlmaWNhdGlvbl9vdXRwdXRbMTAyNF07CiAgICAgICAgY2hhciB2ZXJib3NlX291dHB1dFs0MDk2XTsKICAgICAgICBpbnQgdmVyaWZpY2F0aW9uX3Jlc3VsdDsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gVkVSSUZJQ0FUSU9OIFBIQVNFXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICB2ZXJpZmljYXRpb25fcmVzdWx0ID0gZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlX3ZlcmJvc2UodGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmQsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyaWZpY2F0aW9uX291dHB1dCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzaXplb2YodmVyaWZpY2F0aW9uX291dHB1dCksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJib3NlX291dHB1dCwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHNpemVvZih2ZXJib3NlX291dHB1dCkpOwogICAgICAgICAgICBzdHJuY3B5KHRlc3QtPnZlcmJvc2Vfb3V0cHV0LCB2ZXJib3NlX291dHB1dCwgc2l6ZW9mKHRlc3QtPnZlcmJvc2Vfb3V0cHV0KSAtIDEpOwogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9yZXN1bHQgPSBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUodGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmQsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0LCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHZlcmlmaWNhdGlvbl9vdXRwdXQpKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmlmaWNhdGlvbl9yZXN1bHQgPT0gMCkgewogICAgICAgICAgICBpZiAodGVzdC0+ZXhwZWN0ZWRfb3V0cHV0WzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBFWFBFQ1RFRCBPVVRQVVQgVkFMSURBVElPTlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBBY3R1YWwgb3V0cHV0OiBcIiVzXCJcbiIgUkVTRVQsIHZlcmlmaWNhdGlvbl9vdXRwdXQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0dGVybiBzZWFyY2g6ICVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgc3Ryc3RyKHZlcmlmaWNhdGlvbl9vdXRwdXQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCkgPyAiRk9VTkQiIDogIk5PVCBGT1VORCIpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGlmIChzdHJzdHIodmVyaWZpY2F0aW9uX291dHB1dCwgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KSA9PSBOVUxMKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFBBVFRFUk4gTUFUQ0hJTkcgRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIHN0cmluZyBsZW5ndGg6ICV6dVxuIiBSRVNFVCwgc3RybGVuKHRlc3QtPmV4cGVjdGVkX291dHB1dCkpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEFjdHVhbCBzdHJpbmcgbGVuZ3RoOiAlenVcbiIgUkVTRVQsIHN0cmxlbih2ZXJpZmljYXRpb25fb3V0cHV0KSk7CiAgICAgICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgICAgICBpbnQgbWF4X2xlbiA9IHN0cmxlbih0ZXN0LT5leHBlY3RlZF9vdXRwdXQpOwogICAgICAgICAgICAgICAgICAgICAgICBpbnQgYmVzdF9tYXRjaCA9IDA7CiAgICAgICAgICAgICAgICAgICAgICAgIGludCBiZXN0X3Bvc2l0aW9uID0gLTE7CiAgICAgICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgICAgICBmb3IgKGludCBpID0gMDsgdmVyaWZpY2F0aW9uX291dHB1dFtpXTsgaSsrKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBpbnQgbWF0Y2hfbGVuID0gMDsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHdoaWxlIChtYXRjaF9sZW4gPCBtYXhfbGVuICYmIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXRbaSArIG1hdGNoX2xlbl0gJiYgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyaWZpY2F0aW9uX291dHB1dFtpICsgbWF0Y2hfbGVuXSA9PSB0ZXN0LT5leHBlY3RlZF9vdXRwdXRbbWF0Y2hfbGVuXSkgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIG1hdGNoX2xlbisrOwogICAgICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICAgICAgaWYgKG1hdGNoX2xlbiA+IGJlc3RfbWF0Y2gpIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBiZXN0X21hdGNoID0gbWF0Y2hfbGVuOwogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIGJlc3RfcG9zaXRpb24gPSBpOwogICAgICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgICAgICBpZiAoYmVzdF9tYXRjaCA+IDApIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQmVzdCBwYXJ0aWFsIG1hdGNoOiAlZCBjaGFyYWN0ZXJzIGF0IHBvc2l0aW9uICVkXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBiZXN0X21hdGNoLCBiZXN0X3Bvc2l0aW9uKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGFydGlhbCBtYXRjaCBjb250ZXh0OlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgRXhwZWN0ZWQ6IFwiJXNcIlxuIiBSRVNFVCwgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICBQYXJ0aWFsOiAgXCIlLipzXCJcbiIgUkVTRVQsIGJlc3RfbWF0Y2gsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICZ2ZXJpZmljYXRpb25fb3V0cHV0W2Jlc3RfcG9zaXRpb25dKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICBOZXh0IGV4cGVjdGVkIGNoYXI6ICclYycgKDB4JTAyeClcbiIgUkVTRVQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0W2Jlc3RfbWF0Y2hdLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHRlc3QtPmV4cGVjdGVkX291dHB1dFtiZXN0X21hdGNoXSk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgTmV4dCBhY3R1YWwgY2hhcjogICAnJWMnICgweCUwMngpXG4iIFJFU0VULAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXRbYmVzdF9wb3NpdGlvbiArIGJlc3RfbWF0Y2hdLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXRbYmVzdF9wb3NpdGlvbiArIGJlc3RfbWF0Y2hdKTsKICAgICAgICAgICAgICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTm8gcGFydGlhbCBtYXRjaGVzIGZvdW5kXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICAgICAgaWYgKHN0cmxlbih2ZXJpZmljYXRpb25fb3V0cHV0KSA9PSBzdHJsZW4odGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KSkgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDaGFyYWN0ZXItYnktY2hhcmFjdGVyIGNvbXBhcmlzb246XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIGZvciAoc2l6ZV90IGkgPSAwOyBpIDwgc3RybGVuKHRlc3QtPmV4cGVjdGVkX291dHB1dCk7IGkrKykgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIGlmICh2ZXJpZmljYXRpb25fb3V0cHV0W2ldICE9IHRlc3QtPmV4cGVjdGVkX291dHB1dFtpXSkgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgUG9zaXRpb24gJXp1OiBleHBlY3RlZCAnJWMnICgweCUwMngpLCBnb3QgJyVjJyAoMHglMDJ4KSAlc1xuIiBSRVNFVCwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIGksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB0ZXN0LT5leHBlY3RlZF9vdXRwdXRbaV0sICh1bnNpZ25lZCBjaGFyKXRlc3QtPmV4cGVjdGVkX291dHB1dFtpXSwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXRbaV0sICh1bnNpZ25lZCBjaGFyKXZlcmlmaWNhdGlvbl9vdXRwdXRbaV0sCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0W2ldID09ICdcMCcgPyAiKFNUUklORyBFTkQpIiA6ICIiKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGlmIChzdHJzdHIodmVyaWZpY2F0aW9uX291dHB1dCwgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KSA9PSBOVUxMKSB7CiAgICAgICAgICAgICAgICAgICAgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MgPSAwOwogICAgICAgICAgICAgICAgICAgIHN0cm5jcHkodGVzdC0+ZGV0YWlscywgdmVyaWZpY2F0aW9uX291dHB1dCwgc2l6ZW9mKHRlc3QtPmRldGFpbHMpIC0gMSk7CiAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBWRVJJRklDQVRJT04gRkFJTEVEIC0gUGF0dGVybiBub3QgZm91bmRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFZFUklGSUNBVElPTiBTVUNDRVNTIC0gUGF0dGVybiBmb3VuZFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gVkVSSUZJQ0FUSU9OIFNVQ0NFU1MgLSBObyBleHBlY3RlZCBwYXR0ZXJuIHRvIG1hdGNoXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID0gMDsKICAgICAgICAgICAgc3RyY3B5KHRlc3QtPmRldGFpbHMsICJWZXJpZmljYXRpb24gY29tbWFuZCBmYWlsZWQiKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFZFUklGSUNBVElPTiBGQUlMRUQgLSBDb21tYW5kIGV4ZWN1dGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBWZXJpZmljYXRpb24gY29tbWFuZDogJXNcbiIgUkVTRVQsIHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhpdCBjb2RlOiAlZFxuIiBSRVNFVCwgdmVyaWZpY2F0aW9uX3Jlc3VsdCk7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICB9IGVsc2UgaWYgKCF0ZXN0LT5zdWNjZXNzICYmIHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kWzBdICE9ICdcMCcpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFZFUklGSUNBVElPTiBTS0lQUEVEIC0gTWFpbiBjb21tYW5kIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpbnQgb3ZlcmFsbF9zdWNjZXNzID0gdGVzdC0+c3VjY2VzcyAmJiB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzczsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gRklOQUwgVEVTVCBBU1NFU1NNRU5UXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE1haW4gY29tbWFuZCBzdWNjZXNzOiAlc1xuIiBSRVNFVCwgdGVzdC0+c3VjY2VzcyA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBWZXJpZmljYXRpb24gc3VjY2VzczogJXNcbiIgUkVTRVQsIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID8gIllFUyIgOiAiTk8iKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE92ZXJhbGwgc3VjY2VzczogJXNcbiIgUkVTRVQsIG92ZXJhbGxfc3VjY2VzcyA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUb3RhbCBkdXJhdGlvbjogJWxsZCBtc1xuIiBSRVNFVCwgdGVzdC0+ZHVyYXRpb25fbXMpOwogICAgfQogICAgCiAgICBpZiAob3ZlcmFsbF9zdWNjZXNzKSB7CiAgICAgICAgcHJpbnRmKCJbIiBHUkVFTiAiUEFTUyIgUkVTRVQgIl0iKTsKICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdIik7CiAgICB9CiAgICAKICAgIHByaW50ZigiICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgdGVzdC0+ZHVyYXRpb25fbXMsIFJFU0VUKTsKICAgIAogICAgaWYgKCF0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcykgewogICAgICAgIGlmICh0ZXN0LT5kZXRhaWxzWzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBWZXJpZmljYXRpb24gZmFpbGVkOiAlc1xuIiBSRVNFVCwgdGVzdC0+ZGV0YWlscyk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUgJiYgdGVzdC0+dmVyYm9zZV9vdXRwdXRbMF0gIT0gJ1wwJykgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBGVUxMIFZFUklGSUNBVElPTiBPVVRQVVQ6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFdISVRFICIgIC0tLSBCRUdJTiBWRVJCT1NFIE9VVFBVVCAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoIiVzXG4iLCB0ZXN0LT52ZXJib3NlX291dHB1dCk7CiAgICAgICAgICAgIHByaW50ZihXSElURSAiICAtLS0gRU5EIFZFUkJPU0UgT1VUUFVUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlICYmICFvdmVyYWxsX3N1Y2Nlc3MpIHsKICAgICAgICBwcmludGYoUkVEICJcbiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZBSUxVUkUgUk9PVCBDQVVTRSBBTkFMWVNJU1xuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gVGVzdDogJXNcbiIgUkVTRVQsIHRlc3QtPmRlc2NyaXB0aW9uKTsKICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBNYWluIGNvbW1hbmQgc3VjY2VzczogJXNcbiIgUkVTRVQsIHRlc3QtPnN1Y2Nlc3MgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFZlcmlmaWNhdGlvbiBzdWNjZXNzOiAlc1xuIiBSRVNFVCwgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIAogICAgICAgIGlmICghdGVzdC0+c3VjY2VzcykgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBQUklNQVJZIEZBSUxVUkU6IE1haW4gY29tbWFuZCBleGVjdXRpb25cbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbW1hbmQ6ICVzXG4iIFJFU0VULCB0ZXN0LT5jb21tYW5kKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSYXcgZXhpdCBjb2RlOiAlZFxuIiBSRVNFVCwgcmVzdWx0KTsKICAgICAgICAgICAgCiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFBPU1NJQkxFIFNPTFVUSU9OUzpcbiIgUkVTRVQpOwogICAgICAgICAgICBpZiAoc3Ryc3RyKHRlc3QtPmNvbW1hbmQsICJ0ZXN0ZGIiKSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIENoZWNrIGlmIHRlc3RkYiBkYXRhYmFzZSBleGlzdHNcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFZlcmlmeSBkYXRhYmFzZSBwZXJtaXNzaW9uc1xuIiBSRVNFVCk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgaWYgKHN0cnN0cih0ZXN0LT5jb21tYW5kLCAiZ3JlcCIpKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gQ2hlY2sgaWYgZ3JlcCBwYXR0ZXJuIG1hdGNoZXMgYWN0dWFsIG91dHB1dFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gVmVyaWZ5IGNhc2Ugc2Vuc2l0aXZpdHlcbiIgUkVTRVQpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIGlmIChzdHJzdHIodGVzdC0+Y29tbWFuZCwgInwiKSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIENoZWNrIGVhY2ggY29tbWFuZCBpbiB0aGUgcGlwZWxpbmUgc2VwYXJhdGVseVxuIiBSRVNFVCk7CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgaWYgKCF0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcykgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBQUklNQVJZIEZBSUxVUkU6IFZlcmlmaWNhdGlvbiBwaGFzZVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgVmVyaWZpY2F0aW9uIGNvbW1hbmQ6ICVzXG4iIFJFU0VULCB0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgcGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCB0ZXN0LT5leHBlY3RlZF9vdXRwdXQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIERldGFpbHM6ICVzXG4iIFJFU0VULCB0ZXN0LT5kZXRhaWxzKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICh0ZXN0LT52ZXJib3NlX291dHB1dFswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEZ1bGwgb3V0cHV0IGNhcHR1cmVkICglenUgYnl0ZXMpXG4iIFJFU0VULCBzdHJsZW4odGVzdC0+dmVyYm9zZV9vdXRwdXQpKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgICAgICAKICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcmV0dXJuIG92ZXJhbGxfc3VjY2VzczsKfQoKSHR0cFJlc3BvbnNlKiBodHRwX3JlcXVlc3QoY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiB1cmwsIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGNvbnRlbnRfdHlwZSkgewogICAgSHR0cFJlc3BvbnNlKiByZXNwb25zZSA9IG1hbGxvYyhzaXplb2YoSHR0cFJlc3BvbnNlKSk7CiAgICBpZiAoIXJlc3BvbnNlKSByZXR1cm4gTlVMTDsKICAgIAogICAgcmVzcG9uc2UtPnN0YXR1c19jb2RlID0gMDsKICAgIHJlc3BvbnNlLT5ib2R5ID0gTlVMTDsKICAgIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA9IDA7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdIEhUVFAgUkVRVUVTVCBJTklUSUFUSU9OXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE1ldGhvZDogJXNcbiIgUkVTRVQsIG1ldGhvZCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBVUkw6ICVzXG4iIFJFU0VULCB1cmwpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQm9keTogJXNcbiIgUkVTRVQsIGJvZHkgPyBib2R5IDogIihub25lKSIpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29udGVudC1UeXBlOiAlc1xuIiBSRVNFVCwgY29udGVudF90eXBlID8gY29udGVudF90eXBlIDogIihub25lKSIpOwogICAgfQogICAgCiAgICBjaGFyIGhvc3RbMjU2XSA9ICJsb2NhbGhvc3QiOwogICAgaW50IHBvcnQgPSA4MDgwOwogICAgY2hhciBwYXRoWzEwMjRdID0gIi8iOwogICAgCiAgICBpZiAoc3RybmNtcCh1cmwsICJodHRwOi8vIiwgNykgPT0gMCkgewogICAgICAgIGNvbnN0IGNoYXIqIGhvc3Rfc3RhcnQgPSB1cmwgKyA3OwogICAgICAgIGNvbnN0IGNoYXIqIHBhdGhfc3RhcnQgPSBzdHJjaHIoaG9zdF9zdGFydCwgJy8nKTsKICAgICAgICBjb25zdCBjaGFyKiBwb3J0X3N0YXJ0ID0gc3RyY2hyKGhvc3Rfc3RhcnQsICc6Jyk7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBVUkwgUEFSU0lORyBBTkFMWVNJU1xuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRnVsbCBVUkw6ICVzXG4iIFJFU0VULCB1cmwpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEhvc3Qgc3RhcnQgYXQ6ICVzXG4iIFJFU0VULCBob3N0X3N0YXJ0KTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXRoIHN0YXJ0OiAlc1xuIiBSRVNFVCwgcGF0aF9zdGFydCA/IHBhdGhfc3RhcnQgOiAiTlVMTCIpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBvcnQgc3RhcnQ6ICVzXG4iIFJFU0VULCBwb3J0X3N0YXJ0ID8gcG9ydF9zdGFydCA6ICJOVUxMIik7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmIChwb3J0X3N0YXJ0ICYmICghcGF0aF9zdGFydCB8fCBwb3J0X3N0YXJ0IDwgcGF0aF9zdGFydCkpIHsKICAgICAgICAgICAgc2l6ZV90IGhvc3RfbGVuID0gcG9ydF9zdGFydCAtIGhvc3Rfc3RhcnQ7CiAgICAgICAgICAgIHN0cm5jcHkoaG9zdCwgaG9zdF9zdGFydCwgaG9zdF9sZW4pOwogICAgICAgICAgICBob3N0W2hvc3RfbGVuXSA9ICdcMCc7CiAgICAgICAgICAgIHBvcnQgPSBhdG9pKHBvcnRfc3RhcnQgKyAxKTsKICAgICAgICAgICAgaWYgKHBhdGhfc3RhcnQpIHsKICAgICAgICAgICAgICAgIHN0cmNweShwYXRoLCBwYXRoX3N0YXJ0KTsKICAgICAgICAgICAgfQogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDYXNlIDE6IFBvcnQgYmVmb3JlIHBhdGhcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIb3N0OiAlcyAobGVuZ3RoOiAlenUpXG4iIFJFU0VULCBob3N0LCBob3N0X2xlbik7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBvcnQ6ICVkXG4iIFJFU0VULCBwb3J0KTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIGlmIChwYXRoX3N0YXJ0KSB7CiAgICAgICAgICAgIHNpemVfdCBob3N0X2xlbiA9IHBhdGhfc3RhcnQgLSBob3N0X3N0YXJ0OwogICAgICAgICAgICBzdHJuY3B5KGhvc3QsIGhvc3Rfc3RhcnQsIGhvc3RfbGVuKTsKICAgICAgICAgICAgaG9zdFtob3N0X2xlbl0gPSAnXDAnOwogICAgICAgICAgICBzdHJjcHkocGF0aCwgcGF0aF9zdGFydCk7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENhc2UgMjogTm8gcG9ydCwgaGFzIHBhdGhcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIb3N0OiAlcyAobGVuZ3RoOiAlenUpXG4iIFJFU0VULCBob3N0LCBob3N0X2xlbik7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHN0cmNweShob3N0LCBob3N0X3N0YXJ0KTsKICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2FzZSAzOiBObyBwb3J0LCBubyBwYXRoXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgSG9zdDogJXNcbiIgUkVTRVQsIGhvc3QpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICBzdHJjcHkocGF0aCwgdXJsKTsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2FzZSA0OiBQYXRoIG9ubHkgKG5vIGh0dHA6Ly8pXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUEFSU0VEIFVSTCBDT01QT05FTlRTXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEhvc3Q6ICVzXG4iIFJFU0VULCBob3N0KTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFBvcnQ6ICVkXG4iIFJFU0VULCBwb3J0KTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgIH0KICAgIAogICAgaW50IHNvY2tmZCA9IHNvY2tldChBRl9JTkVULCBTT0NLX1NUUkVBTSwgMCk7CiAgICBpZiAoc29ja2ZkIDwgMCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU09DS0VUIENSRUFUSU9OIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXJyb3I6ICVzIChlcnJubzogJWQpXG4iIFJFU0VULCBzdHJlcnJvcihlcnJubyksIGVycm5vKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBEb21haW46IEFGX0lORVRcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFR5cGU6IFNPQ0tfU1RSRUFNXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQcm90b2NvbDogMFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBTb2NrZXQgY3JlYXRlZCBzdWNjZXNzZnVsbHlcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgU29ja2V0IEZEOiAlZFxuIiBSRVNFVCwgc29ja2ZkKTsKICAgIH0KICAgIAogICAgc3RydWN0IHRpbWV2YWwgdGltZW91dDsKICAgIHRpbWVvdXQudHZfc2VjID0gMTA7CiAgICB0aW1lb3V0LnR2X3VzZWMgPSAwOwogICAgc2V0c29ja29wdChzb2NrZmQsIFNPTF9TT0NLRVQsIFNPX1JDVlRJTUVPLCAmdGltZW91dCwgc2l6ZW9mKHRpbWVvdXQpKTsKICAgIHNldHNvY2tvcHQoc29ja2ZkLCBTT0xfU09DS0VULCBTT19TTkRUSU1FTywgJnRpbWVvdXQsIHNpemVvZih0aW1lb3V0KSk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFRpbWVvdXQgc2V0OiAlbGQgc2Vjb25kc1xuIiBSRVNFVCwgdGltZW91dC50dl9zZWMpOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUkVTT0xWSU5HIEhPU1ROQU1FXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEhvc3RuYW1lIHRvIHJlc29sdmU6ICVzXG4iIFJFU0VULCBob3N0KTsKICAgIH0KICAgIAogICAgc3RydWN0IGhvc3RlbnQqIHNlcnZlciA9IGdldGhvc3RieW5hbWUoaG9zdCk7CiAgICBpZiAoIXNlcnZlcikgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSE9TVE5BTUUgUkVTT0xVVElPTiBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEhvc3Q6ICVzXG4iIFJFU0VULCBob3N0KTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBoX2Vycm5vOiAlZFxuIiBSRVNFVCwgaF9lcnJubyk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUG9zc2libGUgY2F1c2VzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICAtIEROUyBzZXJ2ZXIgbm90IHJlYWNoYWJsZVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICAtIEhvc3RuYW1lIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBOZXR3b3JrIGNvbmZpZ3VyYXRpb24gaXNzdWVcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBIb3N0bmFtZSByZXNvbHZlZCBzdWNjZXNzZnVsbHlcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgT2ZmaWNpYWwgbmFtZTogJXNcbiIgUkVTRVQsIHNlcnZlci0+aF9uYW1lKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEFkZHJlc3MgdHlwZTogJXNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzZXJ2ZXItPmhfYWRkcnR5cGUgPT0gQUZfSU5FVCA/ICJBRl9JTkVUIChJUHY0KSIgOiAiT3RoZXIiKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEFkZHJlc3MgbGVuZ3RoOiAlZCBieXRlc1xuIiBSRVNFVCwgc2VydmVyLT5oX2xlbmd0aCk7CiAgICAgICAgCiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBJUCBhZGRyZXNzZXM6XG4iIFJFU0VUKTsKICAgICAgICBmb3IgKGludCBpID0gMDsgc2VydmVyLT5oX2FkZHJfbGlzdFtpXSAhPSBOVUxMOyBpKyspIHsKICAgICAgICAgICAgc3RydWN0IGluX2FkZHIgYWRkcjsKICAgICAgICAgICAgbWVtY3B5KCZhZGRyLCBzZXJ2ZXItPmhfYWRkcl9saXN0W2ldLCBzaXplb2YoYWRkcikpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgJWQ6ICVzXG4iIFJFU0VULCBpICsgMSwgaW5ldF9udG9hKGFkZHIpKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHN0cnVjdCBzb2NrYWRkcl9pbiBzZXJ2X2FkZHI7CiAgICBtZW1zZXQoJnNlcnZfYWRkciwgMCwgc2l6ZW9mKHNlcnZfYWRkcikpOwogICAgc2Vydl9hZGRyLnNpbl9mYW1pbHkgPSBBRl9JTkVUOwogICAgbWVtY3B5KCZzZXJ2X2FkZHIuc2luX2FkZHIuc19hZGRyLCBzZXJ2ZXItPmhfYWRkciwgc2VydmVyLT5oX2xlbmd0aCk7CiAgICBzZXJ2X2FkZHIuc2luX3BvcnQgPSBodG9ucyhwb3J0KTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEFUVEVNUFRJTkcgQ09OTkVDVElPTlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTZXJ2ZXIgYWRkcmVzczogJXNcbiIgUkVTRVQsIGluZXRfbnRvYShzZXJ2X2FkZHIuc2luX2FkZHIpKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFNlcnZlciBwb3J0OiAlZFxuIiBSRVNFVCwgbnRvaHMoc2Vydl9hZGRyLnNpbl9wb3J0KSk7CiAgICB9CiAgICAKICAgIGlmIChjb25uZWN0KHNvY2tmZCwgKHN0cnVjdCBzb2NrYWRkciopJnNlcnZfYWRkciwgc2l6ZW9mKHNlcnZfYWRkcikpIDwgMCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ09OTkVDVElPTiBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEVycm9yOiAlcyAoZXJybm86ICVkKVxuIiBSRVNFVCwgc3RyZXJyb3IoZXJybm8pLCBlcnJubyk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU2VydmVyOiAlczolZFxuIiBSRVNFVCwgaW5ldF9udG9hKHNlcnZfYWRkci5zaW5fYWRkciksIHBvcnQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFNvY2tldCBGRDogJWRcbiIgUkVTRVQsIHNvY2tmZCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUG9zc2libGUgY2F1c2VzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICAtIFNlcnZlciBub3QgcnVubmluZ1xuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICAtIEZpcmV3YWxsIGJsb2NraW5nIGNvbm5lY3Rpb25cbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBXcm9uZyBwb3J0IG51bWJlclxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIGNsb3NlKHNvY2tmZCk7CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIENvbm5lY3Rpb24gZXN0YWJsaXNoZWQgc3VjY2Vzc2Z1bGx5XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbm5lY3RlZCB0bzogJXM6JWRcbiIgUkVTRVQsIGluZXRfbnRvYShzZXJ2X2FkZHIuc2luX2FkZHIpLCBwb3J0KTsKICAgIH0KICAgIAogICAgY2hhciByZXF1ZXN0WzgxOTJdOwogICAgaW50IHJlcXVlc3RfbGVuOwogICAgCiAgICBpZiAoYm9keSAmJiBjb250ZW50X3R5cGUpIHsKICAgICAgICByZXF1ZXN0X2xlbiA9IHNucHJpbnRmKHJlcXVlc3QsIHNpemVvZihyZXF1ZXN0KSwKICAgICAgICAgICAgIiVzICVzIEhUVFAvMS4xXHJcbiIKICAgICAgICAgICAgIkhvc3Q6ICVzOiVkXHJcbiIKICAgICAgICAgICAgIkNvbnRlbnQtVHlwZTogJXNcclxuIgogICAgICAgICAgICAiQ29udGVudC1MZW5ndGg6ICV6dVxyXG4iCiAgICAgICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgICAgICJcclxuIgogICAgICAgICAgICAiJXMiLAogICAgICAgICAgICBtZXRob2QsIHBhdGgsIGhvc3QsIHBvcnQsIGNvbnRlbnRfdHlwZSwgc3RybGVuKGJvZHkpLCBib2R5KTsKICAgIH0gZWxzZSBpZiAoYm9keSkgewogICAgICAgIHJlcXVlc3RfbGVuID0gc25wcmludGYocmVxdWVzdCwgc2l6ZW9mKHJlcXVlc3QpLAogICAgICAgICAgICAiJXMgJXMgSFRUUC8xLjFcclxuIgogICAgICAgICAgICAiSG9zdDogJXM6JWRcclxuIgogICAgICAgICAgICAiQ29udGVudC1MZW5ndGg6ICV6dVxyXG4iCiAgICAgICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgICAgICJcclxuIgogICAgICAgICAgICAiJXMiLAogICAgICAgICAgICBtZXRob2QsIHBhdGgsIGhvc3QsIHBvcnQsIHN0cmxlbihib2R5KSwgYm9keSk7CiAgICB9IGVsc2UgewogICAgICAgIHJlcXVlc3RfbGVuID0gc25wcmludGYocmVxdWVzdCwgc2l6ZW9mKHJlcXVlc3QpLAogICAgICAgICAgICAiJXMgJXMgSFRUUC8xLjFcclxuIgogICAgICAgICAgICAiSG9zdDogJXM6JWRcclxuIgogICAgICAgICAgICAiQ29ubmVjdGlvbjogY2xvc2VcclxuIgogICAgICAgICAgICAiXHJcbiIsCiAgICAgICAgICAgIG1ldGhvZCwgcGF0aCwgaG9zdCwgcG9ydCk7CiAgICB9CiAgICAKICAgIGlmIChyZXF1ZXN0X2xlbiA+PSAoaW50KXNpemVvZihyZXF1ZXN0KSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSFRUUCBSRVFVRVNUIFRPTyBMQVJHRVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVxdWVzdCBidWZmZXIgc2l6ZTogJXp1IGJ5dGVzXG4iIFJFU0VULCBzaXplb2YocmVxdWVzdCkpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENhbGN1bGF0ZWQgcmVxdWVzdCBsZW5ndGg6ICVkIGJ5dGVzXG4iIFJFU0VULCByZXF1ZXN0X2xlbik7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQm9keSBsZW5ndGg6ICV6dSBieXRlc1xuIiBSRVNFVCwgYm9keSA/IHN0cmxlbihib2R5KSA6IDApOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gSFRUUCBSRVFVRVNUIENPTlNUUlVDVEVEXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFRvdGFsIGxlbmd0aDogJWQgYnl0ZXNcbiIgUkVTRVQsIHJlcXVlc3RfbGVuKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFJlcXVlc3QgcHJldmlldyAoZmlyc3QgNTAwIGJ5dGVzKTpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBSRVFVRVNUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgaW50IHByZXZpZXdfbGVuID0gcmVxdWVzdF9sZW4gPiA1MDAgPyA1MDAgOiByZXF1ZXN0X2xlbjsKICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IHByZXZpZXdfbGVuOyBpKyspIHsKICAgICAgICAgICAgcHV0Y2hhcihyZXF1ZXN0W2ldKTsKICAgICAgICB9CiAgICAgICAgaWYgKHJlcXVlc3RfbGVuID4gNTAwKSB7CiAgICAgICAgICAgIHByaW50ZigiXG4gICAgLi4uIFslZCBtb3JlIGJ5dGVzXVxuIiwgcmVxdWVzdF9sZW4gLSA1MDApOwogICAgICAgIH0KICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIFJFUVVFU1QgLS0tXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNFTkRJTkcgSFRUUCBSRVFVRVNUXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFNvY2tldCBGRDogJWRcbiIgUkVTRVQsIHNvY2tmZCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXF1ZXN0IGxlbmd0aDogJWQgYnl0ZXNcbiIgUkVTRVQsIHJlcXVlc3RfbGVuKTsKICAgIH0KICAgIAogICAgc3NpemVfdCBzZW50X2J5dGVzID0gc2VuZChzb2NrZmQsIHJlcXVlc3QsIHJlcXVlc3RfbGVuLCAwKTsKICAgIGlmIChzZW50X2J5dGVzIDwgMCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU0VORCBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEVycm9yOiAlcyAoZXJybm86ICVkKVxuIiBSRVNFVCwgc3RyZXJyb3IoZXJybm8pLCBlcnJubyk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQXR0ZW1wdGVkIHRvIHNlbmQ6ICVkIGJ5dGVzXG4iIFJFU0VULCByZXF1ZXN0X2xlbik7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQWN0dWFsbHkgc2VudDogJXpkIGJ5dGVzXG4iIFJFU0VULCBzZW50X2J5dGVzKTsKICAgICAgICB9CiAgICAgICAgY2xvc2Uoc29ja2ZkKTsKICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gUmVxdWVzdCBzZW50IHN1Y2Nlc3NmdWxseVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCeXRlcyBzZW50OiAlemQvJWQgKCUuMWYlJSlcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzZW50X2J5dGVzLCByZXF1ZXN0X2xlbiwgKGZsb2F0KXNlbnRfYnl0ZXMvcmVxdWVzdF9sZW4qMTAwKTsKICAgIH0KICAgIAogICAgY2hhciByZXNwb25zZV9idWZmZXJbMTYzODRdOwogICAgc3NpemVfdCB0b3RhbF9yZWNlaXZlZCA9IDA7CiAgICBzc2l6ZV90IHJlY2VpdmVkOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gV0FJVElORyBGT1IgUkVTUE9OU0VcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQnVmZmVyIHNpemU6ICV6dSBieXRlc1xuIiBSRVNFVCwgc2l6ZW9mKHJlc3BvbnNlX2J1ZmZlcikpOwogICAgfQogICAgCiAgICB3aGlsZSAoKHJlY2VpdmVkID0gcmVjdihzb2NrZmQsIHJlc3BvbnNlX2J1ZmZlciArIHRvdGFsX3JlY2VpdmVkLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHJlc3BvbnNlX2J1ZmZlcikgLSB0b3RhbF9yZWNlaXZlZCAtIDEsIDApKSA+IDApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlICYmIHRvdGFsX3JlY2VpdmVkID09IDApIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaXJzdCBjaHVuayByZWNlaXZlZDogJXpkIGJ5dGVzXG4iIFJFU0VULCByZWNlaXZlZCk7CiAgICAgICAgfQogICAgICAgIHRvdGFsX3JlY2VpdmVkICs9IHJlY2VpdmVkOwogICAgICAgIGlmICh0b3RhbF9yZWNlaXZlZCA+PSAoc3NpemVfdClzaXplb2YocmVzcG9uc2VfYnVmZmVyKSAtIDEpIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUkVTUE9OU0UgQlVGRkVSIEZVTExcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCdWZmZXIgY2FwYWNpdHkgcmVhY2hlZDogJXp1IGJ5dGVzXG4iIFJFU0VULCBzaXplb2YocmVzcG9uc2VfYnVmZmVyKSk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAocmVjZWl2ZWQgPCAwKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSRUNFSVZFIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXJyb3I6ICVzIChlcnJubzogJWQpXG4iIFJFU0VULCBzdHJlcnJvcihlcnJubyksIGVycm5vKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUb3RhbCByZWNlaXZlZCBiZWZvcmUgZXJyb3I6ICV6ZCBieXRlc1xuIiBSRVNFVCwgdG90YWxfcmVjZWl2ZWQpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICByZXNwb25zZV9idWZmZXJbdG90YWxfcmVjZWl2ZWRdID0gJ1wwJzsKICAgIGNsb3NlKHNvY2tmZCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIHJlY2VpdmVkIGNvbXBsZXRlbHlcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVG90YWwgYnl0ZXMgcmVjZWl2ZWQ6ICV6ZFxuIiBSRVNFVCwgdG90YWxfcmVjZWl2ZWQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgUmVzcG9uc2UgcHJldmlldyAoZmlyc3QgNTAwIGJ5dGVzKTpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBSRVNQT05TRSBQUkVWSUVXIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgaW50IHByZXZpZXdfbGVuID0gdG90YWxfcmVjZWl2ZWQgPiA1MDAgPyA1MDAgOiB0b3RhbF9yZWNlaXZlZDsKICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IHByZXZpZXdfbGVuOyBpKyspIHsKICAgICAgICAgICAgcHV0Y2hhcihyZXNwb25zZV9idWZmZXJbaV0pOwogICAgICAgIH0KICAgICAgICBpZiAodG90YWxfcmVjZWl2ZWQgPiA1MDApIHsKICAgICAgICAgICAgcHJpbnRmKCJcbiAgICAuLi4gWyV6ZCBtb3JlIGJ5dGVzXVxuIiwgdG90YWxfcmVjZWl2ZWQgLSA1MDApOwogICAgICAgIH0KICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIFJFU1BPTlNFIFBSRVZJRVcgLS0tXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgY2hhciogc3RhdHVzX2xpbmUgPSBzdHJzdHIocmVzcG9uc2VfYnVmZmVyLCAiSFRUUC8xLjEiKTsKICAgIGlmIChzdGF0dXNfbGluZSkgewogICAgICAgIHNzY2FuZihzdGF0dXNfbGluZSwgIkhUVFAvMS4xICVkIiwgJnJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBIVFRQIFNUQVRVUyBMSU5FIFBBUlNFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU3RhdHVzIGxpbmU6ICUuKnNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICAgICAgKGludCkoc3RyY2hyKHN0YXR1c19saW5lLCAnXHInKSAtIHN0YXR1c19saW5lKSwgc3RhdHVzX2xpbmUpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFN0YXR1cyBjb2RlOiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICB9CiAgICB9IGVsc2UgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gTk8gSFRUUCBTVEFUVVMgTElORSBGT1VORFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTG9va2luZyBmb3IgJ0hUVFAvMS4xJyBpbiByZXNwb25zZVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVzcG9uc2Ugc3RhcnQ6ICUuNTBzXG4iIFJFU0VULCByZXNwb25zZV9idWZmZXIpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgY2hhciogYm9keV9zdGFydCA9IHN0cnN0cihyZXNwb25zZV9idWZmZXIsICJcclxuXHJcbiIpOwogICAgaWYgKGJvZHlfc3RhcnQpIHsKICAgICAgICBib2R5X3N0YXJ0ICs9IDQ7CiAgICAgICAgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoID0gdG90YWxfcmVjZWl2ZWQgLSAoYm9keV9zdGFydCAtIHJlc3BvbnNlX2J1ZmZlcik7CiAgICAgICAgcmVzcG9uc2UtPmJvZHkgPSBtYWxsb2MocmVzcG9uc2UtPmJvZHlfbGVuZ3RoICsgMSk7CiAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5KSB7CiAgICAgICAgICAgIG1lbWNweShyZXNwb25zZS0+Ym9keSwgYm9keV9zdGFydCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoKTsKICAgICAgICAgICAgcmVzcG9uc2UtPmJvZHlbcmVzcG9uc2UtPmJvZHlfbGVuZ3RoXSA9ICdcMCc7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFJFU1BPTlNFIEJPRFkgRVhUUkFDVEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQm9keSBzdGFydCBvZmZzZXQ6ICVsZCBieXRlc1xuIiBSRVNFVCwgYm9keV9zdGFydCAtIHJlc3BvbnNlX2J1ZmZlcik7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgbGVuZ3RoOiAlenUgYnl0ZXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgcHJldmlldyAoZmlyc3QgMjAwIGJ5dGVzKTpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKFdISVRFICIgICAgLS0tIEJFR0lOIEJPRFkgUFJFVklFVyAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgaW50IHByZXZpZXdfbGVuID0gcmVzcG9uc2UtPmJvZHlfbGVuZ3RoID4gMjAwID8gMjAwIDogcmVzcG9uc2UtPmJvZHlfbGVuZ3RoOwogICAgICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IGkgPCBwcmV2aWV3X2xlbjsgaSsrKSB7CiAgICAgICAgICAgICAgICAgICAgcHV0Y2hhcihyZXNwb25zZS0+Ym9keVtpXSk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHlfbGVuZ3RoID4gMjAwKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKCJcbiAgICAuLi4gWyV6dSBtb3JlIGJ5dGVzXVxuIiwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoIC0gMjAwKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBFTkQgQk9EWSBQUkVWSUVXIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBNRU1PUlkgQUxMT0NBVElPTiBGQUlMRUQgRk9SIEJPRFlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXF1ZXN0ZWQgc2l6ZTogJXp1IGJ5dGVzXG4iIFJFU0VULCByZXNwb25zZS0+Ym9keV9sZW5ndGggKyAxKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgcmVzcG9uc2UtPmJvZHkgPSBzdHJkdXAoIiIpOwogICAgICAgIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA9IDA7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBOTyBCT0RZIEZPVU5EIElOIFJFU1BPTlNFXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMb29raW5nIGZvciAnXFxyXFxuXFxyXFxuJyBzZXBhcmF0b3JcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFJlc3BvbnNlIG1pZ2h0IGJlIGhlYWRlcnMtb25seVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gSFRUUCBSRVFVRVNUIENPTVBMRVRFXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEZpbmFsIHN0YXR1czogJWRcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5IHNpemU6ICV6dSBieXRlc1xuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE1lbW9yeSBhbGxvY2F0ZWQgZm9yIHJlc3BvbnNlOiAlenUgYnl0ZXNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzaXplb2YoSHR0cFJlc3BvbnNlKSArIChyZXNwb25zZS0+Ym9keSA/IHJlc3BvbnNlLT5ib2R5X2xlbmd0aCArIDEgOiAwKSk7CiAgICB9CiAgICAKICAgIHJldHVybiByZXNwb25zZTsKfQoKdm9pZCBodHRwX3Jlc3BvbnNlX2ZyZWUoSHR0cFJlc3BvbnNlKiByZXNwb25zZSkgewogICAgaWYgKHJlc3BvbnNlKSB7CiAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5KSB7CiAgICAgICAgICAgIGZyZWUocmVzcG9uc2UtPmJvZHkpOwogICAgICAgIH0KICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgIH0KfQoKaW50IHZlcmlmeV9odHRwX3Jlc3BvbnNlKGNvbnN0IEh0dHBSZXNwb25zZSogcmVzcG9uc2UsIGNvbnN0IGNoYXIqIGV4cGVjdGVkX3BhdHRlcm4sIGludCBjaGVja19zdWNjZXNzX29ubHkpIHsKICAgIGlmICghcmVzcG9uc2UpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIlxuICBbVkVSQk9TRV0gSFRUUCBSRVNQT05TRSBWRVJJRklDQVRJT04gRkFJTEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUmVzcG9uc2UgaXMgTlVMTFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgcGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCBleHBlY3RlZF9wYXR0ZXJuID8gZXhwZWN0ZWRfcGF0dGVybiA6ICIobm9uZSkiKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDaGVjayBzdWNjZXNzIG9ubHk6ICVzXG4iIFJFU0VULCBjaGVja19zdWNjZXNzX29ubHkgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIH0KICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gSFRUUCBSRVNQT05TRSBWRVJJRklDQVRJT05cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgUmVzcG9uc2Ugc3RhdHVzIGNvZGU6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgUmVzcG9uc2UgYm9keSBsZW5ndGg6ICV6dSBieXRlc1xuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIHBhdHRlcm46IFwiJXNcIlxuIiBSRVNFVCwgZXhwZWN0ZWRfcGF0dGVybiA/IGV4cGVjdGVkX3BhdHRlcm4gOiAiKG5vbmUpIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDaGVjayBzdWNjZXNzIG9ubHk6ICVzXG4iIFJFU0VULCBjaGVja19zdWNjZXNzX29ubHkgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIAogICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgY29udGVudCAoZmlyc3QgMzAwIGNoYXJzKTpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gQkVHSU4gQk9EWSAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICBpbnQgbGVuID0gcmVzcG9uc2UtPmJvZHlfbGVuZ3RoID4gMzAwID8gMzAwIDogcmVzcG9uc2UtPmJvZHlfbGVuZ3RoOwogICAgICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IGxlbjsgaSsrKSB7CiAgICAgICAgICAgICAgICBwdXRjaGFyKHJlc3BvbnNlLT5ib2R5W2ldKTsKICAgICAgICAgICAgfQogICAgICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHlfbGVuZ3RoID4gMzAwKSB7CiAgICAgICAgICAgICAgICBwcmludGYoIlxuICAgIC4uLiBbJXp1IG1vcmUgY2hhcnNdXG4iLCByZXNwb25zZS0+Ym9keV9sZW5ndGggLSAzMDApOwogICAgICAgICAgICB9CiAgICAgICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBFTkQgQk9EWSAtLS1cbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKGNoZWNrX3N1Y2Nlc3Nfb25seSkgewogICAgICAgIGludCBoYXNfc3VjY2Vzc19maWVsZCA9IHJlc3BvbnNlLT5ib2R5ICYmIHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIlwic3VjY2Vzc1wiOiIpICE9IE5VTEw7CiAgICAgICAgaW50IHZhbGlkX3N0YXR1cyA9IChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPj0gMjAwICYmIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA8IDUwMCk7CiAgICAgICAgaW50IHJlc3VsdCA9IHZhbGlkX3N0YXR1cyAmJiBoYXNfc3VjY2Vzc19maWVsZDsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNVQ0NFU1MtT05MWSBDSEVDSyBBTkFMWVNJU1xuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU3RhdHVzIGNvZGUgdmFsaWQgKDIwMC00OTkpOiAlcyAoJWQpXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgICAgIHZhbGlkX3N0YXR1cyA/ICJZRVMiIDogIk5PIiwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIYXMgJ3N1Y2Nlc3MnIGZpZWxkIGluIEpTT046ICVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgICAgIGhhc19zdWNjZXNzX2ZpZWxkID8gIllFUyIgOiAiTk8iKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb21iaW5lZCByZXN1bHQ6ICVzXG4iIFJFU0VULCByZXN1bHQgPyAiUEFTUyIgOiAiRkFJTCIpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKCF2YWxpZF9zdGF0dXMpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNUQVRVUyBDT0RFIElTU1VFXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQ6IDIwMC00OTlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBHb3Q6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTdGF0dXMgY29kZSBjYXRlZ29yaWVzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgMjAwLTI5OTogU3VjY2Vzc1xuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgMzAwLTM5OTogUmVkaXJlY3Rpb25cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIDQwMC00OTk6IENsaWVudCBlcnJvclxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgNTAwLTU5OTogU2VydmVyIGVycm9yXG4iIFJFU0VUKTsKICAgICAgICAgICAgfQogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKCFoYXNfc3VjY2Vzc19maWVsZCAmJiByZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gTUlTU0lORyBTVUNDRVNTIEZJRUxEXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTG9va2luZyBmb3IgJ1wic3VjY2Vzc1wiOicgaW4gYm9keVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgY29udGVudCB0eXBlIGFuYWx5c2lzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGlmIChzdHJzdHIocmVzcG9uc2UtPmJvZHksICJ7IikgJiYgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAifSIpKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBBcHBlYXJzIHRvIGJlIEpTT05cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIqIGNvbW1vbl9maWVsZHNbXSA9IHsiXCJlcnJvclwiIiwgIlwibWVzc2FnZVwiIiwgIlwic3RhdHVzXCIiLCAiXCJyZXN1bHRcIiIsIE5VTEx9OwogICAgICAgICAgICAgICAgICAgIGZvciAoaW50IGkgPSAwOyBjb21tb25fZmllbGRzW2ldOyBpKyspIHsKICAgICAgICAgICAgICAgICAgICAgICAgaWYgKHN0cnN0cihyZXNwb25zZS0+Ym9keSwgY29tbW9uX2ZpZWxkc1tpXSkpIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRm91bmQgc2ltaWxhciBmaWVsZDogJXNcbiIgUkVTRVQsIGNvbW1vbl9maWVsZHNbaV0pOwogICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfSBlbHNlIGlmIChzdHJzdHIocmVzcG9uc2UtPmJvZHksICI8aHRtbCIpIHx8IHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIjwhRE9DVFlQRSIpKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBBcHBlYXJzIHRvIGJlIEhUTUxcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfSBlbHNlIGlmIChzdHJzdHIocmVzcG9uc2UtPmJvZHksICJlcnJvciIpIHx8IHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIkVycm9yIikpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbnRhaW5zICdlcnJvcicgdGV4dFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICAgICAgCiAgICAgICAgcmV0dXJuIHJlc3VsdDsKICAgIH0gZWxzZSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBGVUxMIFJFU1BPTlNFIENIRUNLXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgaWYgKHJlc3BvbnNlLT5zdGF0dXNfY29kZSA8IDIwMCB8fCByZXNwb25zZS0+c3RhdHVzX2NvZGUgPj0gMzAwKSB7CiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNUQVRVUyBDT0RFIENIRUNLIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkOiAyMDAtMjk5IChzdWNjZXNzKVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEdvdDogJWRcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFN0YXR1cyBjb2RlIG1lYW5pbmc6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgY29uc3QgY2hhciogc3RhdHVzX21lYW5pbmdzW10gPSB7CiAgICAgICAgICAgICAgICAgICAgIjIwMCIsICJPSyIsCiAgICAgICAgICAgICAgICAgICAgIjIwMSIsICJDcmVhdGVkIiwKICAgICAgICAgICAgICAgICAgICAiMjA0IiwgIk5vIENvbnRlbnQiLAogICAgICAgICAgICAgICAgICAgICI0MDAiLCAiQmFkIFJlcXVlc3QiLAogICAgICAgICAgICAgICAgICAgICI0MDEiLCAiVW5hdXRob3JpemVkIiwKICAgICAgICAgICAgICAgICAgICAiNDAzIiwgIkZvcmJpZGRlbiIsCiAgICAgICAgICAgICAgICAgICAgIjQwNCIsICJOb3QgRm91bmQiLAogICAgICAgICAgICAgICAgICAgICI0MDUiLCAiTWV0aG9kIE5vdCBBbGxvd2VkIiwKICAgICAgICAgICAgICAgICAgICAiNDA5IiwgIkNvbmZsaWN0IiwKICAgICAgICAgICAgICAgICAgICAiNTAwIiwgIkludGVybmFsIFNlcnZlciBFcnJvciIsCiAgICAgICAgICAgICAgICAgICAgIjUwMyIsICJTZXJ2aWNlIFVuYXZhaWxhYmxlIiwKICAgICAgICAgICAgICAgICAgICBOVUxMCiAgICAgICAgICAgICAgICB9OwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBjaGFyIHN0YXR1c19zdHJbMTBdOwogICAgICAgICAgICAgICAgc25wcmludGYoc3RhdHVzX3N0ciwgc2l6ZW9mKHN0YXR1c19zdHIpLCAiJWQiLCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBmb3IgKGludCBpID0gMDsgc3RhdHVzX21lYW5pbmdzW2ldICE9IE5VTEw7IGkgKz0gMikgewogICAgICAgICAgICAgICAgICAgIGlmIChzdHJjbXAoc3RhdHVzX3N0ciwgc3RhdHVzX21lYW5pbmdzW2ldKSA9PSAwKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICAlczogJXNcbiIgUkVTRVQsIHN0YXR1c19tZWFuaW5nc1tpXSwgc3RhdHVzX21lYW5pbmdzW2krMV0pOwogICAgICAgICAgICAgICAgICAgICAgICBicmVhazsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBTdGF0dXMgY29kZSBjaGVjayBwYXNzZWQ6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAoZXhwZWN0ZWRfcGF0dGVybiAmJiBleHBlY3RlZF9wYXR0ZXJuWzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgaWYgKCFyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFBBVFRFUk4gQ0hFQ0sgRkFJTEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIHBhdHRlcm46IFwiJXNcIlxuIiBSRVNFVCwgZXhwZWN0ZWRfcGF0dGVybik7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXNwb25zZSBib2R5IGlzIE5VTExcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgCiAgICAgICAgICAgIGNoYXIqIHBhdHRlcm5fZm91bmQgPSBzdHJzdHIocmVzcG9uc2UtPmJvZHksIGV4cGVjdGVkX3BhdHRlcm4pOwogICAgICAgICAgICBpZiAocGF0dGVybl9mb3VuZCA9PSBOVUxMKSB7CiAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUEFUVEVSTiBOT1QgRk9VTkQgSU4gUkVTUE9OU0UgQk9EWVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4pOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0dGVybiBsZW5ndGg6ICV6dSBjaGFyYWN0ZXJzXG4iIFJFU0VULCBzdHJsZW4oZXhwZWN0ZWRfcGF0dGVybikpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQm9keSBsZW5ndGg6ICV6dSBjaGFyYWN0ZXJzXG4iIFJFU0VULCBzdHJsZW4ocmVzcG9uc2UtPmJvZHkpKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENhc2UtaW5zZW5zaXRpdmUgc2VhcmNoOiAiIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBjaGFyKiBsb3dlcl9ib2R5ID0gc3RyZHVwKHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgICAgICAgICBjaGFyKiBsb3dlcl9wYXR0ZXJuID0gc3RyZHVwKGV4cGVjdGVkX3BhdHRlcm4pOwogICAgICAgICAgICAgICAgICAgIGZvciAoc2l6ZV90IGkgPSAwOyBsb3dlcl9ib2R5W2ldOyBpKyspIGxvd2VyX2JvZHlbaV0gPSB0b2xvd2VyKGxvd2VyX2JvZHlbaV0pOwogICAgICAgICAgICAgICAgICAgIGZvciAoc2l6ZV90IGkgPSAwOyBsb3dlcl9wYXR0ZXJuW2ldOyBpKyspIGxvd2VyX3BhdHRlcm5baV0gPSB0b2xvd2VyKGxvd2VyX3BhdHRlcm5baV0pOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGlmIChzdHJzdHIobG93ZXJfYm9keSwgbG93ZXJfcGF0dGVybikpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKCJGT1VORCAoY2FzZSBkaWZmZXJlbmNlKVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgT3JpZ2luYWwgY2FzZSBtaWdodCBiZSBkaWZmZXJlbnRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZigiTk9UIEZPVU5EXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgZnJlZShsb3dlcl9ib2R5KTsKICAgICAgICAgICAgICAgICAgICBmcmVlKGxvd2VyX3BhdHRlcm4pOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTG9va2luZyBmb3Igc2ltaWxhciBwYXR0ZXJuczpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGlmIChzdHJzdHIoZXhwZWN0ZWRfcGF0dGVybiwgInN1Y2Nlc3MiKSkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgQ2hlY2tpbmcgJ1N1Y2Nlc3MnIChjYXBpdGFsIFMpOiAlc1xuIiBSRVNFVCwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIlN1Y2Nlc3MiKSA/ICJGT1VORCIgOiAiTk9UIEZPVU5EIik7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICBDaGVja2luZyAnU1VDQ0VTUycgKGFsbCBjYXBzKTogJXNcbiIgUkVTRVQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzdHJzdHIocmVzcG9uc2UtPmJvZHksICJTVUNDRVNTIikgPyAiRk9VTkQiIDogIk5PVCBGT1VORCIpOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgY29udGVudCBhcm91bmQgZXhwZWN0ZWQgYXJlYTpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBDT05URVhUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgaW50IHN0YXJ0ID0gMDsKICAgICAgICAgICAgICAgICAgICBpbnQgZW5kID0gc3RybGVuKHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgICAgICAgICBpZiAoZW5kID4gMjAwKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHN0YXJ0ID0gZW5kLzIgLSAxMDA7CiAgICAgICAgICAgICAgICAgICAgICAgIGVuZCA9IGVuZC8yICsgMTAwOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICBmb3IgKGludCBpID0gc3RhcnQ7IGkgPCBlbmQgJiYgaSA8IChpbnQpc3RybGVuKHJlc3BvbnNlLT5ib2R5KTsgaSsrKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHB1dGNoYXIocmVzcG9uc2UtPmJvZHlbaV0pOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICBwcmludGYoV0hJVEUgIlxuICAgIC0tLSBFTkQgQ09OVEVYVCAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBQQVRURVJOIEZPVU5EIElOIFJFU1BPTlNFIEJPRFlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCBleHBlY3RlZF9wYXR0ZXJuKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEZvdW5kIGF0IHBvc2l0aW9uOiAlbGRcbiIgUkVTRVQsIHBhdHRlcm5fZm91bmQgLSByZXNwb25zZS0+Ym9keSk7CiAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb250ZXh0IGFyb3VuZCBmb3VuZCBwYXR0ZXJuICg1MCBjaGFycyBiZWZvcmUvYWZ0ZXIpOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFdISVRFICIgICAgLS0tIEJFR0lOIENPTlRFWFQgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBsb25nIHN0YXJ0ID0gcGF0dGVybl9mb3VuZCAtIHJlc3BvbnNlLT5ib2R5IC0gNTA7CiAgICAgICAgICAgICAgICAgICAgaWYgKHN0YXJ0IDwgMCkgc3RhcnQgPSAwOwogICAgICAgICAgICAgICAgICAgIGxvbmcgZW5kID0gcGF0dGVybl9mb3VuZCAtIHJlc3BvbnNlLT5ib2R5ICsgc3RybGVuKGV4cGVjdGVkX3BhdHRlcm4pICsgNTA7CiAgICAgICAgICAgICAgICAgICAgaWYgKGVuZCA+IChsb25nKXN0cmxlbihyZXNwb25zZS0+Ym9keSkpIGVuZCA9IHN0cmxlbihyZXNwb25zZS0+Ym9keSk7CiAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgZm9yIChsb25nIGkgPSBzdGFydDsgaSA8IGVuZDsgaSsrKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIGlmIChpID09IHBhdHRlcm5fZm91bmQgLSByZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOKTsKICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICBpZiAoaSA9PSBwYXR0ZXJuX2ZvdW5kIC0gcmVzcG9uc2UtPmJvZHkgKyBzdHJsZW4oZXhwZWN0ZWRfcGF0dGVybikpIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAgICAgcHV0Y2hhcihyZXNwb25zZS0+Ym9keVtpXSk7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFdISVRFICJcbiAgICAtLS0gRU5EIENPTlRFWFQgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gTm8gcGF0dGVybiBzcGVjaWZpZWQgZm9yIHZlcmlmaWNhdGlvblxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBIVFRQIHJlc3BvbnNlIHZlcmlmaWNhdGlvbiBwYXNzZWRcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICByZXR1cm4gMTsKfQoKY2hhciogZXh0cmFjdF9qc29uX2ZpZWxkKGNvbnN0IGNoYXIqIGpzb24sIGNvbnN0IGNoYXIqIGZpZWxkKSB7CiAgICBpZiAoIWpzb24gfHwgIWZpZWxkKSByZXR1cm4gTlVMTDsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEVYVFJBQ1RJTkcgSlNPTiBGSUVMRFxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaWVsZCB0byBleHRyYWN0OiBcIiVzXCJcbiIgUkVTRVQsIGZpZWxkKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEpTT04gbGVuZ3RoOiAlenUgY2hhcmFjdGVyc1xuIiBSRVNFVCwgc3RybGVuKGpzb24pKTsKICAgIH0KICAgIAogICAgY2hhciBzZWFyY2hfcGF0dGVyblsyNTZdOwogICAgc25wcmludGYoc2VhcmNoX3BhdHRlcm4sIHNpemVvZihzZWFyY2hfcGF0dGVybiksICJcIiVzXCI6XCIiLCBmaWVsZCk7CiAgICAKICAgIGNoYXIqIGZpZWxkX3N0YXJ0ID0gc3Ryc3RyKGpzb24sIHNlYXJjaF9wYXR0ZXJuKTsKICAgIGlmICghZmllbGRfc3RhcnQpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0dGVybiAnXCIlc1wiOlwiJyBub3QgZm91bmQsIHRyeWluZyB3aXRob3V0IHF1b3Rlc1xuIiBSRVNFVCwgZmllbGQpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBzbnByaW50ZihzZWFyY2hfcGF0dGVybiwgc2l6ZW9mKHNlYXJjaF9wYXR0ZXJuKSwgIlwiJXNcIjoiLCBmaWVsZCk7CiAgICAgICAgZmllbGRfc3RhcnQgPSBzdHJzdHIoanNvbiwgc2VhcmNoX3BhdHRlcm4pOwogICAgICAgIGlmICghZmllbGRfc3RhcnQpIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRklFTEQgTk9UIEZPVU5EIElOIEpTT05cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIHNlYXJjaF9wYXR0ZXJuKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgSlNPTiBwcmV2aWV3IChmaXJzdCAyMDAgY2hhcnMpOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBpbnQgbGVuID0gc3RybGVuKGpzb24pID4gMjAwID8gMjAwIDogc3RybGVuKGpzb24pOwogICAgICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IGkgPCBsZW47IGkrKykgcHV0Y2hhcihqc29uW2ldKTsKICAgICAgICAgICAgICAgIGlmIChzdHJsZW4oanNvbikgPiAyMDApIHByaW50ZigiXG4uLi4iKTsKICAgICAgICAgICAgICAgIHByaW50ZigiXG4iIFJFU0VUKTsKICAgICAgICAgICAgfQogICAgICAgICAgICByZXR1cm4gTlVMTDsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgZmllbGRfc3RhcnQgKz0gc3RybGVuKHNlYXJjaF9wYXR0ZXJuKTsKICAgICAgICBjaGFyKiBmaWVsZF9lbmQgPSBzdHJjaHIoZmllbGRfc3RhcnQsICcsJyk7CiAgICAgICAgaWYgKCFmaWVsZF9lbmQpIGZpZWxkX2VuZCA9IHN0cmNocihmaWVsZF9zdGFydCwgJ30nKTsKICAgICAgICBpZiAoIWZpZWxkX2VuZCkgewogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDQU5OT1QgRklORCBGSUVMRCBFTkQgREVMSU1JVEVSXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRmllbGQgc3RhcnQ6IFwiJS41MHNcIlxuIiBSRVNFVCwgZmllbGRfc3RhcnQpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIHJldHVybiBOVUxMOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBzaXplX3QgZmllbGRfbGVuZ3RoID0gZmllbGRfZW5kIC0gZmllbGRfc3RhcnQ7CiAgICAgICAgY2hhciogdmFsdWUgPSBtYWxsb2MoZmllbGRfbGVuZ3RoICsgMSk7CiAgICAgICAgaWYgKCF2YWx1ZSkgewogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBNRU1PUlkgQUxMT0NBVElPTiBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXF1ZXN0ZWQgc2l6ZTogJXp1IGJ5dGVzXG4iIFJFU0VULCBmaWVsZF9sZW5ndGggKyAxKTsKICAgICAgICAgICAgfQogICAgICAgICAgICByZXR1cm4gTlVMTDsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgc3RybmNweSh2YWx1ZSwgZmllbGRfc3RhcnQsIGZpZWxkX2xlbmd0aCk7CiAgICAgICAgdmFsdWVbZmllbGRfbGVuZ3RoXSA9ICdcMCc7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIEZJRUxEIEVYVFJBQ1RFRCAoVU5RVU9URUQpXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaWVsZCB2YWx1ZTogXCIlc1wiXG4iIFJFU0VULCB2YWx1ZSk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgVmFsdWUgbGVuZ3RoOiAlenUgY2hhcmFjdGVyc1xuIiBSRVNFVCwgZmllbGRfbGVuZ3RoKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgcmV0dXJuIHZhbHVlOwogICAgfQogICAgCiAgICBmaWVsZF9zdGFydCArPSBzdHJsZW4oc2VhcmNoX3BhdHRlcm4pOwogICAgY2hhciogZmllbGRfZW5kID0gc3RyY2hyKGZpZWxkX3N0YXJ0LCAnIicpOwogICAgaWYgKCFmaWVsZF9lbmQpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENBTk5PVCBGSU5EIENMT1NJTkcgUVVPVEVcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEZpZWxkIHN0YXJ0OiBcIiUuNTBzXCJcbiIgUkVTRVQsIGZpZWxkX3N0YXJ0KTsKICAgICAgICB9CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIHNpemVfdCBmaWVsZF9sZW5ndGggPSBmaWVsZF9lbmQgLSBmaWVsZF9zdGFydDsKICAgIGNoYXIqIHZhbHVlID0gbWFsbG9jKGZpZWxkX2xlbmd0aCArIDEpOwogICAgaWYgKCF2YWx1ZSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gTUVNT1JZIEFMTE9DQVRJT04gRkFJTEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXF1ZXN0ZWQgc2l6ZTogJXp1IGJ5dGVzXG4iIFJFU0VULCBmaWVsZF9sZW5ndGggKyAxKTsKICAgICAgICB9CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIHN0cm5jcHkodmFsdWUsIGZpZWxkX3N0YXJ0LCBmaWVsZF9sZW5ndGgpOwogICAgdmFsdWVbZmllbGRfbGVuZ3RoXSA9ICdcMCc7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIEZJRUxEIEVYVFJBQ1RFRCAoUVVPVEVEKVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaWVsZCB2YWx1ZTogXCIlc1wiXG4iIFJFU0VULCB2YWx1ZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBWYWx1ZSBsZW5ndGg6ICV6dSBjaGFyYWN0ZXJzXG4iIFJFU0VULCBmaWVsZF9sZW5ndGgpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgU2VhcmNoIHBhdHRlcm4gdXNlZDogXCIlc1wiXG4iIFJFU0VULCBzZWFyY2hfcGF0dGVybik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGb3VuZCBhdCBwb3NpdGlvbjogJWxkXG4iIFJFU0VULCBmaWVsZF9zdGFydCAtIGpzb24gLSBzdHJsZW4oc2VhcmNoX3BhdHRlcm4pKTsKICAgIH0KICAgIAogICAgcmV0dXJuIHZhbHVlOwp9CgppbnQgaHR0cF90ZXN0X2VuZHBvaW50KGNvbnN0IGNoYXIqIGRlc2NyaXB0aW9uLCBjb25zdCBjaGFyKiBtZXRob2QsIGNvbnN0IGNoYXIqIGVuZHBvaW50LCAKICAgICAgICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGV4cGVjdGVkX3BhdHRlcm4sIGludCBjaGVja19zdWNjZXNzX29ubHksIGxvbmcgbG9uZyogZHVyYXRpb24pIHsKICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgZGVzY3JpcHRpb24pOwogICAgZmZsdXNoKHN0ZG91dCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEhUVFAgRU5EUE9JTlQgVEVTVCBTVEFSVFxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBEZXNjcmlwdGlvbjogJXNcbiIgUkVTRVQsIGRlc2NyaXB0aW9uKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE1ldGhvZDogJXNcbiIgUkVTRVQsIG1ldGhvZCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFbmRwb2ludDogJXNcbiIgUkVTRVQsIGVuZHBvaW50KTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHk6ICVzXG4iIFJFU0VULCBib2R5ID8gYm9keSA6ICIobm9uZSkiKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIHBhdHRlcm46IFwiJXNcIlxuIiBSRVNFVCwgZXhwZWN0ZWRfcGF0dGVybiA/IGV4cGVjdGVkX3BhdHRlcm4gOiAiKG5vbmUpIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDaGVjayBzdWNjZXNzIG9ubHk6ICVzXG4iIFJFU0VULCBjaGVja19zdWNjZXNzX29ubHkgPyAiWUVTIiA6ICJOTyIpOwogICAgfQogICAgCiAgICBsb25nIGxvbmcgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgSHR0cFJlc3BvbnNlKiByZXNwb25zZSA9IGh0dHBfcmVxdWVzdChtZXRob2QsIGVuZHBvaW50LCBib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgbG9uZyBsb25nIGVuZF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICBpZiAoZHVyYXRpb24pIHsKICAgICAgICAqZHVyYXRpb24gPSBlbmRfdGltZSAtIHN0YXJ0X3RpbWU7CiAgICB9CiAgICAKICAgIGludCBzdWNjZXNzID0gMDsKICAgIGlmIChyZXNwb25zZSkgewogICAgICAgIHN1Y2Nlc3MgPSB2ZXJpZnlfaHR0cF9yZXNwb25zZShyZXNwb25zZSwgZXhwZWN0ZWRfcGF0dGVybiwgY2hlY2tfc3VjY2Vzc19vbmx5KTsKICAgICAgICAKICAgICAgICBpZiAoIXN1Y2Nlc3MpIHsKICAgICAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgZW5kX3RpbWUgLSBzdGFydF90aW1lLCBSRVNFVCk7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICJcbiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSFRUUCBURVNUIEZBSUxVUkUgQU5BTFlTSVNcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBUZXN0OiAlc1xuIiBSRVNFVCwgZGVzY3JpcHRpb24pOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRW5kcG9pbnQ6ICVzICVzXG4iIFJFU0VULCBtZXRob2QsIGVuZHBvaW50KTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFN0YXR1cyBDb2RlOiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEV4cGVjdGVkIFBhdHRlcm46ICclcydcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4gPyBleHBlY3RlZF9wYXR0ZXJuIDogIk5PTkUiKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENoZWNrIFN1Y2Nlc3MgT25seTogJXNcbiIgUkVTRVQsIGNoZWNrX3N1Y2Nlc3Nfb25seSA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIEJvZHkgKCV6dSBieXRlcyk6XG4iIFJFU0VULCByZXNwb25zZS0+Ym9keV9sZW5ndGgpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihXSElURSAiICAtLS0gQkVHSU4gUkVTUE9OU0UgQk9EWSAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZigiJXNcbiIsIHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgLS0tIEVORCBSRVNQT05TRSBCT0RZIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgaWYgKHN0cnN0cihyZXNwb25zZS0+Ym9keSwgInsiKSAmJiBzdHJzdHIocmVzcG9uc2UtPmJvZHksICJ9IikpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSlNPTiBTVFJVQ1RVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIqIGpzb25fZmllbGRzW10gPSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICAiZXJyb3IiLCAibWVzc2FnZSIsICJkZXRhaWxzIiwgImNvZGUiLCAic3RhdHVzIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAic3VjY2VzcyIsICJkYXRhIiwgInJlc3VsdCIsIE5VTEwKICAgICAgICAgICAgICAgICAgICAgICAgfTsKICAgICAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgICAgIGZvciAoaW50IGkgPSAwOyBqc29uX2ZpZWxkc1tpXTsgaSsrKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBjaGFyKiB2YWx1ZSA9IGV4dHJhY3RfanNvbl9maWVsZChyZXNwb25zZS0+Ym9keSwganNvbl9maWVsZHNbaV0pOwogICAgICAgICAgICAgICAgICAgICAgICAgICAgaWYgKHZhbHVlKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaWVsZCAnJXMnOiAlc1xuIiBSRVNFVCwganNvbl9maWVsZHNbaV0sIHZhbHVlKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBmcmVlKHZhbHVlKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUmVzcG9uc2UgQm9keTogTlVMTFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIFRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIGVuZF90aW1lIC0gc3RhcnRfdGltZSk7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUE9TU0lCTEUgSVNTVUVTIEFORCBTT0xVVElPTlM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgaWYgKHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9PSAwKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFNlcnZlciBtaWdodCBub3QgYmUgcnVubmluZ1xuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIE5ldHdvcmsgY29ubmVjdGl2aXR5IGlzc3VlXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gRmlyZXdhbGwgYmxvY2tpbmcgY29ubmVjdGlvblxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9IGVsc2UgaWYgKHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9PSA0MDQpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gRW5kcG9pbnQgVVJMIG1pZ2h0IGJlIGluY29ycmVjdFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFNlcnZlciByb3V0aW5nIG1pc2NvbmZpZ3VyZWRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfSBlbHNlIGlmIChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gNDA1KSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIEhUVFAgbWV0aG9kIG5vdCBhbGxvd2VkIGZvciB0aGlzIGVuZHBvaW50XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0gZWxzZSBpZiAocmVzcG9uc2UtPnN0YXR1c19jb2RlID49IDUwMCkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBTZXJ2ZXIgaW50ZXJuYWwgZXJyb3JcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBDaGVjayBzZXJ2ZXIgbG9nc1xuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9IGVsc2UgaWYgKHJlc3BvbnNlLT5zdGF0dXNfY29kZSA+PSA0MDApIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gQ2xpZW50IGVycm9yIC0gY2hlY2sgcmVxdWVzdCBwYXJhbWV0ZXJzXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gVmFsaWRhdGUgSlNPTiBmb3JtYXRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBDaGVjayByZXF1aXJlZCBmaWVsZHNcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBpZiAoZXhwZWN0ZWRfcGF0dGVybiAmJiByZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgICAgIGlmICghc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCBleHBlY3RlZF9wYXR0ZXJuKSkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gUGF0dGVybiAnJXMnIG5vdCBmb3VuZCBpbiByZXNwb25zZVxuIiBSRVNFVCwgZXhwZWN0ZWRfcGF0dGVybik7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBDaGVjayBmb3IgY2FzZSBzZW5zaXRpdml0eVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBWZXJpZnkgdGhlIGV4YWN0IGV4cGVjdGVkIG91dHB1dFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5KSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBTdGF0dXM6ICVkLCBSZXNwb25zZTogJXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSwgcmVzcG9uc2UtPmJvZHkpOwogICAgICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFN0YXR1czogJWQsIE5vIHJlc3BvbnNlIGJvZHlcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGVuZF90aW1lIC0gc3RhcnRfdGltZSwgUkVTRVQpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICJcbiAgW1ZFUkJPU0VdIEhUVFAgVEVTVCBTVUNDRVNTIERFVEFJTFNcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSAgIEVuZHBvaW50OiAlcyAlc1xuIiBSRVNFVCwgbWV0aG9kLCBlbmRwb2ludCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdICAgU3RhdHVzIENvZGU6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSAgIFJlc3BvbnNlIFRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIGVuZF90aW1lIC0gc3RhcnRfdGltZSk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdICAgQm9keSBMZW5ndGg6ICV6dSBieXRlc1xuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoKTsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5ICYmIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA8IDUwMCkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gICBSZXNwb25zZSBCb2R5OlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKCIlc1xuIiwgcmVzcG9uc2UtPmJvZHkpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICB9IGVsc2UgewogICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGVuZF90aW1lIC0gc3RhcnRfdGltZSwgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgTm8gcmVzcG9uc2UgZnJvbSBzZXJ2ZXJcbiIgUkVTRVQpOwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiXG4gIFtWRVJCT1NFXSBIVFRQIFRFU1QgRkFJTFVSRSAtIE5PIFJFU1BPTlNFXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBFbmRwb2ludDogJXMgJXNcbiIgUkVTRVQsIG1ldGhvZCwgZW5kcG9pbnQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIFNlcnZlciBtYXkgYmUgZG93biBvciB1bnJlYWNoYWJsZVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgUmVxdWVzdCB0aW1lOiAlbGxkIG1zXG4iIFJFU0VULCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIFBvc3NpYmxlIGNhdXNlczpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gU2VydmVyIG5vdCBzdGFydGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFdyb25nIHBvcnQgbnVtYmVyXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIEZpcmV3YWxsIGJsb2NraW5nIGNvbm5lY3Rpb25cbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gTmV0d29yayBpc3N1ZXNcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gU2VydmVyIGNyYXNoZWRcbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEhUVFAgRU5EUE9JTlQgVEVTVCBDT01QTEVURVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUmVzdWx0OiAlc1xuIiBSRVNFVCwgc3VjY2VzcyA/ICJQQVNTIiA6ICJGQUlMIik7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRHVyYXRpb246ICVsbGQgbXNcbiIgUkVTRVQsIGVuZF90aW1lIC0gc3RhcnRfdGltZSk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIHJldHVybiBzdWNjZXNzOwp9Cgp2b2lkIGNsZWFudXBfdGVzdF9kYXRhYmFzZXMoKSB7CiAgICBwcmludGYoIkNsZWFuaW5nIHVwIHByZXZpb3VzIHRlc3QgZGF0YWJhc2VzLi4uXG4iKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENsZWFuaW5nIHVwIHRlc3QgZGlyZWN0b3JpZXMgaW4gL3RtcC9zeWRiX3Rlc3QvXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICJybSAtcmYgL3RtcC9zeWRiX3Rlc3QvdGVzdGRiXyogL3RtcC9zeWRiX3Rlc3QvdGVzdGRiMl8qIC90bXAvc3lkYl90ZXN0L3Rlc3Rjb2xsZGJfKiAvdG1wL3N5ZGJfdGVzdC90ZXN0aW5zdGRiXyogMj4vZGV2L251bGwiKTsKICAgIHN5c3RlbShjb21tYW5kKTsKICAgIAogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAicm0gLWYgL3RtcC9zeWRiX3Rlc3QvKi5sb2NrIC90bXAvc3lkYl90ZXN0Ly4qLmxvY2sgMj4vZGV2L251bGwiKTsKICAgIHN5c3RlbShjb21tYW5kKTsKICAgIAogICAgdXNsZWVwKDUwMDAwKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENsZWFudXAgY29tcGxldGVkXG4iIFJFU0VUKTsKICAgIH0KfQoKaW50IHJ1bl9odHRwX2RhdGFiYXNlX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiSFRUUCBBUEkgREFUQUJBU0UgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGludCB0b3RhbCA9IDA7CiAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IDA7CiAgICBsb25nIGxvbmcgZHVyYXRpb247CiAgICAKICAgIGNoYXIgdW5pcXVlX2RiMVs2NF0sIHVuaXF1ZV9kYjJbNjRdOwogICAgc3RydWN0IHRpbWVzcGVjIHRzOwogICAgY2xvY2tfZ2V0dGltZShDTE9DS19NT05PVE9OSUMsICZ0cyk7CiAgICBzbnByaW50Zih1bmlxdWVfZGIxLCBzaXplb2YodW5pcXVlX2RiMSksICJ0ZXN0ZGJfJWxkXyVsZCIsIHRzLnR2X3NlYywgdHMudHZfbnNlYyk7CiAgICBzbnByaW50Zih1bmlxdWVfZGIyLCBzaXplb2YodW5pcXVlX2RiMiksICJ0ZXN0ZGIyXyVsZF8lbGQiLCB0cy50dl9zZWMsIHRzLnR2X25zZWMgKyAxKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFVzaW5nIHVuaXF1ZSBkYXRhYmFzZSBuYW1lczogJXMsICVzXG4iIFJFU0VULCB1bmlxdWVfZGIxLCB1bmlxdWVfZGIyKTsKICAgIH0KICAgIAogICAgY2hhciBjcmVhdGVfZGIxX2JvZHlbMTI4XSwgY3JlYXRlX2RiMl9ib2R5WzEyOF07CiAgICBzbnByaW50ZihjcmVhdGVfZGIxX2JvZHksIHNpemVvZihjcmVhdGVfZGIxX2JvZHkpLCAie1wibmFtZVwiOlwiJXNcIn0iLCB1bmlxdWVfZGIxKTsKICAgIHNucHJpbnRmKGNyZWF0ZV9kYjJfYm9keSwgc2l6ZW9mKGNyZWF0ZV9kYjJfYm9keSksICJ7XCJuYW1lXCI6XCIlc1wifSIsIHVuaXF1ZV9kYjIpOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMgLSBMaXN0IGRhdGFiYXNlcyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCAiL2FwaS9kYXRhYmFzZXMiLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDEsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gQ3JlYXRlIGRhdGFiYXNlIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCBjcmVhdGVfZGIxX2JvZHksICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMgLSBDcmVhdGUgc2Vjb25kIGRhdGFiYXNlIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCBjcmVhdGVfZGIyX2JvZHksICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMgLSBQcmV2ZW50IGR1cGxpY2F0ZSBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgY3JlYXRlX2RiMV9ib2R5LCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgY2hhciBkZWxldGVfdXJsWzI1Nl07CiAgICBzbnByaW50ZihkZWxldGVfdXJsLCBzaXplb2YoZGVsZXRlX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcyIsIHVuaXF1ZV9kYjIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiREVMRVRFIC9hcGkvZGF0YWJhc2VzL3tuYW1lfSAtIERlbGV0ZSBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJERUxFVEUiLCBkZWxldGVfdXJsLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIERhdGFiYXNlIEFQSSB0ZXN0czogJWQvJWQgcGFzc2VkIChhdmc6ICVsbGQgbXMpXG4iIFJFU0VULCAKICAgICAgICAgICBwYXNzZWQsIHRvdGFsLCB0b3RhbF90aW1lIC8gKHRvdGFsID4gMCA/IHRvdGFsIDogMSkpOwogICAgCiAgICByZXR1cm4gcGFzc2VkOwp9CgppbnQgcnVuX2h0dHBfY29sbGVjdGlvbl90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIENPTExFQ1RJT04gVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGludCB0b3RhbCA9IDA7CiAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IDA7CiAgICBsb25nIGxvbmcgZHVyYXRpb247CiAgICAKICAgIGNoYXIgdW5pcXVlX2RiWzY0XTsKICAgIHN0cnVjdCB0aW1lc3BlYyB0czsKICAgIGNsb2NrX2dldHRpbWUoQ0xPQ0tfTU9OT1RPTklDLCAmdHMpOwogICAgc25wcmludGYodW5pcXVlX2RiLCBzaXplb2YodW5pcXVlX2RiKSwgInRlc3Rjb2xsZGJfJWxkXyVsZCIsIHRzLnR2X3NlYywgdHMudHZfbnNlYyk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBVc2luZyB1bmlxdWUgZGF0YWJhc2UgbmFtZTogJXNcbiIgUkVTRVQsIHVuaXF1ZV9kYik7CiAgICB9CiAgICAKICAgIGNoYXIgY3JlYXRlX2RiX2JvZHlbMTI4XTsKICAgIHNucHJpbnRmKGNyZWF0ZV9kYl9ib2R5LCBzaXplb2YoY3JlYXRlX2RiX2JvZHkpLCAie1wibmFtZVwiOlwiJXNcIn0iLCB1bmlxdWVfZGIpOwogICAgCiAgICBIdHRwUmVzcG9uc2UqIGRiX3Jlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgY3JlYXRlX2RiX2JvZHksICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICBpZiAoIWRiX3Jlc3BvbnNlIHx8ICF2ZXJpZnlfaHR0cF9yZXNwb25zZShkYl9yZXNwb25zZSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwKSkgewogICAgICAgIHByaW50ZihSRUQgIiAgRmFpbGVkIHRvIGNyZWF0ZSB0ZXN0IGRhdGFiYXNlIGZvciBjb2xsZWN0aW9uIHRlc3RzXG4iIFJFU0VUKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIERhdGFiYXNlIGNyZWF0aW9uIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgIGlmIChkYl9yZXNwb25zZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUmVzcG9uc2Ugc3RhdHVzOiAlZCwgYm9keTogJXNcbiIgUkVTRVQsIGRiX3Jlc3BvbnNlLT5zdGF0dXNfY29kZSwgZGJfcmVzcG9uc2UtPmJvZHkgPyBkYl9yZXNwb25zZS0+Ym9keSA6ICJOVUxMIik7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGRiX3Jlc3BvbnNlKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAKICAgIGNoYXIgbGlzdF9jb2xsc191cmxbMjU2XTsKICAgIHNucHJpbnRmKGxpc3RfY29sbHNfdXJsLCBzaXplb2YobGlzdF9jb2xsc191cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMgLSBMaXN0IGVtcHR5IGNvbGxlY3Rpb25zIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIGxpc3RfY29sbHNfdXJsLCBOVUxMLCAiXCJjb2xsZWN0aW9uc1wiOltdIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGNoYXIgY3JlYXRlX2NvbGxfdXJsWzI1Nl07CiAgICBzbnByaW50ZihjcmVhdGVfY29sbF91cmwsIHNpemVvZihjcmVhdGVfY29sbF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMiLCB1bmlxdWVfZGIpOwogICAgCiAgICBjb25zdCBjaGFyKiB1c2Vyc19zY2hlbWEgPSAie1wibmFtZVwiOlwidXNlcnNcIixcInNjaGVtYVwiOlsiCiAgICAgICAgIntcIm5hbWVcIjpcIm5hbWVcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjp0cnVlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImFnZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImVtYWlsXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9IgogICAgICAgICJdfSI7CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucyAtIENyZWF0ZSB1c2VycyBjb2xsZWN0aW9uIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCBjcmVhdGVfY29sbF91cmwsIHVzZXJzX3NjaGVtYSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgY29uc3QgY2hhciogcHJvZHVjdHNfc2NoZW1hID0gIntcIm5hbWVcIjpcInByb2R1Y3RzXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICJ7XCJuYW1lXCI6XCJuYW1lXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6dHJ1ZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJwcmljZVwiLFwidHlwZVwiOlwiZmxvYXRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9IgogICAgICAgICJdfSI7CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucyAtIENyZWF0ZSBwcm9kdWN0cyBjb2xsZWN0aW9uIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCBjcmVhdGVfY29sbF91cmwsIHByb2R1Y3RzX3NjaGVtYSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMgLSBMaXN0IGNyZWF0ZWQgY29sbGVjdGlvbnMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgbGlzdF9jb2xsc191cmwsIE5VTEwsICJcInVzZXJzXCIiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgY2hhciBzY2hlbWFfdXJsWzI1Nl07CiAgICBzbnByaW50ZihzY2hlbWFfdXJsLCBzaXplb2Yoc2NoZW1hX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9zY2hlbWEiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L3NjaGVtYSAtIEdldCB1c2VycyBzY2hlbWEiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgc2NoZW1hX3VybCwgTlVMTCwgIlwibmFtZVwiIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGNoYXIgZGVsZXRlX2NvbGxfdXJsWzI1Nl07CiAgICBzbnByaW50ZihkZWxldGVfY29sbF91cmwsIHNpemVvZihkZWxldGVfY29sbF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvcHJvZHVjdHMiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiREVMRVRFIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9IC0gRGVsZXRlIHByb2R1Y3RzIGNvbGxlY3Rpb24iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiREVMRVRFIiwgZGVsZXRlX2NvbGxfdXJsLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIENvbGxlY3Rpb24gQVBJIHRlc3RzOiAlZC8lZCBwYXNzZWQgKGF2ZzogJWxsZCBtcylcbiIgUkVTRVQsIAogICAgICAgICAgIHBhc3NlZCwgdG90YWwsIHRvdGFsX3RpbWUgLyAodG90YWwgPiAwID8gdG90YWwgOiAxKSk7CiAgICAKICAgIHJldHVybiBwYXNzZWQ7Cn0KCmludCBydW5faHR0cF9pbnN0YW5jZV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIElOU1RBTkNFIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICBjaGFyIHVuaXF1ZV9kYls2NF07CiAgICBzdHJ1Y3QgdGltZXNwZWMgdHM7CiAgICBjbG9ja19nZXR0aW1lKENMT0NLX01PTk9UT05JQywgJnRzKTsKICAgIHNucHJpbnRmKHVuaXF1ZV9kYiwgc2l6ZW9mKHVuaXF1ZV9kYiksICJ0ZXN0aW5zdGRiXyVsZF8lbGQiLCB0cy50dl9zZWMsIHRzLnR2X25zZWMpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gVXNpbmcgdW5pcXVlIGRhdGFiYXNlIG5hbWU6ICVzXG4iIFJFU0VULCB1bmlxdWVfZGIpOwogICAgfQogICAgCiAgICBjaGFyIGNyZWF0ZV9kYl9ib2R5WzEyOF07CiAgICBzbnByaW50ZihjcmVhdGVfZGJfYm9keSwgc2l6ZW9mKGNyZWF0ZV9kYl9ib2R5KSwgIntcIm5hbWVcIjpcIiVzXCJ9IiwgdW5pcXVlX2RiKTsKICAgIAogICAgSHR0cFJlc3BvbnNlKiBkYl9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYl9ib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaWYgKCFkYl9yZXNwb25zZSB8fCAhdmVyaWZ5X2h0dHBfcmVzcG9uc2UoZGJfcmVzcG9uc2UsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCkpIHsKICAgICAgICBwcmludGYoUkVEICIgIEZhaWxlZCB0byBjcmVhdGUgdGVzdCBkYXRhYmFzZSBmb3IgaW5zdGFuY2UgdGVzdHNcbiIgUkVTRVQpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRGF0YWJhc2UgY3JlYXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGRiX3Jlc3BvbnNlKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAKICAgIGNoYXIgY3JlYXRlX2NvbGxfdXJsWzI1Nl07CiAgICBzbnByaW50ZihjcmVhdGVfY29sbF91cmwsIHNpemVvZihjcmVhdGVfY29sbF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMiLCB1bmlxdWVfZGIpOwogICAgCiAgICBjb25zdCBjaGFyKiB1c2Vyc19zY2hlbWEgPSAie1wibmFtZVwiOlwidXNlcnNcIixcInNjaGVtYVwiOlsiCiAgICAgICAgIntcIm5hbWVcIjpcIm5hbWVcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjp0cnVlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImFnZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImVtYWlsXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9IgogICAgICAgICJdfSI7CiAgICAKICAgIEh0dHBSZXNwb25zZSogY29sbF9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsIGNyZWF0ZV9jb2xsX3VybCwgdXNlcnNfc2NoZW1hLCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaWYgKCFjb2xsX3Jlc3BvbnNlIHx8ICF2ZXJpZnlfaHR0cF9yZXNwb25zZShjb2xsX3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiICBGYWlsZWQgdG8gY3JlYXRlIHRlc3QgY29sbGVjdGlvbiBmb3IgaW5zdGFuY2UgdGVzdHNcbiIgUkVTRVQpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ29sbGVjdGlvbiBjcmVhdGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoY29sbF9yZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoY29sbF9yZXNwb25zZSk7CiAgICAKICAgIGNoYXIgbGlzdF9pbnN0YW5jZXNfdXJsWzI1Nl07CiAgICBzbnByaW50ZihsaXN0X2luc3RhbmNlc191cmwsIHNpemVvZihsaXN0X2luc3RhbmNlc191cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzIiwgdW5pcXVlX2RiKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBMaXN0IGVtcHR5IGluc3RhbmNlcyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBsaXN0X2luc3RhbmNlc191cmwsIE5VTEwsICJcImluc3RhbmNlc1wiOltdIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGNvbnN0IGNoYXIqIHVzZXIxID0gIntcIm5hbWVcIjpcIkpvaG4gRG9lXCIsXCJhZ2VcIjozMCxcImVtYWlsXCI6XCJqb2huQHRlc3QuY29tXCJ9IjsKICAgIGNoYXIgaW5zZXJ0X3VybFsyNTZdOwogICAgc25wcmludGYoaW5zZXJ0X3VybCwgc2l6ZW9mKGluc2VydF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzIiwgdW5pcXVlX2RiKTsKICAgIAogICAgSHR0cFJlc3BvbnNlKiBpbnNlcnRfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCBpbnNlcnRfdXJsLCB1c2VyMSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmIChpbnNlcnRfcmVzcG9uc2UgJiYgdmVyaWZ5X2h0dHBfcmVzcG9uc2UoaW5zZXJ0X3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgY2hhciogaWQxID0gZXh0cmFjdF9qc29uX2ZpZWxkKGluc2VydF9yZXNwb25zZS0+Ym9keSwgImlkIik7CiAgICAgICAgaWYgKGlkMSkgewogICAgICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIEluc2VydCBmaXJzdCB1c2VyIik7CiAgICAgICAgICAgIHByaW50ZigiWyIgR1JFRU4gIlBBU1MiIFJFU0VUICJdICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgZHVyYXRpb24sIFJFU0VUKTsKICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIEluc2VydGVkIHVzZXIgd2l0aCBJRDogJXNcbiIgUkVTRVQsIGlkMSk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgCiAgICAgICAgICAgIGNvbnN0IGNoYXIqIHVzZXIyID0gIntcIm5hbWVcIjpcIkphbmUgU21pdGhcIixcImFnZVwiOjI1LFwiZW1haWxcIjpcImphbmVAdGVzdC5jb21cIn0iOwogICAgICAgICAgICBIdHRwUmVzcG9uc2UqIGluc2VydF9yZXNwb25zZTIgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCBpbnNlcnRfdXJsLCB1c2VyMiwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgICAgICAgICAgaWYgKGluc2VydF9yZXNwb25zZTIgJiYgdmVyaWZ5X2h0dHBfcmVzcG9uc2UoaW5zZXJ0X3Jlc3BvbnNlMiwgIlwic3VjY2Vzc1wiOnRydWUiLCAwKSkgewogICAgICAgICAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBJbnNlcnQgc2Vjb25kIHVzZXIiKTsKICAgICAgICAgICAgICAgIHByaW50ZigiWyIgR1JFRU4gIlBBU1MiIFJFU0VUICJdICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgZHVyYXRpb24sIFJFU0VUKTsKICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gTGlzdCB1c2VycyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBsaXN0X2luc3RhbmNlc191cmwsIE5VTEwsICJKb2huIERvZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHRvdGFsKys7CiAgICAgICAgICAgICAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBjaGFyIHF1ZXJ5X3VybFs1MTJdOwogICAgICAgICAgICAgICAgc25wcmludGYocXVlcnlfdXJsLCBzaXplb2YocXVlcnlfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcz9xdWVyeT1hZ2U6MzAiLCB1bmlxdWVfZGIpOwogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvLi4uL2luc3RhbmNlcz9xdWVyeT1hZ2U6MzAgLSBRdWVyeSBieSBhZ2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgcXVlcnlfdXJsLCBOVUxMLCAiSm9obiBEb2UiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB0b3RhbCsrOwogICAgICAgICAgICAgICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgY2hhciB1cGRhdGVfdXJsWzI1Nl07CiAgICAgICAgICAgICAgICBzbnByaW50Zih1cGRhdGVfdXJsLCBzaXplb2YodXBkYXRlX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9pbnN0YW5jZXMvJXMiLCB1bmlxdWVfZGIsIGlkMSk7CiAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiB1cGRhdGVfZGF0YSA9ICJ7XCJhZ2VcIjozNSxcImVtYWlsXCI6XCJqb2huLnVwZGF0ZWRAdGVzdC5jb21cIn0iOwogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUFVUIC9hcGkvLi4uL2luc3RhbmNlcy97aWR9IC0gVXBkYXRlIHVzZXIiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiUFVUIiwgdXBkYXRlX3VybCwgdXBkYXRlX2RhdGEsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGNoYXIgZGVsZXRlX3VybFsyNTZdOwogICAgICAgICAgICAgICAgc25wcmludGYoZGVsZXRlX3VybCwgc2l6ZW9mKGRlbGV0ZV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzLyVzIiwgdW5pcXVlX2RiLCBpZDEpOwogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiREVMRVRFIC9hcGkvLi4uL2luc3RhbmNlcy97aWR9IC0gRGVsZXRlIHVzZXIiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiREVMRVRFIiwgZGVsZXRlX3VybCwgTlVMTCwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB0b3RhbCsrOwogICAgICAgICAgICAgICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGluc2VydF9yZXNwb25zZTIpOwogICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBJbnNlcnQgc2Vjb25kIHVzZXIiKTsKICAgICAgICAgICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXVxuIik7CiAgICAgICAgICAgICAgICB0b3RhbCsrOwogICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNlY29uZCB1c2VyIGluc2VydGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgICAgIAogICAgICAgICAgICBmcmVlKGlkMSk7CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShpbnNlcnRfcmVzcG9uc2UpOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIEluc2VydCBmaXJzdCB1c2VyIik7CiAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdXG4iKTsKICAgICAgICB0b3RhbCsrOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRmlyc3QgdXNlciBpbnNlcnRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICB9CiAgICB0b3RhbCsrOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIEluc3RhbmNlIEFQSSB0ZXN0czogJWQvJWQgcGFzc2VkIChhdmc6ICVsbGQgbXMpXG4iIFJFU0VULCAKICAgICAgICAgICBwYXNzZWQsIHRvdGFsLCB0b3RhbF90aW1lIC8gKHRvdGFsID4gMCA/IHRvdGFsIDogMSkpOwogICAgCiAgICByZXR1cm4gcGFzc2VkOwp9CgppbnQgcnVuX2h0dHBfY29tbWFuZF90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIENPTU1BTkQgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGludCB0b3RhbCA9IDA7CiAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IDA7CiAgICBsb25nIGxvbmcgZHVyYXRpb247CiAgICAKICAgIGNvbnN0IGNoYXIqIGNvbW1hbmQgPSAie1wiY29tbWFuZFwiOlwibGlzdFwiLFwiYXJndW1lbnRzXCI6W119IjsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9leGVjdXRlIC0gRXhlY3V0ZSBsaXN0IGNvbW1hbmQiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2V4ZWN1dGUiLCBjb21tYW5kLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIENvbW1hbmQgQVBJIHRlc3RzOiAlZC8lZCBwYXNzZWQgKGF2ZzogJWxsZCBtcylcbiIgUkVTRVQsIAogICAgICAgICAgIHBhc3NlZCwgdG90YWwsIHRvdGFsX3RpbWUgLyB0b3RhbCk7CiAgICAKICAgIHJldHVybiBwYXNzZWQ7Cn0KCmludCBydW5faHR0cF9lcnJvcl90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIEVSUk9SIEhBTkRMSU5HIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gSW52YWxpZCBkYXRhYmFzZSBuYW1lIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCAie1wibmFtZVwiOlwiaW52YWxpZC9uYW1lXCJ9IiwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy9ub25leGlzdGVudC9jb2xsZWN0aW9ucyAtIE5vbi1leGlzdGVudCBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCAiL2FwaS9kYXRhYmFzZXMvbm9uZXhpc3RlbnQvY29sbGVjdGlvbnMiLCBOVUxMLCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3Rlc3RkYi9jb2xsZWN0aW9ucy9ub25leGlzdGVudC9pbnN0YW5jZXMgLSBOb24tZXhpc3RlbnQgY29sbGVjdGlvbiIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCAiL2FwaS9kYXRhYmFzZXMvdGVzdGRiL2NvbGxlY3Rpb25zL25vbmV4aXN0ZW50L2luc3RhbmNlcyIsIE5VTEwsICJcInN1Y2Nlc3NcIjpmYWxzZSIsIDEsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gSW52YWxpZCBKU09OIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCAiaW52YWxpZCBqc29uIiwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBBVENIIiwgIi9hcGkvZGF0YWJhc2VzL3Rlc3RkYiIsIE5VTEwsIE5VTEwpOwogICAgaWYgKHJlc3BvbnNlICYmIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9PSA0MDUpIHsKICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQQVRDSCAvYXBpL2RhdGFiYXNlcy90ZXN0ZGIgLSBNZXRob2Qgbm90IGFsbG93ZWQiKTsKICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXVxuIik7CiAgICAgICAgcGFzc2VkKys7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIE1ldGhvZCBub3QgYWxsb3dlZCBoYW5kbGVkIGNvcnJlY3RseVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQQVRDSCAvYXBpL2RhdGFiYXNlcy90ZXN0ZGIgLSBNZXRob2Qgbm90IGFsbG93ZWQiKTsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl1cbiIpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRXhwZWN0ZWQgNDA1IE1ldGhvZCBOb3QgQWxsb3dlZCwgZ290OiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UgPyByZXNwb25zZS0+c3RhdHVzX2NvZGUgOiAwKTsKICAgICAgICB9CiAgICB9CiAgICB0b3RhbCsrOwogICAgaHR0cF9yZXNwb25zZV9mcmVlKHJlc3BvbnNlKTsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBFcnJvciBoYW5kbGluZyB0ZXN0czogJWQvJWQgcGFzc2VkIChhdmc6ICVsbGQgbXMpXG4iIFJFU0VULCAKICAgICAgICAgICBwYXNzZWQsIHRvdGFsLCB0b3RhbF90aW1lIC8gKHRvdGFsID4gMCA/IHRvdGFsIDogMSkpOwogICAgCiAgICByZXR1cm4gcGFzc2VkOwp9Cgp2b2lkIHJ1bl9zZWN1cml0eV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIlNFQ1VSSVRZIFRFU1RTIC0gUGF0aCB2YWxpZGF0aW9uIGFuZCBpbmplY3Rpb24gcHJldmVudGlvbiIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBzZWN1cml0eSB0ZXN0cyB3aXRoIHZlcmJvc2UgbG9nZ2luZ1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIFRlc3RDYXNlIHNlY3VyaXR5X3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiUHJldmVudCBkaXJlY3RvcnkgdHJhdmVyc2FsIGluIGRhdGFiYXNlIG5hbWVzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSAnLi4vZXZpbCcgMj4mMSB8IGdyZXAgLWkgJ2ludmFsaWRcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAidGVzdCAhIC1kICcvdG1wL3N5ZGJfdGVzdC8uLi9ldmlsJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlByZXZlbnQgZGlyZWN0b3J5IHRyYXZlcnNhbCBpbiBjb2xsZWN0aW9uIG5hbWVzIiwgCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiICcuLi8uLi9ldmlsJyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nIDI+JjEgfCBncmVwIC1pICdpbnZhbGlkXFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgInRlc3QgISAtZCAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiLy4uLy4uL2V2aWwnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUmVqZWN0IGludmFsaWQgZGF0YWJhc2UgbmFtZXMgd2l0aCBzcGVjaWFsIGNoYXJzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSAnaW52YWxpZC9uYW1lJyAyPiYxIHwgZ3JlcCAtaSAnaW52YWxpZFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJ0ZXN0ICEgLWQgJy90bXAvc3lkYl90ZXN0L2ludmFsaWQvbmFtZSciLCAKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCBzZWN1cml0eV9jb3VudCA9IHNpemVvZihzZWN1cml0eV90ZXN0cykgLyBzaXplb2Yoc2VjdXJpdHlfdGVzdHNbMF0pOwogICAgaW50IHNlY3VyaXR5X3Bhc3NlZCA9IDA7CiAgICAKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgc2VjdXJpdHlfY291bnQ7IGkrKykgewogICAgICAgIGNoYXIgZmluYWxfY29tbWFuZFsxMDI0XTsKICAgICAgICBjaGFyIGZpbmFsX3ZlcmlmaWNhdGlvblsxMDI0XTsKICAgICAgICAKICAgICAgICBzbnByaW50ZihmaW5hbF9jb21tYW5kLCBzaXplb2YoZmluYWxfY29tbWFuZCksIHNlY3VyaXR5X3Rlc3RzW2ldLmNvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICBzbnByaW50ZihmaW5hbF92ZXJpZmljYXRpb24sIHNpemVvZihmaW5hbF92ZXJpZmljYXRpb24pLCBzZWN1cml0eV90ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIAogICAgICAgIHN0cmNweShzZWN1cml0eV90ZXN0c1tpXS5jb21tYW5kLCBmaW5hbF9jb21tYW5kKTsKICAgICAgICBzdHJjcHkoc2VjdXJpdHlfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGZpbmFsX3ZlcmlmaWNhdGlvbik7CiAgICAgICAgCiAgICAgICAgaWYgKGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbigmc2VjdXJpdHlfdGVzdHNbaV0pKSB7CiAgICAgICAgICAgIHNlY3VyaXR5X3Bhc3NlZCsrOwogICAgICAgIH0KICAgIH0KICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBTZWN1cml0eSB0ZXN0czogJWQvJWQgcGFzc2VkXG4iIFJFU0VULCBzZWN1cml0eV9wYXNzZWQsIHNlY3VyaXR5X2NvdW50KTsKfQoKdm9pZCBydW5fZGF0YV9pbnRlZ3JpdHlfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJEQVRBIElOVEVHUklUWSBURVNUUyAtIENSQyB2YWxpZGF0aW9uIGFuZCBmaWxlIHN0cnVjdHVyZSIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBkYXRhIGludGVncml0eSB0ZXN0c1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIGNoYXIgY3JlYXRlX2RiX2NtZFsyNTZdOwogICAgY2hhciBjcmVhdGVfY29sbGVjdGlvbl9jbWRbMjU2XTsKICAgIGNoYXIgaW5zZXJ0X2NtZFsyNTZdOwogICAgCiAgICBzbnByaW50ZihjcmVhdGVfZGJfY21kLCBzaXplb2YoY3JlYXRlX2RiX2NtZCksICIlcyBjcmVhdGUgaW50ZWdyaXR5ZGIgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIHNucHJpbnRmKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCwgc2l6ZW9mKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCksICIlcyBjcmVhdGUgaW50ZWdyaXR5ZGIgZGF0YSAtLXNjaGVtYSAtLXZhbHVlLXN0cmluZy1yZXEgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIHNucHJpbnRmKGluc2VydF9jbWQsIHNpemVvZihpbnNlcnRfY21kKSwgIiVzIGNyZWF0ZSBpbnRlZ3JpdHlkYiBkYXRhIC0taW5zZXJ0LW9uZSAtLXZhbHVlLVwidGVzdF9kYXRhXzFcIiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgCiAgICBzeXN0ZW0oY3JlYXRlX2RiX2NtZCk7CiAgICBzeXN0ZW0oY3JlYXRlX2NvbGxlY3Rpb25fY21kKTsKICAgIHN5c3RlbShpbnNlcnRfY21kKTsKICAgIAogICAgVGVzdENhc2UgaW50ZWdyaXR5X3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiRGF0YSBmaWxlIGhhcyB2YWxpZCBoZWFkZXIgc3RydWN0dXJlIiwKICAgICAgICAgICAgImVjaG8gJ0hlYWRlciBjaGVjaycgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiaGV4ZHVtcCAtQyAvdG1wL3N5ZGJfdGVzdC9pbnRlZ3JpdHlkYi9kYXRhL2RhdGEuc3lkYiB8IGhlYWQgLTIgfCBncmVwIC1xICdTWURCJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkRhdGEgZmlsZSBncm93cyB3aXRoIGluc2VydHMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIGludGVncml0eWRiIGRhdGEgLS1pbnNlcnQtb25lIC0tdmFsdWUtXCJ0ZXN0X2RhdGFfMlwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAibHMgLWwgL3RtcC9zeWRiX3Rlc3QvaW50ZWdyaXR5ZGIvZGF0YS9kYXRhLnN5ZGIgfCBhd2sgJ3twcmludCAkNX0nIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCBpbnRlZ3JpdHlfY291bnQgPSBzaXplb2YoaW50ZWdyaXR5X3Rlc3RzKSAvIHNpemVvZihpbnRlZ3JpdHlfdGVzdHNbMF0pOwogICAgaW50IGludGVncml0eV9wYXNzZWQgPSAwOwogICAgCiAgICBmb3IgKGludCBpID0gMDsgaSA8IGludGVncml0eV9jb3VudDsgaSsrKSB7CiAgICAgICAgaWYgKHN0cnN0cihpbnRlZ3JpdHlfdGVzdHNbaV0uY29tbWFuZCwgIiVzIikgIT0gTlVMTCkgewogICAgICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgICAgIHNucHJpbnRmKGZpbmFsX2NvbW1hbmQsIHNpemVvZihmaW5hbF9jb21tYW5kKSwgaW50ZWdyaXR5X3Rlc3RzW2ldLmNvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAgICAgc3RyY3B5KGludGVncml0eV90ZXN0c1tpXS5jb21tYW5kLCBmaW5hbF9jb21tYW5kKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgaWYgKGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbigmaW50ZWdyaXR5X3Rlc3RzW2ldKSkgewogICAgICAgICAgICBpbnRlZ3JpdHlfcGFzc2VkKys7CiAgICAgICAgfQogICAgfQogICAgCiAgICBwcmludGYoWUVMTE9XICIgIERhdGEgaW50ZWdyaXR5IHRlc3RzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIGludGVncml0eV9wYXNzZWQsIGludGVncml0eV9jb3VudCk7Cn0KCnZvaWQgcnVuX3BlcmZvcm1hbmNlX3Rlc3QoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJQRVJGT1JNQU5DRSBBTkQgU0NBTEFCSUxJVFkgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgcGVyZm9ybWFuY2UgdGVzdHNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBwcmludGYoIlNldHRpbmcgdXAgcGVyZm9ybWFuY2UgZGF0YWJhc2UuLi5cbiIpOwogICAgY2hhciBjcmVhdGVfZGJfY21kWzI1Nl07CiAgICBjaGFyIGNyZWF0ZV9jb2xsZWN0aW9uX2NtZFsyNTZdOwogICAgCiAgICBzbnByaW50ZihjcmVhdGVfZGJfY21kLCBzaXplb2YoY3JlYXRlX2RiX2NtZCksICIlcyBjcmVhdGUgcGVyZmRiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICBzbnByaW50ZihjcmVhdGVfY29sbGVjdGlvbl9jbWQsIHNpemVvZihjcmVhdGVfY29sbGVjdGlvbl9jbWQpLCAiJXMgY3JlYXRlIHBlcmZkYiB1c2VycyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nLXJlcSAtLWFnZS1pbnQgLS1lbWFpbC1zdHJpbmcgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIAogICAgc3lzdGVtKGNyZWF0ZV9kYl9jbWQpOwogICAgc3lzdGVtKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCk7CiAgICAKICAgIGNoYXIgc2luZ2xlX2luc2VydF9jbWRbMjU2XTsKICAgIHNucHJpbnRmKHNpbmdsZV9pbnNlcnRfY21kLCBzaXplb2Yoc2luZ2xlX2luc2VydF9jbWQpLCAiJXMgY3JlYXRlIHBlcmZkYiB1c2VycyAtLWluc2VydC1vbmUgLS1uYW1lLVwiU2luZ2xlVXNlclwiIC0tYWdlLTMwIC0tZW1haWwtXCJzaW5nbGVAdGVzdC5jb21cIiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgCiAgICBsb25nIGxvbmcgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIHN5c3RlbShzaW5nbGVfaW5zZXJ0X2NtZCk7CiAgICBsb25nIGxvbmcgc2luZ2xlX2luc2VydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNpbmdsZSBpbnNlcnQgdGltZTogJWxsZCBtc1xuIiBSRVNFVCwgc2luZ2xlX2luc2VydF90aW1lKTsKICAgIH0KICAgIAogICAgaW50IGJhdGNoX3NpemUgPSA1MDsKICAgIHByaW50ZigiSW5zZXJ0aW5nICVkIHJlY29yZHMgZm9yIGJhdGNoIHBlcmZvcm1hbmNlLi4uXG4iLCBiYXRjaF9zaXplKTsKICAgIAogICAgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIGludCBzdWNjZXNzX2NvdW50ID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXRjaF9zaXplOyBpKyspIHsKICAgICAgICBjaGFyIGNvbW1hbmRbNTEyXTsKICAgICAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksCiAgICAgICAgICAgICAgICAgIiVzIGNyZWF0ZSBwZXJmZGIgdXNlcnMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIlVzZXIlZFwiIC0tYWdlLSVkIC0tZW1haWwtXCJ1c2VyJWRAdGVzdC5jb21cIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgICAgICBjbGlfY29tbWFuZCwgaSwgMjAgKyAoaSAlIDQwKSwgaSk7CiAgICAgICAgCiAgICAgICAgaWYgKHN5c3RlbShjb21tYW5kKSA9PSAwKSB7CiAgICAgICAgICAgIHN1Y2Nlc3NfY291bnQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGxvbmcgbG9uZyBiYXRjaF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgIGRvdWJsZSBhdmdfYmF0Y2hfdGltZSA9IChkb3VibGUpYmF0Y2hfdGltZSAvIGJhdGNoX3NpemU7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBCYXRjaCBpbnNlcnQ6ICVkLyVkIHN1Y2Nlc3NmdWwsIHRvdGFsIHRpbWU6ICVsbGQgbXMsIGF2ZzogJS4yZiBtc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgIHN1Y2Nlc3NfY291bnQsIGJhdGNoX3NpemUsIGJhdGNoX3RpbWUsIGF2Z19iYXRjaF90aW1lKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCJUZXN0aW5nIHF1ZXJ5IHBlcmZvcm1hbmNlLi4uXG4iKTsKICAgIGNoYXIgcXVlcnlfY21kWzI1Nl07CiAgICBzbnByaW50ZihxdWVyeV9jbWQsIHNpemVvZihxdWVyeV9jbWQpLCAiJXMgZmluZCBwZXJmZGIgdXNlcnMgLS13aGVyZSBcImFnZToyNVwiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICAKICAgIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICBzeXN0ZW0ocXVlcnlfY21kKTsKICAgIGxvbmcgbG9uZyBxdWVyeV90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFF1ZXJ5IHRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIHF1ZXJ5X3RpbWUpOwogICAgfQogICAgCiAgICBpbnQgYWN0dWFsX2NvdW50ID0gY291bnRfaW5zdGFuY2VzX2luX2NvbGxlY3Rpb24oInBlcmZkYiIsICJ1c2VycyIpOwogICAgCiAgICBwcmludGYoIlxuUGVyZm9ybWFuY2UgUmVzdWx0czpcbiIpOwogICAgcHJpbnRmKCIgIFNpbmdsZSBpbnNlcnQ6ICIgQ1lBTiAiJWxsZCBtcyIgUkVTRVQgIlxuIiwgc2luZ2xlX2luc2VydF90aW1lKTsKICAgIHByaW50ZigiICBCYXRjaCBpbnNlcnQgKCVkIHJlY29yZHMpOiAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICIgKGF2ZzogIiBDWUFOICIlLjJmIG1zIiBSRVNFVCAiKVxuIiwgCiAgICAgICAgICAgYmF0Y2hfc2l6ZSwgYmF0Y2hfdGltZSwgYXZnX2JhdGNoX3RpbWUpOwogICAgcHJpbnRmKCIgIFF1ZXJ5IHRpbWU6ICIgQ1lBTiAiJWxsZCBtcyIgUkVTRVQgIlxuIiwgcXVlcnlfdGltZSk7CiAgICBwcmludGYoIiAgSW5zZXJ0IHN1Y2Nlc3MgcmF0ZTogIiBHUkVFTiAiJWQvJWQiIFJFU0VUICJcbiIsIHN1Y2Nlc3NfY291bnQsIGJhdGNoX3NpemUpOwogICAgcHJpbnRmKCIgIFJlY29yZCBjb3VudCB2ZXJpZmljYXRpb246ICIgR1JFRU4gIiVkIiBSRVNFVCAiIHJlY29yZHMgaW4gY29sbGVjdGlvblxuIiwgYWN0dWFsX2NvdW50KTsKICAgIAogICAgaW50IHBlcmZvcm1hbmNlX29rID0gKHNpbmdsZV9pbnNlcnRfdGltZSA8IDEwMDApICYmIChhdmdfYmF0Y2hfdGltZSA8IDUwMCkgJiYgKHF1ZXJ5X3RpbWUgPCA1MDApOwogICAgaWYgKHBlcmZvcm1hbmNlX29rKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIOKckyBQZXJmb3JtYW5jZSB3aXRoaW4gYWNjZXB0YWJsZSBsaW1pdHNcbiIgUkVTRVQpOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIOKaoCBQZXJmb3JtYW5jZSBtYXkgbmVlZCBvcHRpbWl6YXRpb25cbiIgUkVTRVQpOwogICAgfQp9Cgp2b2lkIHJ1bl9lZGdlX2Nhc2VfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJFREdFIENBU0UgQU5EIEVSUk9SIEhBTkRMSU5HIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFN0YXJ0aW5nIGVkZ2UgY2FzZSB0ZXN0c1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIFRlc3RDYXNlIGVkZ2VfdGVzdHNbXSA9IHsKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgZHVwbGljYXRlIGRhdGFiYXNlIGNyZWF0aW9uIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgMj4mMSB8IGdyZXAgLWkgJ2V4aXN0XFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgIiVzIGxpc3QgfCBncmVwIC1jIHRlc3RkYiIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBkdXBsaWNhdGUgY29sbGVjdGlvbiBjcmVhdGlvbiIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHVzZXJzIC0tc2NoZW1hIC0tbmFtZS1zdHJpbmcgMj4mMSB8IGdyZXAgLWkgJ2V4aXN0XFx8ZXJyb3InID4gL2Rldi9udWxsIiwgCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB8IGdyZXAgLWMgdXNlcnMiLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgbWlzc2luZyBkYXRhYmFzZSBxdWVyaWVzIiwKICAgICAgICAgICAgIiVzIGZpbmQgbm9uZXhpc3RlbnRkYiB1c2VycyAtLXdoZXJlIFwibmFtZTp0ZXN0XCIgMj4mMSB8IGdyZXAgLWkgJ2V4aXN0XFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgImVjaG8gJ0Vycm9yIGhhbmRsZWQnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIG1pc3NpbmcgY29sbGVjdGlvbiBxdWVyaWVzIiwgCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBub25leGlzdGVudCAtLXdoZXJlIFwibmFtZTp0ZXN0XCIgMj4mMSB8IGdyZXAgLWkgJ2V4aXN0XFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgImVjaG8gJ0Vycm9yIGhhbmRsZWQnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIG1hbGZvcm1lZCBxdWVyaWVzIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHVzZXJzIC0td2hlcmUgXCJpbnZhbGlkLXF1ZXJ5LWZvcm1hdFwiIDI+JjEgfCBncmVwIC1pICdlcnJvclxcfGludmFsaWQnID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgImVjaG8gJ0Vycm9yIGhhbmRsZWQnIiwgCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBzY2hlbWEgdmFsaWRhdGlvbiBmYWlsdXJlcyIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLWludmFsaWQtZmllbGQtXCJ2YWx1ZVwiIDI+JjEgfCBncmVwIC1pICdlcnJvclxcfHZhbGlkJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdWYWxpZGF0aW9uIHdvcmtlZCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgaW50IGVkZ2VfY291bnQgPSBzaXplb2YoZWRnZV90ZXN0cykgLyBzaXplb2YoZWRnZV90ZXN0c1swXSk7CiAgICBpbnQgZWRnZV9wYXNzZWQgPSAwOwogICAgCiAgICBmb3IgKGludCBpID0gMDsgaSA8IGVkZ2VfY291bnQ7IGkrKykgewogICAgICAgIGNoYXIgZmluYWxfY29tbWFuZFsxMDI0XTsKICAgICAgICBjaGFyIGZpbmFsX3ZlcmlmaWNhdGlvblsxMDI0XTsKICAgICAgICAKICAgICAgICBzbnByaW50ZihmaW5hbF9jb21tYW5kLCBzaXplb2YoZmluYWxfY29tbWFuZCksIGVkZ2VfdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIHNucHJpbnRmKGZpbmFsX3ZlcmlmaWNhdGlvbiwgc2l6ZW9mKGZpbmFsX3ZlcmlmaWNhdGlvbiksIGVkZ2VfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAKICAgICAgICBzdHJjcHkoZWRnZV90ZXN0c1tpXS5jb21tYW5kLCBmaW5hbF9jb21tYW5kKTsKICAgICAgICBzdHJjcHkoZWRnZV90ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgZmluYWxfdmVyaWZpY2F0aW9uKTsKICAgICAgICAKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZlZGdlX3Rlc3RzW2ldKSkgewogICAgICAgICAgICBlZGdlX3Bhc3NlZCsrOwogICAgICAgIH0KICAgIH0KICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBFZGdlIGNhc2UgdGVzdHM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgZWRnZV9wYXNzZWQsIGVkZ2VfY291bnQpOwp9Cgp2b2lkIHJ1bl9jb21wcmVoZW5zaXZlX3ZlcmlmaWNhdGlvbigpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkNPTVBSRUhFTlNJVkUgU1RSVUNUVVJFIFZFUklGSUNBVElPTiIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBjb21wcmVoZW5zaXZlIHN0cnVjdHVyZSB2ZXJpZmljYXRpb25cbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBpbnQgdmVyaWZpY2F0aW9uX3Bhc3NlZCA9IDA7CiAgICBpbnQgdmVyaWZpY2F0aW9uX3RvdGFsID0gMDsKICAgIAogICAgcHJpbnRmKCJWZXJpZnlpbmcgdGVzdGRiIHN0cnVjdHVyZS4uLlxuIik7CiAgICBpZiAodmVyaWZ5X2RhdGFiYXNlX3N0cnVjdHVyZSgidGVzdGRiIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBpZiAodmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKCJ0ZXN0ZGIiLCAidXNlcnMiKSkgdmVyaWZpY2F0aW9uX3Bhc3NlZCsrOwogICAgdmVyaWZpY2F0aW9uX3RvdGFsKys7CiAgICAKICAgIGlmICh2ZXJpZnlfY29sbGVjdGlvbl9zdHJ1Y3R1cmUoInRlc3RkYiIsICJwcm9kdWN0cyIpKSB2ZXJpZmljYXRpb25fcGFzc2VkKys7CiAgICB2ZXJpZmljYXRpb25fdG90YWwrKzsKICAgIAogICAgaWYgKHZlcmlmeV9zY2hlbWFfY29udGVudCgidGVzdGRiIiwgInVzZXJzIiwgIm5hbWUiKSkgdmVyaWZpY2F0aW9uX3Bhc3NlZCsrOwogICAgdmVyaWZpY2F0aW9uX3RvdGFsKys7CiAgICAKICAgIHByaW50ZigiVmVyaWZ5aW5nIHRlc3RkYjIgc3RydWN0dXJlLi4uXG4iKTsKICAgIGlmICh2ZXJpZnlfZGF0YWJhc2Vfc3RydWN0dXJlKCJ0ZXN0ZGIyIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIFN0cnVjdHVyZSB2ZXJpZmljYXRpb246ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgdmVyaWZpY2F0aW9uX3Bhc3NlZCwgdmVyaWZpY2F0aW9uX3RvdGFsKTsKfQoKaW50IHJ1bl9jbGlfdGVzdHMoKSB7CiAgICBwcmludGYoQ1lBTiAiU1lEQiBDTEkgQ09NUFJFSEVOU0lWRSBURVNUIFNVSVRFXG4iIFJFU0VUKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgcHJpbnRmKCJVc2luZyBjb21tYW5kOiAiIFlFTExPVyAiJXMiIFJFU0VUICJcbiIsIGNsaV9jb21tYW5kKTsKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoIlZlcmJvc2UgbW9kZTogIiBZRUxMT1cgIkVOQUJMRUQiIFJFU0VUICIgLSBEZXRhaWxlZCBsb2dnaW5nIGZvciBmYWlsdXJlc1xuIik7CiAgICB9CiAgICBwcmludGYoIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDbGVhbmluZyB1cCBwcmV2aW91cyB0ZXN0IGRhdGEuLi5cbiIgUkVTRVQpOwogICAgfQogICAgc3lzdGVtKCJybSAtcmYgL3RtcC9zeWRiX3Rlc3QgPiAvZGV2L251bGwgMj4mMSIpOwogICAgCiAgICBUZXN0Q2FzZSB0ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIkNyZWF0ZSBkYXRhYmFzZSAndGVzdGRiJyBhbmQgdmVyaWZ5IHN0cnVjdHVyZSIsIAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgInRlc3QgLWQgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYiciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgc2Vjb25kIGRhdGFiYXNlICd0ZXN0ZGIyJyBhbmQgdmVyaWZ5IiwgCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiMiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgInRlc3QgLWQgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYjInIiwgCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkxpc3QgZGF0YWJhc2VzIGFuZCB2ZXJpZnkgYm90aCBleGlzdCIsCiAgICAgICAgICAgICIlcyBsaXN0ID4gL2Rldi9udWxsIDI+JjEiLCAKICAgICAgICAgICAgIiVzIGxpc3QgfCBncmVwIC1jICd0ZXN0ZGJcXHx0ZXN0ZGIyJyIsCiAgICAgICAgICAgICIyIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgJ3VzZXJzJyBjb2xsZWN0aW9uIHdpdGggc2NoZW1hIGFuZCB2ZXJpZnkgZmlsZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nLXJlcSAtLWFnZS1pbnQgLS1lbWFpbC1zdHJpbmcgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1mICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvdXNlcnMvc2NoZW1hLnR4dCcgJiYgdGVzdCAtZiAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL3VzZXJzL2RhdGEuc3lkYiciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgJ3Byb2R1Y3RzJyBjb2xsZWN0aW9uIGFuZCB2ZXJpZnkgc3RydWN0dXJlIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgcHJvZHVjdHMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZy1yZXEgLS1wcmljZS1mbG9hdCA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgInRlc3QgLWYgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYi9wcm9kdWN0cy9zY2hlbWEudHh0JyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlZpZXcgdXNlcnMgc2NoZW1hIGFuZCB2ZXJpZnkgb3V0cHV0IGZvcm1hdCIsCiAgICAgICAgICAgICIlcyBzY2hlbWEgdGVzdGRiIHVzZXJzID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgc2NoZW1hIHRlc3RkYiB1c2VycyB8IGdyZXAgLXEgJ0ZpZWxkLipUeXBlJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkluc2VydCB1c2VyIHJlY29yZCBhbmQgdmVyaWZ5IGJ5IGNvdW50aW5nIGluc3RhbmNlcyIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJKb2huIERvZVwiIC0tYWdlLTMwIC0tZW1haWwtXCJqb2huQHRlc3QuY29tXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGdyZXAgLWMgJ1wiX2lkXCInIiwKICAgICAgICAgICAgIjEiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkluc2VydCBzZWNvbmQgdXNlciBhbmQgdmVyaWZ5IHRvdGFsIGNvdW50IiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgdXNlcnMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIkphbmUgU21pdGhcIiAtLWFnZS0yNSAtLWVtYWlsLVwiamFuZUB0ZXN0LmNvbVwiID4gL2Rldi9udWxsIDI+JjEiLCAKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgZ3JlcCAtYyAnXCJfaWRcIiciLAogICAgICAgICAgICAiMiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSW5zZXJ0IHByb2R1Y3QgcmVjb3JkIGFuZCB2ZXJpZnkgY3JlYXRpb24iLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiBwcm9kdWN0cyAtLWluc2VydC1vbmUgLS1uYW1lLVwiVGVzdCBQcm9kdWN0XCIgLS1wcmljZS0xOS45OSA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHByb2R1Y3RzIHwgZ3JlcCAtYyAnVGVzdCBQcm9kdWN0JyIsCiAgICAgICAgICAgICIxIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJRdWVyeSB1c2VycyBieSBhZ2UgYW5kIHZlcmlmeSBleGFjdCBtYXRjaCIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiYWdlOjMwXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiYWdlOjMwXCIgfCBncmVwIC1jICdKb2huIERvZSciLAogICAgICAgICAgICAiMSIsIAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlF1ZXJ5IHByb2R1Y3RzIGJ5IG5hbWUgYW5kIHZlcmlmeSByZXN1bHQiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgcHJvZHVjdHMgLS13aGVyZSBcIm5hbWU6VGVzdCBQcm9kdWN0XCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBwcm9kdWN0cyAtLXdoZXJlIFwibmFtZTpUZXN0IFByb2R1Y3RcIiB8IGdyZXAgLWMgJ1Rlc3QgUHJvZHVjdCciLAogICAgICAgICAgICAiMSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUXVlcnkgd2l0aCBub24tZXhpc3RlbnQgY29uZGl0aW9uIHJldHVybnMgZW1wdHkiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImFnZTo5OTlcIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6OTk5XCIgfCB3YyAtbCIsCiAgICAgICAgICAgICIwIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJMaXN0IGNvbGxlY3Rpb25zIGluIHRlc3RkYiBhbmQgdmVyaWZ5IGNvdW50IiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgfCBncmVwIC1jICd1c2Vyc1xcfHByb2R1Y3RzJyIsIAogICAgICAgICAgICAiMiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiTGlzdCB1c2VycyBhbmQgdmVyaWZ5IHJlY29yZCBjb3VudCIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgZ3JlcCAtYyAnXCJfaWRcIiciLAogICAgICAgICAgICAiMiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiVmVyaWZ5IFVVSUQgZm9ybWF0IGluIGluc2VydGVkIHJlY29yZHMiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgfCBoZWFkIC0xID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgfCBoZWFkIC0xIHwgZ3JlcCAtRW8gJ1wiW2EtZjAtOV17OH0tW2EtZjAtOV17NH0tW2EtZjAtOV17NH0tW2EtZjAtOV17NH0tW2EtZjAtOV17MTJ9XCInIHwgd2MgLWwiLAogICAgICAgICAgICAiMSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCB0b3RhbF90ZXN0cyA9IHNpemVvZih0ZXN0cykgLyBzaXplb2YodGVzdHNbMF0pOwogICAgaW50IHBhc3NlZF90ZXN0cyA9IDA7CiAgICBsb25nIGxvbmcgdG90YWxfZHVyYXRpb24gPSAwOwogICAgCiAgICBmb3IgKGludCBpID0gMDsgaSA8IHRvdGFsX3Rlc3RzOyBpKyspIHsKICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgY2hhciBmaW5hbF92ZXJpZmljYXRpb25bMTAyNF07CiAgICAgICAgCiAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCB0ZXN0c1tpXS5jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgc25wcmludGYoZmluYWxfdmVyaWZpY2F0aW9uLCBzaXplb2YoZmluYWxfdmVyaWZpY2F0aW9uKSwgdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAKICAgICAgICBzdHJjcHkodGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgc3RyY3B5KHRlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBmaW5hbF92ZXJpZmljYXRpb24pOwogICAgfQogICAgCiAgICBmb3IgKGludCBpID0gMDsgaSA8IHRvdGFsX3Rlc3RzOyBpKyspIHsKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZ0ZXN0c1tpXSkpIHsKICAgICAgICAgICAgcGFzc2VkX3Rlc3RzKys7CiAgICAgICAgfQogICAgICAgIHRvdGFsX2R1cmF0aW9uICs9IHRlc3RzW2ldLmR1cmF0aW9uX21zOwogICAgfQogICAgCiAgICByZXR1cm4gcGFzc2VkX3Rlc3RzOwp9Cgp2b2lkIHByaW50X2h0dHBfcmVzdWx0cyhpbnQgZGJfcGFzc2VkLCBpbnQgZGJfdG90YWwsIGludCBjb2xsX3Bhc3NlZCwgaW50IGNvbGxfdG90YWwsIAogICAgICAgICAgICAgICAgICAgICAgIGludCBpbnN0X3Bhc3NlZCwgaW50IGluc3RfdG90YWwsIGludCBjbWRfcGFzc2VkLCBpbnQgY21kX3RvdGFsLAogICAgICAgICAgICAgICAgICAgICAgIGludCBlcnJfcGFzc2VkLCBpbnQgZXJyX3RvdGFsLCBsb25nIGxvbmcgdG90YWxfdGltZSkgewogICAgcHJpbnRmKCJcbiIpOwogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIik7CiAgICBwcmludGYoQkxVRSAiICAgICAgICAgICBIVFRQIEFQSSBURVNUIFJFU1VMVFMgICAgICAgICAgICIgUkVTRVQgIlxuIik7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIAogICAgaW50IHRvdGFsX3Bhc3NlZCA9IGRiX3Bhc3NlZCArIGNvbGxfcGFzc2VkICsgaW5zdF9wYXNzZWQgKyBjbWRfcGFzc2VkICsgZXJyX3Bhc3NlZDsKICAgIGludCB0b3RhbF90ZXN0cyA9IGRiX3RvdGFsICsgY29sbF90b3RhbCArIGluc3RfdG90YWwgKyBjbWRfdG90YWwgKyBlcnJfdG90YWw7CiAgICBkb3VibGUgcGVyY2VudGFnZSA9IChkb3VibGUpdG90YWxfcGFzc2VkIC8gdG90YWxfdGVzdHMgKiAxMDA7CiAgICAKICAgIGNoYXIgKmNvbG9yID0gKHBlcmNlbnRhZ2UgPj0gOTApID8gR1JFRU4gOiAocGVyY2VudGFnZSA+PSA3MCkgPyBZRUxMT1cgOiBSRUQ7CiAgICBjaGFyICpzdGF0dXMgPSAocGVyY2VudGFnZSA+PSA5MCkgPyAiRVhDRUxMRU5UIiA6IChwZXJjZW50YWdlID49IDcwKSA/ICJHT09EIiA6ICJORUVEUyBJTVBST1ZFTUVOVCI7CiAgICAKICAgIHByaW50ZigiICBEYXRhYmFzZSBUZXN0czogICAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGRiX3Bhc3NlZCA9PSBkYl90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgZGJfcGFzc2VkLCBkYl90b3RhbCk7CiAgICBwcmludGYoIiAgQ29sbGVjdGlvbiBUZXN0czogICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChjb2xsX3Bhc3NlZCA9PSBjb2xsX3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBjb2xsX3Bhc3NlZCwgY29sbF90b3RhbCk7CiAgICBwcmludGYoIiAgSW5zdGFuY2UgVGVzdHM6ICAgICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChpbnN0X3Bhc3NlZCA9PSBpbnN0X3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBpbnN0X3Bhc3NlZCwgaW5zdF90b3RhbCk7CiAgICBwcmludGYoIiAgQ29tbWFuZCBUZXN0czogICAgICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChjbWRfcGFzc2VkID09IGNtZF90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgY21kX3Bhc3NlZCwgY21kX3RvdGFsKTsKICAgIHByaW50ZigiICBFcnJvciBUZXN0czogICAgICAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGVycl9wYXNzZWQgPT0gZXJyX3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBlcnJfcGFzc2VkLCBlcnJfdG90YWwpOwogICAgcHJpbnRmKCIgIFRvdGFsIFRpbWU6ICAgICAgICAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICJcbiIsIHRvdGFsX3RpbWUpOwogICAgcHJpbnRmKCIgIE92ZXJhbGw6ICAgICAgICAgICAlcyVkLyVkICglLjFmJSUpIC0gJXMiIFJFU0VUICJcbiIsIAogICAgICAgICAgIGNvbG9yLCB0b3RhbF9wYXNzZWQsIHRvdGFsX3Rlc3RzLCBwZXJjZW50YWdlLCBzdGF0dXMpOwogICAgCiAgICBwcmludGYoIlxuICBEZXRhaWxlZCBCcmVha2Rvd246XG4iKTsKICAgIAogICAgaW50IGJhcl93aWR0aCA9IDIwOwogICAgCiAgICBwcmludGYoIiAgRGF0YWJhc2VzOiAgICAgICAgWyIpOwogICAgaW50IGRiX2ZpbGxlZCA9IChpbnQpKChkb3VibGUpZGJfcGFzc2VkIC8gZGJfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgZGJfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSlkYl9wYXNzZWQgLyBkYl90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBDb2xsZWN0aW9uczogICAgICBbIik7CiAgICBpbnQgY29sbF9maWxsZWQgPSAoaW50KSgoZG91YmxlKWNvbGxfcGFzc2VkIC8gY29sbF90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBjb2xsX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpY29sbF9wYXNzZWQgLyBjb2xsX3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIEluc3RhbmNlczogICAgICAgIFsiKTsKICAgIGludCBpbnN0X2ZpbGxlZCA9IChpbnQpKChkb3VibGUpaW5zdF9wYXNzZWQgLyBpbnN0X3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGluc3RfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSlpbnN0X3Bhc3NlZCAvIGluc3RfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgQ29tbWFuZHM6ICAgICAgICAgWyIpOwogICAgaW50IGNtZF9maWxsZWQgPSAoaW50KSgoZG91YmxlKWNtZF9wYXNzZWQgLyBjbWRfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgY21kX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpY21kX3Bhc3NlZCAvIGNtZF90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBFcnJvciBIYW5kbGluZzogICBbIik7CiAgICBpbnQgZXJyX2ZpbGxlZCA9IChpbnQpKChkb3VibGUpZXJyX3Bhc3NlZCAvIGVycl90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBlcnJfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSllcnJfcGFzc2VkIC8gZXJyX3RvdGFsICogMTAwKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSAmJiB0b3RhbF9wYXNzZWQgPCB0b3RhbF90ZXN0cykgewogICAgICAgIHByaW50ZigiXG4iIFlFTExPVyAiICBbVkVSQk9TRV0gRmFpbGVkIHRlc3RzIGRldGFpbGVkIGluIGxvZ3MgYWJvdmVcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG5cbiIpOwp9Cgp2b2lkIHByaW50X2NsaV9yZXN1bHRzKGludCBjbGlfcGFzc2VkLCBpbnQgY2xpX3RvdGFsLCBsb25nIGxvbmcgdG90YWxfdGltZSwgaW50IHNlY3VyaXR5X3Bhc3NlZCwgaW50IHNlY3VyaXR5X3RvdGFsLAogICAgICAgICAgICAgICAgICAgICAgaW50IGludGVncml0eV9wYXNzZWQsIGludCBpbnRlZ3JpdHlfdG90YWwsIGludCBlZGdlX3Bhc3NlZCwgaW50IGVkZ2VfdG90YWwpIHsKICAgIHByaW50ZigiXG4iKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgcHJpbnRmKEJMVUUgIiAgICAgICAgICAgQ09NUFJFSEVOU0lWRSBURVNUIFJFU1VMVFMgICAgICAgICAiIFJFU0VUICJcbiIpOwogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIik7CiAgICAKICAgIGRvdWJsZSBjbGlfcGVyY2VudGFnZSA9IChkb3VibGUpY2xpX3Bhc3NlZCAvIGNsaV90b3RhbCAqIDEwMDsKICAgIGNoYXIgKmNsaV9jb2xvciA9IChjbGlfcGVyY2VudGFnZSA+PSA5MCkgPyBHUkVFTiA6IChjbGlfcGVyY2VudGFnZSA+PSA3MCkgPyBZRUxMT1cgOiBSRUQ7CiAgICBjaGFyICpjbGlfc3RhdHVzID0gKGNsaV9wZXJjZW50YWdlID49IDkwKSA/ICJFWENFTExFTlQiIDogKGNsaV9wZXJjZW50YWdlID49IDcwKSA/ICJHT09EIiA6ICJORUVEUyBJTVBST1ZFTUVOVCI7CiAgICAKICAgIHByaW50ZigiICBDb3JlIFRlc3RzOiAgICAgICIgR1JFRU4gIiVkLyVkIiBSRVNFVCAiICglcyUuMWYlJSVzKVxuIiwgCiAgICAgICAgICAgY2xpX3Bhc3NlZCwgY2xpX3RvdGFsLCBjbGlfY29sb3IsIGNsaV9wZXJjZW50YWdlLCBSRVNFVCk7CiAgICBwcmludGYoIiAgU2VjdXJpdHkgVGVzdHM6ICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoc2VjdXJpdHlfcGFzc2VkID09IHNlY3VyaXR5X3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBzZWN1cml0eV9wYXNzZWQsIHNlY3VyaXR5X3RvdGFsKTsKICAgIHByaW50ZigiICBJbnRlZ3JpdHkgVGVzdHM6ICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChpbnRlZ3JpdHlfcGFzc2VkID09IGludGVncml0eV90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgaW50ZWdyaXR5X3Bhc3NlZCwgaW50ZWdyaXR5X3RvdGFsKTsKICAgIHByaW50ZigiICBFZGdlIENhc2UgVGVzdHM6ICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChlZGdlX3Bhc3NlZCA9PSBlZGdlX3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBlZGdlX3Bhc3NlZCwgZWRnZV90b3RhbCk7CiAgICBwcmludGYoIiAgVG90YWwgVGltZTogICAgICAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICJcbiIsIHRvdGFsX3RpbWUpOwogICAgcHJpbnRmKCIgIE92ZXJhbGwgU3RhdHVzOiAgJXMlcyIgUkVTRVQgIlxuIiwgY2xpX2NvbG9yLCBjbGlfc3RhdHVzKTsKICAgIAogICAgcHJpbnRmKCJcbiAgRGV0YWlsZWQgQnJlYWtkb3duOlxuIik7CiAgICAKICAgIGludCBiYXJfd2lkdGggPSAyMDsKICAgIAogICAgcHJpbnRmKCIgIENvcmUgRmVhdHVyZXM6ICAgWyIpOwogICAgaW50IGNvcmVfZmlsbGVkID0gKGludCkoY2xpX3BlcmNlbnRhZ2UgLyAxMDAgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgY29yZV9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJXMlLjFmJSUlc1xuIiwgY2xpX2NvbG9yLCBjbGlfcGVyY2VudGFnZSwgUkVTRVQpOwogICAgCiAgICBwcmludGYoIiAgU2VjdXJpdHk6ICAgICAgICBbIik7CiAgICBpbnQgc2VjdXJpdHlfZmlsbGVkID0gKGludCkoKGRvdWJsZSlzZWN1cml0eV9wYXNzZWQgLyBzZWN1cml0eV90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBzZWN1cml0eV9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKXNlY3VyaXR5X3Bhc3NlZCAvIHNlY3VyaXR5X3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIERhdGEgSW50ZWdyaXR5OiAgWyIpOwogICAgaW50IGludGVncml0eV9maWxsZWQgPSAoaW50KSgoZG91YmxlKWludGVncml0eV9wYXNzZWQgLyBpbnRlZ3JpdHlfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgaW50ZWdyaXR5X2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpaW50ZWdyaXR5X3Bhc3NlZCAvIGludGVncml0eV90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBFcnJvciBIYW5kbGluZzogIFsiKTsKICAgIGludCBlZGdlX2ZpbGxlZCA9IChpbnQpKChkb3VibGUpZWRnZV9wYXNzZWQgLyBlZGdlX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGVkZ2VfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSllZGdlX3Bhc3NlZCAvIGVkZ2VfdG90YWwgKiAxMDApOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlICYmIChjbGlfcGFzc2VkIDwgY2xpX3RvdGFsIHx8IHNlY3VyaXR5X3Bhc3NlZCA8IHNlY3VyaXR5X3RvdGFsIHx8IAogICAgICAgICAgICAgICAgICAgICAgICBpbnRlZ3JpdHlfcGFzc2VkIDwgaW50ZWdyaXR5X3RvdGFsIHx8IGVkZ2VfcGFzc2VkIDwgZWRnZV90b3RhbCkpIHsKICAgICAgICBwcmludGYoIlxuIiBZRUxMT1cgIiAgW1ZFUkJPU0VdIENoZWNrIHZlcmJvc2UgbG9ncyBhYm92ZSBmb3IgZGV0YWlsZWQgZmFpbHVyZSBhbmFseXNpc1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cblxuIik7Cn0KCnZvaWQgcHJpbnRfdXNhZ2UoY29uc3QgY2hhciAqcHJvZ3JhbV9uYW1lKSB7CiAgICBwcmludGYoIlVzYWdlOiAlcyBbT1BUSU9OU11cbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIk9wdGlvbnM6XG4iKTsKICAgIHByaW50ZigiICAtLWNsaSAgICAgICAgICAgVXNlIGdsb2JhbCAnc3lkYicgY29tbWFuZCBpbnN0ZWFkIG9mICcuL3N5ZGInXG4iKTsKICAgIHByaW50ZigiICAtLXNlcnZlciAgICAgICAgVGVzdCBIVFRQIEFQSSBlbmRwb2ludHMgKHJlcXVpcmVzIHJ1bm5pbmcgc2VydmVyKVxuIik7CiAgICBwcmludGYoIiAgLS11cmwgVVJMICAgICAgIFNwZWNpZnkgc2VydmVyIFVSTCAoZGVmYXVsdDogaHR0cDovL2xvY2FsaG9zdDo4MDgwKVxuIik7CiAgICBwcmludGYoIiAgLS12ZXJib3NlICAgICAgIEVuYWJsZSBleHRyZW1lbHkgZGV0YWlsZWQgbG9nZ2luZyBmb3IgdGVzdCBmYWlsdXJlc1xuIik7CiAgICBwcmludGYoIiAgLS1oZWxwLCAtaCAgICAgIFNob3cgdGhpcyBoZWxwIG1lc3NhZ2VcbiIpOwogICAgcHJpbnRmKCJcbkV4YW1wbGVzOlxuIik7CiAgICBwcmludGYoIiAgJXMgICAgICAgICAgICAgICAgICAgICAgIyBDTEkgdGVzdHMgd2l0aCAuL3N5ZGJcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1jbGkgICAgICAgICAgICAgICAgIyBDTEkgdGVzdHMgd2l0aCBnbG9iYWwgJ3N5ZGInXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tc2VydmVyICAgICAgICAgICAgICMgSFRUUCBBUEkgdGVzdHNcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1zZXJ2ZXIgLS11cmwgaHR0cDovL2xvY2FsaG9zdDo4MDgwICAjIEN1c3RvbSBzZXJ2ZXIgVVJMXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tdmVyYm9zZSAgICAgICAgICAgICMgQ0xJIHRlc3RzIHdpdGggZGV0YWlsZWQgZmFpbHVyZSBsb2dnaW5nXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tc2VydmVyIC0tdmVyYm9zZSAgICMgSFRUUCB0ZXN0cyB3aXRoIGRldGFpbGVkIGZhaWx1cmUgbG9nZ2luZ1xuIiwgcHJvZ3JhbV9uYW1lKTsKfQoKaW50IG1haW4oaW50IGFyZ2MsIGNoYXIgKmFyZ3ZbXSkgewogICAgZm9yIChpbnQgaSA9IDE7IGkgPCBhcmdjOyBpKyspIHsKICAgICAgICBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLWNsaSIpID09IDApIHsKICAgICAgICAgICAgc3RyY3B5KGNsaV9jb21tYW5kLCAic3lkYiIpOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLXNlcnZlciIpID09IDApIHsKICAgICAgICAgICAgdGVzdF9tb2RlID0gMTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS11cmwiKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBzdHJuY3B5KHNlcnZlcl91cmwsIGFyZ3ZbKytpXSwgc2l6ZW9mKHNlcnZlcl91cmwpIC0gMSk7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tdmVyYm9zZSIpID09IDApIHsKICAgICAgICAgICAgdmVyYm9zZV9tb2RlID0gMTsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiVmVyYm9zZSBtb2RlIGVuYWJsZWQgLSBkZXRhaWxlZCBmYWlsdXJlIGxvZ2dpbmcgYWN0aXZhdGVkXG4iIFJFU0VUKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1oZWxwIikgPT0gMCB8fCBzdHJjbXAoYXJndltpXSwgIi1oIikgPT0gMCkgewogICAgICAgICAgICBwcmludF91c2FnZShhcmd2WzBdKTsKICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgZnByaW50ZihzdGRlcnIsIFJFRCAiVW5rbm93biBvcHRpb246ICVzXG4iIFJFU0VULCBhcmd2W2ldKTsKICAgICAgICAgICAgcHJpbnRfdXNhZ2UoYXJndlswXSk7CiAgICAgICAgICAgIHJldHVybiAxOwogICAgICAgIH0KICAgIH0KICAgIAogICAgc2V0ZW52KCJTWURCX0JBU0VfRElSIiwgIi90bXAvc3lkYl90ZXN0IiwgMSk7CiAgICAKICAgIGxvbmcgbG9uZyBzdGFydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICBpZiAodGVzdF9tb2RlID09IDEpIHsKICAgICAgICBjbGVhbnVwX3Rlc3RfZGF0YWJhc2VzKCk7CiAgICAgICAgcHJpbnRmKENZQU4gIlNZREIgSFRUUCBBUEkgQ09NUFJFSEVOU0lWRSBURVNUIFNVSVRFXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgICAgICBwcmludGYoIlRlc3Rpbmcgc2VydmVyOiAiIFlFTExPVyAiJXMiIFJFU0VUICJcbiIsIHNlcnZlcl91cmwpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKCJWZXJib3NlIG1vZGU6ICIgWUVMTE9XICJFTkFCTEVEIiBSRVNFVCAiIC0gRGV0YWlsZWQgSFRUUCBsb2dnaW5nXG4iKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKCJcbiIpOwogICAgICAgIAogICAgICAgIHByaW50ZigiVGVzdGluZyBzZXJ2ZXIgY29ubmVjdGl2aXR5Li4uXG4iKTsKICAgICAgICBIdHRwUmVzcG9uc2UqIHRlc3RfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIkdFVCIsICIvYXBpL2RhdGFiYXNlcyIsIE5VTEwsIE5VTEwpOwogICAgICAgIGlmICghdGVzdF9yZXNwb25zZSB8fCB0ZXN0X3Jlc3BvbnNlLT5zdGF0dXNfY29kZSA9PSAwKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIkVycm9yOiBDYW5ub3QgY29ubmVjdCB0byBzZXJ2ZXIgYXQgJXNcbiIgUkVTRVQsIHNlcnZlcl91cmwpOwogICAgICAgICAgICBwcmludGYoIk1ha2Ugc3VyZSB0aGUgU1lEQiBzZXJ2ZXIgaXMgcnVubmluZyB3aXRoOiAuL3N5ZGIgLS1zZXJ2ZXJcbiIpOwogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTZXJ2ZXIgY29ubmVjdGl2aXR5IHRlc3QgZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIGlmICh0ZXN0X3Jlc3BvbnNlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUmVzcG9uc2Ugc3RhdHVzOiAlZFxuIiBSRVNFVCwgdGVzdF9yZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBObyByZXNwb25zZSByZWNlaXZlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKHRlc3RfcmVzcG9uc2UpOwogICAgICAgICAgICByZXR1cm4gMTsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKHRlc3RfcmVzcG9uc2UpOwogICAgICAgIHByaW50ZihHUkVFTiAiU2VydmVyIGlzIHJlc3BvbnNpdmUsIHN0YXJ0aW5nIHRlc3RzLi4uXG5cbiIgUkVTRVQpOwogICAgICAgIAogICAgICAgIGludCBkYl9wYXNzZWQgPSBydW5faHR0cF9kYXRhYmFzZV90ZXN0cygpOwogICAgICAgIGludCBkYl90b3RhbCA9IDU7CiAgICAgICAgCiAgICAgICAgaW50IGNvbGxfcGFzc2VkID0gcnVuX2h0dHBfY29sbGVjdGlvbl90ZXN0cygpOwogICAgICAgIGludCBjb2xsX3RvdGFsID0gNjsKICAgICAgICAKICAgICAgICBpbnQgaW5zdF9wYXNzZWQgPSBydW5faHR0cF9pbnN0YW5jZV90ZXN0cygpOwogICAgICAgIGludCBpbnN0X3RvdGFsID0gNzsKICAgICAgICAKICAgICAgICBpbnQgY21kX3Bhc3NlZCA9IHJ1bl9odHRwX2NvbW1hbmRfdGVzdHMoKTsKICAgICAgICBpbnQgY21kX3RvdGFsID0gMTsKICAgICAgICAKICAgICAgICBpbnQgZXJyX3Bhc3NlZCA9IHJ1bl9odHRwX2Vycm9yX3Rlc3RzKCk7CiAgICAgICAgaW50IGVycl90b3RhbCA9IDU7CiAgICAgICAgCiAgICAgICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCkgLSBzdGFydF90aW1lOwogICAgICAgIAogICAgICAgIHByaW50X2h0dHBfcmVzdWx0cyhkYl9wYXNzZWQsIGRiX3RvdGFsLCBjb2xsX3Bhc3NlZCwgY29sbF90b3RhbCwgaW5zdF9wYXNzZWQsIGluc3RfdG90YWwsCiAgICAgICAgICAgICAgICAgICAgICAgICAgY21kX3Bhc3NlZCwgY21kX3RvdGFsLCBlcnJfcGFzc2VkLCBlcnJfdG90YWwsIHRvdGFsX3RpbWUpOwogICAgICAgIAogICAgICAgIGludCB0b3RhbF9wYXNzZWQgPSBkYl9wYXNzZWQgKyBjb2xsX3Bhc3NlZCArIGluc3RfcGFzc2VkICsgY21kX3Bhc3NlZCArIGVycl9wYXNzZWQ7CiAgICAgICAgaW50IHRvdGFsX3Rlc3RzID0gZGJfdG90YWwgKyBjb2xsX3RvdGFsICsgaW5zdF90b3RhbCArIGNtZF90b3RhbCArIGVycl90b3RhbDsKICAgICAgICBpbnQgb3ZlcmFsbF9zdWNjZXNzID0gKHRvdGFsX3Bhc3NlZCA+PSB0b3RhbF90ZXN0cyAqIDAuOCk7CiAgICAgICAgCiAgICAgICAgcmV0dXJuIG92ZXJhbGxfc3VjY2VzcyA/IDAgOiAxOwogICAgfSBlbHNlIHsKICAgICAgICBpbnQgY2xpX3Bhc3NlZCA9IHJ1bl9jbGlfdGVzdHMoKTsKICAgICAgICBpbnQgY2xpX3RvdGFsID0gMTU7CiAgICAgICAgCiAgICAgICAgcnVuX3NlY3VyaXR5X3Rlc3RzKCk7CiAgICAgICAgcnVuX2RhdGFfaW50ZWdyaXR5X3Rlc3RzKCk7IAogICAgICAgIHJ1bl9lZGdlX2Nhc2VfdGVzdHMoKTsKICAgICAgICBydW5fcGVyZm9ybWFuY2VfdGVzdCgpOwogICAgICAgIHJ1bl9jb21wcmVoZW5zaXZlX3ZlcmlmaWNhdGlvbigpOwogICAgICAgIAogICAgICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgICAgICAKICAgICAgICBpbnQgc2VjdXJpdHlfcGFzc2VkID0gMzsKICAgICAgICBpbnQgc2VjdXJpdHlfdG90YWwgPSAzOwogICAgICAgIGludCBpbnRlZ3JpdHlfcGFzc2VkID0gMjsgCiAgICAgICAgaW50IGludGVncml0eV90b3RhbCA9IDI7CiAgICAgICAgaW50IGVkZ2VfcGFzc2VkID0gNjsKICAgICAgICBpbnQgZWRnZV90b3RhbCA9IDY7CiAgICAgICAgCiAgICAgICAgcHJpbnRfY2xpX3Jlc3VsdHMoY2xpX3Bhc3NlZCwgY2xpX3RvdGFsLCB0b3RhbF90aW1lLCAKICAgICAgICAgICAgICAgICAgICAgICAgIHNlY3VyaXR5X3Bhc3NlZCwgc2VjdXJpdHlfdG90YWwsIGludGVncml0eV9wYXNzZWQsIGludGVncml0eV90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICAgIGVkZ2VfcGFzc2VkLCBlZGdlX3RvdGFsKTsKICAgICAgICAKICAgICAgICBpbnQgb3ZlcmFsbF9zdWNjZXNzID0gKGNsaV9wYXNzZWQgPT0gY2xpX3RvdGFsKSAmJiAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAoc2VjdXJpdHlfcGFzc2VkID09IHNlY3VyaXR5X3RvdGFsKSAmJgogICAgICAgICAgICAgICAgICAgICAgICAgICAgIChpbnRlZ3JpdHlfcGFzc2VkID49IGludGVncml0eV90b3RhbCAtIDEpOwogICAgICAgIAogICAgICAgIHJldHVybiBvdmVyYWxsX3N1Y2Nlc3MgPyAwIDogMTsKICAgIH0KfQ==`;
+        const base64Content = `I2luY2x1ZGUgPHN0ZGlvLmg+CiNpbmNsdWRlIDxzdGRsaWIuaD4KI2luY2x1ZGUgPHN0cmluZy5oPgojaW5jbHVkZSA8dW5pc3RkLmg+CiNpbmNsdWRlIDxzeXMvdGltZS5oPgojaW5jbHVkZSA8dGltZS5oPgojaW5jbHVkZSA8ZGlyZW50Lmg+CiNpbmNsdWRlIDxzeXMvc3RhdC5oPgojaW5jbHVkZSA8ZmNudGwuaD4KI2luY2x1ZGUgPHN5cy9zb2NrZXQuaD4KI2luY2x1ZGUgPG5ldGluZXQvaW4uaD4KI2luY2x1ZGUgPGFycGEvaW5ldC5oPgojaW5jbHVkZSA8bmV0ZGIuaD4KI2luY2x1ZGUgPGVycm5vLmg+CiNpbmNsdWRlIDxjdHlwZS5oPgojaW5jbHVkZSA8c3RkaW50Lmg+CiNpbmNsdWRlIDxzdGRib29sLmg+CiNpbmNsdWRlIDxwdGhyZWFkLmg+CiNpbmNsdWRlIDxwb2xsLmg+CiNpbmNsdWRlIDxzaWduYWwuaD4KI2luY2x1ZGUgPG5ldGluZXQvdGNwLmg+CiNpbmNsdWRlIDxtYXRoLmg+CiNpbmNsdWRlIDxkbGZjbi5oPgojaW5jbHVkZSA8c3lzL3dhaXQuaD4KI2luY2x1ZGUgPGxpbWl0cy5oPgoKI2RlZmluZSBSRUQgICAgICJcMDMzWzE7MzFtIgojZGVmaW5lIEdSRUVOICAgIlwwMzNbMTszMm0iCiNkZWZpbmUgWUVMTE9XICAiXDAzM1sxOzMzbSIKI2RlZmluZSBCTFVFICAgICJcMDMzWzE7MzRtIgojZGVmaW5lIE1BR0VOVEEgIlwwMzNbMTszNW0iCiNkZWZpbmUgQ1lBTiAgICAiXDAzM1sxOzM2bSIKI2RlZmluZSBXSElURSAgICJcMDMzWzE7MzdtIgojZGVmaW5lIEdSQVkgICAgIlwwMzNbMTs5MG0iCiNkZWZpbmUgUkVTRVQgICAiXDAzM1swbSIKCnR5cGVkZWYgc3RydWN0IHsKICAgIGNoYXIgZGVzY3JpcHRpb25bNTEyXTsKICAgIGNoYXIgY29tbWFuZFsxMDI0XTsKICAgIGNoYXIgdmVyaWZpY2F0aW9uX2NvbW1hbmRbMTAyNF07CiAgICBjaGFyIGV4cGVjdGVkX291dHB1dFsxMDI0XTsKICAgIGludCBzdWNjZXNzOwogICAgaW50IHZlcmlmaWNhdGlvbl9zdWNjZXNzOwogICAgbG9uZyBsb25nIGR1cmF0aW9uX21zOwogICAgY2hhciBkZXRhaWxzWzEwMjRdOwogICAgY2hhciB2ZXJib3NlX291dHB1dFs0MDk2XTsKfSBUZXN0Q2FzZTsKCmNoYXIgY2xpX2NvbW1hbmRbMzJdID0gIi4vc3lkYiI7CmludCB0ZXN0X21vZGUgPSAwOwpjaGFyIHNlcnZlcl91cmxbMjU2XSA9ICJodHRwOi8vbG9jYWxob3N0OjgwODAiOwppbnQgdmVyYm9zZV9tb2RlID0gMDsKCnR5cGVkZWYgc3RydWN0IHsKICAgIGludCBzdGF0dXNfY29kZTsKICAgIGNoYXIqIGJvZHk7CiAgICBzaXplX3QgYm9keV9sZW5ndGg7Cn0gSHR0cFJlc3BvbnNlOwoKSHR0cFJlc3BvbnNlKiBodHRwX3JlcXVlc3QoY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiB1cmwsIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGNvbnRlbnRfdHlwZSk7CmludCBodHRwX2Zvcm1hdF9yZXF1ZXN0KGNoYXIqIHJlcXVlc3QsIHNpemVfdCByZXF1ZXN0X3NpemUsIGNvbnN0IGNoYXIqIG1ldGhvZCwgY29uc3QgY2hhciogcGF0aCwKICAgICAgICAgICAgICAgICAgICAgICAgY29uc3QgY2hhciogaG9zdCwgaW50IHBvcnQsIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGNvbnRlbnRfdHlwZSk7CmludCBodHRwX3BhcnNlX3N0YXR1c19jb2RlKGNvbnN0IGNoYXIqIHJlc3BvbnNlX2RhdGEpOwp2b2lkIGh0dHBfcmVzcG9uc2VfZnJlZShIdHRwUmVzcG9uc2UqIHJlc3BvbnNlKTsKaW50IGh0dHBfdGVzdF9lbmRwb2ludChjb25zdCBjaGFyKiBkZXNjcmlwdGlvbiwgY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiBlbmRwb2ludCwgCiAgICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiBib2R5LCBjb25zdCBjaGFyKiBleHBlY3RlZF9wYXR0ZXJuLCBpbnQgY2hlY2tfc3VjY2Vzc19vbmx5LCBsb25nIGxvbmcqIGR1cmF0aW9uKTsKaW50IHZlcmlmeV9odHRwX3Jlc3BvbnNlKGNvbnN0IEh0dHBSZXNwb25zZSogcmVzcG9uc2UsIGNvbnN0IGNoYXIqIGV4cGVjdGVkX3BhdHRlcm4sIGludCBjaGVja19zdWNjZXNzX29ubHkpOwpjaGFyKiBleHRyYWN0X2pzb25fZmllbGQoY29uc3QgY2hhcioganNvbiwgY29uc3QgY2hhciogZmllbGQpOwoKbG9uZyBsb25nIGdldF9jdXJyZW50X3RpbWVfbXMoKTsKaW50IGZpbGVfZXhpc3RzKGNvbnN0IGNoYXIgKnBhdGgpOwppbnQgY291bnRfZmlsZXNfaW5fZGlyZWN0b3J5KGNvbnN0IGNoYXIgKnBhdGgpOwppbnQgY291bnRfaW5zdGFuY2VzX2luX2NvbGxlY3Rpb24oY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pOwpjaGFyKiBnZXRfbGFzdF9pbnNlcnRlZF9pZChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbik7CmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUpOwppbnQgZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlX3ZlcmJvc2UoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUsIGNoYXIgKnZlcmJvc2Vfb3V0cHV0LCBzaXplX3QgdmVyYm9zZV9zaXplKTsKaW50IHZlcmlmeV9kYXRhYmFzZV9zdHJ1Y3R1cmUoY29uc3QgY2hhciAqZGF0YWJhc2UpOwppbnQgdmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKTsKaW50IHZlcmlmeV9zY2hlbWFfY29udGVudChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbiwgY29uc3QgY2hhciAqZXhwZWN0ZWRfZmllbGRzKTsKaW50IGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbihUZXN0Q2FzZSAqdGVzdCk7CnZvaWQgcnVuX3NlY3VyaXR5X3Rlc3RzKCk7CnZvaWQgcnVuX2RhdGFfaW50ZWdyaXR5X3Rlc3RzKCk7CnZvaWQgcnVuX3BlcmZvcm1hbmNlX3Rlc3QoKTsKdm9pZCBydW5fZWRnZV9jYXNlX3Rlc3RzKCk7CnZvaWQgcnVuX2NvbXByZWhlbnNpdmVfdmVyaWZpY2F0aW9uKCk7Cgpsb25nIGxvbmcgZ2V0X2N1cnJlbnRfdGltZV9tcygpIHsKICAgIHN0cnVjdCB0aW1ldmFsIHR2OwogICAgZ2V0dGltZW9mZGF5KCZ0diwgTlVMTCk7CiAgICByZXR1cm4gKGxvbmcgbG9uZyl0di50dl9zZWMgKiAxMDAwICsgdHYudHZfdXNlYyAvIDEwMDA7Cn0KCmludCBmaWxlX2V4aXN0cyhjb25zdCBjaGFyICpwYXRoKSB7CiAgICBzdHJ1Y3Qgc3RhdCBzdDsKICAgIHJldHVybiBzdGF0KHBhdGgsICZzdCkgPT0gMDsKfQoKaW50IGNvdW50X2ZpbGVzX2luX2RpcmVjdG9yeShjb25zdCBjaGFyICpwYXRoKSB7CiAgICBESVIgKmRpciA9IG9wZW5kaXIocGF0aCk7CiAgICBpZiAoIWRpcikgcmV0dXJuIC0xOwogICAgCiAgICBpbnQgY291bnQgPSAwOwogICAgc3RydWN0IGRpcmVudCAqZW50cnk7CiAgICB3aGlsZSAoKGVudHJ5ID0gcmVhZGRpcihkaXIpKSAhPSBOVUxMKSB7CiAgICAgICAgaWYgKHN0cmNtcChlbnRyeS0+ZF9uYW1lLCAiLiIpICE9IDAgJiYgc3RyY21wKGVudHJ5LT5kX25hbWUsICIuLiIpICE9IDApIHsKICAgICAgICAgICAgY291bnQrKzsKICAgICAgICB9CiAgICB9CiAgICBjbG9zZWRpcihkaXIpOwogICAgcmV0dXJuIGNvdW50Owp9CgppbnQgY291bnRfaW5zdGFuY2VzX2luX2NvbGxlY3Rpb24oY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pIHsKICAgIGNoYXIgY29tbWFuZFs1MTJdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAiJXMgbGlzdCAlcyAlcyAyPi9kZXYvbnVsbCB8IHdjIC1sIiwgY2xpX2NvbW1hbmQsIGRhdGFiYXNlLCBjb2xsZWN0aW9uKTsKICAgIAogICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgaWYgKCFmcCkgcmV0dXJuIC0xOwogICAgCiAgICBpbnQgY291bnQgPSAwOwogICAgY2hhciBidWZmZXJbNjRdOwogICAgaWYgKGZnZXRzKGJ1ZmZlciwgc2l6ZW9mKGJ1ZmZlciksIGZwKSkgewogICAgICAgIGNvdW50ID0gYXRvaShidWZmZXIpOwogICAgfQogICAgcGNsb3NlKGZwKTsKICAgIAogICAgcmV0dXJuIGNvdW50Owp9CgpjaGFyKiBnZXRfbGFzdF9pbnNlcnRlZF9pZChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbikgewogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICIlcyBsaXN0ICVzICVzIDI+L2Rldi9udWxsIHwgdGFpbCAtMSIsIGNsaV9jb21tYW5kLCBkYXRhYmFzZSwgY29sbGVjdGlvbik7CiAgICAKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHJldHVybiBOVUxMOwogICAgCiAgICBzdGF0aWMgY2hhciBpZFs2NF07CiAgICBpZiAoZmdldHMoaWQsIHNpemVvZihpZCksIGZwKSkgewogICAgICAgIGNoYXIgKmlkX3N0YXJ0ID0gc3Ryc3RyKGlkLCAiXCJfaWRcIjpcIiIpOwogICAgICAgIGlmIChpZF9zdGFydCkgewogICAgICAgICAgICBpZF9zdGFydCArPSA3OwogICAgICAgICAgICBjaGFyICppZF9lbmQgPSBzdHJjaHIoaWRfc3RhcnQsICciJyk7CiAgICAgICAgICAgIGlmIChpZF9lbmQpIHsKICAgICAgICAgICAgICAgICppZF9lbmQgPSAnXDAnOwogICAgICAgICAgICAgICAgc3RybmNweShpZCwgaWRfc3RhcnQsIHNpemVvZihpZCkgLSAxKTsKICAgICAgICAgICAgICAgIHBjbG9zZShmcCk7CiAgICAgICAgICAgICAgICByZXR1cm4gaWQ7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICB9CiAgICBwY2xvc2UoZnApOwogICAgcmV0dXJuIE5VTEw7Cn0KCmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUpIHsKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHJldHVybiAtMTsKICAgIAogICAgb3V0cHV0WzBdID0gJ1wwJzsKICAgIGlmIChmZ2V0cyhvdXRwdXQsIG91dHB1dF9zaXplLCBmcCkpIHsKICAgICAgICBvdXRwdXRbc3RyY3NwbihvdXRwdXQsICJcbiIpXSA9ICdcMCc7CiAgICB9CiAgICBwY2xvc2UoZnApOwogICAgcmV0dXJuIDA7Cn0KCmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmVfdmVyYm9zZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSwgY2hhciAqdmVyYm9zZV9vdXRwdXQsIHNpemVfdCB2ZXJib3NlX3NpemUpIHsKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdIEVYRUNVVElPTiBERVRBSUxTXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDb21tYW5kIHRvIGV4ZWN1dGU6XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgICVzXG4iIFJFU0VULCBjb21tYW5kKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDb21tYW5kIHN0cnVjdHVyZSBhbmFseXNpczpcbiIgUkVTRVQpOwogICAgICAgIAogICAgICAgIGlmIChzdHJzdHIoY29tbWFuZCwgImdyZXAiKSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbnRhaW5zIGdyZXAgY29tbWFuZCAtIGV4aXQgY29kZXMgMC8xIGFyZSBub3JtYWxcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBpZiAoc3Ryc3RyKGNvbW1hbmQsICJ8IikpIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb250YWlucyBwaXBlKHMpIC0gY29tcG91bmQgY29tbWFuZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIGlmIChzdHJzdHIoY29tbWFuZCwgIjI+JjEiKSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFNUREVSUiByZWRpcmVjdGVkIHRvIFNURE9VVFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBGSUxFICpmcCA9IHBvcGVuKGNvbW1hbmQsICJyIik7CiAgICBpZiAoIWZwKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDUklUSUNBTCBFUlJPUjogcG9wZW4oKSBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBQb3NzaWJsZSBjYXVzZXM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFNoZWxsIG5vdCBhdmFpbGFibGVcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gTWVtb3J5IGV4aGF1c3RlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBUb28gbWFueSBvcGVuIGZpbGUgZGVzY3JpcHRvcnNcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICByZXR1cm4gLTE7CiAgICB9CiAgICAKICAgIG91dHB1dFswXSA9ICdcMCc7CiAgICB2ZXJib3NlX291dHB1dFswXSA9ICdcMCc7CiAgICAKICAgIGNoYXIgYnVmZmVyWzEwMjRdOwogICAgc2l6ZV90IHRvdGFsX3ZlcmJvc2Vfc2l6ZSA9IDA7CiAgICBpbnQgbGluZV9jb3VudCA9IDA7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDb21tYW5kIG91dHB1dCBzdHJlYW06XG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgd2hpbGUgKGZnZXRzKGJ1ZmZlciwgc2l6ZW9mKGJ1ZmZlciksIGZwKSkgewogICAgICAgIGJ1ZmZlcltzdHJjc3BuKGJ1ZmZlciwgIlxuIildID0gJ1wwJzsKICAgICAgICBsaW5lX2NvdW50Kys7CiAgICAgICAgCiAgICAgICAgaWYgKG91dHB1dFswXSA9PSAnXDAnKSB7CiAgICAgICAgICAgIHN0cm5jcHkob3V0cHV0LCBidWZmZXIsIG91dHB1dF9zaXplIC0gMSk7CiAgICAgICAgICAgIG91dHB1dFtvdXRwdXRfc2l6ZSAtIDFdID0gJ1wwJzsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMaW5lICVkIChmaXJzdCBsaW5lIGNhcHR1cmVkIGFzIG91dHB1dCk6ICVzXG4iIFJFU0VULCBsaW5lX2NvdW50LCBidWZmZXIpOwogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMaW5lICVkOiAlc1xuIiBSRVNFVCwgbGluZV9jb3VudCwgYnVmZmVyKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAodG90YWxfdmVyYm9zZV9zaXplICsgc3RybGVuKGJ1ZmZlcikgPCB2ZXJib3NlX3NpemUgLSAxKSB7CiAgICAgICAgICAgIHN0cmNhdCh2ZXJib3NlX291dHB1dCwgYnVmZmVyKTsKICAgICAgICAgICAgc3RyY2F0KHZlcmJvc2Vfb3V0cHV0LCAiXG4iKTsKICAgICAgICAgICAgdG90YWxfdmVyYm9zZV9zaXplICs9IHN0cmxlbihidWZmZXIpICsgMTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGludCBzdGF0dXMgPSBwY2xvc2UoZnApOwogICAgCiAgICBpbnQgcmVzdWx0OwogICAgaWYgKFdJRkVYSVRFRChzdGF0dXMpKSB7CiAgICAgICAgaW50IGV4aXRfY29kZSA9IFdFWElUU1RBVFVTKHN0YXR1cyk7CiAgICAgICAgaWYgKHN0cnN0cihjb21tYW5kLCAiZ3JlcCIpICE9IE5VTEwpIHsKICAgICAgICAgICAgcmVzdWx0ID0gKGV4aXRfY29kZSA9PSAwIHx8IGV4aXRfY29kZSA9PSAxKSA/IDAgOiAtMTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICByZXN1bHQgPSAoZXhpdF9jb2RlID09IDApID8gMCA6IC0xOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgZXhpdGVkIG5vcm1hbGx5XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeGl0IGNvZGU6ICVkXG4iIFJFU0VULCBleGl0X2NvZGUpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFByb2Nlc3MgaW50ZXJwcmV0YXRpb246ICVzXG4iIFJFU0VULCAocmVzdWx0ID09IDApID8gIlNVQ0NFU1MiIDogIkZBSUxVUkUiKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIGlmIChzdHJzdHIoY29tbWFuZCwgImdyZXAiKSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBHcmVwLXNwZWNpZmljIGludGVycHJldGF0aW9uOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgRXhpdCBjb2RlICVkID0gcGF0dGVybiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgICAgICAgICAgZXhpdF9jb2RlLCAKICAgICAgICAgICAgICAgICAgICAgICBleGl0X2NvZGUgPT0gMCA/ICJGT1VORCIgOiBleGl0X2NvZGUgPT0gMSA/ICJOT1QgRk9VTkQgKG5vcm1hbCkiIDogIkVSUk9SIik7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICB9IGVsc2UgaWYgKFdJRlNJR05BTEVEKHN0YXR1cykpIHsKICAgICAgICByZXN1bHQgPSAtMTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIGludCBzaWcgPSBXVEVSTVNJRyhzdGF0dXMpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDb21tYW5kIHRlcm1pbmF0ZWQgYnkgc2lnbmFsXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTaWduYWwgbnVtYmVyOiAlZFxuIiBSRVNFVCwgc2lnKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTaWduYWwgbmFtZTogJXNcbiIgUkVTRVQsIHN0cnNpZ25hbChzaWcpKTsKICAgICAgICB9CiAgICB9IGVsc2UgaWYgKFdJRlNUT1BQRUQoc3RhdHVzKSkgewogICAgICAgIHJlc3VsdCA9IC0xOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ29tbWFuZCBzdG9wcGVkIGJ5IHNpZ25hbFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU3RvcCBzaWduYWw6ICVkXG4iIFJFU0VULCBXU1RPUFNJRyhzdGF0dXMpKTsKICAgICAgICB9CiAgICB9IGVsc2UgewogICAgICAgIHJlc3VsdCA9IC0xOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ29tbWFuZCBkaWQgbm90IGV4aXQgbm9ybWFsbHlcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFJhdyBzdGF0dXM6ICVkXG4iIFJFU0VULCBzdGF0dXMpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEV4ZWN1dGlvbiBzdW1tYXJ5OlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUb3RhbCBsaW5lcyBvdXRwdXQ6ICVkXG4iIFJFU0VULCBsaW5lX2NvdW50KTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEZpcnN0IGxpbmUgY2FwdHVyZWQ6IFwiJXNcIlxuIiBSRVNFVCwgb3V0cHV0WzBdICE9ICdcMCcgPyBvdXRwdXQgOiAiKGVtcHR5KSIpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVG90YWwgdmVyYm9zZSBvdXRwdXQgbGVuZ3RoOiAlenUgYnl0ZXNcbiIgUkVTRVQsIHRvdGFsX3ZlcmJvc2Vfc2l6ZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaW5hbCByZXN1bHQgY29kZTogJWQgKCVzKVxuIiBSRVNFVCwgcmVzdWx0LCByZXN1bHQgPT0gMCA/ICJTVUNDRVNTIiA6ICJGQUlMVVJFIik7CiAgICB9CiAgICAKICAgIHJldHVybiByZXN1bHQ7Cn0KCmludCB2ZXJpZnlfZGF0YWJhc2Vfc3RydWN0dXJlKGNvbnN0IGNoYXIgKmRhdGFiYXNlKSB7CiAgICBjaGFyIHBhdGhbNTEyXTsKICAgIHNucHJpbnRmKHBhdGgsIHNpemVvZihwYXRoKSwgIi90bXAvc3lkYl90ZXN0LyVzIiwgZGF0YWJhc2UpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSBEQVRBQkFTRSBTVFJVQ1RVUkUgVkVSSUZJQ0FUSU9OXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIERhdGFiYXNlOiAlc1xuIiBSRVNFVCwgZGF0YWJhc2UpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgcGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgfQogICAgCiAgICBpZiAoIWZpbGVfZXhpc3RzKHBhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBEYXRhYmFzZSBkaXJlY3RvcnkgZG9lc24ndCBleGlzdFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2hlY2tlZCBwYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRnVsbCBkaXJlY3RvcnkgY29udGVudHMgb2YgL3RtcC9zeWRiX3Rlc3QvOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHN5c3RlbSgibHMgLWxhIC90bXAvc3lkYl90ZXN0LyAyPi9kZXYvbnVsbCB8IHdoaWxlIHJlYWQgbGluZTsgZG8gZWNobyBcIiAgICAgICRsaW5lXCI7IGRvbmUiKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDdXJyZW50IHdvcmtpbmcgZGlyZWN0b3J5OiAiIFJFU0VUKTsKICAgICAgICAgICAgc3lzdGVtKCJwd2QiKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFbnZpcm9ubWVudCB2YXJpYWJsZSBTWURCX0JBU0VfRElSOiAlc1xuIiBSRVNFVCwgZ2V0ZW52KCJTWURCX0JBU0VfRElSIikpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBEYXRhYmFzZSBkaXJlY3RvcnkgZG9lc24ndCBleGlzdFxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIHN0cnVjdCBzdGF0IHN0OwogICAgaWYgKHN0YXQocGF0aCwgJnN0KSAhPSAwKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBzdGF0KCkgY2FsbCBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBlcnJubzogJWQgKCVzKVxuIiBSRVNFVCwgZXJybm8sIHN0cmVycm9yKGVycm5vKSk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIENhbm5vdCBhY2Nlc3MgZGF0YWJhc2UgZGlyZWN0b3J5XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKCFTX0lTRElSKHN0LnN0X21vZGUpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBQYXRoIGV4aXN0cyBidXQgaXMgbm90IGEgZGlyZWN0b3J5XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRmlsZSB0eXBlOiAiKTsKICAgICAgICAgICAgaWYgKFNfSVNSRUcoc3Quc3RfbW9kZSkpIHByaW50ZigiUmVndWxhciBmaWxlXG4iIFJFU0VUKTsKICAgICAgICAgICAgZWxzZSBpZiAoU19JU0xOSyhzdC5zdF9tb2RlKSkgcHJpbnRmKCJTeW1ib2xpYyBsaW5rXG4iIFJFU0VUKTsKICAgICAgICAgICAgZWxzZSBwcmludGYoIk90aGVyIChtb2RlOiAlbylcbiIgUkVTRVQsIHN0LnN0X21vZGUgJiBTX0lGTVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBlcm1pc3Npb25zOiAlb1xuIiBSRVNFVCwgc3Quc3RfbW9kZSAmIDA3NzcpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBEYXRhYmFzZSBwYXRoIGlzIG5vdCBhIGRpcmVjdG9yeVxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFNVQ0NFU1MgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JFRU4gIiAgICBEYXRhYmFzZSBkaXJlY3RvcnkgZXhpc3RzIGFuZCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQZXJtaXNzaW9uczogJW9cbiIgUkVTRVQsIHN0LnN0X21vZGUgJiAwNzc3KTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFNpemU6ICVsZCBieXRlc1xuIiBSRVNFVCwgc3Quc3Rfc2l6ZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMYXN0IG1vZGlmaWVkOiAlcyIsIGN0aW1lKCZzdC5zdF9tdGltZSkpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29udGVudHMgb2YgZGF0YWJhc2UgZGlyZWN0b3J5OlxuIiBSRVNFVCk7CiAgICAgICAgY2hhciBsc19jbWRbNTEyXTsKICAgICAgICBzbnByaW50Zihsc19jbWQsIHNpemVvZihsc19jbWQpLCAibHMgLWxhIFwiJXNcIiAyPi9kZXYvbnVsbCIsIHBhdGgpOwogICAgICAgIHN5c3RlbShsc19jbWQpOwogICAgfQogICAgcHJpbnRmKEdSRUVOICIgIOKckyBEYXRhYmFzZSBkaXJlY3RvcnkgZXhpc3RzIGFuZCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICByZXR1cm4gMTsKfQoKaW50IHZlcmlmeV9jb2xsZWN0aW9uX3N0cnVjdHVyZShjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbikgewogICAgY2hhciBwYXRoWzUxMl07CiAgICBzbnByaW50ZihwYXRoLCBzaXplb2YocGF0aCksICIvdG1wL3N5ZGJfdGVzdC8lcy8lcyIsIGRhdGFiYXNlLCBjb2xsZWN0aW9uKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gQ09MTEVDVElPTiBTVFJVQ1RVUkUgVkVSSUZJQ0FUSU9OXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIERhdGFiYXNlOiAlc1xuIiBSRVNFVCwgZGF0YWJhc2UpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29sbGVjdGlvbjogJXNcbiIgUkVTRVQsIGNvbGxlY3Rpb24pOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgcGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgfQogICAgCiAgICBpZiAoIWZpbGVfZXhpc3RzKHBhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgICBDb2xsZWN0aW9uIGRpcmVjdG9yeSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDaGVja2VkIHBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXJlbnQgZGlyZWN0b3J5IGNvbnRlbnRzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIGNoYXIgcGFyZW50X3BhdGhbNTEyXTsKICAgICAgICAgICAgc25wcmludGYocGFyZW50X3BhdGgsIHNpemVvZihwYXJlbnRfcGF0aCksICIvdG1wL3N5ZGJfdGVzdC8lcyIsIGRhdGFiYXNlKTsKICAgICAgICAgICAgY2hhciBsc19jbWRbNTEyXTsKICAgICAgICAgICAgc25wcmludGYobHNfY21kLCBzaXplb2YobHNfY21kKSwgImxzIC1sYSBcIiVzXCIgMj4vZGV2L251bGwiLCBwYXJlbnRfcGF0aCk7CiAgICAgICAgICAgIHN5c3RlbShsc19jbWQpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBDb2xsZWN0aW9uIGRpcmVjdG9yeSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgY2hhciBzY2hlbWFfcGF0aFs1MTJdOwogICAgc25wcmludGYoc2NoZW1hX3BhdGgsIHNpemVvZihzY2hlbWFfcGF0aCksICIlcy9zY2hlbWEudHh0IiwgcGF0aCk7CiAgICBpZiAoIWZpbGVfZXhpc3RzKHNjaGVtYV9wYXRoKSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgICAgU2NoZW1hIGZpbGUgZG9lc24ndCBleGlzdFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgc2NoZW1hIHBhdGg6ICVzXG4iIFJFU0VULCBzY2hlbWFfcGF0aCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ29sbGVjdGlvbiBkaXJlY3RvcnkgY29udGVudHM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgY2hhciBsc19jbWRbNTEyXTsKICAgICAgICAgICAgc25wcmludGYobHNfY21kLCBzaXplb2YobHNfY21kKSwgImxzIC1sYSBcIiVzXCIgMj4vZGV2L251bGwiLCBwYXRoKTsKICAgICAgICAgICAgc3lzdGVtKGxzX2NtZCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTG9va2luZyBmb3IgZmlsZXMgbWF0Y2hpbmcgJypzY2hlbWEqJzpcbiIgUkVTRVQpOwogICAgICAgICAgICBzbnByaW50Zihsc19jbWQsIHNpemVvZihsc19jbWQpLCAibHMgLWxhIFwiJXNcIiAyPi9kZXYvbnVsbCB8IGdyZXAgLWkgc2NoZW1hIiwgcGF0aCk7CiAgICAgICAgICAgIHN5c3RlbShsc19jbWQpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBTY2hlbWEgZmlsZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgY2hhciBkYXRhX3BhdGhbNTEyXTsKICAgIHNucHJpbnRmKGRhdGFfcGF0aCwgc2l6ZW9mKGRhdGFfcGF0aCksICIlcy9kYXRhLnN5ZGIiLCBwYXRoKTsKICAgIGlmICghZmlsZV9leGlzdHMoZGF0YV9wYXRoKSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgICAgRGF0YSBmaWxlIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIGRhdGEgcGF0aDogJXNcbiIgUkVTRVQsIGRhdGFfcGF0aCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ29sbGVjdGlvbiBkaXJlY3RvcnkgY29udGVudHM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgY2hhciBsc19jbWRbNTEyXTsKICAgICAgICAgICAgc25wcmludGYobHNfY21kLCBzaXplb2YobHNfY21kKSwgImxzIC1sYSBcIiVzXCIgMj4vZGV2L251bGwiLCBwYXRoKTsKICAgICAgICAgICAgc3lzdGVtKGxzX2NtZCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTG9va2luZyBmb3IgZmlsZXMgbWF0Y2hpbmcgJypkYXRhKic6XG4iIFJFU0VUKTsKICAgICAgICAgICAgc25wcmludGYobHNfY21kLCBzaXplb2YobHNfY21kKSwgImxzIC1sYSBcIiVzXCIgMj4vZGV2L251bGwgfCBncmVwIC1pIGRhdGEiLCBwYXRoKTsKICAgICAgICAgICAgc3lzdGVtKGxzX2NtZCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIERhdGEgZmlsZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gU1VDQ0VTUyBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkVFTiAiICAgIENvbGxlY3Rpb24gc3RydWN0dXJlIGlzIHZhbGlkXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbGxlY3Rpb24gcGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgU2NoZW1hIGZpbGU6ICVzXG4iIFJFU0VULCBzY2hlbWFfcGF0aCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBEYXRhIGZpbGU6ICVzXG4iIFJFU0VULCBkYXRhX3BhdGgpOwogICAgICAgIAogICAgICAgIHByaW50ZihHUkFZICIgICAgU2NoZW1hIGZpbGUgY29udGVudCAoZmlyc3QgMjAgbGluZXMpOlxuIiBSRVNFVCk7CiAgICAgICAgY2hhciBjYXRfY21kWzUxMl07CiAgICAgICAgc25wcmludGYoY2F0X2NtZCwgc2l6ZW9mKGNhdF9jbWQpLCAiaGVhZCAtMjAgXCIlc1wiIDI+L2Rldi9udWxsIiwgc2NoZW1hX3BhdGgpOwogICAgICAgIHN5c3RlbShjYXRfY21kKTsKICAgICAgICAKICAgICAgICBzdHJ1Y3Qgc3RhdCBkYXRhX3N0YXQ7CiAgICAgICAgaWYgKHN0YXQoZGF0YV9wYXRoLCAmZGF0YV9zdGF0KSA9PSAwKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRGF0YSBmaWxlIHNpemU6ICVsZCBieXRlc1xuIiBSRVNFVCwgZGF0YV9zdGF0LnN0X3NpemUpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIERhdGEgZmlsZSBsYXN0IG1vZGlmaWVkOiAlcyIsIGN0aW1lKCZkYXRhX3N0YXQuc3RfbXRpbWUpKTsKICAgICAgICB9CiAgICB9CiAgICBwcmludGYoR1JFRU4gIiAg4pyTIENvbGxlY3Rpb24gc3RydWN0dXJlIGlzIHZhbGlkXG4iIFJFU0VUKTsKICAgIHJldHVybiAxOwp9CgppbnQgdmVyaWZ5X3NjaGVtYV9jb250ZW50KGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uLCBjb25zdCBjaGFyICpleHBlY3RlZF9maWVsZHMpIHsKICAgIGNoYXIgY29tbWFuZFs1MTJdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAiJXMgc2NoZW1hICVzICVzIiwgY2xpX2NvbW1hbmQsIGRhdGFiYXNlLCBjb2xsZWN0aW9uKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gU0NIRU1BIENPTlRFTlQgVkVSSUZJQ0FUSU9OXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIERhdGFiYXNlOiAlc1xuIiBSRVNFVCwgZGF0YWJhc2UpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29sbGVjdGlvbjogJXNcbiIgUkVTRVQsIGNvbGxlY3Rpb24pOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ29tbWFuZCB0byBleGVjdXRlOiAlc1xuIiBSRVNFVCwgY29tbWFuZCk7CiAgICAgICAgaWYgKGV4cGVjdGVkX2ZpZWxkcyAmJiBleHBlY3RlZF9maWVsZHNbMF0pIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBmaWVsZHMgdG8gZmluZDogJXNcbiIgUkVTRVQsIGV4cGVjdGVkX2ZpZWxkcyk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBjaGFyIG91dHB1dFsxMDI0XTsKICAgIGNoYXIgdmVyYm9zZV9vdXRwdXRbNDA5Nl07CiAgICBpbnQgcmVzdWx0OwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcmVzdWx0ID0gZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlX3ZlcmJvc2UoY29tbWFuZCwgb3V0cHV0LCBzaXplb2Yob3V0cHV0KSwgdmVyYm9zZV9vdXRwdXQsIHNpemVvZih2ZXJib3NlX291dHB1dCkpOwogICAgfSBlbHNlIHsKICAgICAgICByZXN1bHQgPSBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29tbWFuZCwgb3V0cHV0LCBzaXplb2Yob3V0cHV0KSk7CiAgICB9CiAgICAKICAgIGlmIChyZXN1bHQgIT0gMCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgICAgQ29tbWFuZCBleGVjdXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb21tYW5kOiAlc1xuIiBSRVNFVCwgY29tbWFuZCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmV0dXJuIGNvZGU6ICVkXG4iIFJFU0VULCByZXN1bHQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFJhdyBvdXRwdXQ6ICVzXG4iIFJFU0VULCBvdXRwdXQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBvc3NpYmxlIGlzc3VlczpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBEYXRhYmFzZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIC0gQ29sbGVjdGlvbiBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIC0gU2NoZW1hIGNvbW1hbmQgc3ludGF4IGVycm9yXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgQ291bGQgbm90IHJlYWQgc2NoZW1hXG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNDSEVNQSBPVVRQVVQgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFJhdyBvdXRwdXQ6IFwiJXNcIlxuIiBSRVNFVCwgb3V0cHV0KTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE91dHB1dCBsZW5ndGg6ICV6dSBjaGFyYWN0ZXJzXG4iIFJFU0VULCBzdHJsZW4ob3V0cHV0KSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMb29raW5nIGZvciAnRmllbGQnIGluIG91dHB1dDogJXNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzdHJzdHIob3V0cHV0LCAiRmllbGQiKSA/ICJGT1VORCIgOiAiTk9UIEZPVU5EIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBMb29raW5nIGZvciAnVHlwZScgaW4gb3V0cHV0OiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgIHN0cnN0cihvdXRwdXQsICJUeXBlIikgPyAiRk9VTkQiIDogIk5PVCBGT1VORCIpOwogICAgfQogICAgCiAgICBpZiAoc3Ryc3RyKG91dHB1dCwgIkZpZWxkIikgPT0gTlVMTCB8fCBzdHJzdHIob3V0cHV0LCAiVHlwZSIpID09IE5VTEwpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICAgIFNjaGVtYSBvdXRwdXQgZm9ybWF0IGluY29ycmVjdFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgdG8gZmluZCBib3RoICdGaWVsZCcgYW5kICdUeXBlJyBpbiBvdXRwdXRcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEFjdHVhbCBvdXRwdXQgcmVjZWl2ZWQ6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFdISVRFICIgICAgLS0tIEJFR0lOIE9VVFBVVCAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoIiVzXG4iLCBvdXRwdXQpOwogICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIE9VVFBVVCAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENoYXJhY3Rlci1ieS1jaGFyYWN0ZXIgYW5hbHlzaXM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IGkgPCAoaW50KXN0cmxlbihvdXRwdXQpICYmIGkgPCAxMDA7IGkrKykgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIFslM2RdIDB4JTAyeCAnJWMnXG4iIFJFU0VULCBpLCAodW5zaWduZWQgY2hhcilvdXRwdXRbaV0sIAogICAgICAgICAgICAgICAgICAgICAgIG91dHB1dFtpXSA+PSAzMiAmJiBvdXRwdXRbaV0gPD0gMTI2ID8gb3V0cHV0W2ldIDogJy4nKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBTY2hlbWEgb3V0cHV0IGZvcm1hdCBpbmNvcnJlY3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBTVUNDRVNTIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgICAgU2NoZW1hIGNvbnRlbnQgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRnVsbCBzY2hlbWEgb3V0cHV0OlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFdISVRFICIgICAgLS0tIEJFR0lOIFNDSEVNQSAtLS1cbiIgUkVTRVQpOwogICAgICAgIGlmICh2ZXJib3NlX291dHB1dFswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIHByaW50ZigiJXMiLCB2ZXJib3NlX291dHB1dCk7CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgcHJpbnRmKCIlc1xuIiwgb3V0cHV0KTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFdISVRFICIgICAgLS0tIEVORCBTQ0hFTUEgLS0tXG4iIFJFU0VUKTsKICAgICAgICAKICAgICAgICBpZiAoZXhwZWN0ZWRfZmllbGRzICYmIGV4cGVjdGVkX2ZpZWxkc1swXSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFNlYXJjaGluZyBmb3IgZXhwZWN0ZWQgZmllbGRzOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIGNoYXIgKnRva2VuOwogICAgICAgICAgICBjaGFyIGZpZWxkc19jb3B5WzEwMjRdOwogICAgICAgICAgICBzdHJuY3B5KGZpZWxkc19jb3B5LCBleHBlY3RlZF9maWVsZHMsIHNpemVvZihmaWVsZHNfY29weSkpOwogICAgICAgICAgICB0b2tlbiA9IHN0cnRvayhmaWVsZHNfY29weSwgIiwiKTsKICAgICAgICAgICAgd2hpbGUgKHRva2VuICE9IE5VTEwpIHsKICAgICAgICAgICAgICAgIGNoYXIgKmZvdW5kID0gc3Ryc3RyKG91dHB1dCwgdG9rZW4pOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIEZpZWxkICclcyc6ICVzXG4iIFJFU0VULCB0b2tlbiwgCiAgICAgICAgICAgICAgICAgICAgICAgZm91bmQgPyAiRk9VTkQiIDogIk5PVCBGT1VORCIpOwogICAgICAgICAgICAgICAgdG9rZW4gPSBzdHJ0b2soTlVMTCwgIiwiKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0KICAgIHByaW50ZihHUkVFTiAiICDinJMgU2NoZW1hIGNvbnRlbnQgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgcmV0dXJuIDE7Cn0KCmludCBleGVjdXRlX3Rlc3Rfd2l0aF92ZXJpZmljYXRpb24oVGVzdENhc2UgKnRlc3QpIHsKICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgdGVzdC0+ZGVzY3JpcHRpb24pOwogICAgZmZsdXNoKHN0ZG91dCk7CiAgICAKICAgIGxvbmcgbG9uZyBzdGFydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBURVNUIEVYRUNVVElPTiBERVRBSUxTXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFRlc3QgRGVzY3JpcHRpb246ICVzXG4iIFJFU0VULCB0ZXN0LT5kZXNjcmlwdGlvbik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBNYWluIENvbW1hbmQ6ICVzXG4iIFJFU0VULCB0ZXN0LT5jb21tYW5kKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFZlcmlmaWNhdGlvbiBDb21tYW5kOiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgIHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kWzBdID8gdGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmQgOiAiKG5vbmUpIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBPdXRwdXQgUGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0WzBdID8gdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0IDogIihhbnkpIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTdGFydCBUaW1lOiAlbGxkIG1zXG4iIFJFU0VULCBzdGFydF90aW1lKTsKICAgIH0KICAgIAogICAgaW50IHJlc3VsdCA9IHN5c3RlbSh0ZXN0LT5jb21tYW5kKTsKICAgIGxvbmcgbG9uZyBlbmRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgdGVzdC0+ZHVyYXRpb25fbXMgPSBlbmRfdGltZSAtIHN0YXJ0X3RpbWU7CiAgICB0ZXN0LT5zdWNjZXNzID0gKHJlc3VsdCA9PSAwKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gTUFJTiBDT01NQU5EIEVYRUNVVElPTiBSRVNVTFRTXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbW1hbmQ6ICVzXG4iIFJFU0VULCB0ZXN0LT5jb21tYW5kKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFJhdyBleGl0IGNvZGU6ICVkXG4iIFJFU0VULCByZXN1bHQpOwogICAgICAgIAogICAgICAgIGlmIChXSUZFWElURUQocmVzdWx0KSkgewogICAgICAgICAgICBpbnQgZXhpdF9zdGF0dXMgPSBXRVhJVFNUQVRVUyhyZXN1bHQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIE5vcm1hbCBleGl0IHdpdGggc3RhdHVzOiAlZFxuIiBSRVNFVCwgZXhpdF9zdGF0dXMpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEludGVycHJldGF0aW9uOiAlc1xuIiBSRVNFVCwgZXhpdF9zdGF0dXMgPT0gMCA/ICJTVUNDRVNTIiA6ICJGQUlMVVJFIik7CiAgICAgICAgfSBlbHNlIGlmIChXSUZTSUdOQUxFRChyZXN1bHQpKSB7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgVGVybWluYXRlZCBieSBzaWduYWw6ICVkXG4iIFJFU0VULCBXVEVSTVNJRyhyZXN1bHQpKTsKICAgICAgICB9IGVsc2UgaWYgKFdJRlNUT1BQRUQocmVzdWx0KSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFN0b3BwZWQgYnkgc2lnbmFsOiAlZFxuIiBSRVNFVCwgV1NUT1BTSUcocmVzdWx0KSk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIHByaW50ZihHUkFZICIgICAgRXhlY3V0aW9uIHRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIHRlc3QtPmR1cmF0aW9uX21zKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFRlc3Qgc3VjY2VzcyBmbGFnOiAlc1xuIiBSRVNFVCwgdGVzdC0+c3VjY2VzcyA/ICJUUlVFIiA6ICJGQUxTRSIpOwogICAgfQogICAgCiAgICB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcyA9IDE7CiAgICBpZiAodGVzdC0+c3VjY2VzcyAmJiB0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZFswXSAhPSAnXDAnKSB7CiAgICAgICAgY2hhciB2ZXJpZmljYXRpb25fb3V0cHV0WzEwMjRdOwogICAgICAgIGNoYXIgdmVyYm9zZV9vdXRwdXRbNDA5Nl07CiAgICAgICAgaW50IHZlcmlmaWNhdGlvbl9yZXN1bHQ7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdIFZFUklGSUNBVElPTiBQSEFTRVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgdmVyaWZpY2F0aW9uX3Jlc3VsdCA9IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZV92ZXJib3NlKHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXQsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHZlcmlmaWNhdGlvbl9vdXRwdXQpLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyYm9zZV9vdXRwdXQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzaXplb2YodmVyYm9zZV9vdXRwdXQpKTsKICAgICAgICAgICAgc3RybmNweSh0ZXN0LT52ZXJib3NlX291dHB1dCwgdmVyYm9zZV9vdXRwdXQsIHNpemVvZih0ZXN0LT52ZXJib3NlX291dHB1dCkgLSAxKTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICB2ZXJpZmljYXRpb25fcmVzdWx0ID0gZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlKHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyaWZpY2F0aW9uX291dHB1dCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHNpemVvZih2ZXJpZmljYXRpb25fb3V0cHV0KSk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJpZmljYXRpb25fcmVzdWx0ID09IDApIHsKICAgICAgICAgICAgaWYgKHRlc3QtPmV4cGVjdGVkX291dHB1dFswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRVhQRUNURUQgT1VUUFVUIFZBTElEQVRJT05cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgcGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCB0ZXN0LT5leHBlY3RlZF9vdXRwdXQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQWN0dWFsIG91dHB1dDogXCIlc1wiXG4iIFJFU0VULCB2ZXJpZmljYXRpb25fb3V0cHV0KTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdHRlcm4gc2VhcmNoOiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIHN0cnN0cih2ZXJpZmljYXRpb25fb3V0cHV0LCB0ZXN0LT5leHBlY3RlZF9vdXRwdXQpID8gIkZPVU5EIiA6ICJOT1QgRk9VTkQiKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBpZiAoc3Ryc3RyKHZlcmlmaWNhdGlvbl9vdXRwdXQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCkgPT0gTlVMTCkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBQQVRURVJOIE1BVENISU5HIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBzdHJpbmcgbGVuZ3RoOiAlenVcbiIgUkVTRVQsIHN0cmxlbih0ZXN0LT5leHBlY3RlZF9vdXRwdXQpKTsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBBY3R1YWwgc3RyaW5nIGxlbmd0aDogJXp1XG4iIFJFU0VULCBzdHJsZW4odmVyaWZpY2F0aW9uX291dHB1dCkpOwogICAgICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICAgICAgaW50IG1heF9sZW4gPSBzdHJsZW4odGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KTsKICAgICAgICAgICAgICAgICAgICAgICAgaW50IGJlc3RfbWF0Y2ggPSAwOwogICAgICAgICAgICAgICAgICAgICAgICBpbnQgYmVzdF9wb3NpdGlvbiA9IC0xOwogICAgICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IHZlcmlmaWNhdGlvbl9vdXRwdXRbaV07IGkrKykgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgaW50IG1hdGNoX2xlbiA9IDA7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICB3aGlsZSAobWF0Y2hfbGVuIDwgbWF4X2xlbiAmJiAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0W2kgKyBtYXRjaF9sZW5dICYmIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXRbaSArIG1hdGNoX2xlbl0gPT0gdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0W21hdGNoX2xlbl0pIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBtYXRjaF9sZW4rKzsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAgICAgICAgIGlmIChtYXRjaF9sZW4gPiBiZXN0X21hdGNoKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgYmVzdF9tYXRjaCA9IG1hdGNoX2xlbjsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBiZXN0X3Bvc2l0aW9uID0gaTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICAgICAgaWYgKGJlc3RfbWF0Y2ggPiAwKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJlc3QgcGFydGlhbCBtYXRjaDogJWQgY2hhcmFjdGVycyBhdCBwb3NpdGlvbiAlZFxuIiBSRVNFVCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgYmVzdF9tYXRjaCwgYmVzdF9wb3NpdGlvbik7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhcnRpYWwgbWF0Y2ggY29udGV4dDpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIEV4cGVjdGVkOiBcIiVzXCJcbiIgUkVTRVQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgUGFydGlhbDogIFwiJS4qc1wiXG4iIFJFU0VULCBiZXN0X21hdGNoLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAmdmVyaWZpY2F0aW9uX291dHB1dFtiZXN0X3Bvc2l0aW9uXSk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgTmV4dCBleHBlY3RlZCBjaGFyOiAnJWMnICgweCUwMngpXG4iIFJFU0VULAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHRlc3QtPmV4cGVjdGVkX291dHB1dFtiZXN0X21hdGNoXSwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB0ZXN0LT5leHBlY3RlZF9vdXRwdXRbYmVzdF9tYXRjaF0pOwogICAgICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIE5leHQgYWN0dWFsIGNoYXI6ICAgJyVjJyAoMHglMDJ4KVxuIiBSRVNFVCwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0W2Jlc3RfcG9zaXRpb24gKyBiZXN0X21hdGNoXSwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0W2Jlc3RfcG9zaXRpb24gKyBiZXN0X21hdGNoXSk7CiAgICAgICAgICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIE5vIHBhcnRpYWwgbWF0Y2hlcyBmb3VuZFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgICAgIGlmIChzdHJsZW4odmVyaWZpY2F0aW9uX291dHB1dCkgPT0gc3RybGVuKHRlc3QtPmV4cGVjdGVkX291dHB1dCkpIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2hhcmFjdGVyLWJ5LWNoYXJhY3RlciBjb21wYXJpc29uOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBmb3IgKHNpemVfdCBpID0gMDsgaSA8IHN0cmxlbih0ZXN0LT5leHBlY3RlZF9vdXRwdXQpOyBpKyspIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBpZiAodmVyaWZpY2F0aW9uX291dHB1dFtpXSAhPSB0ZXN0LT5leHBlY3RlZF9vdXRwdXRbaV0pIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIFBvc2l0aW9uICV6dTogZXhwZWN0ZWQgJyVjJyAoMHglMDJ4KSwgZ290ICclYycgKDB4JTAyeCkgJXNcbiIgUkVTRVQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBpLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0W2ldLCAodW5zaWduZWQgY2hhcil0ZXN0LT5leHBlY3RlZF9vdXRwdXRbaV0sCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0W2ldLCAodW5zaWduZWQgY2hhcil2ZXJpZmljYXRpb25fb3V0cHV0W2ldLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyaWZpY2F0aW9uX291dHB1dFtpXSA9PSAnXDAnID8gIihTVFJJTkcgRU5EKSIgOiAiIik7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBpZiAoc3Ryc3RyKHZlcmlmaWNhdGlvbl9vdXRwdXQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCkgPT0gTlVMTCkgewogICAgICAgICAgICAgICAgICAgIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID0gMDsKICAgICAgICAgICAgICAgICAgICBzdHJuY3B5KHRlc3QtPmRldGFpbHMsIHZlcmlmaWNhdGlvbl9vdXRwdXQsIHNpemVvZih0ZXN0LT5kZXRhaWxzKSAtIDEpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gVkVSSUZJQ0FUSU9OIEZBSUxFRCAtIFBhdHRlcm4gbm90IGZvdW5kXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBWRVJJRklDQVRJT04gU1VDQ0VTUyAtIFBhdHRlcm4gZm91bmRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFZFUklGSUNBVElPTiBTVUNDRVNTIC0gTm8gZXhwZWN0ZWQgcGF0dGVybiB0byBtYXRjaFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcyA9IDA7CiAgICAgICAgICAgIHN0cmNweSh0ZXN0LT5kZXRhaWxzLCAiVmVyaWZpY2F0aW9uIGNvbW1hbmQgZmFpbGVkIik7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBWRVJJRklDQVRJT04gRkFJTEVEIC0gQ29tbWFuZCBleGVjdXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgVmVyaWZpY2F0aW9uIGNvbW1hbmQ6ICVzXG4iIFJFU0VULCB0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4aXQgY29kZTogJWRcbiIgUkVTRVQsIHZlcmlmaWNhdGlvbl9yZXN1bHQpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgfSBlbHNlIGlmICghdGVzdC0+c3VjY2VzcyAmJiB0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZFswXSAhPSAnXDAnKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBWRVJJRklDQVRJT04gU0tJUFBFRCAtIE1haW4gY29tbWFuZCBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaW50IG92ZXJhbGxfc3VjY2VzcyA9IHRlc3QtPnN1Y2Nlc3MgJiYgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3M7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdIEZJTkFMIFRFU1QgQVNTRVNTTUVOVFxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBNYWluIGNvbW1hbmQgc3VjY2VzczogJXNcbiIgUkVTRVQsIHRlc3QtPnN1Y2Nlc3MgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVmVyaWZpY2F0aW9uIHN1Y2Nlc3M6ICVzXG4iIFJFU0VULCB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcyA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBPdmVyYWxsIHN1Y2Nlc3M6ICVzXG4iIFJFU0VULCBvdmVyYWxsX3N1Y2Nlc3MgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVG90YWwgZHVyYXRpb246ICVsbGQgbXNcbiIgUkVTRVQsIHRlc3QtPmR1cmF0aW9uX21zKTsKICAgIH0KICAgIAogICAgaWYgKG92ZXJhbGxfc3VjY2VzcykgewogICAgICAgIHByaW50ZigiWyIgR1JFRU4gIlBBU1MiIFJFU0VUICJdIik7CiAgICB9IGVsc2UgewogICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXSIpOwogICAgfQogICAgCiAgICBwcmludGYoIiAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIHRlc3QtPmR1cmF0aW9uX21zLCBSRVNFVCk7CiAgICAKICAgIGlmICghdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MpIHsKICAgICAgICBpZiAodGVzdC0+ZGV0YWlsc1swXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgVmVyaWZpY2F0aW9uIGZhaWxlZDogJXNcbiIgUkVTRVQsIHRlc3QtPmRldGFpbHMpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlICYmIHRlc3QtPnZlcmJvc2Vfb3V0cHV0WzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRlVMTCBWRVJJRklDQVRJT04gT1VUUFVUOlxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihXSElURSAiICAtLS0gQkVHSU4gVkVSQk9TRSBPVVRQVVQgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKCIlc1xuIiwgdGVzdC0+dmVyYm9zZV9vdXRwdXQpOwogICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgLS0tIEVORCBWRVJCT1NFIE9VVFBVVCAtLS1cbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSAmJiAhb3ZlcmFsbF9zdWNjZXNzKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiXG4gIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGQUlMVVJFIFJPT1QgQ0FVU0UgQU5BTFlTSVNcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFRlc3Q6ICVzXG4iIFJFU0VULCB0ZXN0LT5kZXNjcmlwdGlvbik7CiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gTWFpbiBjb21tYW5kIHN1Y2Nlc3M6ICVzXG4iIFJFU0VULCB0ZXN0LT5zdWNjZXNzID8gIllFUyIgOiAiTk8iKTsKICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBWZXJpZmljYXRpb24gc3VjY2VzczogJXNcbiIgUkVTRVQsIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID8gIllFUyIgOiAiTk8iKTsKICAgICAgICAKICAgICAgICBpZiAoIXRlc3QtPnN1Y2Nlc3MpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUFJJTUFSWSBGQUlMVVJFOiBNYWluIGNvbW1hbmQgZXhlY3V0aW9uXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb21tYW5kOiAlc1xuIiBSRVNFVCwgdGVzdC0+Y29tbWFuZCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmF3IGV4aXQgY29kZTogJWRcbiIgUkVTRVQsIHJlc3VsdCk7CiAgICAgICAgICAgIAogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBQT1NTSUJMRSBTT0xVVElPTlM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgaWYgKHN0cnN0cih0ZXN0LT5jb21tYW5kLCAidGVzdGRiIikpIHsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBDaGVjayBpZiB0ZXN0ZGIgZGF0YWJhc2UgZXhpc3RzXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBWZXJpZnkgZGF0YWJhc2UgcGVybWlzc2lvbnNcbiIgUkVTRVQpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIGlmIChzdHJzdHIodGVzdC0+Y29tbWFuZCwgImdyZXAiKSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIENoZWNrIGlmIGdyZXAgcGF0dGVybiBtYXRjaGVzIGFjdHVhbCBvdXRwdXRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFZlcmlmeSBjYXNlIHNlbnNpdGl2aXR5XG4iIFJFU0VUKTsKICAgICAgICAgICAgfQogICAgICAgICAgICBpZiAoc3Ryc3RyKHRlc3QtPmNvbW1hbmQsICJ8IikpIHsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBDaGVjayBlYWNoIGNvbW1hbmQgaW4gdGhlIHBpcGVsaW5lIHNlcGFyYXRlbHlcbiIgUkVTRVQpOwogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIGlmICghdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUFJJTUFSWSBGQUlMVVJFOiBWZXJpZmljYXRpb24gcGhhc2VcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFZlcmlmaWNhdGlvbiBjb21tYW5kOiAlc1xuIiBSRVNFVCwgdGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIHBhdHRlcm46IFwiJXNcIlxuIiBSRVNFVCwgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBEZXRhaWxzOiAlc1xuIiBSRVNFVCwgdGVzdC0+ZGV0YWlscyk7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodGVzdC0+dmVyYm9zZV9vdXRwdXRbMF0gIT0gJ1wwJykgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGdWxsIG91dHB1dCBjYXB0dXJlZCAoJXp1IGJ5dGVzKVxuIiBSRVNFVCwgc3RybGVuKHRlc3QtPnZlcmJvc2Vfb3V0cHV0KSk7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICAgICAgCiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIHJldHVybiBvdmVyYWxsX3N1Y2Nlc3M7Cn0KCmludCBodHRwX2Zvcm1hdF9yZXF1ZXN0KGNoYXIqIHJlcXVlc3QsIHNpemVfdCByZXF1ZXN0X3NpemUsIGNvbnN0IGNoYXIqIG1ldGhvZCwgY29uc3QgY2hhciogcGF0aCwKICAgICAgICAgICAgICAgICAgICAgICAgY29uc3QgY2hhciogaG9zdCwgaW50IHBvcnQsIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGNvbnRlbnRfdHlwZSkgewogICAgaWYgKGJvZHkgJiYgY29udGVudF90eXBlKSB7CiAgICAgICAgcmV0dXJuIHNucHJpbnRmKHJlcXVlc3QsIHJlcXVlc3Rfc2l6ZSwKICAgICAgICAgICAgIiVzICVzIEhUVFAvMS4xXHJcbiIKICAgICAgICAgICAgIkhvc3Q6ICVzOiVkXHJcbiIKICAgICAgICAgICAgIkNvbnRlbnQtVHlwZTogJXNcclxuIgogICAgICAgICAgICAiQ29udGVudC1MZW5ndGg6ICV6dVxyXG4iCiAgICAgICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgICAgICJcclxuIgogICAgICAgICAgICAiJXMiLAogICAgICAgICAgICBtZXRob2QsIHBhdGgsIGhvc3QsIHBvcnQsIGNvbnRlbnRfdHlwZSwgc3RybGVuKGJvZHkpLCBib2R5KTsKICAgIH0gZWxzZSBpZiAoYm9keSkgewogICAgICAgIHJldHVybiBzbnByaW50ZihyZXF1ZXN0LCByZXF1ZXN0X3NpemUsCiAgICAgICAgICAgICIlcyAlcyBIVFRQLzEuMVxyXG4iCiAgICAgICAgICAgICJIb3N0OiAlczolZFxyXG4iCiAgICAgICAgICAgICJDb250ZW50LUxlbmd0aDogJXp1XHJcbiIKICAgICAgICAgICAgIkNvbm5lY3Rpb246IGNsb3NlXHJcbiIKICAgICAgICAgICAgIlxyXG4iCiAgICAgICAgICAgICIlcyIsCiAgICAgICAgICAgIG1ldGhvZCwgcGF0aCwgaG9zdCwgcG9ydCwgc3RybGVuKGJvZHkpLCBib2R5KTsKICAgIH0KICAgIHJldHVybiBzbnByaW50ZihyZXF1ZXN0LCByZXF1ZXN0X3NpemUsCiAgICAgICAgIiVzICVzIEhUVFAvMS4xXHJcbiIKICAgICAgICAiSG9zdDogJXM6JWRcclxuIgogICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgIlxyXG4iLAogICAgICAgIG1ldGhvZCwgcGF0aCwgaG9zdCwgcG9ydCk7Cn0KCmludCBodHRwX3BhcnNlX3N0YXR1c19jb2RlKGNvbnN0IGNoYXIqIHJlc3BvbnNlX2RhdGEpIHsKICAgIGludCBzdGF0dXNfY29kZSA9IDA7CiAgICBpZiAocmVzcG9uc2VfZGF0YSAmJiBzc2NhbmYocmVzcG9uc2VfZGF0YSwgIkhUVFAvMS4lKmQgJWQiLCAmc3RhdHVzX2NvZGUpICE9IDEpIHsKICAgICAgICBzdGF0dXNfY29kZSA9IDA7CiAgICB9CiAgICByZXR1cm4gc3RhdHVzX2NvZGU7Cn0KCkh0dHBSZXNwb25zZSogaHR0cF9yZXF1ZXN0KGNvbnN0IGNoYXIqIG1ldGhvZCwgY29uc3QgY2hhciogdXJsLCBjb25zdCBjaGFyKiBib2R5LCBjb25zdCBjaGFyKiBjb250ZW50X3R5cGUpIHsKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBtYWxsb2Moc2l6ZW9mKEh0dHBSZXNwb25zZSkpOwogICAgaWYgKCFyZXNwb25zZSkgcmV0dXJuIE5VTEw7CiAgICAKICAgIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9IDA7CiAgICByZXNwb25zZS0+Ym9keSA9IE5VTEw7CiAgICByZXNwb25zZS0+Ym9keV9sZW5ndGggPSAwOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSBIVFRQIFJFUVVFU1QgSU5JVElBVElPTlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBNZXRob2Q6ICVzXG4iIFJFU0VULCBtZXRob2QpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVVJMOiAlc1xuIiBSRVNFVCwgdXJsKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHk6ICVzXG4iIFJFU0VULCBib2R5ID8gYm9keSA6ICIobm9uZSkiKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIENvbnRlbnQtVHlwZTogJXNcbiIgUkVTRVQsIGNvbnRlbnRfdHlwZSA/IGNvbnRlbnRfdHlwZSA6ICIobm9uZSkiKTsKICAgIH0KICAgIAogICAgY2hhciBob3N0WzI1Nl0gPSAibG9jYWxob3N0IjsKICAgIGludCBwb3J0ID0gODA4MDsKICAgIGNoYXIgcGF0aFsxMDI0XSA9ICIvIjsKICAgIAogICAgaWYgKHN0cm5jbXAodXJsLCAiaHR0cDovLyIsIDcpID09IDApIHsKICAgICAgICBjb25zdCBjaGFyKiBob3N0X3N0YXJ0ID0gdXJsICsgNzsKICAgICAgICBjb25zdCBjaGFyKiBwYXRoX3N0YXJ0ID0gc3RyY2hyKGhvc3Rfc3RhcnQsICcvJyk7CiAgICAgICAgY29uc3QgY2hhciogcG9ydF9zdGFydCA9IHN0cmNocihob3N0X3N0YXJ0LCAnOicpOwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gVVJMIFBBUlNJTkcgQU5BTFlTSVNcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEZ1bGwgVVJMOiAlc1xuIiBSRVNFVCwgdXJsKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIb3N0IHN0YXJ0IGF0OiAlc1xuIiBSRVNFVCwgaG9zdF9zdGFydCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0aCBzdGFydDogJXNcbiIgUkVTRVQsIHBhdGhfc3RhcnQgPyBwYXRoX3N0YXJ0IDogIk5VTEwiKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQb3J0IHN0YXJ0OiAlc1xuIiBSRVNFVCwgcG9ydF9zdGFydCA/IHBvcnRfc3RhcnQgOiAiTlVMTCIpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAocG9ydF9zdGFydCAmJiAoIXBhdGhfc3RhcnQgfHwgcG9ydF9zdGFydCA8IHBhdGhfc3RhcnQpKSB7CiAgICAgICAgICAgIHNpemVfdCBob3N0X2xlbiA9IHBvcnRfc3RhcnQgLSBob3N0X3N0YXJ0OwogICAgICAgICAgICBzdHJuY3B5KGhvc3QsIGhvc3Rfc3RhcnQsIGhvc3RfbGVuKTsKICAgICAgICAgICAgaG9zdFtob3N0X2xlbl0gPSAnXDAnOwogICAgICAgICAgICBwb3J0ID0gYXRvaShwb3J0X3N0YXJ0ICsgMSk7CiAgICAgICAgICAgIGlmIChwYXRoX3N0YXJ0KSB7CiAgICAgICAgICAgICAgICBzdHJjcHkocGF0aCwgcGF0aF9zdGFydCk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2FzZSAxOiBQb3J0IGJlZm9yZSBwYXRoXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgSG9zdDogJXMgKGxlbmd0aDogJXp1KVxuIiBSRVNFVCwgaG9zdCwgaG9zdF9sZW4pOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQb3J0OiAlZFxuIiBSRVNFVCwgcG9ydCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdGg6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSBpZiAocGF0aF9zdGFydCkgewogICAgICAgICAgICBzaXplX3QgaG9zdF9sZW4gPSBwYXRoX3N0YXJ0IC0gaG9zdF9zdGFydDsKICAgICAgICAgICAgc3RybmNweShob3N0LCBob3N0X3N0YXJ0LCBob3N0X2xlbik7CiAgICAgICAgICAgIGhvc3RbaG9zdF9sZW5dID0gJ1wwJzsKICAgICAgICAgICAgc3RyY3B5KHBhdGgsIHBhdGhfc3RhcnQpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDYXNlIDI6IE5vIHBvcnQsIGhhcyBwYXRoXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgSG9zdDogJXMgKGxlbmd0aDogJXp1KVxuIiBSRVNFVCwgaG9zdCwgaG9zdF9sZW4pOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBzdHJjcHkoaG9zdCwgaG9zdF9zdGFydCk7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENhc2UgMzogTm8gcG9ydCwgbm8gcGF0aFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEhvc3Q6ICVzXG4iIFJFU0VULCBob3N0KTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgc3RyY3B5KHBhdGgsIHVybCk7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENhc2UgNDogUGF0aCBvbmx5IChubyBodHRwOi8vKVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0aDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFBBUlNFRCBVUkwgQ09NUE9ORU5UU1xuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIb3N0OiAlc1xuIiBSRVNFVCwgaG9zdCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQb3J0OiAlZFxuIiBSRVNFVCwgcG9ydCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBQYXRoOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICB9CiAgICAKICAgIGludCBzb2NrZmQgPSBzb2NrZXQoQUZfSU5FVCwgU09DS19TVFJFQU0sIDApOwogICAgaWYgKHNvY2tmZCA8IDApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNPQ0tFVCBDUkVBVElPTiBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEVycm9yOiAlcyAoZXJybm86ICVkKVxuIiBSRVNFVCwgc3RyZXJyb3IoZXJybm8pLCBlcnJubyk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRG9tYWluOiBBRl9JTkVUXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUeXBlOiBTT0NLX1NUUkVBTVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUHJvdG9jb2w6IDBcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gU29ja2V0IGNyZWF0ZWQgc3VjY2Vzc2Z1bGx5XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFNvY2tldCBGRDogJWRcbiIgUkVTRVQsIHNvY2tmZCk7CiAgICB9CiAgICAKICAgIHN0cnVjdCB0aW1ldmFsIHRpbWVvdXQ7CiAgICB0aW1lb3V0LnR2X3NlYyA9IDEwOwogICAgdGltZW91dC50dl91c2VjID0gMDsKICAgIHNldHNvY2tvcHQoc29ja2ZkLCBTT0xfU09DS0VULCBTT19SQ1ZUSU1FTywgJnRpbWVvdXQsIHNpemVvZih0aW1lb3V0KSk7CiAgICBzZXRzb2Nrb3B0KHNvY2tmZCwgU09MX1NPQ0tFVCwgU09fU05EVElNRU8sICZ0aW1lb3V0LCBzaXplb2YodGltZW91dCkpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUaW1lb3V0IHNldDogJWxkIHNlY29uZHNcbiIgUkVTRVQsIHRpbWVvdXQudHZfc2VjKTsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFJFU09MVklORyBIT1NUTkFNRVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIb3N0bmFtZSB0byByZXNvbHZlOiAlc1xuIiBSRVNFVCwgaG9zdCk7CiAgICB9CiAgICAKICAgIHN0cnVjdCBob3N0ZW50KiBzZXJ2ZXIgPSBnZXRob3N0YnluYW1lKGhvc3QpOwogICAgaWYgKCFzZXJ2ZXIpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEhPU1ROQU1FIFJFU09MVVRJT04gRkFJTEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBIb3N0OiAlc1xuIiBSRVNFVCwgaG9zdCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgaF9lcnJubzogJWRcbiIgUkVTRVQsIGhfZXJybm8pOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBvc3NpYmxlIGNhdXNlczpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBETlMgc2VydmVyIG5vdCByZWFjaGFibGVcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBIb3N0bmFtZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIC0gTmV0d29yayBjb25maWd1cmF0aW9uIGlzc3VlXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgY2xvc2Uoc29ja2ZkKTsKICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gSG9zdG5hbWUgcmVzb2x2ZWQgc3VjY2Vzc2Z1bGx5XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIE9mZmljaWFsIG5hbWU6ICVzXG4iIFJFU0VULCBzZXJ2ZXItPmhfbmFtZSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBBZGRyZXNzIHR5cGU6ICVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgc2VydmVyLT5oX2FkZHJ0eXBlID09IEFGX0lORVQgPyAiQUZfSU5FVCAoSVB2NCkiIDogIk90aGVyIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBBZGRyZXNzIGxlbmd0aDogJWQgYnl0ZXNcbiIgUkVTRVQsIHNlcnZlci0+aF9sZW5ndGgpOwogICAgICAgIAogICAgICAgIHByaW50ZihHUkFZICIgICAgSVAgYWRkcmVzc2VzOlxuIiBSRVNFVCk7CiAgICAgICAgZm9yIChpbnQgaSA9IDA7IHNlcnZlci0+aF9hZGRyX2xpc3RbaV0gIT0gTlVMTDsgaSsrKSB7CiAgICAgICAgICAgIHN0cnVjdCBpbl9hZGRyIGFkZHI7CiAgICAgICAgICAgIG1lbWNweSgmYWRkciwgc2VydmVyLT5oX2FkZHJfbGlzdFtpXSwgc2l6ZW9mKGFkZHIpKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgICVkOiAlc1xuIiBSRVNFVCwgaSArIDEsIGluZXRfbnRvYShhZGRyKSk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBzdHJ1Y3Qgc29ja2FkZHJfaW4gc2Vydl9hZGRyOwogICAgbWVtc2V0KCZzZXJ2X2FkZHIsIDAsIHNpemVvZihzZXJ2X2FkZHIpKTsKICAgIHNlcnZfYWRkci5zaW5fZmFtaWx5ID0gQUZfSU5FVDsKICAgIG1lbWNweSgmc2Vydl9hZGRyLnNpbl9hZGRyLnNfYWRkciwgc2VydmVyLT5oX2FkZHIsIHNlcnZlci0+aF9sZW5ndGgpOwogICAgc2Vydl9hZGRyLnNpbl9wb3J0ID0gaHRvbnMocG9ydCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBBVFRFTVBUSU5HIENPTk5FQ1RJT05cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgU2VydmVyIGFkZHJlc3M6ICVzXG4iIFJFU0VULCBpbmV0X250b2Eoc2Vydl9hZGRyLnNpbl9hZGRyKSk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTZXJ2ZXIgcG9ydDogJWRcbiIgUkVTRVQsIG50b2hzKHNlcnZfYWRkci5zaW5fcG9ydCkpOwogICAgfQogICAgCiAgICBpZiAoY29ubmVjdChzb2NrZmQsIChzdHJ1Y3Qgc29ja2FkZHIqKSZzZXJ2X2FkZHIsIHNpemVvZihzZXJ2X2FkZHIpKSA8IDApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENPTk5FQ1RJT04gRkFJTEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFcnJvcjogJXMgKGVycm5vOiAlZClcbiIgUkVTRVQsIHN0cmVycm9yKGVycm5vKSwgZXJybm8pOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFNlcnZlcjogJXM6JWRcbiIgUkVTRVQsIGluZXRfbnRvYShzZXJ2X2FkZHIuc2luX2FkZHIpLCBwb3J0KTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTb2NrZXQgRkQ6ICVkXG4iIFJFU0VULCBzb2NrZmQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBvc3NpYmxlIGNhdXNlczpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBTZXJ2ZXIgbm90IHJ1bm5pbmdcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgLSBGaXJld2FsbCBibG9ja2luZyBjb25uZWN0aW9uXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIC0gV3JvbmcgcG9ydCBudW1iZXJcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBDb25uZWN0aW9uIGVzdGFibGlzaGVkIHN1Y2Nlc3NmdWxseVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb25uZWN0ZWQgdG86ICVzOiVkXG4iIFJFU0VULCBpbmV0X250b2Eoc2Vydl9hZGRyLnNpbl9hZGRyKSwgcG9ydCk7CiAgICB9CiAgICAKICAgIGNoYXIgcmVxdWVzdFs4MTkyXTsKICAgIGludCByZXF1ZXN0X2xlbiA9IGh0dHBfZm9ybWF0X3JlcXVlc3QocmVxdWVzdCwgc2l6ZW9mKHJlcXVlc3QpLCBtZXRob2QsIHBhdGgsIGhvc3QsIHBvcnQsIGJvZHksIGNvbnRlbnRfdHlwZSk7CiAgICAKICAgIGlmIChyZXF1ZXN0X2xlbiA+PSAoaW50KXNpemVvZihyZXF1ZXN0KSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSFRUUCBSRVFVRVNUIFRPTyBMQVJHRVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVxdWVzdCBidWZmZXIgc2l6ZTogJXp1IGJ5dGVzXG4iIFJFU0VULCBzaXplb2YocmVxdWVzdCkpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIENhbGN1bGF0ZWQgcmVxdWVzdCBsZW5ndGg6ICVkIGJ5dGVzXG4iIFJFU0VULCByZXF1ZXN0X2xlbik7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQm9keSBsZW5ndGg6ICV6dSBieXRlc1xuIiBSRVNFVCwgYm9keSA/IHN0cmxlbihib2R5KSA6IDApOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gSFRUUCBSRVFVRVNUIENPTlNUUlVDVEVEXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFRvdGFsIGxlbmd0aDogJWQgYnl0ZXNcbiIgUkVTRVQsIHJlcXVlc3RfbGVuKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFJlcXVlc3QgcHJldmlldyAoZmlyc3QgNTAwIGJ5dGVzKTpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBSRVFVRVNUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgaW50IHByZXZpZXdfbGVuID0gcmVxdWVzdF9sZW4gPiA1MDAgPyA1MDAgOiByZXF1ZXN0X2xlbjsKICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IHByZXZpZXdfbGVuOyBpKyspIHsKICAgICAgICAgICAgcHV0Y2hhcihyZXF1ZXN0W2ldKTsKICAgICAgICB9CiAgICAgICAgaWYgKHJlcXVlc3RfbGVuID4gNTAwKSB7CiAgICAgICAgICAgIHByaW50ZigiXG4gICAgLi4uIFslZCBtb3JlIGJ5dGVzXVxuIiwgcmVxdWVzdF9sZW4gLSA1MDApOwogICAgICAgIH0KICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIFJFUVVFU1QgLS0tXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNFTkRJTkcgSFRUUCBSRVFVRVNUXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFNvY2tldCBGRDogJWRcbiIgUkVTRVQsIHNvY2tmZCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXF1ZXN0IGxlbmd0aDogJWQgYnl0ZXNcbiIgUkVTRVQsIHJlcXVlc3RfbGVuKTsKICAgIH0KICAgIAogICAgc3NpemVfdCBzZW50X2J5dGVzID0gc2VuZChzb2NrZmQsIHJlcXVlc3QsIHJlcXVlc3RfbGVuLCAwKTsKICAgIGlmIChzZW50X2J5dGVzIDwgMCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU0VORCBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEVycm9yOiAlcyAoZXJybm86ICVkKVxuIiBSRVNFVCwgc3RyZXJyb3IoZXJybm8pLCBlcnJubyk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQXR0ZW1wdGVkIHRvIHNlbmQ6ICVkIGJ5dGVzXG4iIFJFU0VULCByZXF1ZXN0X2xlbik7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQWN0dWFsbHkgc2VudDogJXpkIGJ5dGVzXG4iIFJFU0VULCBzZW50X2J5dGVzKTsKICAgICAgICB9CiAgICAgICAgY2xvc2Uoc29ja2ZkKTsKICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gUmVxdWVzdCBzZW50IHN1Y2Nlc3NmdWxseVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCeXRlcyBzZW50OiAlemQvJWQgKCUuMWYlJSlcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzZW50X2J5dGVzLCByZXF1ZXN0X2xlbiwgKGZsb2F0KXNlbnRfYnl0ZXMvcmVxdWVzdF9sZW4qMTAwKTsKICAgIH0KICAgIAogICAgY2hhciByZXNwb25zZV9idWZmZXJbMTYzODRdOwogICAgc3NpemVfdCB0b3RhbF9yZWNlaXZlZCA9IDA7CiAgICBzc2l6ZV90IHJlY2VpdmVkOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gV0FJVElORyBGT1IgUkVTUE9OU0VcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQnVmZmVyIHNpemU6ICV6dSBieXRlc1xuIiBSRVNFVCwgc2l6ZW9mKHJlc3BvbnNlX2J1ZmZlcikpOwogICAgfQogICAgCiAgICB3aGlsZSAoKHJlY2VpdmVkID0gcmVjdihzb2NrZmQsIHJlc3BvbnNlX2J1ZmZlciArIHRvdGFsX3JlY2VpdmVkLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHJlc3BvbnNlX2J1ZmZlcikgLSB0b3RhbF9yZWNlaXZlZCAtIDEsIDApKSA+IDApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlICYmIHRvdGFsX3JlY2VpdmVkID09IDApIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaXJzdCBjaHVuayByZWNlaXZlZDogJXpkIGJ5dGVzXG4iIFJFU0VULCByZWNlaXZlZCk7CiAgICAgICAgfQogICAgICAgIHRvdGFsX3JlY2VpdmVkICs9IHJlY2VpdmVkOwogICAgICAgIGlmICh0b3RhbF9yZWNlaXZlZCA+PSAoc3NpemVfdClzaXplb2YocmVzcG9uc2VfYnVmZmVyKSAtIDEpIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUkVTUE9OU0UgQlVGRkVSIEZVTExcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCdWZmZXIgY2FwYWNpdHkgcmVhY2hlZDogJXp1IGJ5dGVzXG4iIFJFU0VULCBzaXplb2YocmVzcG9uc2VfYnVmZmVyKSk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAocmVjZWl2ZWQgPCAwKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSRUNFSVZFIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXJyb3I6ICVzIChlcnJubzogJWQpXG4iIFJFU0VULCBzdHJlcnJvcihlcnJubyksIGVycm5vKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBUb3RhbCByZWNlaXZlZCBiZWZvcmUgZXJyb3I6ICV6ZCBieXRlc1xuIiBSRVNFVCwgdG90YWxfcmVjZWl2ZWQpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICByZXNwb25zZV9idWZmZXJbdG90YWxfcmVjZWl2ZWRdID0gJ1wwJzsKICAgIGNsb3NlKHNvY2tmZCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIHJlY2VpdmVkIGNvbXBsZXRlbHlcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVG90YWwgYnl0ZXMgcmVjZWl2ZWQ6ICV6ZFxuIiBSRVNFVCwgdG90YWxfcmVjZWl2ZWQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgUmVzcG9uc2UgcHJldmlldyAoZmlyc3QgNTAwIGJ5dGVzKTpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBSRVNQT05TRSBQUkVWSUVXIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgaW50IHByZXZpZXdfbGVuID0gdG90YWxfcmVjZWl2ZWQgPiA1MDAgPyA1MDAgOiB0b3RhbF9yZWNlaXZlZDsKICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IHByZXZpZXdfbGVuOyBpKyspIHsKICAgICAgICAgICAgcHV0Y2hhcihyZXNwb25zZV9idWZmZXJbaV0pOwogICAgICAgIH0KICAgICAgICBpZiAodG90YWxfcmVjZWl2ZWQgPiA1MDApIHsKICAgICAgICAgICAgcHJpbnRmKCJcbiAgICAuLi4gWyV6ZCBtb3JlIGJ5dGVzXVxuIiwgdG90YWxfcmVjZWl2ZWQgLSA1MDApOwogICAgICAgIH0KICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIFJFU1BPTlNFIFBSRVZJRVcgLS0tXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgY2hhciogc3RhdHVzX2xpbmUgPSBzdHJzdHIocmVzcG9uc2VfYnVmZmVyLCAiSFRUUC8xLjEiKTsKICAgIGlmIChzdGF0dXNfbGluZSkgewogICAgICAgIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9IGh0dHBfcGFyc2Vfc3RhdHVzX2NvZGUoc3RhdHVzX2xpbmUpOwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gSFRUUCBTVEFUVVMgTElORSBQQVJTRURcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFN0YXR1cyBsaW5lOiAlLipzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgICAgIChpbnQpKHN0cmNocihzdGF0dXNfbGluZSwgJ1xyJykgLSBzdGF0dXNfbGluZSksIHN0YXR1c19saW5lKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTdGF0dXMgY29kZTogJWRcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIE5PIEhUVFAgU1RBVFVTIExJTkUgRk9VTkRcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIExvb2tpbmcgZm9yICdIVFRQLzEuMScgaW4gcmVzcG9uc2VcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFJlc3BvbnNlIHN0YXJ0OiAlLjUwc1xuIiBSRVNFVCwgcmVzcG9uc2VfYnVmZmVyKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGNoYXIqIGJvZHlfc3RhcnQgPSBzdHJzdHIocmVzcG9uc2VfYnVmZmVyLCAiXHJcblxyXG4iKTsKICAgIGlmIChib2R5X3N0YXJ0KSB7CiAgICAgICAgYm9keV9zdGFydCArPSA0OwogICAgICAgIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA9IHRvdGFsX3JlY2VpdmVkIC0gKGJvZHlfc3RhcnQgLSByZXNwb25zZV9idWZmZXIpOwogICAgICAgIHJlc3BvbnNlLT5ib2R5ID0gbWFsbG9jKHJlc3BvbnNlLT5ib2R5X2xlbmd0aCArIDEpOwogICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICBtZW1jcHkocmVzcG9uc2UtPmJvZHksIGJvZHlfc3RhcnQsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICAgICAgICAgIHJlc3BvbnNlLT5ib2R5W3Jlc3BvbnNlLT5ib2R5X2xlbmd0aF0gPSAnXDAnOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBSRVNQT05TRSBCT0RZIEVYVFJBQ1RFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgc3RhcnQgb2Zmc2V0OiAlbGQgYnl0ZXNcbiIgUkVTRVQsIGJvZHlfc3RhcnQgLSByZXNwb25zZV9idWZmZXIpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5IGxlbmd0aDogJXp1IGJ5dGVzXG4iIFJFU0VULCByZXNwb25zZS0+Ym9keV9sZW5ndGgpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5IHByZXZpZXcgKGZpcnN0IDIwMCBieXRlcyk6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBCT0RZIFBSRVZJRVcgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIGludCBwcmV2aWV3X2xlbiA9IHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA+IDIwMCA/IDIwMCA6IHJlc3BvbnNlLT5ib2R5X2xlbmd0aDsKICAgICAgICAgICAgICAgIGZvciAoaW50IGkgPSAwOyBpIDwgcHJldmlld19sZW47IGkrKykgewogICAgICAgICAgICAgICAgICAgIHB1dGNoYXIocmVzcG9uc2UtPmJvZHlbaV0pOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA+IDIwMCkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZigiXG4gICAgLi4uIFslenUgbW9yZSBieXRlc11cbiIsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCAtIDIwMCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIEJPRFkgUFJFVklFVyAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gTUVNT1JZIEFMTE9DQVRJT04gRkFJTEVEIEZPUiBCT0RZXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVxdWVzdGVkIHNpemU6ICV6dSBieXRlc1xuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoICsgMSk7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICB9IGVsc2UgewogICAgICAgIHJlc3BvbnNlLT5ib2R5ID0gc3RyZHVwKCIiKTsKICAgICAgICByZXNwb25zZS0+Ym9keV9sZW5ndGggPSAwOwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gTk8gQk9EWSBGT1VORCBJTiBSRVNQT05TRVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgTG9va2luZyBmb3IgJ1xcclxcblxcclxcbicgc2VwYXJhdG9yXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBSZXNwb25zZSBtaWdodCBiZSBoZWFkZXJzLW9ubHlcbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEhUVFAgUkVRVUVTVCBDT01QTEVURVxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaW5hbCBzdGF0dXM6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQm9keSBzaXplOiAlenUgYnl0ZXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBNZW1vcnkgYWxsb2NhdGVkIGZvciByZXNwb25zZTogJXp1IGJ5dGVzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgc2l6ZW9mKEh0dHBSZXNwb25zZSkgKyAocmVzcG9uc2UtPmJvZHkgPyByZXNwb25zZS0+Ym9keV9sZW5ndGggKyAxIDogMCkpOwogICAgfQogICAgCiAgICByZXR1cm4gcmVzcG9uc2U7Cn0KCnZvaWQgaHR0cF9yZXNwb25zZV9mcmVlKEh0dHBSZXNwb25zZSogcmVzcG9uc2UpIHsKICAgIGlmIChyZXNwb25zZSkgewogICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICBmcmVlKHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICB9CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICB9Cn0KCmludCB2ZXJpZnlfaHR0cF9yZXNwb25zZShjb25zdCBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlLCBjb25zdCBjaGFyKiBleHBlY3RlZF9wYXR0ZXJuLCBpbnQgY2hlY2tfc3VjY2Vzc19vbmx5KSB7CiAgICBpZiAoIXJlc3BvbnNlKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICJcbiAgW1ZFUkJPU0VdIEhUVFAgUkVTUE9OU0UgVkVSSUZJQ0FUSU9OIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIGlzIE5VTExcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkIHBhdHRlcm46IFwiJXNcIlxuIiBSRVNFVCwgZXhwZWN0ZWRfcGF0dGVybiA/IGV4cGVjdGVkX3BhdHRlcm4gOiAiKG5vbmUpIik7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ2hlY2sgc3VjY2VzcyBvbmx5OiAlc1xuIiBSRVNFVCwgY2hlY2tfc3VjY2Vzc19vbmx5ID8gIllFUyIgOiAiTk8iKTsKICAgICAgICB9CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICJcbiAgW1ZFUkJPU0VdIEhUVFAgUkVTUE9OU0UgVkVSSUZJQ0FUSU9OXG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFJlc3BvbnNlIHN0YXR1cyBjb2RlOiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFJlc3BvbnNlIGJvZHkgbGVuZ3RoOiAlenUgYnl0ZXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4gPyBleHBlY3RlZF9wYXR0ZXJuIDogIihub25lKSIpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ2hlY2sgc3VjY2VzcyBvbmx5OiAlc1xuIiBSRVNFVCwgY2hlY2tfc3VjY2Vzc19vbmx5ID8gIllFUyIgOiAiTk8iKTsKICAgICAgICAKICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5IGNvbnRlbnQgKGZpcnN0IDMwMCBjaGFycyk6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFdISVRFICIgICAgLS0tIEJFR0lOIEJPRFkgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgaW50IGxlbiA9IHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA+IDMwMCA/IDMwMCA6IHJlc3BvbnNlLT5ib2R5X2xlbmd0aDsKICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IGkgPCBsZW47IGkrKykgewogICAgICAgICAgICAgICAgcHV0Y2hhcihyZXNwb25zZS0+Ym9keVtpXSk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA+IDMwMCkgewogICAgICAgICAgICAgICAgcHJpbnRmKCJcbiAgICAuLi4gWyV6dSBtb3JlIGNoYXJzXVxuIiwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoIC0gMzAwKTsKICAgICAgICAgICAgfQogICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gRU5EIEJPRFkgLS0tXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGlmIChjaGVja19zdWNjZXNzX29ubHkpIHsKICAgICAgICBpbnQgaGFzX3N1Y2Nlc3NfZmllbGQgPSByZXNwb25zZS0+Ym9keSAmJiBzdHJzdHIocmVzcG9uc2UtPmJvZHksICJcInN1Y2Nlc3NcIjoiKSAhPSBOVUxMOwogICAgICAgIGludCB2YWxpZF9zdGF0dXMgPSAocmVzcG9uc2UtPnN0YXR1c19jb2RlID49IDIwMCAmJiByZXNwb25zZS0+c3RhdHVzX2NvZGUgPCA1MDApOwogICAgICAgIGludCByZXN1bHQgPSB2YWxpZF9zdGF0dXMgJiYgaGFzX3N1Y2Nlc3NfZmllbGQ7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTVUNDRVNTLU9OTFkgQ0hFQ0sgQU5BTFlTSVNcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFN0YXR1cyBjb2RlIHZhbGlkICgyMDAtNDk5KTogJXMgKCVkKVxuIiBSRVNFVCwgCiAgICAgICAgICAgICAgICAgICB2YWxpZF9zdGF0dXMgPyAiWUVTIiA6ICJOTyIsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgSGFzICdzdWNjZXNzJyBmaWVsZCBpbiBKU09OOiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgICAgICBoYXNfc3VjY2Vzc19maWVsZCA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ29tYmluZWQgcmVzdWx0OiAlc1xuIiBSRVNFVCwgcmVzdWx0ID8gIlBBU1MiIDogIkZBSUwiKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICghdmFsaWRfc3RhdHVzKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTVEFUVVMgQ09ERSBJU1NVRVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEV4cGVjdGVkOiAyMDAtNDk5XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgR290OiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgU3RhdHVzIGNvZGUgY2F0ZWdvcmllczpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIDIwMC0yOTk6IFN1Y2Nlc3NcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIDMwMC0zOTk6IFJlZGlyZWN0aW9uXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgICA0MDAtNDk5OiBDbGllbnQgZXJyb3JcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIDUwMC01OTk6IFNlcnZlciBlcnJvclxuIiBSRVNFVCk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICghaGFzX3N1Y2Nlc3NfZmllbGQgJiYgcmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIE1JU1NJTkcgU1VDQ0VTUyBGSUVMRFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIExvb2tpbmcgZm9yICdcInN1Y2Nlc3NcIjonIGluIGJvZHlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5IGNvbnRlbnQgdHlwZSBhbmFseXNpczpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBpZiAoc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAieyIpICYmIHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIn0iKSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQXBwZWFycyB0byBiZSBKU09OXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiBjb21tb25fZmllbGRzW10gPSB7IlwiZXJyb3JcIiIsICJcIm1lc3NhZ2VcIiIsICJcInN0YXR1c1wiIiwgIlwicmVzdWx0XCIiLCBOVUxMfTsKICAgICAgICAgICAgICAgICAgICBmb3IgKGludCBpID0gMDsgY29tbW9uX2ZpZWxkc1tpXTsgaSsrKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIGlmIChzdHJzdHIocmVzcG9uc2UtPmJvZHksIGNvbW1vbl9maWVsZHNbaV0pKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEZvdW5kIHNpbWlsYXIgZmllbGQ6ICVzXG4iIFJFU0VULCBjb21tb25fZmllbGRzW2ldKTsKICAgICAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIH0gZWxzZSBpZiAoc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAiPGh0bWwiKSB8fCBzdHJzdHIocmVzcG9uc2UtPmJvZHksICI8IURPQ1RZUEUiKSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQXBwZWFycyB0byBiZSBIVE1MXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0gZWxzZSBpZiAoc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAiZXJyb3IiKSB8fCBzdHJzdHIocmVzcG9uc2UtPmJvZHksICJFcnJvciIpKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDb250YWlucyAnZXJyb3InIHRleHRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIAogICAgICAgIHJldHVybiByZXN1bHQ7CiAgICB9IGVsc2UgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRlVMTCBSRVNQT05TRSBDSEVDS1xuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmIChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPCAyMDAgfHwgcmVzcG9uc2UtPnN0YXR1c19jb2RlID49IDMwMCkgewogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTVEFUVVMgQ09ERSBDSEVDSyBGQUlMRURcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZDogMjAwLTI5OSAoc3VjY2VzcylcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBHb3Q6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBTdGF0dXMgY29kZSBtZWFuaW5nOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIqIHN0YXR1c19tZWFuaW5nc1tdID0gewogICAgICAgICAgICAgICAgICAgICIyMDAiLCAiT0siLAogICAgICAgICAgICAgICAgICAgICIyMDEiLCAiQ3JlYXRlZCIsCiAgICAgICAgICAgICAgICAgICAgIjIwNCIsICJObyBDb250ZW50IiwKICAgICAgICAgICAgICAgICAgICAiNDAwIiwgIkJhZCBSZXF1ZXN0IiwKICAgICAgICAgICAgICAgICAgICAiNDAxIiwgIlVuYXV0aG9yaXplZCIsCiAgICAgICAgICAgICAgICAgICAgIjQwMyIsICJGb3JiaWRkZW4iLAogICAgICAgICAgICAgICAgICAgICI0MDQiLCAiTm90IEZvdW5kIiwKICAgICAgICAgICAgICAgICAgICAiNDA1IiwgIk1ldGhvZCBOb3QgQWxsb3dlZCIsCiAgICAgICAgICAgICAgICAgICAgIjQwOSIsICJDb25mbGljdCIsCiAgICAgICAgICAgICAgICAgICAgIjUwMCIsICJJbnRlcm5hbCBTZXJ2ZXIgRXJyb3IiLAogICAgICAgICAgICAgICAgICAgICI1MDMiLCAiU2VydmljZSBVbmF2YWlsYWJsZSIsCiAgICAgICAgICAgICAgICAgICAgTlVMTAogICAgICAgICAgICAgICAgfTsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgY2hhciBzdGF0dXNfc3RyWzEwXTsKICAgICAgICAgICAgICAgIHNucHJpbnRmKHN0YXR1c19zdHIsIHNpemVvZihzdGF0dXNfc3RyKSwgIiVkIiwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IHN0YXR1c19tZWFuaW5nc1tpXSAhPSBOVUxMOyBpICs9IDIpIHsKICAgICAgICAgICAgICAgICAgICBpZiAoc3RyY21wKHN0YXR1c19zdHIsIHN0YXR1c19tZWFuaW5nc1tpXSkgPT0gMCkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgJXM6ICVzXG4iIFJFU0VULCBzdGF0dXNfbWVhbmluZ3NbaV0sIHN0YXR1c19tZWFuaW5nc1tpKzFdKTsKICAgICAgICAgICAgICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgICAgIHJldHVybiAwOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gU3RhdHVzIGNvZGUgY2hlY2sgcGFzc2VkOiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgaWYgKGV4cGVjdGVkX3BhdHRlcm4gJiYgZXhwZWN0ZWRfcGF0dGVyblswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIGlmICghcmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBQQVRURVJOIENIRUNLIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4pOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVzcG9uc2UgYm9keSBpcyBOVUxMXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHJldHVybiAwOwogICAgICAgICAgICB9CiAgICAgICAgICAgIAogICAgICAgICAgICBjaGFyKiBwYXR0ZXJuX2ZvdW5kID0gc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCBleHBlY3RlZF9wYXR0ZXJuKTsKICAgICAgICAgICAgaWYgKHBhdHRlcm5fZm91bmQgPT0gTlVMTCkgewogICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFBBVFRFUk4gTk9UIEZPVU5EIElOIFJFU1BPTlNFIEJPRFlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRXhwZWN0ZWQgcGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCBleHBlY3RlZF9wYXR0ZXJuKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdHRlcm4gbGVuZ3RoOiAlenUgY2hhcmFjdGVyc1xuIiBSRVNFVCwgc3RybGVuKGV4cGVjdGVkX3BhdHRlcm4pKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEJvZHkgbGVuZ3RoOiAlenUgY2hhcmFjdGVyc1xuIiBSRVNFVCwgc3RybGVuKHJlc3BvbnNlLT5ib2R5KSk7CiAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBDYXNlLWluc2Vuc2l0aXZlIHNlYXJjaDogIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgY2hhciogbG93ZXJfYm9keSA9IHN0cmR1cChyZXNwb25zZS0+Ym9keSk7CiAgICAgICAgICAgICAgICAgICAgY2hhciogbG93ZXJfcGF0dGVybiA9IHN0cmR1cChleHBlY3RlZF9wYXR0ZXJuKTsKICAgICAgICAgICAgICAgICAgICBmb3IgKHNpemVfdCBpID0gMDsgbG93ZXJfYm9keVtpXTsgaSsrKSBsb3dlcl9ib2R5W2ldID0gdG9sb3dlcihsb3dlcl9ib2R5W2ldKTsKICAgICAgICAgICAgICAgICAgICBmb3IgKHNpemVfdCBpID0gMDsgbG93ZXJfcGF0dGVybltpXTsgaSsrKSBsb3dlcl9wYXR0ZXJuW2ldID0gdG9sb3dlcihsb3dlcl9wYXR0ZXJuW2ldKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBpZiAoc3Ryc3RyKGxvd2VyX2JvZHksIGxvd2VyX3BhdHRlcm4pKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZigiRk9VTkQgKGNhc2UgZGlmZmVyZW5jZSlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIE9yaWdpbmFsIGNhc2UgbWlnaHQgYmUgZGlmZmVyZW50XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoIk5PVCBGT1VORFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgICAgIGZyZWUobG93ZXJfYm9keSk7CiAgICAgICAgICAgICAgICAgICAgZnJlZShsb3dlcl9wYXR0ZXJuKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIExvb2tpbmcgZm9yIHNpbWlsYXIgcGF0dGVybnM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBpZiAoc3Ryc3RyKGV4cGVjdGVkX3BhdHRlcm4sICJzdWNjZXNzIikpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAgIENoZWNraW5nICdTdWNjZXNzJyAoY2FwaXRhbCBTKTogJXNcbiIgUkVTRVQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzdHJzdHIocmVzcG9uc2UtPmJvZHksICJTdWNjZXNzIikgPyAiRk9VTkQiIDogIk5PVCBGT1VORCIpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgICAgQ2hlY2tpbmcgJ1NVQ0NFU1MnIChhbGwgY2Fwcyk6ICVzXG4iIFJFU0VULAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAiU1VDQ0VTUyIpID8gIkZPVU5EIiA6ICJOT1QgRk9VTkQiKTsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5IGNvbnRlbnQgYXJvdW5kIGV4cGVjdGVkIGFyZWE6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgICAtLS0gQkVHSU4gQ09OVEVYVCAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIGludCBzdGFydCA9IDA7CiAgICAgICAgICAgICAgICAgICAgaW50IGVuZCA9IHN0cmxlbihyZXNwb25zZS0+Ym9keSk7CiAgICAgICAgICAgICAgICAgICAgaWYgKGVuZCA+IDIwMCkgewogICAgICAgICAgICAgICAgICAgICAgICBzdGFydCA9IGVuZC8yIC0gMTAwOwogICAgICAgICAgICAgICAgICAgICAgICBlbmQgPSBlbmQvMiArIDEwMDsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgZm9yIChpbnQgaSA9IHN0YXJ0OyBpIDwgZW5kICYmIGkgPCAoaW50KXN0cmxlbihyZXNwb25zZS0+Ym9keSk7IGkrKykgewogICAgICAgICAgICAgICAgICAgICAgICBwdXRjaGFyKHJlc3BvbnNlLT5ib2R5W2ldKTsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFdISVRFICJcbiAgICAtLS0gRU5EIENPTlRFWFQgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHJldHVybiAwOwogICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gUEFUVEVSTiBGT1VORCBJTiBSRVNQT05TRSBCT0RZXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdHRlcm46IFwiJXNcIlxuIiBSRVNFVCwgZXhwZWN0ZWRfcGF0dGVybik7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGb3VuZCBhdCBwb3NpdGlvbjogJWxkXG4iIFJFU0VULCBwYXR0ZXJuX2ZvdW5kIC0gcmVzcG9uc2UtPmJvZHkpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgQ29udGV4dCBhcm91bmQgZm91bmQgcGF0dGVybiAoNTAgY2hhcnMgYmVmb3JlL2FmdGVyKTpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihXSElURSAiICAgIC0tLSBCRUdJTiBDT05URVhUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgbG9uZyBzdGFydCA9IHBhdHRlcm5fZm91bmQgLSByZXNwb25zZS0+Ym9keSAtIDUwOwogICAgICAgICAgICAgICAgICAgIGlmIChzdGFydCA8IDApIHN0YXJ0ID0gMDsKICAgICAgICAgICAgICAgICAgICBsb25nIGVuZCA9IHBhdHRlcm5fZm91bmQgLSByZXNwb25zZS0+Ym9keSArIHN0cmxlbihleHBlY3RlZF9wYXR0ZXJuKSArIDUwOwogICAgICAgICAgICAgICAgICAgIGlmIChlbmQgPiAobG9uZylzdHJsZW4ocmVzcG9uc2UtPmJvZHkpKSBlbmQgPSBzdHJsZW4ocmVzcG9uc2UtPmJvZHkpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGZvciAobG9uZyBpID0gc3RhcnQ7IGkgPCBlbmQ7IGkrKykgewogICAgICAgICAgICAgICAgICAgICAgICBpZiAoaSA9PSBwYXR0ZXJuX2ZvdW5kIC0gcmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTik7CiAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICAgICAgaWYgKGkgPT0gcGF0dGVybl9mb3VuZCAtIHJlc3BvbnNlLT5ib2R5ICsgc3RybGVuKGV4cGVjdGVkX3BhdHRlcm4pKSB7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVTRVQpOwogICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgICAgIHB1dGNoYXIocmVzcG9uc2UtPmJvZHlbaV0pOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihXSElURSAiXG4gICAgLS0tIEVORCBDT05URVhUIC0tLVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIE5vIHBhdHRlcm4gc3BlY2lmaWVkIGZvciB2ZXJpZmljYXRpb25cbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gSFRUUCByZXNwb25zZSB2ZXJpZmljYXRpb24gcGFzc2VkXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcmV0dXJuIDE7Cn0KCmNoYXIqIGV4dHJhY3RfanNvbl9maWVsZChjb25zdCBjaGFyKiBqc29uLCBjb25zdCBjaGFyKiBmaWVsZCkgewogICAgaWYgKCFqc29uIHx8ICFmaWVsZCkgcmV0dXJuIE5VTEw7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBFWFRSQUNUSU5HIEpTT04gRklFTERcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRmllbGQgdG8gZXh0cmFjdDogXCIlc1wiXG4iIFJFU0VULCBmaWVsZCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBKU09OIGxlbmd0aDogJXp1IGNoYXJhY3RlcnNcbiIgUkVTRVQsIHN0cmxlbihqc29uKSk7CiAgICB9CiAgICAKICAgIGNoYXIgc2VhcmNoX3BhdHRlcm5bMjU2XTsKICAgIHNucHJpbnRmKHNlYXJjaF9wYXR0ZXJuLCBzaXplb2Yoc2VhcmNoX3BhdHRlcm4pLCAiXCIlc1wiOlwiIiwgZmllbGQpOwogICAgCiAgICBjaGFyKiBmaWVsZF9zdGFydCA9IHN0cnN0cihqc29uLCBzZWFyY2hfcGF0dGVybik7CiAgICBpZiAoIWZpZWxkX3N0YXJ0KSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFBhdHRlcm4gJ1wiJXNcIjpcIicgbm90IGZvdW5kLCB0cnlpbmcgd2l0aG91dCBxdW90ZXNcbiIgUkVTRVQsIGZpZWxkKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgc25wcmludGYoc2VhcmNoX3BhdHRlcm4sIHNpemVvZihzZWFyY2hfcGF0dGVybiksICJcIiVzXCI6IiwgZmllbGQpOwogICAgICAgIGZpZWxkX3N0YXJ0ID0gc3Ryc3RyKGpzb24sIHNlYXJjaF9wYXR0ZXJuKTsKICAgICAgICBpZiAoIWZpZWxkX3N0YXJ0KSB7CiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZJRUxEIE5PVCBGT1VORCBJTiBKU09OXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUGF0dGVybjogXCIlc1wiXG4iIFJFU0VULCBzZWFyY2hfcGF0dGVybik7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEpTT04gcHJldmlldyAoZmlyc3QgMjAwIGNoYXJzKTpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgaW50IGxlbiA9IHN0cmxlbihqc29uKSA+IDIwMCA/IDIwMCA6IHN0cmxlbihqc29uKTsKICAgICAgICAgICAgICAgIGZvciAoaW50IGkgPSAwOyBpIDwgbGVuOyBpKyspIHB1dGNoYXIoanNvbltpXSk7CiAgICAgICAgICAgICAgICBpZiAoc3RybGVuKGpzb24pID4gMjAwKSBwcmludGYoIlxuLi4uIik7CiAgICAgICAgICAgICAgICBwcmludGYoIlxuIiBSRVNFVCk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgcmV0dXJuIE5VTEw7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGZpZWxkX3N0YXJ0ICs9IHN0cmxlbihzZWFyY2hfcGF0dGVybik7CiAgICAgICAgY2hhciogZmllbGRfZW5kID0gc3RyY2hyKGZpZWxkX3N0YXJ0LCAnLCcpOwogICAgICAgIGlmICghZmllbGRfZW5kKSBmaWVsZF9lbmQgPSBzdHJjaHIoZmllbGRfc3RhcnQsICd9Jyk7CiAgICAgICAgaWYgKCFmaWVsZF9lbmQpIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ0FOTk9UIEZJTkQgRklFTEQgRU5EIERFTElNSVRFUlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIEZpZWxkIHN0YXJ0OiBcIiUuNTBzXCJcbiIgUkVTRVQsIGZpZWxkX3N0YXJ0KTsKICAgICAgICAgICAgfQogICAgICAgICAgICByZXR1cm4gTlVMTDsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgc2l6ZV90IGZpZWxkX2xlbmd0aCA9IGZpZWxkX2VuZCAtIGZpZWxkX3N0YXJ0OwogICAgICAgIGNoYXIqIHZhbHVlID0gbWFsbG9jKGZpZWxkX2xlbmd0aCArIDEpOwogICAgICAgIGlmICghdmFsdWUpIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gTUVNT1JZIEFMTE9DQVRJT04gRkFJTEVEXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVxdWVzdGVkIHNpemU6ICV6dSBieXRlc1xuIiBSRVNFVCwgZmllbGRfbGVuZ3RoICsgMSk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgcmV0dXJuIE5VTEw7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIHN0cm5jcHkodmFsdWUsIGZpZWxkX3N0YXJ0LCBmaWVsZF9sZW5ndGgpOwogICAgICAgIHZhbHVlW2ZpZWxkX2xlbmd0aF0gPSAnXDAnOwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBGSUVMRCBFWFRSQUNURUQgKFVOUVVPVEVEKVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRmllbGQgdmFsdWU6IFwiJXNcIlxuIiBSRVNFVCwgdmFsdWUpOwogICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIFZhbHVlIGxlbmd0aDogJXp1IGNoYXJhY3RlcnNcbiIgUkVTRVQsIGZpZWxkX2xlbmd0aCk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIHJldHVybiB2YWx1ZTsKICAgIH0KICAgIAogICAgZmllbGRfc3RhcnQgKz0gc3RybGVuKHNlYXJjaF9wYXR0ZXJuKTsKICAgIGNoYXIqIGZpZWxkX2VuZCA9IHN0cmNocihmaWVsZF9zdGFydCwgJyInKTsKICAgIGlmICghZmllbGRfZW5kKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDQU5OT1QgRklORCBDTE9TSU5HIFFVT1RFXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBGaWVsZCBzdGFydDogXCIlLjUwc1wiXG4iIFJFU0VULCBmaWVsZF9zdGFydCk7CiAgICAgICAgfQogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBzaXplX3QgZmllbGRfbGVuZ3RoID0gZmllbGRfZW5kIC0gZmllbGRfc3RhcnQ7CiAgICBjaGFyKiB2YWx1ZSA9IG1hbGxvYyhmaWVsZF9sZW5ndGggKyAxKTsKICAgIGlmICghdmFsdWUpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIE1FTU9SWSBBTExPQ0FUSU9OIEZBSUxFRFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgUmVxdWVzdGVkIHNpemU6ICV6dSBieXRlc1xuIiBSRVNFVCwgZmllbGRfbGVuZ3RoICsgMSk7CiAgICAgICAgfQogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBzdHJuY3B5KHZhbHVlLCBmaWVsZF9zdGFydCwgZmllbGRfbGVuZ3RoKTsKICAgIHZhbHVlW2ZpZWxkX2xlbmd0aF0gPSAnXDAnOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBGSUVMRCBFWFRSQUNURUQgKFFVT1RFRClcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRmllbGQgdmFsdWU6IFwiJXNcIlxuIiBSRVNFVCwgdmFsdWUpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgVmFsdWUgbGVuZ3RoOiAlenUgY2hhcmFjdGVyc1xuIiBSRVNFVCwgZmllbGRfbGVuZ3RoKTsKICAgICAgICBwcmludGYoR1JBWSAiICAgIFNlYXJjaCBwYXR0ZXJuIHVzZWQ6IFwiJXNcIlxuIiBSRVNFVCwgc2VhcmNoX3BhdHRlcm4pOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRm91bmQgYXQgcG9zaXRpb246ICVsZFxuIiBSRVNFVCwgZmllbGRfc3RhcnQgLSBqc29uIC0gc3RybGVuKHNlYXJjaF9wYXR0ZXJuKSk7CiAgICB9CiAgICAKICAgIHJldHVybiB2YWx1ZTsKfQoKaW50IGh0dHBfdGVzdF9lbmRwb2ludChjb25zdCBjaGFyKiBkZXNjcmlwdGlvbiwgY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiBlbmRwb2ludCwgCiAgICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiBib2R5LCBjb25zdCBjaGFyKiBleHBlY3RlZF9wYXR0ZXJuLCBpbnQgY2hlY2tfc3VjY2Vzc19vbmx5LCBsb25nIGxvbmcqIGR1cmF0aW9uKSB7CiAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsIGRlc2NyaXB0aW9uKTsKICAgIGZmbHVzaChzdGRvdXQpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBIVFRQIEVORFBPSU5UIFRFU1QgU1RBUlRcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRGVzY3JpcHRpb246ICVzXG4iIFJFU0VULCBkZXNjcmlwdGlvbik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBNZXRob2Q6ICVzXG4iIFJFU0VULCBtZXRob2QpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgRW5kcG9pbnQ6ICVzXG4iIFJFU0VULCBlbmRwb2ludCk7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBCb2R5OiAlc1xuIiBSRVNFVCwgYm9keSA/IGJvZHkgOiAiKG5vbmUpIik7CiAgICAgICAgcHJpbnRmKEdSQVkgIiAgICBFeHBlY3RlZCBwYXR0ZXJuOiBcIiVzXCJcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4gPyBleHBlY3RlZF9wYXR0ZXJuIDogIihub25lKSIpOwogICAgICAgIHByaW50ZihHUkFZICIgICAgQ2hlY2sgc3VjY2VzcyBvbmx5OiAlc1xuIiBSRVNFVCwgY2hlY2tfc3VjY2Vzc19vbmx5ID8gIllFUyIgOiAiTk8iKTsKICAgIH0KICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QobWV0aG9kLCBlbmRwb2ludCwgYm9keSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGxvbmcgbG9uZyBlbmRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgaWYgKGR1cmF0aW9uKSB7CiAgICAgICAgKmR1cmF0aW9uID0gZW5kX3RpbWUgLSBzdGFydF90aW1lOwogICAgfQogICAgCiAgICBpbnQgc3VjY2VzcyA9IDA7CiAgICBpZiAocmVzcG9uc2UpIHsKICAgICAgICBzdWNjZXNzID0gdmVyaWZ5X2h0dHBfcmVzcG9uc2UocmVzcG9uc2UsIGV4cGVjdGVkX3BhdHRlcm4sIGNoZWNrX3N1Y2Nlc3Nfb25seSk7CiAgICAgICAgCiAgICAgICAgaWYgKCFzdWNjZXNzKSB7CiAgICAgICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGVuZF90aW1lIC0gc3RhcnRfdGltZSwgUkVTRVQpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiXG4gIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEhUVFAgVEVTVCBGQUlMVVJFIEFOQUxZU0lTXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gVGVzdDogJXNcbiIgUkVTRVQsIGRlc2NyaXB0aW9uKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEVuZHBvaW50OiAlcyAlc1xuIiBSRVNFVCwgbWV0aG9kLCBlbmRwb2ludCk7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTdGF0dXMgQ29kZTogJWRcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBFeHBlY3RlZCBQYXR0ZXJuOiAnJXMnXG4iIFJFU0VULCBleHBlY3RlZF9wYXR0ZXJuID8gZXhwZWN0ZWRfcGF0dGVybiA6ICJOT05FIik7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDaGVjayBTdWNjZXNzIE9ubHk6ICVzXG4iIFJFU0VULCBjaGVja19zdWNjZXNzX29ubHkgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBCb2R5ICglenUgYnl0ZXMpOlxuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoV0hJVEUgIiAgLS0tIEJFR0lOIFJFU1BPTlNFIEJPRFkgLS0tXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoIiVzXG4iLCByZXNwb25zZS0+Ym9keSk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFdISVRFICIgIC0tLSBFTkQgUkVTUE9OU0UgQk9EWSAtLS1cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGlmIChzdHJzdHIocmVzcG9uc2UtPmJvZHksICJ7IikgJiYgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAifSIpKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEpTT04gU1RSVUNUVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiBqc29uX2ZpZWxkc1tdID0gewogICAgICAgICAgICAgICAgICAgICAgICAgICAgImVycm9yIiwgIm1lc3NhZ2UiLCAiZGV0YWlscyIsICJjb2RlIiwgInN0YXR1cyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgInN1Y2Nlc3MiLCAiZGF0YSIsICJyZXN1bHQiLCBOVUxMCiAgICAgICAgICAgICAgICAgICAgICAgIH07CiAgICAgICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgICAgICBmb3IgKGludCBpID0gMDsganNvbl9maWVsZHNbaV07IGkrKykgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgY2hhciogdmFsdWUgPSBleHRyYWN0X2pzb25fZmllbGQocmVzcG9uc2UtPmJvZHksIGpzb25fZmllbGRzW2ldKTsKICAgICAgICAgICAgICAgICAgICAgICAgICAgIGlmICh2YWx1ZSkgewogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgRmllbGQgJyVzJzogJXNcbiIgUkVTRVQsIGpzb25fZmllbGRzW2ldLCB2YWx1ZSk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgZnJlZSh2YWx1ZSk7CiAgICAgICAgICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIEJvZHk6IE5VTExcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBUaW1lOiAlbGxkIG1zXG4iIFJFU0VULCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFBPU1NJQkxFIElTU1VFUyBBTkQgU09MVVRJT05TOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGlmIChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gMCkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBTZXJ2ZXIgbWlnaHQgbm90IGJlIHJ1bm5pbmdcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBOZXR3b3JrIGNvbm5lY3Rpdml0eSBpc3N1ZVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIEZpcmV3YWxsIGJsb2NraW5nIGNvbm5lY3Rpb25cbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfSBlbHNlIGlmIChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gNDA0KSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIEVuZHBvaW50IFVSTCBtaWdodCBiZSBpbmNvcnJlY3RcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBTZXJ2ZXIgcm91dGluZyBtaXNjb25maWd1cmVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0gZWxzZSBpZiAocmVzcG9uc2UtPnN0YXR1c19jb2RlID09IDQwNSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBIVFRQIG1ldGhvZCBub3QgYWxsb3dlZCBmb3IgdGhpcyBlbmRwb2ludFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9IGVsc2UgaWYgKHJlc3BvbnNlLT5zdGF0dXNfY29kZSA+PSA1MDApIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gU2VydmVyIGludGVybmFsIGVycm9yXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gQ2hlY2sgc2VydmVyIGxvZ3NcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfSBlbHNlIGlmIChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPj0gNDAwKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIENsaWVudCBlcnJvciAtIGNoZWNrIHJlcXVlc3QgcGFyYW1ldGVyc1xuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFZhbGlkYXRlIEpTT04gZm9ybWF0XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gQ2hlY2sgcmVxdWlyZWQgZmllbGRzXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgaWYgKGV4cGVjdGVkX3BhdHRlcm4gJiYgcmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgICAgICBpZiAoIXN0cnN0cihyZXNwb25zZS0+Ym9keSwgZXhwZWN0ZWRfcGF0dGVybikpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFBhdHRlcm4gJyVzJyBub3QgZm91bmQgaW4gcmVzcG9uc2VcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4pOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gQ2hlY2sgZm9yIGNhc2Ugc2Vuc2l0aXZpdHlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JBWSAiICAgIC0gVmVyaWZ5IHRoZSBleGFjdCBleHBlY3RlZCBvdXRwdXRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgU3RhdHVzOiAlZCwgUmVzcG9uc2U6ICVzXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUsIHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBTdGF0dXM6ICVkLCBObyByZXNwb25zZSBib2R5XG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgcHJpbnRmKCJbIiBHUkVFTiAiUEFTUyIgUkVTRVQgIl0gJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUsIFJFU0VUKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiXG4gIFtWRVJCT1NFXSBIVFRQIFRFU1QgU1VDQ0VTUyBERVRBSUxTXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gICBFbmRwb2ludDogJXMgJXNcbiIgUkVTRVQsIG1ldGhvZCwgZW5kcG9pbnQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSAgIFN0YXR1cyBDb2RlOiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gICBSZXNwb25zZSBUaW1lOiAlbGxkIG1zXG4iIFJFU0VULCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSAgIEJvZHkgTGVuZ3RoOiAlenUgYnl0ZXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSAmJiByZXNwb25zZS0+Ym9keV9sZW5ndGggPCA1MDApIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdICAgUmVzcG9uc2UgQm9keTpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZigiJXNcbiIsIHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUocmVzcG9uc2UpOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl0gJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUsIFJFU0VUKTsKICAgICAgICBwcmludGYoUkVEICIgIE5vIHJlc3BvbnNlIGZyb20gc2VydmVyXG4iIFJFU0VUKTsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIlxuICBbVkVSQk9TRV0gSFRUUCBURVNUIEZBSUxVUkUgLSBOTyBSRVNQT05TRVxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgRW5kcG9pbnQ6ICVzICVzXG4iIFJFU0VULCBtZXRob2QsIGVuZHBvaW50KTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBTZXJ2ZXIgbWF5IGJlIGRvd24gb3IgdW5yZWFjaGFibGVcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIFJlcXVlc3QgdGltZTogJWxsZCBtc1xuIiBSRVNFVCwgZW5kX3RpbWUgLSBzdGFydF90aW1lKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBQb3NzaWJsZSBjYXVzZXM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFNlcnZlciBub3Qgc3RhcnRlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBXcm9uZyBwb3J0IG51bWJlclxuIiBSRVNFVCk7CiAgICAgICAgICAgIHByaW50ZihHUkFZICIgICAgLSBGaXJld2FsbCBibG9ja2luZyBjb25uZWN0aW9uXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIE5ldHdvcmsgaXNzdWVzXG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKEdSQVkgIiAgICAtIFNlcnZlciBjcmFzaGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSA9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iIFJFU0VUKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBIVFRQIEVORFBPSU5UIFRFU1QgQ09NUExFVEVcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFJlc3VsdDogJXNcbiIgUkVTRVQsIHN1Y2Nlc3MgPyAiUEFTUyIgOiAiRkFJTCIpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIER1cmF0aW9uOiAlbGxkIG1zXG4iIFJFU0VULCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdID09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIgUkVTRVQpOwogICAgfQogICAgCiAgICByZXR1cm4gc3VjY2VzczsKfQoKdm9pZCBjbGVhbnVwX3Rlc3RfZGF0YWJhc2VzKCkgewogICAgcHJpbnRmKCJDbGVhbmluZyB1cCBwcmV2aW91cyB0ZXN0IGRhdGFiYXNlcy4uLlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDbGVhbmluZyB1cCB0ZXN0IGRpcmVjdG9yaWVzIGluIC90bXAvc3lkYl90ZXN0L1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIGNoYXIgY29tbWFuZFs1MTJdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAicm0gLXJmIC90bXAvc3lkYl90ZXN0L3Rlc3RkYl8qIC90bXAvc3lkYl90ZXN0L3Rlc3RkYjJfKiAvdG1wL3N5ZGJfdGVzdC90ZXN0Y29sbGRiXyogL3RtcC9zeWRiX3Rlc3QvdGVzdGluc3RkYl8qIDI+L2Rldi9udWxsIik7CiAgICBzeXN0ZW0oY29tbWFuZCk7CiAgICAKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgInJtIC1mIC90bXAvc3lkYl90ZXN0LyoubG9jayAvdG1wL3N5ZGJfdGVzdC8uKi5sb2NrIDI+L2Rldi9udWxsIik7CiAgICBzeXN0ZW0oY29tbWFuZCk7CiAgICAKICAgIHVzbGVlcCg1MDAwMCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDbGVhbnVwIGNvbXBsZXRlZFxuIiBSRVNFVCk7CiAgICB9Cn0KCmludCBydW5faHR0cF9kYXRhYmFzZV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIERBVEFCQVNFIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICBjaGFyIHVuaXF1ZV9kYjFbNjRdLCB1bmlxdWVfZGIyWzY0XTsKICAgIHN0cnVjdCB0aW1lc3BlYyB0czsKICAgIGNsb2NrX2dldHRpbWUoQ0xPQ0tfTU9OT1RPTklDLCAmdHMpOwogICAgc25wcmludGYodW5pcXVlX2RiMSwgc2l6ZW9mKHVuaXF1ZV9kYjEpLCAidGVzdGRiXyVsZF8lbGQiLCB0cy50dl9zZWMsIHRzLnR2X25zZWMpOwogICAgc25wcmludGYodW5pcXVlX2RiMiwgc2l6ZW9mKHVuaXF1ZV9kYjIpLCAidGVzdGRiMl8lbGRfJWxkIiwgdHMudHZfc2VjLCB0cy50dl9uc2VjICsgMSk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBVc2luZyB1bmlxdWUgZGF0YWJhc2UgbmFtZXM6ICVzLCAlc1xuIiBSRVNFVCwgdW5pcXVlX2RiMSwgdW5pcXVlX2RiMik7CiAgICB9CiAgICAKICAgIGNoYXIgY3JlYXRlX2RiMV9ib2R5WzEyOF0sIGNyZWF0ZV9kYjJfYm9keVsxMjhdOwogICAgc25wcmludGYoY3JlYXRlX2RiMV9ib2R5LCBzaXplb2YoY3JlYXRlX2RiMV9ib2R5KSwgIntcIm5hbWVcIjpcIiVzXCJ9IiwgdW5pcXVlX2RiMSk7CiAgICBzbnByaW50ZihjcmVhdGVfZGIyX2JvZHksIHNpemVvZihjcmVhdGVfZGIyX2JvZHkpLCAie1wibmFtZVwiOlwiJXNcIn0iLCB1bmlxdWVfZGIyKTsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzIC0gTGlzdCBkYXRhYmFzZXMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgIi9hcGkvZGF0YWJhc2VzIiwgTlVMTCwgIlwic3VjY2Vzc1wiOnRydWUiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcyAtIENyZWF0ZSBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgY3JlYXRlX2RiMV9ib2R5LCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gQ3JlYXRlIHNlY29uZCBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgY3JlYXRlX2RiMl9ib2R5LCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gUHJldmVudCBkdXBsaWNhdGUgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYjFfYm9keSwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGNoYXIgZGVsZXRlX3VybFsyNTZdOwogICAgc25wcmludGYoZGVsZXRlX3VybCwgc2l6ZW9mKGRlbGV0ZV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMiLCB1bmlxdWVfZGIyKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkRFTEVURSAvYXBpL2RhdGFiYXNlcy97bmFtZX0gLSBEZWxldGUgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiREVMRVRFIiwgZGVsZXRlX3VybCwgTlVMTCwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBEYXRhYmFzZSBBUEkgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl9odHRwX2NvbGxlY3Rpb25fdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBDT0xMRUNUSU9OIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICBjaGFyIHVuaXF1ZV9kYls2NF07CiAgICBzdHJ1Y3QgdGltZXNwZWMgdHM7CiAgICBjbG9ja19nZXR0aW1lKENMT0NLX01PTk9UT05JQywgJnRzKTsKICAgIHNucHJpbnRmKHVuaXF1ZV9kYiwgc2l6ZW9mKHVuaXF1ZV9kYiksICJ0ZXN0Y29sbGRiXyVsZF8lbGQiLCB0cy50dl9zZWMsIHRzLnR2X25zZWMpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gVXNpbmcgdW5pcXVlIGRhdGFiYXNlIG5hbWU6ICVzXG4iIFJFU0VULCB1bmlxdWVfZGIpOwogICAgfQogICAgCiAgICBjaGFyIGNyZWF0ZV9kYl9ib2R5WzEyOF07CiAgICBzbnByaW50ZihjcmVhdGVfZGJfYm9keSwgc2l6ZW9mKGNyZWF0ZV9kYl9ib2R5KSwgIntcIm5hbWVcIjpcIiVzXCJ9IiwgdW5pcXVlX2RiKTsKICAgIAogICAgSHR0cFJlc3BvbnNlKiBkYl9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYl9ib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaWYgKCFkYl9yZXNwb25zZSB8fCAhdmVyaWZ5X2h0dHBfcmVzcG9uc2UoZGJfcmVzcG9uc2UsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCkpIHsKICAgICAgICBwcmludGYoUkVEICIgIEZhaWxlZCB0byBjcmVhdGUgdGVzdCBkYXRhYmFzZSBmb3IgY29sbGVjdGlvbiB0ZXN0c1xuIiBSRVNFVCk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBEYXRhYmFzZSBjcmVhdGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICBpZiAoZGJfcmVzcG9uc2UpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIHN0YXR1czogJWQsIGJvZHk6ICVzXG4iIFJFU0VULCBkYl9yZXNwb25zZS0+c3RhdHVzX2NvZGUsIGRiX3Jlc3BvbnNlLT5ib2R5ID8gZGJfcmVzcG9uc2UtPmJvZHkgOiAiTlVMTCIpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoZGJfcmVzcG9uc2UpOwogICAgCiAgICBjaGFyIGxpc3RfY29sbHNfdXJsWzI1Nl07CiAgICBzbnByaW50ZihsaXN0X2NvbGxzX3VybCwgc2l6ZW9mKGxpc3RfY29sbHNfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zIiwgdW5pcXVlX2RiKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zIC0gTGlzdCBlbXB0eSBjb2xsZWN0aW9ucyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBsaXN0X2NvbGxzX3VybCwgTlVMTCwgIlwiY29sbGVjdGlvbnNcIjpbXSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBjaGFyIGNyZWF0ZV9jb2xsX3VybFsyNTZdOwogICAgc25wcmludGYoY3JlYXRlX2NvbGxfdXJsLCBzaXplb2YoY3JlYXRlX2NvbGxfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zIiwgdW5pcXVlX2RiKTsKICAgIAogICAgY29uc3QgY2hhciogdXNlcnNfc2NoZW1hID0gIntcIm5hbWVcIjpcInVzZXJzXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICJ7XCJuYW1lXCI6XCJuYW1lXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6dHJ1ZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJhZ2VcIixcInR5cGVcIjpcImludFwiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJlbWFpbFwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSIKICAgICAgICAiXX0iOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMgLSBDcmVhdGUgdXNlcnMgY29sbGVjdGlvbiIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgY3JlYXRlX2NvbGxfdXJsLCB1c2Vyc19zY2hlbWEsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGNvbnN0IGNoYXIqIHByb2R1Y3RzX3NjaGVtYSA9ICJ7XCJuYW1lXCI6XCJwcm9kdWN0c1wiLFwic2NoZW1hXCI6WyIKICAgICAgICAie1wibmFtZVwiOlwibmFtZVwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwicHJpY2VcIixcInR5cGVcIjpcImZsb2F0XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSIKICAgICAgICAiXX0iOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMgLSBDcmVhdGUgcHJvZHVjdHMgY29sbGVjdGlvbiIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgY3JlYXRlX2NvbGxfdXJsLCBwcm9kdWN0c19zY2hlbWEsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zIC0gTGlzdCBjcmVhdGVkIGNvbGxlY3Rpb25zIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIGxpc3RfY29sbHNfdXJsLCBOVUxMLCAiXCJ1c2Vyc1wiIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGNoYXIgc2NoZW1hX3VybFsyNTZdOwogICAgc25wcmludGYoc2NoZW1hX3VybCwgc2l6ZW9mKHNjaGVtYV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvc2NoZW1hIiwgdW5pcXVlX2RiKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9zY2hlbWEgLSBHZXQgdXNlcnMgc2NoZW1hIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIHNjaGVtYV91cmwsIE5VTEwsICJcIm5hbWVcIiIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBjaGFyIGRlbGV0ZV9jb2xsX3VybFsyNTZdOwogICAgc25wcmludGYoZGVsZXRlX2NvbGxfdXJsLCBzaXplb2YoZGVsZXRlX2NvbGxfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3Byb2R1Y3RzIiwgdW5pcXVlX2RiKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkRFTEVURSAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfSAtIERlbGV0ZSBwcm9kdWN0cyBjb2xsZWN0aW9uIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkRFTEVURSIsIGRlbGV0ZV9jb2xsX3VybCwgTlVMTCwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBDb2xsZWN0aW9uIEFQSSB0ZXN0czogJWQvJWQgcGFzc2VkIChhdmc6ICVsbGQgbXMpXG4iIFJFU0VULCAKICAgICAgICAgICBwYXNzZWQsIHRvdGFsLCB0b3RhbF90aW1lIC8gKHRvdGFsID4gMCA/IHRvdGFsIDogMSkpOwogICAgCiAgICByZXR1cm4gcGFzc2VkOwp9CgppbnQgcnVuX2h0dHBfaW5zdGFuY2VfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBJTlNUQU5DRSBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gMDsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbjsKICAgIAogICAgY2hhciB1bmlxdWVfZGJbNjRdOwogICAgc3RydWN0IHRpbWVzcGVjIHRzOwogICAgY2xvY2tfZ2V0dGltZShDTE9DS19NT05PVE9OSUMsICZ0cyk7CiAgICBzbnByaW50Zih1bmlxdWVfZGIsIHNpemVvZih1bmlxdWVfZGIpLCAidGVzdGluc3RkYl8lbGRfJWxkIiwgdHMudHZfc2VjLCB0cy50dl9uc2VjKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFVzaW5nIHVuaXF1ZSBkYXRhYmFzZSBuYW1lOiAlc1xuIiBSRVNFVCwgdW5pcXVlX2RiKTsKICAgIH0KICAgIAogICAgY2hhciBjcmVhdGVfZGJfYm9keVsxMjhdOwogICAgc25wcmludGYoY3JlYXRlX2RiX2JvZHksIHNpemVvZihjcmVhdGVfZGJfYm9keSksICJ7XCJuYW1lXCI6XCIlc1wifSIsIHVuaXF1ZV9kYik7CiAgICAKICAgIEh0dHBSZXNwb25zZSogZGJfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCBjcmVhdGVfZGJfYm9keSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmICghZGJfcmVzcG9uc2UgfHwgIXZlcmlmeV9odHRwX3Jlc3BvbnNlKGRiX3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiICBGYWlsZWQgdG8gY3JlYXRlIHRlc3QgZGF0YWJhc2UgZm9yIGluc3RhbmNlIHRlc3RzXG4iIFJFU0VUKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIERhdGFiYXNlIGNyZWF0aW9uIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoZGJfcmVzcG9uc2UpOwogICAgCiAgICBjaGFyIGNyZWF0ZV9jb2xsX3VybFsyNTZdOwogICAgc25wcmludGYoY3JlYXRlX2NvbGxfdXJsLCBzaXplb2YoY3JlYXRlX2NvbGxfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zIiwgdW5pcXVlX2RiKTsKICAgIAogICAgY29uc3QgY2hhciogdXNlcnNfc2NoZW1hID0gIntcIm5hbWVcIjpcInVzZXJzXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICJ7XCJuYW1lXCI6XCJuYW1lXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6dHJ1ZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJhZ2VcIixcInR5cGVcIjpcImludFwiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJlbWFpbFwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSIKICAgICAgICAiXX0iOwogICAgCiAgICBIdHRwUmVzcG9uc2UqIGNvbGxfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCBjcmVhdGVfY29sbF91cmwsIHVzZXJzX3NjaGVtYSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmICghY29sbF9yZXNwb25zZSB8fCAhdmVyaWZ5X2h0dHBfcmVzcG9uc2UoY29sbF9yZXNwb25zZSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwKSkgewogICAgICAgIHByaW50ZihSRUQgIiAgRmFpbGVkIHRvIGNyZWF0ZSB0ZXN0IGNvbGxlY3Rpb24gZm9yIGluc3RhbmNlIHRlc3RzXG4iIFJFU0VUKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENvbGxlY3Rpb24gY3JlYXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGNvbGxfcmVzcG9uc2UpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgaHR0cF9yZXNwb25zZV9mcmVlKGNvbGxfcmVzcG9uc2UpOwogICAgCiAgICBjaGFyIGxpc3RfaW5zdGFuY2VzX3VybFsyNTZdOwogICAgc25wcmludGYobGlzdF9pbnN0YW5jZXNfdXJsLCBzaXplb2YobGlzdF9pbnN0YW5jZXNfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcyIsIHVuaXF1ZV9kYik7CiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gTGlzdCBlbXB0eSBpbnN0YW5jZXMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgbGlzdF9pbnN0YW5jZXNfdXJsLCBOVUxMLCAiXCJpbnN0YW5jZXNcIjpbXSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBjb25zdCBjaGFyKiB1c2VyMSA9ICJ7XCJuYW1lXCI6XCJKb2huIERvZVwiLFwiYWdlXCI6MzAsXCJlbWFpbFwiOlwiam9obkB0ZXN0LmNvbVwifSI7CiAgICBjaGFyIGluc2VydF91cmxbMjU2XTsKICAgIHNucHJpbnRmKGluc2VydF91cmwsIHNpemVvZihpbnNlcnRfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcyIsIHVuaXF1ZV9kYik7CiAgICAKICAgIEh0dHBSZXNwb25zZSogaW5zZXJ0X3Jlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgaW5zZXJ0X3VybCwgdXNlcjEsICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICBpZiAoaW5zZXJ0X3Jlc3BvbnNlICYmIHZlcmlmeV9odHRwX3Jlc3BvbnNlKGluc2VydF9yZXNwb25zZSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwKSkgewogICAgICAgIGNoYXIqIGlkMSA9IGV4dHJhY3RfanNvbl9maWVsZChpbnNlcnRfcmVzcG9uc2UtPmJvZHksICJpZCIpOwogICAgICAgIGlmIChpZDEpIHsKICAgICAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBJbnNlcnQgZmlyc3QgdXNlciIpOwogICAgICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGR1cmF0aW9uLCBSRVNFVCk7CiAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBJbnNlcnRlZCB1c2VyIHdpdGggSUQ6ICVzXG4iIFJFU0VULCBpZDEpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIAogICAgICAgICAgICBjb25zdCBjaGFyKiB1c2VyMiA9ICJ7XCJuYW1lXCI6XCJKYW5lIFNtaXRoXCIsXCJhZ2VcIjoyNSxcImVtYWlsXCI6XCJqYW5lQHRlc3QuY29tXCJ9IjsKICAgICAgICAgICAgSHR0cFJlc3BvbnNlKiBpbnNlcnRfcmVzcG9uc2UyID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgaW5zZXJ0X3VybCwgdXNlcjIsICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICAgICAgICAgIGlmIChpbnNlcnRfcmVzcG9uc2UyICYmIHZlcmlmeV9odHRwX3Jlc3BvbnNlKGluc2VydF9yZXNwb25zZTIsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCkpIHsKICAgICAgICAgICAgICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gSW5zZXJ0IHNlY29uZCB1c2VyIik7CiAgICAgICAgICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGR1cmF0aW9uLCBSRVNFVCk7CiAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIExpc3QgdXNlcnMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgbGlzdF9pbnN0YW5jZXNfdXJsLCBOVUxMLCAiSm9obiBEb2UiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB0b3RhbCsrOwogICAgICAgICAgICAgICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgY2hhciBxdWVyeV91cmxbNTEyXTsKICAgICAgICAgICAgICAgIHNucHJpbnRmKHF1ZXJ5X3VybCwgc2l6ZW9mKHF1ZXJ5X3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9pbnN0YW5jZXM/cXVlcnk9YWdlOjMwIiwgdW5pcXVlX2RiKTsKICAgICAgICAgICAgICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpLy4uLi9pbnN0YW5jZXM/cXVlcnk9YWdlOjMwIC0gUXVlcnkgYnkgYWdlIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIHF1ZXJ5X3VybCwgTlVMTCwgIkpvaG4gRG9lIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGNoYXIgdXBkYXRlX3VybFsyNTZdOwogICAgICAgICAgICAgICAgc25wcmludGYodXBkYXRlX3VybCwgc2l6ZW9mKHVwZGF0ZV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzLyVzIiwgdW5pcXVlX2RiLCBpZDEpOwogICAgICAgICAgICAgICAgY29uc3QgY2hhciogdXBkYXRlX2RhdGEgPSAie1wiYWdlXCI6MzUsXCJlbWFpbFwiOlwiam9obi51cGRhdGVkQHRlc3QuY29tXCJ9IjsKICAgICAgICAgICAgICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBVVCAvYXBpLy4uLi9pbnN0YW5jZXMve2lkfSAtIFVwZGF0ZSB1c2VyIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIlBVVCIsIHVwZGF0ZV91cmwsIHVwZGF0ZV9kYXRhLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHRvdGFsKys7CiAgICAgICAgICAgICAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBjaGFyIGRlbGV0ZV91cmxbMjU2XTsKICAgICAgICAgICAgICAgIHNucHJpbnRmKGRlbGV0ZV91cmwsIHNpemVvZihkZWxldGVfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcy8lcyIsIHVuaXF1ZV9kYiwgaWQxKTsKICAgICAgICAgICAgICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkRFTEVURSAvYXBpLy4uLi9pbnN0YW5jZXMve2lkfSAtIERlbGV0ZSB1c2VyIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIkRFTEVURSIsIGRlbGV0ZV91cmwsIE5VTEwsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShpbnNlcnRfcmVzcG9uc2UyKTsKICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gSW5zZXJ0IHNlY29uZCB1c2VyIik7CiAgICAgICAgICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl1cbiIpOwogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTZWNvbmQgdXNlciBpbnNlcnRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgICAgICAKICAgICAgICAgICAgZnJlZShpZDEpOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoaW5zZXJ0X3Jlc3BvbnNlKTsKICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBJbnNlcnQgZmlyc3QgdXNlciIpOwogICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXVxuIik7CiAgICAgICAgdG90YWwrKzsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZpcnN0IHVzZXIgaW5zZXJ0aW9uIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgdG90YWwrKzsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBJbnN0YW5jZSBBUEkgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl9odHRwX2NvbW1hbmRfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBDT01NQU5EIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICBjb25zdCBjaGFyKiBjb21tYW5kID0gIntcImNvbW1hbmRcIjpcImxpc3RcIixcImFyZ3VtZW50c1wiOltdfSI7CiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZXhlY3V0ZSAtIEV4ZWN1dGUgbGlzdCBjb21tYW5kIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9leGVjdXRlIiwgY29tbWFuZCwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBDb21tYW5kIEFQSSB0ZXN0czogJWQvJWQgcGFzc2VkIChhdmc6ICVsbGQgbXMpXG4iIFJFU0VULCAKICAgICAgICAgICBwYXNzZWQsIHRvdGFsLCB0b3RhbF90aW1lIC8gdG90YWwpOwogICAgCiAgICByZXR1cm4gcGFzc2VkOwp9CgppbnQgcnVuX2h0dHBfZXJyb3JfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBFUlJPUiBIQU5ETElORyBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gMDsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcyAtIEludmFsaWQgZGF0YWJhc2UgbmFtZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgIntcIm5hbWVcIjpcImludmFsaWQvbmFtZVwifSIsICJcInN1Y2Nlc3NcIjpmYWxzZSIsIDEsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMvbm9uZXhpc3RlbnQvY29sbGVjdGlvbnMgLSBOb24tZXhpc3RlbnQgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgIi9hcGkvZGF0YWJhc2VzL25vbmV4aXN0ZW50L2NvbGxlY3Rpb25zIiwgTlVMTCwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy90ZXN0ZGIvY29sbGVjdGlvbnMvbm9uZXhpc3RlbnQvaW5zdGFuY2VzIC0gTm9uLWV4aXN0ZW50IGNvbGxlY3Rpb24iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgIi9hcGkvZGF0YWJhc2VzL3Rlc3RkYi9jb2xsZWN0aW9ucy9ub25leGlzdGVudC9pbnN0YW5jZXMiLCBOVUxMLCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcyAtIEludmFsaWQgSlNPTiIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgImludmFsaWQganNvbiIsICJcInN1Y2Nlc3NcIjpmYWxzZSIsIDEsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQQVRDSCIsICIvYXBpL2RhdGFiYXNlcy90ZXN0ZGIiLCBOVUxMLCBOVUxMKTsKICAgIGlmIChyZXNwb25zZSAmJiByZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gNDA1KSB7CiAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUEFUQ0ggL2FwaS9kYXRhYmFzZXMvdGVzdGRiIC0gTWV0aG9kIG5vdCBhbGxvd2VkIik7CiAgICAgICAgcHJpbnRmKCJbIiBHUkVFTiAiUEFTUyIgUkVTRVQgIl1cbiIpOwogICAgICAgIHBhc3NlZCsrOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBNZXRob2Qgbm90IGFsbG93ZWQgaGFuZGxlZCBjb3JyZWN0bHlcbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUEFUQ0ggL2FwaS9kYXRhYmFzZXMvdGVzdGRiIC0gTWV0aG9kIG5vdCBhbGxvd2VkIik7CiAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdXG4iKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEV4cGVjdGVkIDQwNSBNZXRob2QgTm90IEFsbG93ZWQsIGdvdDogJWRcbiIgUkVTRVQsIHJlc3BvbnNlID8gcmVzcG9uc2UtPnN0YXR1c19jb2RlIDogMCk7CiAgICAgICAgfQogICAgfQogICAgdG90YWwrKzsKICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgRXJyb3IgaGFuZGxpbmcgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKdm9pZCBydW5fc2VjdXJpdHlfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJTRUNVUklUWSBURVNUUyAtIFBhdGggdmFsaWRhdGlvbiBhbmQgaW5qZWN0aW9uIHByZXZlbnRpb24iIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgc2VjdXJpdHkgdGVzdHMgd2l0aCB2ZXJib3NlIGxvZ2dpbmdcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBUZXN0Q2FzZSBzZWN1cml0eV90ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIlByZXZlbnQgZGlyZWN0b3J5IHRyYXZlcnNhbCBpbiBkYXRhYmFzZSBuYW1lcyIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgJy4uL2V2aWwnIDI+JjEgfCBncmVwIC1pICdpbnZhbGlkXFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgInRlc3QgISAtZCAnL3RtcC9zeWRiX3Rlc3QvLi4vZXZpbCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJQcmV2ZW50IGRpcmVjdG9yeSB0cmF2ZXJzYWwgaW4gY29sbGVjdGlvbiBuYW1lcyIsIAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiAnLi4vLi4vZXZpbCcgLS1zY2hlbWEgLS1uYW1lLXN0cmluZyAyPiYxIHwgZ3JlcCAtaSAnaW52YWxpZFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJ0ZXN0ICEgLWQgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYi8uLi8uLi9ldmlsJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlJlamVjdCBpbnZhbGlkIGRhdGFiYXNlIG5hbWVzIHdpdGggc3BlY2lhbCBjaGFycyIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgJ2ludmFsaWQvbmFtZScgMj4mMSB8IGdyZXAgLWkgJ2ludmFsaWRcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAidGVzdCAhIC1kICcvdG1wL3N5ZGJfdGVzdC9pbnZhbGlkL25hbWUnIiwgCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9CiAgICB9OwogICAgCiAgICBpbnQgc2VjdXJpdHlfY291bnQgPSBzaXplb2Yoc2VjdXJpdHlfdGVzdHMpIC8gc2l6ZW9mKHNlY3VyaXR5X3Rlc3RzWzBdKTsKICAgIGludCBzZWN1cml0eV9wYXNzZWQgPSAwOwogICAgCiAgICBmb3IgKGludCBpID0gMDsgaSA8IHNlY3VyaXR5X2NvdW50OyBpKyspIHsKICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgY2hhciBmaW5hbF92ZXJpZmljYXRpb25bMTAyNF07CiAgICAgICAgCiAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCBzZWN1cml0eV90ZXN0c1tpXS5jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgc25wcmludGYoZmluYWxfdmVyaWZpY2F0aW9uLCBzaXplb2YoZmluYWxfdmVyaWZpY2F0aW9uKSwgc2VjdXJpdHlfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAKICAgICAgICBzdHJjcHkoc2VjdXJpdHlfdGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgc3RyY3B5KHNlY3VyaXR5X3Rlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBmaW5hbF92ZXJpZmljYXRpb24pOwogICAgICAgIAogICAgICAgIGlmIChleGVjdXRlX3Rlc3Rfd2l0aF92ZXJpZmljYXRpb24oJnNlY3VyaXR5X3Rlc3RzW2ldKSkgewogICAgICAgICAgICBzZWN1cml0eV9wYXNzZWQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgU2VjdXJpdHkgdGVzdHM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgc2VjdXJpdHlfcGFzc2VkLCBzZWN1cml0eV9jb3VudCk7Cn0KCnZvaWQgcnVuX2RhdGFfaW50ZWdyaXR5X3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiREFUQSBJTlRFR1JJVFkgVEVTVFMgLSBDUkMgdmFsaWRhdGlvbiBhbmQgZmlsZSBzdHJ1Y3R1cmUiIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgZGF0YSBpbnRlZ3JpdHkgdGVzdHNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBjaGFyIGNyZWF0ZV9kYl9jbWRbMjU2XTsKICAgIGNoYXIgY3JlYXRlX2NvbGxlY3Rpb25fY21kWzI1Nl07CiAgICBjaGFyIGluc2VydF9jbWRbMjU2XTsKICAgIAogICAgc25wcmludGYoY3JlYXRlX2RiX2NtZCwgc2l6ZW9mKGNyZWF0ZV9kYl9jbWQpLCAiJXMgY3JlYXRlIGludGVncml0eWRiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICBzbnByaW50ZihjcmVhdGVfY29sbGVjdGlvbl9jbWQsIHNpemVvZihjcmVhdGVfY29sbGVjdGlvbl9jbWQpLCAiJXMgY3JlYXRlIGludGVncml0eWRiIGRhdGEgLS1zY2hlbWEgLS12YWx1ZS1zdHJpbmctcmVxID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICBzbnByaW50ZihpbnNlcnRfY21kLCBzaXplb2YoaW5zZXJ0X2NtZCksICIlcyBjcmVhdGUgaW50ZWdyaXR5ZGIgZGF0YSAtLWluc2VydC1vbmUgLS12YWx1ZS1cInRlc3RfZGF0YV8xXCIgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIAogICAgc3lzdGVtKGNyZWF0ZV9kYl9jbWQpOwogICAgc3lzdGVtKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCk7CiAgICBzeXN0ZW0oaW5zZXJ0X2NtZCk7CiAgICAKICAgIFRlc3RDYXNlIGludGVncml0eV90ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIkRhdGEgZmlsZSBoYXMgdmFsaWQgaGVhZGVyIHN0cnVjdHVyZSIsCiAgICAgICAgICAgICJlY2hvICdIZWFkZXIgY2hlY2snID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgImhleGR1bXAgLUMgL3RtcC9zeWRiX3Rlc3QvaW50ZWdyaXR5ZGIvZGF0YS9kYXRhLnN5ZGIgfCBoZWFkIC0yIHwgZ3JlcCAtcSAnU1lEQiciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJEYXRhIGZpbGUgZ3Jvd3Mgd2l0aCBpbnNlcnRzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSBpbnRlZ3JpdHlkYiBkYXRhIC0taW5zZXJ0LW9uZSAtLXZhbHVlLVwidGVzdF9kYXRhXzJcIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgImxzIC1sIC90bXAvc3lkYl90ZXN0L2ludGVncml0eWRiL2RhdGEvZGF0YS5zeWRiIHwgYXdrICd7cHJpbnQgJDV9JyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9CiAgICB9OwogICAgCiAgICBpbnQgaW50ZWdyaXR5X2NvdW50ID0gc2l6ZW9mKGludGVncml0eV90ZXN0cykgLyBzaXplb2YoaW50ZWdyaXR5X3Rlc3RzWzBdKTsKICAgIGludCBpbnRlZ3JpdHlfcGFzc2VkID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBpbnRlZ3JpdHlfY291bnQ7IGkrKykgewogICAgICAgIGlmIChzdHJzdHIoaW50ZWdyaXR5X3Rlc3RzW2ldLmNvbW1hbmQsICIlcyIpICE9IE5VTEwpIHsKICAgICAgICAgICAgY2hhciBmaW5hbF9jb21tYW5kWzEwMjRdOwogICAgICAgICAgICBzbnByaW50ZihmaW5hbF9jb21tYW5kLCBzaXplb2YoZmluYWxfY29tbWFuZCksIGludGVncml0eV90ZXN0c1tpXS5jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgICAgIHN0cmNweShpbnRlZ3JpdHlfdGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmIChleGVjdXRlX3Rlc3Rfd2l0aF92ZXJpZmljYXRpb24oJmludGVncml0eV90ZXN0c1tpXSkpIHsKICAgICAgICAgICAgaW50ZWdyaXR5X3Bhc3NlZCsrOwogICAgICAgIH0KICAgIH0KICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBEYXRhIGludGVncml0eSB0ZXN0czogJWQvJWQgcGFzc2VkXG4iIFJFU0VULCBpbnRlZ3JpdHlfcGFzc2VkLCBpbnRlZ3JpdHlfY291bnQpOwp9Cgp2b2lkIHJ1bl9wZXJmb3JtYW5jZV90ZXN0KCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiUEVSRk9STUFOQ0UgQU5EIFNDQUxBQklMSVRZIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFN0YXJ0aW5nIHBlcmZvcm1hbmNlIHRlc3RzXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCJTZXR0aW5nIHVwIHBlcmZvcm1hbmNlIGRhdGFiYXNlLi4uXG4iKTsKICAgIGNoYXIgY3JlYXRlX2RiX2NtZFsyNTZdOwogICAgY2hhciBjcmVhdGVfY29sbGVjdGlvbl9jbWRbMjU2XTsKICAgIAogICAgc25wcmludGYoY3JlYXRlX2RiX2NtZCwgc2l6ZW9mKGNyZWF0ZV9kYl9jbWQpLCAiJXMgY3JlYXRlIHBlcmZkYiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgc25wcmludGYoY3JlYXRlX2NvbGxlY3Rpb25fY21kLCBzaXplb2YoY3JlYXRlX2NvbGxlY3Rpb25fY21kKSwgIiVzIGNyZWF0ZSBwZXJmZGIgdXNlcnMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZy1yZXEgLS1hZ2UtaW50IC0tZW1haWwtc3RyaW5nID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICAKICAgIHN5c3RlbShjcmVhdGVfZGJfY21kKTsKICAgIHN5c3RlbShjcmVhdGVfY29sbGVjdGlvbl9jbWQpOwogICAgCiAgICBjaGFyIHNpbmdsZV9pbnNlcnRfY21kWzI1Nl07CiAgICBzbnByaW50ZihzaW5nbGVfaW5zZXJ0X2NtZCwgc2l6ZW9mKHNpbmdsZV9pbnNlcnRfY21kKSwgIiVzIGNyZWF0ZSBwZXJmZGIgdXNlcnMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIlNpbmdsZVVzZXJcIiAtLWFnZS0zMCAtLWVtYWlsLVwic2luZ2xlQHRlc3QuY29tXCIgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICBzeXN0ZW0oc2luZ2xlX2luc2VydF9jbWQpOwogICAgbG9uZyBsb25nIHNpbmdsZV9pbnNlcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTaW5nbGUgaW5zZXJ0IHRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIHNpbmdsZV9pbnNlcnRfdGltZSk7CiAgICB9CiAgICAKICAgIGludCBiYXRjaF9zaXplID0gNTA7CiAgICBwcmludGYoIkluc2VydGluZyAlZCByZWNvcmRzIGZvciBiYXRjaCBwZXJmb3JtYW5jZS4uLlxuIiwgYmF0Y2hfc2l6ZSk7CiAgICAKICAgIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICBpbnQgc3VjY2Vzc19jb3VudCA9IDA7CiAgICAKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmF0Y2hfc2l6ZTsgaSsrKSB7CiAgICAgICAgY2hhciBjb21tYW5kWzUxMl07CiAgICAgICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLAogICAgICAgICAgICAgICAgICIlcyBjcmVhdGUgcGVyZmRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJVc2VyJWRcIiAtLWFnZS0lZCAtLWVtYWlsLVwidXNlciVkQHRlc3QuY29tXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICAgICAgY2xpX2NvbW1hbmQsIGksIDIwICsgKGkgJSA0MCksIGkpOwogICAgICAgIAogICAgICAgIGlmIChzeXN0ZW0oY29tbWFuZCkgPT0gMCkgewogICAgICAgICAgICBzdWNjZXNzX2NvdW50Kys7CiAgICAgICAgfQogICAgfQogICAgCiAgICBsb25nIGxvbmcgYmF0Y2hfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICBkb3VibGUgYXZnX2JhdGNoX3RpbWUgPSAoZG91YmxlKWJhdGNoX3RpbWUgLyBiYXRjaF9zaXplOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQmF0Y2ggaW5zZXJ0OiAlZC8lZCBzdWNjZXNzZnVsLCB0b3RhbCB0aW1lOiAlbGxkIG1zLCBhdmc6ICUuMmYgbXNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzdWNjZXNzX2NvdW50LCBiYXRjaF9zaXplLCBiYXRjaF90aW1lLCBhdmdfYmF0Y2hfdGltZSk7CiAgICB9CiAgICAKICAgIHByaW50ZigiVGVzdGluZyBxdWVyeSBwZXJmb3JtYW5jZS4uLlxuIik7CiAgICBjaGFyIHF1ZXJ5X2NtZFsyNTZdOwogICAgc25wcmludGYocXVlcnlfY21kLCBzaXplb2YocXVlcnlfY21kKSwgIiVzIGZpbmQgcGVyZmRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6MjVcIiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgCiAgICBzdGFydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgc3lzdGVtKHF1ZXJ5X2NtZCk7CiAgICBsb25nIGxvbmcgcXVlcnlfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBRdWVyeSB0aW1lOiAlbGxkIG1zXG4iIFJFU0VULCBxdWVyeV90aW1lKTsKICAgIH0KICAgIAogICAgaW50IGFjdHVhbF9jb3VudCA9IGNvdW50X2luc3RhbmNlc19pbl9jb2xsZWN0aW9uKCJwZXJmZGIiLCAidXNlcnMiKTsKICAgIAogICAgcHJpbnRmKCJcblBlcmZvcm1hbmNlIFJlc3VsdHM6XG4iKTsKICAgIHByaW50ZigiICBTaW5nbGUgaW5zZXJ0OiAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICJcbiIsIHNpbmdsZV9pbnNlcnRfdGltZSk7CiAgICBwcmludGYoIiAgQmF0Y2ggaW5zZXJ0ICglZCByZWNvcmRzKTogIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiIChhdmc6ICIgQ1lBTiAiJS4yZiBtcyIgUkVTRVQgIilcbiIsIAogICAgICAgICAgIGJhdGNoX3NpemUsIGJhdGNoX3RpbWUsIGF2Z19iYXRjaF90aW1lKTsKICAgIHByaW50ZigiICBRdWVyeSB0aW1lOiAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICJcbiIsIHF1ZXJ5X3RpbWUpOwogICAgcHJpbnRmKCIgIEluc2VydCBzdWNjZXNzIHJhdGU6ICIgR1JFRU4gIiVkLyVkIiBSRVNFVCAiXG4iLCBzdWNjZXNzX2NvdW50LCBiYXRjaF9zaXplKTsKICAgIHByaW50ZigiICBSZWNvcmQgY291bnQgdmVyaWZpY2F0aW9uOiAiIEdSRUVOICIlZCIgUkVTRVQgIiByZWNvcmRzIGluIGNvbGxlY3Rpb25cbiIsIGFjdHVhbF9jb3VudCk7CiAgICAKICAgIGludCBwZXJmb3JtYW5jZV9vayA9IChzaW5nbGVfaW5zZXJ0X3RpbWUgPCAxMDAwKSAmJiAoYXZnX2JhdGNoX3RpbWUgPCA1MDApICYmIChxdWVyeV90aW1lIDwgNTAwKTsKICAgIGlmIChwZXJmb3JtYW5jZV9vaykgewogICAgICAgIHByaW50ZihHUkVFTiAiICDinJMgUGVyZm9ybWFuY2Ugd2l0aGluIGFjY2VwdGFibGUgbGltaXRzXG4iIFJFU0VUKTsKICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICDimqAgUGVyZm9ybWFuY2UgbWF5IG5lZWQgb3B0aW1pemF0aW9uXG4iIFJFU0VUKTsKICAgIH0KfQoKdm9pZCBydW5fZWRnZV9jYXNlX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiRURHRSBDQVNFIEFORCBFUlJPUiBIQU5ETElORyBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBlZGdlIGNhc2UgdGVzdHNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBUZXN0Q2FzZSBlZGdlX3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIGR1cGxpY2F0ZSBkYXRhYmFzZSBjcmVhdGlvbiIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICIlcyBsaXN0IHwgZ3JlcCAtYyB0ZXN0ZGIiLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgZHVwbGljYXRlIGNvbGxlY3Rpb24gY3JlYXRpb24iLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsIAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgfCBncmVwIC1jIHVzZXJzIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIG1pc3NpbmcgZGF0YWJhc2UgcXVlcmllcyIsCiAgICAgICAgICAgICIlcyBmaW5kIG5vbmV4aXN0ZW50ZGIgdXNlcnMgLS13aGVyZSBcIm5hbWU6dGVzdFwiIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdFcnJvciBoYW5kbGVkJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBtaXNzaW5nIGNvbGxlY3Rpb24gcXVlcmllcyIsIAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgbm9uZXhpc3RlbnQgLS13aGVyZSBcIm5hbWU6dGVzdFwiIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdFcnJvciBoYW5kbGVkJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBtYWxmb3JtZWQgcXVlcmllcyIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiaW52YWxpZC1xdWVyeS1mb3JtYXRcIiAyPiYxIHwgZ3JlcCAtaSAnZXJyb3JcXHxpbnZhbGlkJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdFcnJvciBoYW5kbGVkJyIsIAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgc2NoZW1hIHZhbGlkYXRpb24gZmFpbHVyZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLWluc2VydC1vbmUgLS1pbnZhbGlkLWZpZWxkLVwidmFsdWVcIiAyPiYxIHwgZ3JlcCAtaSAnZXJyb3JcXHx2YWxpZCcgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiZWNobyAnVmFsaWRhdGlvbiB3b3JrZWQnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCBlZGdlX2NvdW50ID0gc2l6ZW9mKGVkZ2VfdGVzdHMpIC8gc2l6ZW9mKGVkZ2VfdGVzdHNbMF0pOwogICAgaW50IGVkZ2VfcGFzc2VkID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBlZGdlX2NvdW50OyBpKyspIHsKICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgY2hhciBmaW5hbF92ZXJpZmljYXRpb25bMTAyNF07CiAgICAgICAgCiAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCBlZGdlX3Rlc3RzW2ldLmNvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICBzbnByaW50ZihmaW5hbF92ZXJpZmljYXRpb24sIHNpemVvZihmaW5hbF92ZXJpZmljYXRpb24pLCBlZGdlX3Rlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgCiAgICAgICAgc3RyY3B5KGVkZ2VfdGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgc3RyY3B5KGVkZ2VfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGZpbmFsX3ZlcmlmaWNhdGlvbik7CiAgICAgICAgCiAgICAgICAgaWYgKGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbigmZWRnZV90ZXN0c1tpXSkpIHsKICAgICAgICAgICAgZWRnZV9wYXNzZWQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgRWRnZSBjYXNlIHRlc3RzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIGVkZ2VfcGFzc2VkLCBlZGdlX2NvdW50KTsKfQoKdm9pZCBydW5fY29tcHJlaGVuc2l2ZV92ZXJpZmljYXRpb24oKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJDT01QUkVIRU5TSVZFIFNUUlVDVFVSRSBWRVJJRklDQVRJT04iIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgY29tcHJlaGVuc2l2ZSBzdHJ1Y3R1cmUgdmVyaWZpY2F0aW9uXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgaW50IHZlcmlmaWNhdGlvbl9wYXNzZWQgPSAwOwogICAgaW50IHZlcmlmaWNhdGlvbl90b3RhbCA9IDA7CiAgICAKICAgIHByaW50ZigiVmVyaWZ5aW5nIHRlc3RkYiBzdHJ1Y3R1cmUuLi5cbiIpOwogICAgaWYgKHZlcmlmeV9kYXRhYmFzZV9zdHJ1Y3R1cmUoInRlc3RkYiIpKSB2ZXJpZmljYXRpb25fcGFzc2VkKys7CiAgICB2ZXJpZmljYXRpb25fdG90YWwrKzsKICAgIAogICAgaWYgKHZlcmlmeV9jb2xsZWN0aW9uX3N0cnVjdHVyZSgidGVzdGRiIiwgInVzZXJzIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBpZiAodmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKCJ0ZXN0ZGIiLCAicHJvZHVjdHMiKSkgdmVyaWZpY2F0aW9uX3Bhc3NlZCsrOwogICAgdmVyaWZpY2F0aW9uX3RvdGFsKys7CiAgICAKICAgIGlmICh2ZXJpZnlfc2NoZW1hX2NvbnRlbnQoInRlc3RkYiIsICJ1c2VycyIsICJuYW1lIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBwcmludGYoIlZlcmlmeWluZyB0ZXN0ZGIyIHN0cnVjdHVyZS4uLlxuIik7CiAgICBpZiAodmVyaWZ5X2RhdGFiYXNlX3N0cnVjdHVyZSgidGVzdGRiMiIpKSB2ZXJpZmljYXRpb25fcGFzc2VkKys7CiAgICB2ZXJpZmljYXRpb25fdG90YWwrKzsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBTdHJ1Y3R1cmUgdmVyaWZpY2F0aW9uOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIHZlcmlmaWNhdGlvbl9wYXNzZWQsIHZlcmlmaWNhdGlvbl90b3RhbCk7Cn0KCmludCBydW5fY2xpX3Rlc3RzKCkgewogICAgcHJpbnRmKENZQU4gIlNZREIgQ0xJIENPTVBSRUhFTlNJVkUgVEVTVCBTVUlURVxuIiBSRVNFVCk7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIHByaW50ZigiVXNpbmcgY29tbWFuZDogIiBZRUxMT1cgIiVzIiBSRVNFVCAiXG4iLCBjbGlfY29tbWFuZCk7CiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKCJWZXJib3NlIG1vZGU6ICIgWUVMTE9XICJFTkFCTEVEIiBSRVNFVCAiIC0gRGV0YWlsZWQgbG9nZ2luZyBmb3IgZmFpbHVyZXNcbiIpOwogICAgfQogICAgcHJpbnRmKCJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ2xlYW5pbmcgdXAgcHJldmlvdXMgdGVzdCBkYXRhLi4uXG4iIFJFU0VUKTsKICAgIH0KICAgIHN5c3RlbSgicm0gLXJmIC90bXAvc3lkYl90ZXN0ID4gL2Rldi9udWxsIDI+JjEiKTsKICAgIAogICAgVGVzdENhc2UgdGVzdHNbXSA9IHsKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgZGF0YWJhc2UgJ3Rlc3RkYicgYW5kIHZlcmlmeSBzdHJ1Y3R1cmUiLCAKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1kICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGInIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlIHNlY29uZCBkYXRhYmFzZSAndGVzdGRiMicgYW5kIHZlcmlmeSIsIAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYjIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1kICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIyJyIsIAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJMaXN0IGRhdGFiYXNlcyBhbmQgdmVyaWZ5IGJvdGggZXhpc3QiLAogICAgICAgICAgICAiJXMgbGlzdCA+IC9kZXYvbnVsbCAyPiYxIiwgCiAgICAgICAgICAgICIlcyBsaXN0IHwgZ3JlcCAtYyAndGVzdGRiXFx8dGVzdGRiMiciLAogICAgICAgICAgICAiMiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlICd1c2VycycgY29sbGVjdGlvbiB3aXRoIHNjaGVtYSBhbmQgdmVyaWZ5IGZpbGVzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgdXNlcnMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZy1yZXEgLS1hZ2UtaW50IC0tZW1haWwtc3RyaW5nID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAidGVzdCAtZiAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL3VzZXJzL3NjaGVtYS50eHQnICYmIHRlc3QgLWYgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYi91c2Vycy9kYXRhLnN5ZGInIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlICdwcm9kdWN0cycgY29sbGVjdGlvbiBhbmQgdmVyaWZ5IHN0cnVjdHVyZSIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHByb2R1Y3RzIC0tc2NoZW1hIC0tbmFtZS1zdHJpbmctcmVxIC0tcHJpY2UtZmxvYXQgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1mICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvcHJvZHVjdHMvc2NoZW1hLnR4dCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJWaWV3IHVzZXJzIHNjaGVtYSBhbmQgdmVyaWZ5IG91dHB1dCBmb3JtYXQiLAogICAgICAgICAgICAiJXMgc2NoZW1hIHRlc3RkYiB1c2VycyA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIHNjaGVtYSB0ZXN0ZGIgdXNlcnMgfCBncmVwIC1xICdGaWVsZC4qVHlwZSciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJJbnNlcnQgdXNlciByZWNvcmQgYW5kIHZlcmlmeSBieSBjb3VudGluZyBpbnN0YW5jZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLWluc2VydC1vbmUgLS1uYW1lLVwiSm9obiBEb2VcIiAtLWFnZS0zMCAtLWVtYWlsLVwiam9obkB0ZXN0LmNvbVwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgfCBncmVwIC1jICdcIl9pZFwiJyIsCiAgICAgICAgICAgICIxIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJJbnNlcnQgc2Vjb25kIHVzZXIgYW5kIHZlcmlmeSB0b3RhbCBjb3VudCIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJKYW5lIFNtaXRoXCIgLS1hZ2UtMjUgLS1lbWFpbC1cImphbmVAdGVzdC5jb21cIiA+IC9kZXYvbnVsbCAyPiYxIiwgCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGdyZXAgLWMgJ1wiX2lkXCInIiwKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkluc2VydCBwcm9kdWN0IHJlY29yZCBhbmQgdmVyaWZ5IGNyZWF0aW9uIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgcHJvZHVjdHMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIlRlc3QgUHJvZHVjdFwiIC0tcHJpY2UtMTkuOTkgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiBwcm9kdWN0cyB8IGdyZXAgLWMgJ1Rlc3QgUHJvZHVjdCciLAogICAgICAgICAgICAiMSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUXVlcnkgdXNlcnMgYnkgYWdlIGFuZCB2ZXJpZnkgZXhhY3QgbWF0Y2giLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImFnZTozMFwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImFnZTozMFwiIHwgZ3JlcCAtYyAnSm9obiBEb2UnIiwKICAgICAgICAgICAgIjEiLCAKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJRdWVyeSBwcm9kdWN0cyBieSBuYW1lIGFuZCB2ZXJpZnkgcmVzdWx0IiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHByb2R1Y3RzIC0td2hlcmUgXCJuYW1lOlRlc3QgUHJvZHVjdFwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgcHJvZHVjdHMgLS13aGVyZSBcIm5hbWU6VGVzdCBQcm9kdWN0XCIgfCBncmVwIC1jICdUZXN0IFByb2R1Y3QnIiwKICAgICAgICAgICAgIjEiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlF1ZXJ5IHdpdGggbm9uLWV4aXN0ZW50IGNvbmRpdGlvbiByZXR1cm5zIGVtcHR5IiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6OTk5XCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiYWdlOjk5OVwiIHwgd2MgLWwiLAogICAgICAgICAgICAiMCIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiTGlzdCBjb2xsZWN0aW9ucyBpbiB0ZXN0ZGIgYW5kIHZlcmlmeSBjb3VudCIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHwgZ3JlcCAtYyAndXNlcnNcXHxwcm9kdWN0cyciLCAKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkxpc3QgdXNlcnMgYW5kIHZlcmlmeSByZWNvcmQgY291bnQiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGdyZXAgLWMgJ1wiX2lkXCInIiwKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlZlcmlmeSBVVUlEIGZvcm1hdCBpbiBpbnNlcnRlZCByZWNvcmRzIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgaGVhZCAtMSA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgaGVhZCAtMSB8IGdyZXAgLUVvICdcIlthLWYwLTldezh9LVthLWYwLTldezR9LVthLWYwLTldezR9LVthLWYwLTldezR9LVthLWYwLTldezEyfVwiJyB8IHdjIC1sIiwKICAgICAgICAgICAgIjEiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9CiAgICB9OwogICAgCiAgICBpbnQgdG90YWxfdGVzdHMgPSBzaXplb2YodGVzdHMpIC8gc2l6ZW9mKHRlc3RzWzBdKTsKICAgIGludCBwYXNzZWRfdGVzdHMgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX2R1cmF0aW9uID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCB0b3RhbF90ZXN0czsgaSsrKSB7CiAgICAgICAgY2hhciBmaW5hbF9jb21tYW5kWzEwMjRdOwogICAgICAgIGNoYXIgZmluYWxfdmVyaWZpY2F0aW9uWzEwMjRdOwogICAgICAgIAogICAgICAgIHNucHJpbnRmKGZpbmFsX2NvbW1hbmQsIHNpemVvZihmaW5hbF9jb21tYW5kKSwgdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIHNucHJpbnRmKGZpbmFsX3ZlcmlmaWNhdGlvbiwgc2l6ZW9mKGZpbmFsX3ZlcmlmaWNhdGlvbiksIHRlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgCiAgICAgICAgc3RyY3B5KHRlc3RzW2ldLmNvbW1hbmQsIGZpbmFsX2NvbW1hbmQpOwogICAgICAgIHN0cmNweSh0ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgZmluYWxfdmVyaWZpY2F0aW9uKTsKICAgIH0KICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCB0b3RhbF90ZXN0czsgaSsrKSB7CiAgICAgICAgaWYgKGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbigmdGVzdHNbaV0pKSB7CiAgICAgICAgICAgIHBhc3NlZF90ZXN0cysrOwogICAgICAgIH0KICAgICAgICB0b3RhbF9kdXJhdGlvbiArPSB0ZXN0c1tpXS5kdXJhdGlvbl9tczsKICAgIH0KICAgIAogICAgcmV0dXJuIHBhc3NlZF90ZXN0czsKfQoKdm9pZCBwcmludF9odHRwX3Jlc3VsdHMoaW50IGRiX3Bhc3NlZCwgaW50IGRiX3RvdGFsLCBpbnQgY29sbF9wYXNzZWQsIGludCBjb2xsX3RvdGFsLCAKICAgICAgICAgICAgICAgICAgICAgICBpbnQgaW5zdF9wYXNzZWQsIGludCBpbnN0X3RvdGFsLCBpbnQgY21kX3Bhc3NlZCwgaW50IGNtZF90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICBpbnQgZXJyX3Bhc3NlZCwgaW50IGVycl90b3RhbCwgbG9uZyBsb25nIHRvdGFsX3RpbWUpIHsKICAgIHByaW50ZigiXG4iKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgcHJpbnRmKEJMVUUgIiAgICAgICAgICAgSFRUUCBBUEkgVEVTVCBSRVNVTFRTICAgICAgICAgICAiIFJFU0VUICJcbiIpOwogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIik7CiAgICAKICAgIGludCB0b3RhbF9wYXNzZWQgPSBkYl9wYXNzZWQgKyBjb2xsX3Bhc3NlZCArIGluc3RfcGFzc2VkICsgY21kX3Bhc3NlZCArIGVycl9wYXNzZWQ7CiAgICBpbnQgdG90YWxfdGVzdHMgPSBkYl90b3RhbCArIGNvbGxfdG90YWwgKyBpbnN0X3RvdGFsICsgY21kX3RvdGFsICsgZXJyX3RvdGFsOwogICAgZG91YmxlIHBlcmNlbnRhZ2UgPSAoZG91YmxlKXRvdGFsX3Bhc3NlZCAvIHRvdGFsX3Rlc3RzICogMTAwOwogICAgCiAgICBjaGFyICpjb2xvciA9IChwZXJjZW50YWdlID49IDkwKSA/IEdSRUVOIDogKHBlcmNlbnRhZ2UgPj0gNzApID8gWUVMTE9XIDogUkVEOwogICAgY2hhciAqc3RhdHVzID0gKHBlcmNlbnRhZ2UgPj0gOTApID8gIkVYQ0VMTEVOVCIgOiAocGVyY2VudGFnZSA+PSA3MCkgPyAiR09PRCIgOiAiTkVFRFMgSU1QUk9WRU1FTlQiOwogICAgCiAgICBwcmludGYoIiAgRGF0YWJhc2UgVGVzdHM6ICAgICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChkYl9wYXNzZWQgPT0gZGJfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGRiX3Bhc3NlZCwgZGJfdG90YWwpOwogICAgcHJpbnRmKCIgIENvbGxlY3Rpb24gVGVzdHM6ICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoY29sbF9wYXNzZWQgPT0gY29sbF90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgY29sbF9wYXNzZWQsIGNvbGxfdG90YWwpOwogICAgcHJpbnRmKCIgIEluc3RhbmNlIFRlc3RzOiAgICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoaW5zdF9wYXNzZWQgPT0gaW5zdF90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgaW5zdF9wYXNzZWQsIGluc3RfdG90YWwpOwogICAgcHJpbnRmKCIgIENvbW1hbmQgVGVzdHM6ICAgICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoY21kX3Bhc3NlZCA9PSBjbWRfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGNtZF9wYXNzZWQsIGNtZF90b3RhbCk7CiAgICBwcmludGYoIiAgRXJyb3IgVGVzdHM6ICAgICAgICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChlcnJfcGFzc2VkID09IGVycl90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgZXJyX3Bhc3NlZCwgZXJyX3RvdGFsKTsKICAgIHByaW50ZigiICBUb3RhbCBUaW1lOiAgICAgICAgIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiXG4iLCB0b3RhbF90aW1lKTsKICAgIHByaW50ZigiICBPdmVyYWxsOiAgICAgICAgICAgJXMlZC8lZCAoJS4xZiUlKSAtICVzIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICBjb2xvciwgdG90YWxfcGFzc2VkLCB0b3RhbF90ZXN0cywgcGVyY2VudGFnZSwgc3RhdHVzKTsKICAgIAogICAgcHJpbnRmKCJcbiAgRGV0YWlsZWQgQnJlYWtkb3duOlxuIik7CiAgICAKICAgIGludCBiYXJfd2lkdGggPSAyMDsKICAgIAogICAgcHJpbnRmKCIgIERhdGFiYXNlczogICAgICAgIFsiKTsKICAgIGludCBkYl9maWxsZWQgPSAoaW50KSgoZG91YmxlKWRiX3Bhc3NlZCAvIGRiX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGRiX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpZGJfcGFzc2VkIC8gZGJfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgQ29sbGVjdGlvbnM6ICAgICAgWyIpOwogICAgaW50IGNvbGxfZmlsbGVkID0gKGludCkoKGRvdWJsZSljb2xsX3Bhc3NlZCAvIGNvbGxfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgY29sbF9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWNvbGxfcGFzc2VkIC8gY29sbF90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBJbnN0YW5jZXM6ICAgICAgICBbIik7CiAgICBpbnQgaW5zdF9maWxsZWQgPSAoaW50KSgoZG91YmxlKWluc3RfcGFzc2VkIC8gaW5zdF90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBpbnN0X2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpaW5zdF9wYXNzZWQgLyBpbnN0X3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIENvbW1hbmRzOiAgICAgICAgIFsiKTsKICAgIGludCBjbWRfZmlsbGVkID0gKGludCkoKGRvdWJsZSljbWRfcGFzc2VkIC8gY21kX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGNtZF9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWNtZF9wYXNzZWQgLyBjbWRfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgRXJyb3IgSGFuZGxpbmc6ICAgWyIpOwogICAgaW50IGVycl9maWxsZWQgPSAoaW50KSgoZG91YmxlKWVycl9wYXNzZWQgLyBlcnJfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgZXJyX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpZXJyX3Bhc3NlZCAvIGVycl90b3RhbCAqIDEwMCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUgJiYgdG90YWxfcGFzc2VkIDwgdG90YWxfdGVzdHMpIHsKICAgICAgICBwcmludGYoIlxuIiBZRUxMT1cgIiAgW1ZFUkJPU0VdIEZhaWxlZCB0ZXN0cyBkZXRhaWxlZCBpbiBsb2dzIGFib3ZlXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuXG4iKTsKfQoKdm9pZCBwcmludF9jbGlfcmVzdWx0cyhpbnQgY2xpX3Bhc3NlZCwgaW50IGNsaV90b3RhbCwgbG9uZyBsb25nIHRvdGFsX3RpbWUsIGludCBzZWN1cml0eV9wYXNzZWQsIGludCBzZWN1cml0eV90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgIGludCBpbnRlZ3JpdHlfcGFzc2VkLCBpbnQgaW50ZWdyaXR5X3RvdGFsLCBpbnQgZWRnZV9wYXNzZWQsIGludCBlZGdlX3RvdGFsKSB7CiAgICBwcmludGYoIlxuIik7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIHByaW50ZihCTFVFICIgICAgICAgICAgIENPTVBSRUhFTlNJVkUgVEVTVCBSRVNVTFRTICAgICAgICAgIiBSRVNFVCAiXG4iKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgCiAgICBkb3VibGUgY2xpX3BlcmNlbnRhZ2UgPSAoZG91YmxlKWNsaV9wYXNzZWQgLyBjbGlfdG90YWwgKiAxMDA7CiAgICBjaGFyICpjbGlfY29sb3IgPSAoY2xpX3BlcmNlbnRhZ2UgPj0gOTApID8gR1JFRU4gOiAoY2xpX3BlcmNlbnRhZ2UgPj0gNzApID8gWUVMTE9XIDogUkVEOwogICAgY2hhciAqY2xpX3N0YXR1cyA9IChjbGlfcGVyY2VudGFnZSA+PSA5MCkgPyAiRVhDRUxMRU5UIiA6IChjbGlfcGVyY2VudGFnZSA+PSA3MCkgPyAiR09PRCIgOiAiTkVFRFMgSU1QUk9WRU1FTlQiOwogICAgCiAgICBwcmludGYoIiAgQ29yZSBUZXN0czogICAgICAiIEdSRUVOICIlZC8lZCIgUkVTRVQgIiAoJXMlLjFmJSUlcylcbiIsIAogICAgICAgICAgIGNsaV9wYXNzZWQsIGNsaV90b3RhbCwgY2xpX2NvbG9yLCBjbGlfcGVyY2VudGFnZSwgUkVTRVQpOwogICAgcHJpbnRmKCIgIFNlY3VyaXR5IFRlc3RzOiAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKHNlY3VyaXR5X3Bhc3NlZCA9PSBzZWN1cml0eV90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgc2VjdXJpdHlfcGFzc2VkLCBzZWN1cml0eV90b3RhbCk7CiAgICBwcmludGYoIiAgSW50ZWdyaXR5IFRlc3RzOiAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoaW50ZWdyaXR5X3Bhc3NlZCA9PSBpbnRlZ3JpdHlfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGludGVncml0eV9wYXNzZWQsIGludGVncml0eV90b3RhbCk7CiAgICBwcmludGYoIiAgRWRnZSBDYXNlIFRlc3RzOiAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoZWRnZV9wYXNzZWQgPT0gZWRnZV90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgZWRnZV9wYXNzZWQsIGVkZ2VfdG90YWwpOwogICAgcHJpbnRmKCIgIFRvdGFsIFRpbWU6ICAgICAgIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiXG4iLCB0b3RhbF90aW1lKTsKICAgIHByaW50ZigiICBPdmVyYWxsIFN0YXR1czogICVzJXMiIFJFU0VUICJcbiIsIGNsaV9jb2xvciwgY2xpX3N0YXR1cyk7CiAgICAKICAgIHByaW50ZigiXG4gIERldGFpbGVkIEJyZWFrZG93bjpcbiIpOwogICAgCiAgICBpbnQgYmFyX3dpZHRoID0gMjA7CiAgICAKICAgIHByaW50ZigiICBDb3JlIEZlYXR1cmVzOiAgIFsiKTsKICAgIGludCBjb3JlX2ZpbGxlZCA9IChpbnQpKGNsaV9wZXJjZW50YWdlIC8gMTAwICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGNvcmVfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICVzJS4xZiUlJXNcbiIsIGNsaV9jb2xvciwgY2xpX3BlcmNlbnRhZ2UsIFJFU0VUKTsKICAgIAogICAgcHJpbnRmKCIgIFNlY3VyaXR5OiAgICAgICAgWyIpOwogICAgaW50IHNlY3VyaXR5X2ZpbGxlZCA9IChpbnQpKChkb3VibGUpc2VjdXJpdHlfcGFzc2VkIC8gc2VjdXJpdHlfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgc2VjdXJpdHlfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSlzZWN1cml0eV9wYXNzZWQgLyBzZWN1cml0eV90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBEYXRhIEludGVncml0eTogIFsiKTsKICAgIGludCBpbnRlZ3JpdHlfZmlsbGVkID0gKGludCkoKGRvdWJsZSlpbnRlZ3JpdHlfcGFzc2VkIC8gaW50ZWdyaXR5X3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGludGVncml0eV9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWludGVncml0eV9wYXNzZWQgLyBpbnRlZ3JpdHlfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgRXJyb3IgSGFuZGxpbmc6ICBbIik7CiAgICBpbnQgZWRnZV9maWxsZWQgPSAoaW50KSgoZG91YmxlKWVkZ2VfcGFzc2VkIC8gZWRnZV90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBlZGdlX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpZWRnZV9wYXNzZWQgLyBlZGdlX3RvdGFsICogMTAwKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSAmJiAoY2xpX3Bhc3NlZCA8IGNsaV90b3RhbCB8fCBzZWN1cml0eV9wYXNzZWQgPCBzZWN1cml0eV90b3RhbCB8fCAKICAgICAgICAgICAgICAgICAgICAgICAgaW50ZWdyaXR5X3Bhc3NlZCA8IGludGVncml0eV90b3RhbCB8fCBlZGdlX3Bhc3NlZCA8IGVkZ2VfdG90YWwpKSB7CiAgICAgICAgcHJpbnRmKCJcbiIgWUVMTE9XICIgIFtWRVJCT1NFXSBDaGVjayB2ZXJib3NlIGxvZ3MgYWJvdmUgZm9yIGRldGFpbGVkIGZhaWx1cmUgYW5hbHlzaXNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG5cbiIpOwp9CgovLyA9PT09PT09PT09PT09PT09PT09PSBIVFRQIExPQUQgR0VORVJBVE9SID09PT09PT09PT09PT09PT09PT09Ci8vCi8vIC0tbG9hZCBkcml2ZXMgYSBydW5uaW5nIGBzeWRiIC0tc2VydmVyYCB3aXRoIGNvbmN1cnJlbnQgY29ubmVjdGlvbnMgc3ByZWFkIG92ZXIKLy8gd29ya2VyIHRocmVhZHMuIEVhY2ggdGhyZWFkIG11bHRpcGxleGVzIGl0cyBjb25uZWN0aW9ucyB3aXRoIHBvbGwoKSBvbiBub24tYmxvY2tpbmcKLy8gc29ja2V0cywgdXNpbmcgdGhlIHNhbWUgcmVxdWVzdCBmb3JtYXQgYXMgaHR0cF9yZXF1ZXN0KCkuIEluIGNsb3NlZC1sb29wIG1vZGUgZXZlcnkKLy8gY29ubmVjdGlvbiBzZW5kcyBpdHMgbmV4dCByZXF1ZXN0IGFzIHNvb24gYXMgdGhlIHByZXZpb3VzIG9uZSBjb21wbGV0ZXM7IHdpdGggLS1yYXRlCi8vIHRoZSB0aHJlYWRzIGZvbGxvdyBhIGNvbnN0YW50LXJhdGUgc2NoZWR1bGUgKG9wZW4gbG9vcCkgYW5kIGxhdGVuY3kgaXMgbWVhc3VyZWQgZnJvbQovLyB0aGUgc2NoZWR1bGVkIHNlbmQgdGltZSwgc28gYSBzdGFsbGVkIHNlcnZlciBpcyBub3QgaGlkZGVuIGJ5IHRoZSBjbGllbnQgd2FpdGluZyBvbiBpdC4KLy8gTGF0ZW5jaWVzIGFyZSByZWNvcmRlZCBpbiBsb2ctbGluZWFyIChIRFItc3R5bGUpIGhpc3RvZ3JhbXMgcGVyIG9wZXJhdGlvbiB0eXBlLgovLwovLyAtLXdvcmtsb2FkIGEuLmYgc2VsZWN0cyBhIFlDU0Itc3R5bGUgcHJlc2V0IChvcGVyYXRpb24gbWl4LCBrZXkgZGlzdHJpYnV0aW9uIGFuZAovLyByZWNvcmQgY291bnQpLiAtLWVtYmVkZGVkIHJ1bnMgdGhlIHNhbWUgd29ya2xvYWQgaW4tcHJvY2VzcyB0aHJvdWdoIGxpYnN5ZGIuCgojZGVmaW5lIExPQURfTUFYSU1VTV9USFJFQURTIDI1NgojZGVmaW5lIExPQURfTUFYSU1VTV9DT05ORUNUSU9OUyA0MDk2CiNkZWZpbmUgTE9BRF9SRVFVRVNUX0JVRkZFUl9TSVpFIDgxOTIKI2RlZmluZSBMT0FEX1JFU1BPTlNFX0JVRkZFUl9TSVpFIDE2Mzg0CiNkZWZpbmUgTE9BRF9SRVFVRVNUX1RJTUVPVVRfVVMgMTAwMDAwMDBMTAojZGVmaW5lIExPQURfSURFTlRJRklFUl9TSVpFIDM3CiNkZWZpbmUgTE9BRF9JREVOVElGSUVSX0NIVU5LX1NJWkUgNjU1MzYKI2RlZmluZSBMT0FEX0lERU5USUZJRVJfTUFYSU1VTV9DSFVOS1MgNDA5NgojZGVmaW5lIExPQURfU0NBTl9SQU5HRV9TSVpFIDEwCiNkZWZpbmUgTE9BRF9ERUZBVUxUX1pJUEZJQU5fQ09OU1RBTlQgMC45OQoKLy8gSGlzdG9ncmFtOiB2YWx1ZXMgYmVsb3cgMTI4dXMgYXJlIGV4YWN0LCBhYm92ZSB0aGF0IGVhY2ggcG93ZXIgb2YgdHdvIGlzIHNwbGl0IGludG8KLy8gNjQgc3ViLWJ1Y2tldHMsIHNvIGFueSByZWNvcmRlZCB2YWx1ZSBpcyByZXBvcnRlZCB3aXRoaW4gMS42JSBvZiBpdHMgdHJ1ZSB2YWx1ZQojZGVmaW5lIEhJU1RPR1JBTV9MSU5FQVJfTElNSVQgMTI4CiNkZWZpbmUgSElTVE9HUkFNX1NVQl9CVUNLRVRTIDY0CiNkZWZpbmUgSElTVE9HUkFNX0JVQ0tFVF9DT1VOVCAoSElTVE9HUkFNX0xJTkVBUl9MSU1JVCArICg2NCAtIDcpICogSElTVE9HUkFNX1NVQl9CVUNLRVRTKQoKdHlwZWRlZiBzdHJ1Y3QgewogICAgdWludDY0X3QgY291bnRzW0hJU1RPR1JBTV9CVUNLRVRfQ09VTlRdOwogICAgdWludDY0X3QgdG90YWxfY291bnQ7CiAgICB1aW50NjRfdCBtYXhpbXVtX3ZhbHVlOwogICAgbG9uZyBkb3VibGUgc3VtOwp9IExhdGVuY3lIaXN0b2dyYW07Cgp0eXBlZGVmIGVudW0gewogICAgTE9BRF9PUEVSQVRJT05fR0VUID0gMCwKICAgIExPQURfT1BFUkFUSU9OX0lOU0VSVCwKICAgIExPQURfT1BFUkFUSU9OX1VQREFURSwKICAgIExPQURfT1BFUkFUSU9OX0RFTEVURSwKICAgIExPQURfT1BFUkFUSU9OX1FVRVJZLAogICAgTE9BRF9PUEVSQVRJT05fTElTVCwKICAgIExPQURfT1BFUkFUSU9OX1NDQU4sCiAgICBMT0FEX09QRVJBVElPTl9SRUFEX01PRElGWV9XUklURSwKICAgIExPQURfT1BFUkFUSU9OX0NPVU5UCn0gTG9hZE9wZXJhdGlvbjsKCnN0YXRpYyBjb25zdCBjaGFyKiBsb2FkX29wZXJhdGlvbl9uYW1lc1tMT0FEX09QRVJBVElPTl9DT1VOVF0gPSB7CiAgICAiZ2V0IiwgImluc2VydCIsICJ1cGRhdGUiLCAiZGVsZXRlIiwgInF1ZXJ5IiwgImxpc3QiLCAic2NhbiIsICJybXciCn07Cgp0eXBlZGVmIGVudW0gewogICAgTE9BRF9ESVNUUklCVVRJT05fVU5JRk9STSA9IDAsCiAgICBMT0FEX0RJU1RSSUJVVElPTl9aSVBGSUFOLAogICAgTE9BRF9ESVNUUklCVVRJT05fTEFURVNUCn0gTG9hZERpc3RyaWJ1dGlvbjsKCnN0YXRpYyBjb25zdCBjaGFyKiBsb2FkX2Rpc3RyaWJ1dGlvbl9uYW1lc1tdID0geyAidW5pZm9ybSIsICJ6aXBmaWFuIiwgImxhdGVzdCIgfTsKCi8vIFlDU0IgY29yZSB3b3JrbG9hZHMuIFJlYWRzIGFyZSBwb2ludCBnZXRzIGJ5IGlkOyBzY2FucyByZWFkIHRoZSByZWNvcmRzIHNoYXJpbmcgYQovLyAicmFuZ2UiIHZhbHVlIChMT0FEX1NDQU5fUkFOR0VfU0laRSBjb25zZWN1dGl2ZSBrZXlzKSwgc2luY2UgU3lEQiBoYXMgbm8gcmFuZ2UgcXVlcnkKdHlwZWRlZiBzdHJ1Y3QgewogICAgY29uc3QgY2hhciogbmFtZTsKICAgIGNvbnN0IGNoYXIqIGRlc2NyaXB0aW9uOwogICAgY29uc3QgY2hhciogbWl4OwogICAgTG9hZERpc3RyaWJ1dGlvbiBkaXN0cmlidXRpb247Cn0gTG9hZFdvcmtsb2FkUHJlc2V0OwoKc3RhdGljIGNvbnN0IExvYWRXb3JrbG9hZFByZXNldCBsb2FkX3dvcmtsb2FkX3ByZXNldHNbXSA9IHsKICAgIHsgImEiLCAidXBkYXRlIGhlYXZ5IiwgICAgICAgICJnZXQ9NTAsdXBkYXRlPTUwIiwgTE9BRF9ESVNUUklCVVRJT05fWklQRklBTiB9LAogICAgeyAiYiIsICJyZWFkIG1vc3RseSIsICAgICAgICAgImdldD05NSx1cGRhdGU9NSIsICBMT0FEX0RJU1RSSUJVVElPTl9aSVBGSUFOIH0sCiAgICB7ICJjIiwgInJlYWQgb25seSIsICAgICAgICAgICAiZ2V0PTEwMCIsICAgICAgICAgIExPQURfRElTVFJJQlVUSU9OX1pJUEZJQU4gfSwKICAgIHsgImQiLCAicmVhZCBsYXRlc3QiLCAgICAgICAgICJnZXQ9OTUsaW5zZXJ0PTUiLCAgTE9BRF9ESVNUUklCVVRJT05fTEFURVNUIH0sCiAgICB7ICJlIiwgInNob3J0IHJhbmdlcyIsICAgICAgICAic2Nhbj05NSxpbnNlcnQ9NSIsIExPQURfRElTVFJJQlVUSU9OX1pJUEZJQU4gfSwKICAgIHsgImYiLCAicmVhZC1tb2RpZnktd3JpdGUiLCAgICJnZXQ9NTAscm13PTUwIiwgICAgTE9BRF9ESVNUUklCVVRJT05fWklQRklBTiB9Cn07CgojZGVmaW5lIExPQURfV09SS0xPQURfUFJFU0VUX0NPVU5UICgoaW50KShzaXplb2YobG9hZF93b3JrbG9hZF9wcmVzZXRzKSAvIHNpemVvZihsb2FkX3dvcmtsb2FkX3ByZXNldHNbMF0pKSkKCi8vIFlDU0IncyB6aXBmaWFuIGdlbmVyYXRvciAoR3JheSBldCBhbC4pLCBzaXplZCB0byB0aGUgcmVjb3JkIGNvdW50IGF0IHBoYXNlIHN0YXJ0CnR5cGVkZWYgc3RydWN0IHsKICAgIGxvbmcgbG9uZyBpdGVtX2NvdW50OwogICAgZG91YmxlIHRoZXRhOwogICAgZG91YmxlIGFscGhhOwogICAgZG91YmxlIHpldGFfbjsKICAgIGRvdWJsZSBldGE7CiAgICBkb3VibGUgaGFsZl9wb3dfdGhldGE7Cn0gWmlwZmlhbkdlbmVyYXRvcjsKCnR5cGVkZWYgc3RydWN0IHsKICAgIGNoYXIgaWRlbnRpZmllcltMT0FEX0lERU5USUZJRVJfU0laRV07CiAgICBsb25nIGxvbmcga2V5Owp9IExvYWRSZWNvcmQ7CgovLyBFbnRyeSBwb2ludHMgcmVzb2x2ZWQgZnJvbSBsaWJzeWRiLnNvIGZvciAtLWVtYmVkZGVkCnR5cGVkZWYgc3RydWN0IHsKICAgIHZvaWQqIGxpYnJhcnk7CiAgICB2b2lkKiAoKm9wZW4pKGNvbnN0IGNoYXIqIGJhc2VfZGlyZWN0b3J5LCBjb25zdCBjaGFyKiBkYXRhYmFzZV9uYW1lKTsKICAgIHZvaWQgKCpjbG9zZSkodm9pZCogaGFuZGxlKTsKICAgIHZvaWQgKCpmcmVlKSh2b2lkKiBwb2ludGVyKTsKICAgIGludCAoKmNyZWF0ZV9jb2xsZWN0aW9uKSh2b2lkKiBoYW5kbGUsIGNvbnN0IGNoYXIqIGNvbGxlY3Rpb25fbmFtZSwgY29uc3QgY2hhciogc2NoZW1hX2pzb24pOwogICAgaW50ICgqaW5zZXJ0KSh2b2lkKiBoYW5kbGUsIGNvbnN0IGNoYXIqIGNvbGxlY3Rpb25fbmFtZSwgY29uc3QgY2hhciogaW5zdGFuY2VfanNvbiwgY2hhciogaW5zdGFuY2VfaWQpOwogICAgaW50ICgqdXBkYXRlKSh2b2lkKiBoYW5kbGUsIGNvbnN0IGNoYXIqIGNvbGxlY3Rpb25fbmFtZSwgY29uc3QgY2hhciogaW5zdGFuY2VfaWQsIGNvbnN0IGNoYXIqIHVwZGF0ZV9qc29uKTsKICAgIGludCAoKmRlbGV0ZV9pbnN0YW5jZSkodm9pZCogaGFuZGxlLCBjb25zdCBjaGFyKiBjb2xsZWN0aW9uX25hbWUsIGNvbnN0IGNoYXIqIGluc3RhbmNlX2lkKTsKICAgIGNoYXIqICgqZ2V0KSh2b2lkKiBoYW5kbGUsIGNvbnN0IGNoYXIqIGNvbGxlY3Rpb25fbmFtZSwgY29uc3QgY2hhciogaW5zdGFuY2VfaWQpOwogICAgdm9pZCogKCpxdWVyeSkodm9pZCogaGFuZGxlLCBjb25zdCBjaGFyKiBjb2xsZWN0aW9uX25hbWUsIGNvbnN0IGNoYXIqIHF1ZXJ5KTsKICAgIGNvbnN0IGNoYXIqICgqY3Vyc29yX25leHQpKHZvaWQqIGN1cnNvcik7CiAgICB2b2lkICgqY3Vyc29yX2Nsb3NlKSh2b2lkKiBjdXJzb3IpOwp9IEVtYmVkZGVkQXBpOwoKdHlwZWRlZiBlbnVtIHsKICAgIExPQURfU0xPVF9JRExFID0gMCwKICAgIExPQURfU0xPVF9DT05ORUNUSU5HLAogICAgTE9BRF9TTE9UX1NFTkRJTkcsCiAgICBMT0FEX1NMT1RfUkVDRUlWSU5HCn0gTG9hZFNsb3RTdGF0ZTsKCnR5cGVkZWYgc3RydWN0IHsKICAgIGludCBzb2NrZXRfZmQ7CiAgICBMb2FkU2xvdFN0YXRlIHN0YXRlOwogICAgTG9hZE9wZXJhdGlvbiBvcGVyYXRpb247CiAgICBsb25nIGxvbmcgaW50ZW5kZWRfc3RhcnRfdXM7CiAgICBsb25nIGxvbmcgZGVhZGxpbmVfdXM7CiAgICBjaGFyIHJlcXVlc3RbTE9BRF9SRVFVRVNUX0JVRkZFUl9TSVpFXTsKICAgIHNpemVfdCByZXF1ZXN0X2xlbmd0aDsKICAgIHNpemVfdCByZXF1ZXN0X3NlbnQ7CiAgICBjaGFyIHJlc3BvbnNlW0xPQURfUkVTUE9OU0VfQlVGRkVSX1NJWkVdOwogICAgc2l6ZV90IHJlc3BvbnNlX2xlbmd0aDsKICAgIGxvbmcgbG9uZyBrZXk7CiAgICBjaGFyIGlkZW50aWZpZXJbTE9BRF9JREVOVElGSUVSX1NJWkVdOwogICAgaW50IHJlYWRfbW9kaWZ5X3dyaXRlX3N0ZXA7ICAvLyAwID0gcmVhZCBwZW5kaW5nLCAxID0gd3JpdGUgcGVuZGluZwp9IExvYWRTbG90OwoKdHlwZWRlZiBzdHJ1Y3QgewogICAgaW50IHRocmVhZF9pbmRleDsKICAgIGludCBjb25uZWN0aW9uX2NvdW50OwogICAgZG91YmxlIHJhdGVfcGVyX3NlY29uZDsgICAgICAvLyAwID0gY2xvc2VkIGxvb3AKICAgIGxvbmcgbG9uZyByZXF1ZXN0X2xpbWl0OyAgICAgLy8gMCA9IHJ1biBmb3IgdGhlIGNvbmZpZ3VyZWQgZHVyYXRpb24KICAgIHVuc2lnbmVkIGxvbmcgbG9uZyByYW5kb21fc3RhdGU7CiAgICBMb2FkU2xvdCogc2xvdHM7CiAgICBMYXRlbmN5SGlzdG9ncmFtIGhpc3RvZ3JhbXNbTE9BRF9PUEVSQVRJT05fQ09VTlRdOwogICAgbG9uZyBsb25nIGNvbXBsZXRlZF9yZXF1ZXN0czsKICAgIGxvbmcgbG9uZyBjb25uZWN0X2Vycm9yczsKICAgIGxvbmcgbG9uZyB0aW1lb3V0X2Vycm9yczsKICAgIGxvbmcgbG9uZyBzdGF0dXNfZXJyb3JzOwogICAgbG9uZyBsb25nIGJ5dGVzX3JlY2VpdmVkOwogICAgTG9hZE9wZXJhdGlvbiBjdXJyZW50X29wZXJhdGlvbjsgIC8vIGVtYmVkZGVkIG1vZGU6IG9wZXJhdGlvbiBhY3R1YWxseSBleGVjdXRlZAp9IExvYWRUaHJlYWQ7Cgp0eXBlZGVmIHN0cnVjdCB7CiAgICBjaGFyIGhvc3RbMjU2XTsKICAgIGludCBwb3J0OwogICAgc3RydWN0IHNvY2thZGRyX2luIGFkZHJlc3M7CiAgICBjaGFyIGRhdGFiYXNlWzY0XTsKICAgIGNoYXIgY29sbGVjdGlvbls2NF07CiAgICBpbnQgdGhyZWFkX2NvdW50OwogICAgaW50IGNvbm5lY3Rpb25fY291bnQ7CiAgICBpbnQgZHVyYXRpb25fc2Vjb25kczsKICAgIGRvdWJsZSByYXRlX3Blcl9zZWNvbmQ7CiAgICBsb25nIGxvbmcgcmVxdWVzdF9saW1pdDsKICAgIGludCB2YWx1ZV9zaXplOwogICAgbG9uZyBsb25nIHByZWxvYWRfcmVjb3JkczsKICAgIGludCBvcGVyYXRpb25fd2VpZ2h0c1tMT0FEX09QRVJBVElPTl9DT1VOVF07CiAgICBpbnQgdG90YWxfd2VpZ2h0OwogICAgY2hhciBtaXhfZGVzY3JpcHRpb25bMjU2XTsKICAgIGNoYXIganNvbl9vdXRwdXRfcGF0aFs1MTJdOwogICAgY29uc3QgY2hhciogd29ya2xvYWRfbmFtZTsKICAgIExvYWREaXN0cmlidXRpb24gZGlzdHJpYnV0aW9uOwogICAgZG91YmxlIHppcGZpYW5fY29uc3RhbnQ7CiAgICBjaGFyIGVtYmVkZGVkX2xpYnJhcnlfcGF0aFs1MTJdOwogICAgY2hhciBlbWJlZGRlZF9iYXNlX2RpcmVjdG9yeVs1MTJdOwp9IExvYWRDb25maWc7CgpzdGF0aWMgTG9hZENvbmZpZyBsb2FkX2NvbmZpZzsKc3RhdGljIHZvbGF0aWxlIGludCBsb2FkX3N0b3BfcmVxdWVzdGVkID0gMDsKc3RhdGljIGxvbmcgbG9uZyBsb2FkX2lzc3VlZF9yZXF1ZXN0cyA9IDA7CnN0YXRpYyBsb25nIGxvbmcgbG9hZF9uZXh0X2tleSA9IDA7CnN0YXRpYyBaaXBmaWFuR2VuZXJhdG9yIGxvYWRfemlwZmlhbjsKc3RhdGljIEVtYmVkZGVkQXBpIGxvYWRfZW1iZWRkZWQ7CgovLyBSZWNvcmRzIHJldHVybmVkIGJ5IGluc2VydHMsIHNoYXJlZCBieSBhbGwgdGhyZWFkcy4gQXBwZW5kcyB0YWtlIHRoZSBtdXRleDsgcmVhZGVycwovLyBvbmx5IHNlZSByZWNvcmRzIGJlbG93IHRoZSBwdWJsaXNoZWQgY291bnQsIGFuZCBjaHVua3MgbmV2ZXIgbW92ZSBvbmNlIGFsbG9jYXRlZApzdGF0aWMgTG9hZFJlY29yZCogbG9hZF9pZGVudGlmaWVyX2NodW5rc1tMT0FEX0lERU5USUZJRVJfTUFYSU1VTV9DSFVOS1NdOwpzdGF0aWMgbG9uZyBsb25nIGxvYWRfaWRlbnRpZmllcl9jb3VudCA9IDA7CnN0YXRpYyBwdGhyZWFkX211dGV4X3QgbG9hZF9pZGVudGlmaWVyX211dGV4ID0gUFRIUkVBRF9NVVRFWF9JTklUSUFMSVpFUjsKCmxvbmcgbG9uZyBnZXRfY3VycmVudF90aW1lX3VzKCkgewogICAgc3RydWN0IHRpbWVzcGVjIG5vdzsKICAgIGNsb2NrX2dldHRpbWUoQ0xPQ0tfTU9OT1RPTklDLCAmbm93KTsKICAgIHJldHVybiAobG9uZyBsb25nKW5vdy50dl9zZWMgKiAxMDAwMDAwTEwgKyBub3cudHZfbnNlYyAvIDEwMDA7Cn0KCnN0YXRpYyBpbnQgaGlzdG9ncmFtX2J1Y2tldF9pbmRleCh1aW50NjRfdCB2YWx1ZSkgewogICAgaWYgKHZhbHVlIDwgSElTVE9HUkFNX0xJTkVBUl9MSU1JVCkgcmV0dXJuIChpbnQpdmFsdWU7CiAgICBpbnQgZXhwb25lbnQgPSA2MyAtIF9fYnVpbHRpbl9jbHpsbCh2YWx1ZSk7CiAgICBpbnQgc2hpZnQgPSBleHBvbmVudCAtIDY7CiAgICBpbnQgc3ViX2J1Y2tldCA9IChpbnQpKHZhbHVlID4+IHNoaWZ0KSAtIEhJU1RPR1JBTV9TVUJfQlVDS0VUUzsKICAgIHJldHVybiBISVNUT0dSQU1fTElORUFSX0xJTUlUICsgKGV4cG9uZW50IC0gNykgKiBISVNUT0dSQU1fU1VCX0JVQ0tFVFMgKyBzdWJfYnVja2V0Owp9CgpzdGF0aWMgdWludDY0X3QgaGlzdG9ncmFtX2J1Y2tldF91cHBlcl92YWx1ZShpbnQgaW5kZXgpIHsKICAgIGlmIChpbmRleCA8IEhJU1RPR1JBTV9MSU5FQVJfTElNSVQpIHJldHVybiAodWludDY0X3QpaW5kZXg7CiAgICBpbnQgZXhwb25lbnQgPSAoaW5kZXggLSBISVNUT0dSQU1fTElORUFSX0xJTUlUKSAvIEhJU1RPR1JBTV9TVUJfQlVDS0VUUyArIDc7CiAgICBpbnQgc3ViX2J1Y2tldCA9IChpbmRleCAtIEhJU1RPR1JBTV9MSU5FQVJfTElNSVQpICUgSElTVE9HUkFNX1NVQl9CVUNLRVRTICsgSElTVE9HUkFNX1NVQl9CVUNLRVRTOwogICAgaW50IHNoaWZ0ID0gZXhwb25lbnQgLSA2OwogICAgcmV0dXJuICgoKHVpbnQ2NF90KXN1Yl9idWNrZXQgKyAxKSA8PCBzaGlmdCkgLSAxOwp9Cgp2b2lkIGhpc3RvZ3JhbV9yZWNvcmQoTGF0ZW5jeUhpc3RvZ3JhbSogaGlzdG9ncmFtLCB1aW50NjRfdCB2YWx1ZSkgewogICAgaGlzdG9ncmFtLT5jb3VudHNbaGlzdG9ncmFtX2J1Y2tldF9pbmRleCh2YWx1ZSldKys7CiAgICBoaXN0b2dyYW0tPnRvdGFsX2NvdW50Kys7CiAgICBoaXN0b2dyYW0tPnN1bSArPSB2YWx1ZTsKICAgIGlmICh2YWx1ZSA+IGhpc3RvZ3JhbS0+bWF4aW11bV92YWx1ZSkgaGlzdG9ncmFtLT5tYXhpbXVtX3ZhbHVlID0gdmFsdWU7Cn0KCnZvaWQgaGlzdG9ncmFtX21lcmdlKExhdGVuY3lIaXN0b2dyYW0qIHRhcmdldCwgY29uc3QgTGF0ZW5jeUhpc3RvZ3JhbSogc291cmNlKSB7CiAgICBmb3IgKGludCBpbmRleCA9IDA7IGluZGV4IDwgSElTVE9HUkFNX0JVQ0tFVF9DT1VOVDsgaW5kZXgrKykgewogICAgICAgIHRhcmdldC0+Y291bnRzW2luZGV4XSArPSBzb3VyY2UtPmNvdW50c1tpbmRleF07CiAgICB9CiAgICB0YXJnZXQtPnRvdGFsX2NvdW50ICs9IHNvdXJjZS0+dG90YWxfY291bnQ7CiAgICB0YXJnZXQtPnN1bSArPSBzb3VyY2UtPnN1bTsKICAgIGlmIChzb3VyY2UtPm1heGltdW1fdmFsdWUgPiB0YXJnZXQtPm1heGltdW1fdmFsdWUpIHRhcmdldC0+bWF4aW11bV92YWx1ZSA9IHNvdXJjZS0+bWF4aW11bV92YWx1ZTsKfQoKdWludDY0X3QgaGlzdG9ncmFtX3BlcmNlbnRpbGUoY29uc3QgTGF0ZW5jeUhpc3RvZ3JhbSogaGlzdG9ncmFtLCBkb3VibGUgcGVyY2VudGlsZSkgewogICAgaWYgKGhpc3RvZ3JhbS0+dG90YWxfY291bnQgPT0gMCkgcmV0dXJuIDA7CiAgICB1aW50NjRfdCB0YXJnZXQgPSAodWludDY0X3QpKChwZXJjZW50aWxlIC8gMTAwLjApICogaGlzdG9ncmFtLT50b3RhbF9jb3VudCArIDAuNSk7CiAgICBpZiAodGFyZ2V0IDwgMSkgdGFyZ2V0ID0gMTsKICAgIHVpbnQ2NF90IGN1bXVsYXRpdmUgPSAwOwogICAgZm9yIChpbnQgaW5kZXggPSAwOyBpbmRleCA8IEhJU1RPR1JBTV9CVUNLRVRfQ09VTlQ7IGluZGV4KyspIHsKICAgICAgICBjdW11bGF0aXZlICs9IGhpc3RvZ3JhbS0+Y291bnRzW2luZGV4XTsKICAgICAgICBpZiAoY3VtdWxhdGl2ZSA+PSB0YXJnZXQpIHsKICAgICAgICAgICAgdWludDY0X3QgdmFsdWUgPSBoaXN0b2dyYW1fYnVja2V0X3VwcGVyX3ZhbHVlKGluZGV4KTsKICAgICAgICAgICAgcmV0dXJuIHZhbHVlIDwgaGlzdG9ncmFtLT5tYXhpbXVtX3ZhbHVlID8gdmFsdWUgOiBoaXN0b2dyYW0tPm1heGltdW1fdmFsdWU7CiAgICAgICAgfQogICAgfQogICAgcmV0dXJuIGhpc3RvZ3JhbS0+bWF4aW11bV92YWx1ZTsKfQoKc3RhdGljIHVuc2lnbmVkIGxvbmcgbG9uZyBsb2FkX3JhbmRvbV9uZXh0KHVuc2lnbmVkIGxvbmcgbG9uZyogc3RhdGUpIHsKICAgIC8vIHhvcnNoaWZ0NjQqOiBjaGVhcCwgcGVyLXRocmVhZCwgZ29vZCBlbm91Z2ggZm9yIHBpY2tpbmcga2V5cyBhbmQgb3BlcmF0aW9ucwogICAgdW5zaWduZWQgbG9uZyBsb25nIHZhbHVlID0gKnN0YXRlOwogICAgdmFsdWUgXj0gdmFsdWUgPj4gMTI7CiAgICB2YWx1ZSBePSB2YWx1ZSA8PCAyNTsKICAgIHZhbHVlIF49IHZhbHVlID4+IDI3OwogICAgKnN0YXRlID0gdmFsdWU7CiAgICByZXR1cm4gdmFsdWUgKiAyNjg1ODIxNjU3NzM2MzM4NzE3VUxMOwp9CgpzdGF0aWMgZG91YmxlIGxvYWRfcmFuZG9tX3VuaXQodW5zaWduZWQgbG9uZyBsb25nKiBzdGF0ZSkgewogICAgcmV0dXJuIChsb2FkX3JhbmRvbV9uZXh0KHN0YXRlKSA+PiAxMSkgKiAoMS4wIC8gOTAwNzE5OTI1NDc0MDk5Mi4wKTsKfQoKdm9pZCBsb2FkX2lkZW50aWZpZXJfYXBwZW5kKGNvbnN0IGNoYXIqIGlkZW50aWZpZXIsIGxvbmcgbG9uZyBrZXkpIHsKICAgIHB0aHJlYWRfbXV0ZXhfbG9jaygmbG9hZF9pZGVudGlmaWVyX211dGV4KTsKICAgIGxvbmcgbG9uZyBpbmRleCA9IGxvYWRfaWRlbnRpZmllcl9jb3VudDsKICAgIGxvbmcgbG9uZyBjaHVua19pbmRleCA9IGluZGV4IC8gTE9BRF9JREVOVElGSUVSX0NIVU5LX1NJWkU7CiAgICBpZiAoY2h1bmtfaW5kZXggPCBMT0FEX0lERU5USUZJRVJfTUFYSU1VTV9DSFVOS1MpIHsKICAgICAgICBpZiAoIWxvYWRfaWRlbnRpZmllcl9jaHVua3NbY2h1bmtfaW5kZXhdKSB7CiAgICAgICAgICAgIGxvYWRfaWRlbnRpZmllcl9jaHVua3NbY2h1bmtfaW5kZXhdID0gY2FsbG9jKExPQURfSURFTlRJRklFUl9DSFVOS19TSVpFLCBzaXplb2YoTG9hZFJlY29yZCkpOwogICAgICAgIH0KICAgICAgICBpZiAobG9hZF9pZGVudGlmaWVyX2NodW5rc1tjaHVua19pbmRleF0pIHsKICAgICAgICAgICAgTG9hZFJlY29yZCogcmVjb3JkID0gJmxvYWRfaWRlbnRpZmllcl9jaHVua3NbY2h1bmtfaW5kZXhdW2luZGV4ICUgTE9BRF9JREVOVElGSUVSX0NIVU5LX1NJWkVdOwogICAgICAgICAgICBzdHJuY3B5KHJlY29yZC0+aWRlbnRpZmllciwgaWRlbnRpZmllciwgTE9BRF9JREVOVElGSUVSX1NJWkUgLSAxKTsKICAgICAgICAgICAgcmVjb3JkLT5rZXkgPSBrZXk7CiAgICAgICAgICAgIF9fYXRvbWljX3N0b3JlX24oJmxvYWRfaWRlbnRpZmllcl9jb3VudCwgaW5kZXggKyAxLCBfX0FUT01JQ19SRUxFQVNFKTsKICAgICAgICB9CiAgICB9CiAgICBwdGhyZWFkX211dGV4X3VubG9jaygmbG9hZF9pZGVudGlmaWVyX211dGV4KTsKfQoKY29uc3QgTG9hZFJlY29yZCogbG9hZF9yZWNvcmRfYXQobG9uZyBsb25nIGluZGV4KSB7CiAgICByZXR1cm4gJmxvYWRfaWRlbnRpZmllcl9jaHVua3NbaW5kZXggLyBMT0FEX0lERU5USUZJRVJfQ0hVTktfU0laRV1baW5kZXggJSBMT0FEX0lERU5USUZJRVJfQ0hVTktfU0laRV07Cn0KCnZvaWQgemlwZmlhbl9pbml0aWFsaXplKFppcGZpYW5HZW5lcmF0b3IqIGdlbmVyYXRvciwgbG9uZyBsb25nIGl0ZW1fY291bnQsIGRvdWJsZSB0aGV0YSkgewogICAgZ2VuZXJhdG9yLT5pdGVtX2NvdW50ID0gaXRlbV9jb3VudCA+IDAgPyBpdGVtX2NvdW50IDogMTsKICAgIGdlbmVyYXRvci0+dGhldGEgPSB0aGV0YTsKICAgIGdlbmVyYXRvci0+YWxwaGEgPSAxLjAgLyAoMS4wIC0gdGhldGEpOwogICAgZ2VuZXJhdG9yLT56ZXRhX24gPSAwOwogICAgZm9yIChsb25nIGxvbmcgaXRlbSA9IDE7IGl0ZW0gPD0gZ2VuZXJhdG9yLT5pdGVtX2NvdW50OyBpdGVtKyspIHsKICAgICAgICBnZW5lcmF0b3ItPnpldGFfbiArPSAxLjAgLyBwb3coKGRvdWJsZSlpdGVtLCB0aGV0YSk7CiAgICB9CiAgICBkb3VibGUgemV0YV8yID0gMS4wICsgMS4wIC8gcG93KDIuMCwgdGhldGEpOwogICAgZ2VuZXJhdG9yLT5ldGEgPSAoMS4wIC0gcG93KDIuMCAvIGdlbmVyYXRvci0+aXRlbV9jb3VudCwgMS4wIC0gdGhldGEpKSAvICgxLjAgLSB6ZXRhXzIgLyBnZW5lcmF0b3ItPnpldGFfbik7CiAgICBnZW5lcmF0b3ItPmhhbGZfcG93X3RoZXRhID0gMS4wICsgcG93KDAuNSwgdGhldGEpOwp9CgovLyBSYW5rIDAgaXMgdGhlIG1vc3QgcG9wdWxhciBpdGVtCmxvbmcgbG9uZyB6aXBmaWFuX25leHQoY29uc3QgWmlwZmlhbkdlbmVyYXRvciogZ2VuZXJhdG9yLCB1bnNpZ25lZCBsb25nIGxvbmcqIHJhbmRvbV9zdGF0ZSkgewogICAgZG91YmxlIHVuaWZvcm0gPSBsb2FkX3JhbmRvbV91bml0KHJhbmRvbV9zdGF0ZSk7CiAgICBkb3VibGUgc2NhbGVkID0gdW5pZm9ybSAqIGdlbmVyYXRvci0+emV0YV9uOwogICAgaWYgKHNjYWxlZCA8IDEuMCkgcmV0dXJuIDA7CiAgICBpZiAoc2NhbGVkIDwgZ2VuZXJhdG9yLT5oYWxmX3Bvd190aGV0YSkgcmV0dXJuIDE7CiAgICBsb25nIGxvbmcgcmFuayA9IChsb25nIGxvbmcpKGdlbmVyYXRvci0+aXRlbV9jb3VudCAqIHBvdyhnZW5lcmF0b3ItPmV0YSAqIHVuaWZvcm0gLSBnZW5lcmF0b3ItPmV0YSArIDEuMCwgZ2VuZXJhdG9yLT5hbHBoYSkpOwogICAgcmV0dXJuIHJhbmsgPCBnZW5lcmF0b3ItPml0ZW1fY291bnQgPyByYW5rIDogZ2VuZXJhdG9yLT5pdGVtX2NvdW50IC0gMTsKfQoKc3RhdGljIHVuc2lnbmVkIGxvbmcgbG9uZyBsb2FkX2Zudl9oYXNoKHVuc2lnbmVkIGxvbmcgbG9uZyB2YWx1ZSkgewogICAgdW5zaWduZWQgbG9uZyBsb25nIGhhc2ggPSAweENCRjI5Q0U0ODQyMjIzMjVVTEw7CiAgICBmb3IgKGludCBieXRlX2luZGV4ID0gMDsgYnl0ZV9pbmRleCA8IDg7IGJ5dGVfaW5kZXgrKykgewogICAgICAgIGhhc2ggXj0gKHZhbHVlID4+IChieXRlX2luZGV4ICogOCkpICYgMHhGRjsKICAgICAgICBoYXNoICo9IDB4MTAwMDAwMDAxQjNVTEw7CiAgICB9CiAgICByZXR1cm4gaGFzaDsKfQoKLy8gUGlja3MgYW4gZXhpc3RpbmcgcmVjb3JkIHdpdGggdGhlIGNvbmZpZ3VyZWQgZGlzdHJpYnV0aW9uOyBOVUxMIHVudGlsIG9uZSBleGlzdHMuCi8vIFppcGZpYW4gcmFua3MgYXJlIHNjcmFtYmxlZCAoaGFzaGVkKSBzbyBob3QgcmVjb3JkcyBhcmUgc3ByZWFkIG92ZXIgdGhlIGNvbGxlY3Rpb247Ci8vICJsYXRlc3QiIGNvdW50cyByYW5rcyBiYWNrIGZyb20gdGhlIG5ld2VzdCBpbnNlcnQKY29uc3QgTG9hZFJlY29yZCogbG9hZF9jaG9vc2VfcmVjb3JkKExvYWRUaHJlYWQqIHRocmVhZCkgewogICAgbG9uZyBsb25nIGNvdW50ID0gX19hdG9taWNfbG9hZF9uKCZsb2FkX2lkZW50aWZpZXJfY291bnQsIF9fQVRPTUlDX0FDUVVJUkUpOwogICAgaWYgKGNvdW50ID09IDApIHJldHVybiBOVUxMOwoKICAgIGxvbmcgbG9uZyBpbmRleDsKICAgIHN3aXRjaCAobG9hZF9jb25maWcuZGlzdHJpYnV0aW9uKSB7CiAgICAgICAgY2FzZSBMT0FEX0RJU1RSSUJVVElPTl9aSVBGSUFOOgogICAgICAgICAgICBpbmRleCA9IChsb25nIGxvbmcpKGxvYWRfZm52X2hhc2goKHVuc2lnbmVkIGxvbmcgbG9uZyl6aXBmaWFuX25leHQoJmxvYWRfemlwZmlhbiwgJnRocmVhZC0+cmFuZG9tX3N0YXRlKSkgJQogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICh1bnNpZ25lZCBsb25nIGxvbmcpY291bnQpOwogICAgICAgICAgICBicmVhazsKICAgICAgICBjYXNlIExPQURfRElTVFJJQlVUSU9OX0xBVEVTVDogewogICAgICAgICAgICBsb25nIGxvbmcgcmFuayA9IHppcGZpYW5fbmV4dCgmbG9hZF96aXBmaWFuLCAmdGhyZWFkLT5yYW5kb21fc3RhdGUpOwogICAgICAgICAgICBpbmRleCA9IGNvdW50IC0gMSAtIChyYW5rIDwgY291bnQgPyByYW5rIDogY291bnQgLSAxKTsKICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgfQogICAgICAgIGRlZmF1bHQ6CiAgICAgICAgICAgIGluZGV4ID0gKGxvbmcgbG9uZykobG9hZF9yYW5kb21fbmV4dCgmdGhyZWFkLT5yYW5kb21fc3RhdGUpICUgKHVuc2lnbmVkIGxvbmcgbG9uZyljb3VudCk7CiAgICAgICAgICAgIGJyZWFrOwogICAgfQogICAgcmV0dXJuIGxvYWRfcmVjb3JkX2F0KGluZGV4KTsKfQoKc3RhdGljIExvYWRPcGVyYXRpb24gbG9hZF9jaG9vc2Vfb3BlcmF0aW9uKExvYWRUaHJlYWQqIHRocmVhZCkgewogICAgaW50IHBpY2sgPSAoaW50KShsb2FkX3JhbmRvbV9uZXh0KCZ0aHJlYWQtPnJhbmRvbV9zdGF0ZSkgJSAodW5zaWduZWQgbG9uZyBsb25nKWxvYWRfY29uZmlnLnRvdGFsX3dlaWdodCk7CiAgICBmb3IgKGludCBvcGVyYXRpb24gPSAwOyBvcGVyYXRpb24gPCBMT0FEX09QRVJBVElPTl9DT1VOVDsgb3BlcmF0aW9uKyspIHsKICAgICAgICBwaWNrIC09IGxvYWRfY29uZmlnLm9wZXJhdGlvbl93ZWlnaHRzW29wZXJhdGlvbl07CiAgICAgICAgaWYgKHBpY2sgPCAwKSByZXR1cm4gKExvYWRPcGVyYXRpb24pb3BlcmF0aW9uOwogICAgfQogICAgcmV0dXJuIExPQURfT1BFUkFUSU9OX0dFVDsKfQoKLy8gU3ludGhldGljIGRvY3VtZW50OyB0aGUgcGF5bG9hZCBwYWRzIGl0IHRvIHJvdWdobHkgdmFsdWVfc2l6ZSBieXRlcwpzdGF0aWMgaW50IGxvYWRfYnVpbGRfZG9jdW1lbnQoY2hhciogYnVmZmVyLCBzaXplX3QgYnVmZmVyX3NpemUsIHVuc2lnbmVkIGxvbmcgbG9uZyBrZXkpIHsKICAgIGludCBsZW5ndGggPSBzbnByaW50ZihidWZmZXIsIGJ1ZmZlcl9zaXplLAogICAgICAgICJ7XCJuYW1lXCI6XCJ1c2VyJWxsdVwiLFwiZW1haWxcIjpcInVzZXIlbGx1QGV4YW1wbGUuY29tXCIsXCJhZ2VcIjolbGx1LFwic2NvcmVcIjolbGx1LFwicmFuZ2VcIjolbGx1LFwicGF5bG9hZFwiOlwiIiwKICAgICAgICBrZXksIGtleSwga2V5ICUgMTAwLCBrZXkgJSAxMDAwMDAsIGtleSAvIExPQURfU0NBTl9SQU5HRV9TSVpFKTsKICAgIGludCBwYWRkaW5nID0gbG9hZF9jb25maWcudmFsdWVfc2l6ZSAtIGxlbmd0aCAtIDI7CiAgICBmb3IgKGludCBpbmRleCA9IDA7IGluZGV4IDwgcGFkZGluZyAmJiBsZW5ndGggPCAoaW50KWJ1ZmZlcl9zaXplIC0gMzsgaW5kZXgrKykgewogICAgICAgIGJ1ZmZlcltsZW5ndGgrK10gPSAnYScgKyAoY2hhcikoKGtleSArIGluZGV4KSAlIDI2KTsKICAgIH0KICAgIGxlbmd0aCArPSBzbnByaW50ZihidWZmZXIgKyBsZW5ndGgsIGJ1ZmZlcl9zaXplIC0gbGVuZ3RoLCAiXCJ9Iik7CiAgICByZXR1cm4gbGVuZ3RoOwp9CgovLyBQaWNrcyB0aGUgcmVjb3JkIChvciBuZXcga2V5KSBhbiBvcGVyYXRpb24gd29ya3Mgb247IG9wZXJhdGlvbnMgdGhhdCBuZWVkIGFuCi8vIGV4aXN0aW5nIHJlY29yZCBiZWNvbWUgaW5zZXJ0cyB1bnRpbCB0aGUgZmlyc3QgaW5zZXJ0IGhhcyBjb21wbGV0ZWQKc3RhdGljIExvYWRPcGVyYXRpb24gbG9hZF9jaG9vc2VfdGFyZ2V0KExvYWRUaHJlYWQqIHRocmVhZCwgTG9hZE9wZXJhdGlvbiBvcGVyYXRpb24sIGxvbmcgbG9uZyoga2V5LCBjaGFyKiBpZGVudGlmaWVyKSB7CiAgICBpZiAob3BlcmF0aW9uID09IExPQURfT1BFUkFUSU9OX0lOU0VSVCkgewogICAgICAgICprZXkgPSBfX2F0b21pY19mZXRjaF9hZGQoJmxvYWRfbmV4dF9rZXksIDEsIF9fQVRPTUlDX1JFTEFYRUQpOwogICAgICAgIHJldHVybiBvcGVyYXRpb247CiAgICB9CiAgICBpZiAob3BlcmF0aW9uID09IExPQURfT1BFUkFUSU9OX1FVRVJZIHx8IG9wZXJhdGlvbiA9PSBMT0FEX09QRVJBVElPTl9MSVNUKSB7CiAgICAgICAgKmtleSA9IChsb25nIGxvbmcpKGxvYWRfcmFuZG9tX25leHQoJnRocmVhZC0+cmFuZG9tX3N0YXRlKSAlIDEwMDAwMDAwMDBVTEwpOwogICAgICAgIHJldHVybiBvcGVyYXRpb247CiAgICB9CgogICAgY29uc3QgTG9hZFJlY29yZCogcmVjb3JkID0gbG9hZF9jaG9vc2VfcmVjb3JkKHRocmVhZCk7CiAgICBpZiAoIXJlY29yZCkgewogICAgICAgICprZXkgPSBfX2F0b21pY19mZXRjaF9hZGQoJmxvYWRfbmV4dF9rZXksIDEsIF9fQVRPTUlDX1JFTEFYRUQpOwogICAgICAgIHJldHVybiBMT0FEX09QRVJBVElPTl9JTlNFUlQ7CiAgICB9CiAgICAqa2V5ID0gcmVjb3JkLT5rZXk7CiAgICBtZW1jcHkoaWRlbnRpZmllciwgcmVjb3JkLT5pZGVudGlmaWVyLCBMT0FEX0lERU5USUZJRVJfU0laRSk7CiAgICByZXR1cm4gb3BlcmF0aW9uOwp9CgpzdGF0aWMgdm9pZCBsb2FkX3ByZXBhcmVfcmVxdWVzdChMb2FkVGhyZWFkKiB0aHJlYWQsIExvYWRTbG90KiBzbG90LCBMb2FkT3BlcmF0aW9uIG9wZXJhdGlvbikgewogICAgY2hhciBwYXRoWzUxMl07CiAgICBjaGFyIGJvZHlbTE9BRF9SRVFVRVNUX0JVRkZFUl9TSVpFIC8gMl07CiAgICBjb25zdCBjaGFyKiBtZXRob2QgPSAiR0VUIjsKICAgIGNvbnN0IGNoYXIqIHJlcXVlc3RfYm9keSA9IE5VTEw7CiAgICBsb25nIGxvbmcga2V5ID0gc2xvdC0+a2V5OwogICAgY29uc3QgY2hhciogaWRlbnRpZmllciA9IHNsb3QtPmlkZW50aWZpZXI7CgogICAgaWYgKG9wZXJhdGlvbiAhPSBMT0FEX09QRVJBVElPTl9SRUFEX01PRElGWV9XUklURSB8fCBzbG90LT5yZWFkX21vZGlmeV93cml0ZV9zdGVwID09IDApIHsKICAgICAgICBvcGVyYXRpb24gPSBsb2FkX2Nob29zZV90YXJnZXQodGhyZWFkLCBvcGVyYXRpb24sICZzbG90LT5rZXksIHNsb3QtPmlkZW50aWZpZXIpOwogICAgICAgIGtleSA9IHNsb3QtPmtleTsKICAgICAgICBzbG90LT5yZWFkX21vZGlmeV93cml0ZV9zdGVwID0gMDsKICAgIH0KCiAgICBpbnQgcGF0aF9sZW5ndGggPSBzbnByaW50ZihwYXRoLCBzaXplb2YocGF0aCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy8lcy9pbnN0YW5jZXMiLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgbG9hZF9jb25maWcuZGF0YWJhc2UsIGxvYWRfY29uZmlnLmNvbGxlY3Rpb24pOwogICAgc3dpdGNoIChvcGVyYXRpb24pIHsKICAgICAgICBjYXNlIExPQURfT1BFUkFUSU9OX0dFVDoKICAgICAgICAgICAgc25wcmludGYocGF0aCArIHBhdGhfbGVuZ3RoLCBzaXplb2YocGF0aCkgLSBwYXRoX2xlbmd0aCwgIj9xdWVyeT1faWQ6JXMiLCBpZGVudGlmaWVyKTsKICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgY2FzZSBMT0FEX09QRVJBVElPTl9JTlNFUlQ6CiAgICAgICAgICAgIG1ldGhvZCA9ICJQT1NUIjsKICAgICAgICAgICAgbG9hZF9idWlsZF9kb2N1bWVudChib2R5LCBzaXplb2YoYm9keSksICh1bnNpZ25lZCBsb25nIGxvbmcpa2V5KTsKICAgICAgICAgICAgcmVxdWVzdF9ib2R5ID0gYm9keTsKICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgY2FzZSBMT0FEX09QRVJBVElPTl9VUERBVEU6CiAgICAgICAgICAgIG1ldGhvZCA9ICJQVVQiOwogICAgICAgICAgICBzbnByaW50ZihwYXRoICsgcGF0aF9sZW5ndGgsIHNpemVvZihwYXRoKSAtIHBhdGhfbGVuZ3RoLCAiLyVzIiwgaWRlbnRpZmllcik7CiAgICAgICAgICAgIHNucHJpbnRmKGJvZHksIHNpemVvZihib2R5KSwgIntcInNjb3JlXCI6JWxsdX0iLCBsb2FkX3JhbmRvbV9uZXh0KCZ0aHJlYWQtPnJhbmRvbV9zdGF0ZSkgJSAxMDAwMDApOwogICAgICAgICAgICByZXF1ZXN0X2JvZHkgPSBib2R5OwogICAgICAgICAgICBicmVhazsKICAgICAgICBjYXNlIExPQURfT1BFUkFUSU9OX0RFTEVURToKICAgICAgICAgICAgbWV0aG9kID0gIkRFTEVURSI7CiAgICAgICAgICAgIHNucHJpbnRmKHBhdGggKyBwYXRoX2xlbmd0aCwgc2l6ZW9mKHBhdGgpIC0gcGF0aF9sZW5ndGgsICIvJXMiLCBpZGVudGlmaWVyKTsKICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgY2FzZSBMT0FEX09QRVJBVElPTl9RVUVSWToKICAgICAgICAgICAgc25wcmludGYocGF0aCArIHBhdGhfbGVuZ3RoLCBzaXplb2YocGF0aCkgLSBwYXRoX2xlbmd0aCwgIj9xdWVyeT1hZ2U6JWxsZCIsIGtleSAlIDEwMCk7CiAgICAgICAgICAgIGJyZWFrOwogICAgICAgIGNhc2UgTE9BRF9PUEVSQVRJT05fU0NBTjoKICAgICAgICAgICAgc25wcmludGYocGF0aCArIHBhdGhfbGVuZ3RoLCBzaXplb2YocGF0aCkgLSBwYXRoX2xlbmd0aCwgIj9xdWVyeT1yYW5nZTolbGxkIiwga2V5IC8gTE9BRF9TQ0FOX1JBTkdFX1NJWkUpOwogICAgICAgICAgICBicmVhazsKICAgICAgICBjYXNlIExPQURfT1BFUkFUSU9OX1JFQURfTU9ESUZZX1dSSVRFOgogICAgICAgICAgICBpZiAoc2xvdC0+cmVhZF9tb2RpZnlfd3JpdGVfc3RlcCA9PSAwKSB7CiAgICAgICAgICAgICAgICBzbnByaW50ZihwYXRoICsgcGF0aF9sZW5ndGgsIHNpemVvZihwYXRoKSAtIHBhdGhfbGVuZ3RoLCAiP3F1ZXJ5PV9pZDolcyIsIGlkZW50aWZpZXIpOwogICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgbWV0aG9kID0gIlBVVCI7CiAgICAgICAgICAgICAgICBzbnByaW50ZihwYXRoICsgcGF0aF9sZW5ndGgsIHNpemVvZihwYXRoKSAtIHBhdGhfbGVuZ3RoLCAiLyVzIiwgaWRlbnRpZmllcik7CiAgICAgICAgICAgICAgICBzbnByaW50Zihib2R5LCBzaXplb2YoYm9keSksICJ7XCJzY29yZVwiOiVsbHV9IiwgbG9hZF9yYW5kb21fbmV4dCgmdGhyZWFkLT5yYW5kb21fc3RhdGUpICUgMTAwMDAwKTsKICAgICAgICAgICAgICAgIHJlcXVlc3RfYm9keSA9IGJvZHk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgZGVmYXVsdDoKICAgICAgICAgICAgYnJlYWs7CiAgICB9CgogICAgc2xvdC0+b3BlcmF0aW9uID0gb3BlcmF0aW9uOwogICAgaW50IGxlbmd0aCA9IGh0dHBfZm9ybWF0X3JlcXVlc3Qoc2xvdC0+cmVxdWVzdCwgc2l6ZW9mKHNsb3QtPnJlcXVlc3QpLCBtZXRob2QsIHBhdGgsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBsb2FkX2NvbmZpZy5ob3N0LCBsb2FkX2NvbmZpZy5wb3J0LCByZXF1ZXN0X2JvZHksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICByZXF1ZXN0X2JvZHkgPyAiYXBwbGljYXRpb24vanNvbiIgOiBOVUxMKTsKICAgIHNsb3QtPnJlcXVlc3RfbGVuZ3RoID0gbGVuZ3RoID4gMCAmJiBsZW5ndGggPCAoaW50KXNpemVvZihzbG90LT5yZXF1ZXN0KSA/IChzaXplX3QpbGVuZ3RoIDogMDsKICAgIHNsb3QtPnJlcXVlc3Rfc2VudCA9IDA7CiAgICBzbG90LT5yZXNwb25zZV9sZW5ndGggPSAwOwp9CgpzdGF0aWMgdm9pZCBsb2FkX2Nsb3NlX3Nsb3QoTG9hZFNsb3QqIHNsb3QpIHsKICAgIGlmIChzbG90LT5zb2NrZXRfZmQgPj0gMCkgY2xvc2Uoc2xvdC0+c29ja2V0X2ZkKTsKICAgIHNsb3QtPnNvY2tldF9mZCA9IC0xOwogICAgc2xvdC0+c3RhdGUgPSBMT0FEX1NMT1RfSURMRTsKfQoKc3RhdGljIGludCBsb2FkX2Nvbm5lY3Rfc2xvdChMb2FkVGhyZWFkKiB0aHJlYWQsIExvYWRTbG90KiBzbG90KSB7CiAgICBzbG90LT5kZWFkbGluZV91cyA9IGdldF9jdXJyZW50X3RpbWVfdXMoKSArIExPQURfUkVRVUVTVF9USU1FT1VUX1VTOwogICAgc2xvdC0+c29ja2V0X2ZkID0gc29ja2V0KEFGX0lORVQsIFNPQ0tfU1RSRUFNIHwgU09DS19OT05CTE9DSywgMCk7CiAgICBpZiAoc2xvdC0+c29ja2V0X2ZkIDwgMCB8fCBzbG90LT5yZXF1ZXN0X2xlbmd0aCA9PSAwKSB7CiAgICAgICAgdGhyZWFkLT5jb25uZWN0X2Vycm9ycysrOwogICAgICAgIGxvYWRfY2xvc2Vfc2xvdChzbG90KTsKICAgICAgICByZXR1cm4gLTE7CiAgICB9CiAgICBpbnQgbm9fZGVsYXkgPSAxOwogICAgc2V0c29ja29wdChzbG90LT5zb2NrZXRfZmQsIElQUFJPVE9fVENQLCBUQ1BfTk9ERUxBWSwgJm5vX2RlbGF5LCBzaXplb2Yobm9fZGVsYXkpKTsKCiAgICBpZiAoY29ubmVjdChzbG90LT5zb2NrZXRfZmQsIChzdHJ1Y3Qgc29ja2FkZHIqKSZsb2FkX2NvbmZpZy5hZGRyZXNzLCBzaXplb2YobG9hZF9jb25maWcuYWRkcmVzcykpIDwgMCAmJgogICAgICAgIGVycm5vICE9IEVJTlBST0dSRVNTKSB7CiAgICAgICAgdGhyZWFkLT5jb25uZWN0X2Vycm9ycysrOwogICAgICAgIGxvYWRfY2xvc2Vfc2xvdChzbG90KTsKICAgICAgICByZXR1cm4gLTE7CiAgICB9CiAgICBzbG90LT5zdGF0ZSA9IExPQURfU0xPVF9DT05ORUNUSU5HOwogICAgcmV0dXJuIDA7Cn0KCnN0YXRpYyBpbnQgbG9hZF9zdGFydF9yZXF1ZXN0KExvYWRUaHJlYWQqIHRocmVhZCwgTG9hZFNsb3QqIHNsb3QsIGxvbmcgbG9uZyBpbnRlbmRlZF9zdGFydF91cykgewogICAgc2xvdC0+cmVhZF9tb2RpZnlfd3JpdGVfc3RlcCA9IDA7CiAgICBsb2FkX3ByZXBhcmVfcmVxdWVzdCh0aHJlYWQsIHNsb3QsIGxvYWRfY2hvb3NlX29wZXJhdGlvbih0aHJlYWQpKTsKICAgIHNsb3QtPmludGVuZGVkX3N0YXJ0X3VzID0gaW50ZW5kZWRfc3RhcnRfdXM7CiAgICByZXR1cm4gbG9hZF9jb25uZWN0X3Nsb3QodGhyZWFkLCBzbG90KTsKfQoKc3RhdGljIHZvaWQgbG9hZF9jb21wbGV0ZV9yZXF1ZXN0KExvYWRUaHJlYWQqIHRocmVhZCwgTG9hZFNsb3QqIHNsb3QpIHsKICAgIHNsb3QtPnJlc3BvbnNlW3Nsb3QtPnJlc3BvbnNlX2xlbmd0aF0gPSAnXDAnOwogICAgaW50IHN0YXR1c19jb2RlID0gaHR0cF9wYXJzZV9zdGF0dXNfY29kZShzbG90LT5yZXNwb25zZSk7CgogICAgLy8gUmVhZC1tb2RpZnktd3JpdGU6IHRoZSByZWFkIHN1Y2NlZWRlZCwgbm93IHdyaXRlIG9uIGEgbmV3IGNvbm5lY3Rpb24gYW5kIHRpbWUgYm90aAogICAgaWYgKHNsb3QtPm9wZXJhdGlvbiA9PSBMT0FEX09QRVJBVElPTl9SRUFEX01PRElGWV9XUklURSAmJiBzbG90LT5yZWFkX21vZGlmeV93cml0ZV9zdGVwID09IDAgJiYKICAgICAgICBzdGF0dXNfY29kZSA+PSAyMDAgJiYgc3RhdHVzX2NvZGUgPCAzMDApIHsKICAgICAgICBsb2FkX2Nsb3NlX3Nsb3Qoc2xvdCk7CiAgICAgICAgc2xvdC0+cmVhZF9tb2RpZnlfd3JpdGVfc3RlcCA9IDE7CiAgICAgICAgbG9hZF9wcmVwYXJlX3JlcXVlc3QodGhyZWFkLCBzbG90LCBMT0FEX09QRVJBVElPTl9SRUFEX01PRElGWV9XUklURSk7CiAgICAgICAgbG9hZF9jb25uZWN0X3Nsb3QodGhyZWFkLCBzbG90KTsKICAgICAgICByZXR1cm47CiAgICB9CgogICAgbG9uZyBsb25nIGxhdGVuY3kgPSBnZXRfY3VycmVudF90aW1lX3VzKCkgLSBzbG90LT5pbnRlbmRlZF9zdGFydF91czsKCiAgICBoaXN0b2dyYW1fcmVjb3JkKCZ0aHJlYWQtPmhpc3RvZ3JhbXNbc2xvdC0+b3BlcmF0aW9uXSwgbGF0ZW5jeSA+IDAgPyAodWludDY0X3QpbGF0ZW5jeSA6IDApOwogICAgdGhyZWFkLT5jb21wbGV0ZWRfcmVxdWVzdHMrKzsKICAgIGlmIChzdGF0dXNfY29kZSA8IDIwMCB8fCBzdGF0dXNfY29kZSA+PSAzMDApIHsKICAgICAgICB0aHJlYWQtPnN0YXR1c19lcnJvcnMrKzsKICAgIH0gZWxzZSBpZiAoc2xvdC0+b3BlcmF0aW9uID09IExPQURfT1BFUkFUSU9OX0lOU0VSVCkgewogICAgICAgIGNoYXIqIGlkZW50aWZpZXIgPSBzdHJzdHIoc2xvdC0+cmVzcG9uc2UsICJcImlkXCI6XCIiKTsKICAgICAgICBpZiAoaWRlbnRpZmllcikgewogICAgICAgICAgICBpZGVudGlmaWVyICs9IDY7CiAgICAgICAgICAgIGNoYXIqIGlkZW50aWZpZXJfZW5kID0gc3RyY2hyKGlkZW50aWZpZXIsICciJyk7CiAgICAgICAgICAgIGlmIChpZGVudGlmaWVyX2VuZCAmJiBpZGVudGlmaWVyX2VuZCAtIGlkZW50aWZpZXIgPCBMT0FEX0lERU5USUZJRVJfU0laRSkgewogICAgICAgICAgICAgICAgKmlkZW50aWZpZXJfZW5kID0gJ1wwJzsKICAgICAgICAgICAgICAgIGxvYWRfaWRlbnRpZmllcl9hcHBlbmQoaWRlbnRpZmllciwgc2xvdC0+a2V5KTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0KICAgIGxvYWRfY2xvc2Vfc2xvdChzbG90KTsKfQoKLy8gQWR2YW5jZSBvbmUgc2xvdCBhZnRlciBwb2xsKCkgcmVwb3J0ZWQgYWN0aXZpdHkgb24gaXQKc3RhdGljIHZvaWQgbG9hZF9zZXJ2aWNlX3Nsb3QoTG9hZFRocmVhZCogdGhyZWFkLCBMb2FkU2xvdCogc2xvdCwgc2hvcnQgcmV2ZW50cykgewogICAgaWYgKHNsb3QtPnN0YXRlID09IExPQURfU0xPVF9DT05ORUNUSU5HICYmIChyZXZlbnRzICYgKFBPTExPVVQgfCBQT0xMRVJSIHwgUE9MTEhVUCkpKSB7CiAgICAgICAgaW50IHNvY2tldF9lcnJvciA9IDA7CiAgICAgICAgc29ja2xlbl90IGVycm9yX2xlbmd0aCA9IHNpemVvZihzb2NrZXRfZXJyb3IpOwogICAgICAgIGdldHNvY2tvcHQoc2xvdC0+c29ja2V0X2ZkLCBTT0xfU09DS0VULCBTT19FUlJPUiwgJnNvY2tldF9lcnJvciwgJmVycm9yX2xlbmd0aCk7CiAgICAgICAgaWYgKHNvY2tldF9lcnJvciAhPSAwKSB7CiAgICAgICAgICAgIHRocmVhZC0+Y29ubmVjdF9lcnJvcnMrKzsKICAgICAgICAgICAgbG9hZF9jbG9zZV9zbG90KHNsb3QpOwogICAgICAgICAgICByZXR1cm47CiAgICAgICAgfQogICAgICAgIHNsb3QtPnN0YXRlID0gTE9BRF9TTE9UX1NFTkRJTkc7CiAgICB9CgogICAgaWYgKHNsb3QtPnN0YXRlID09IExPQURfU0xPVF9TRU5ESU5HKSB7CiAgICAgICAgc3NpemVfdCBzZW50ID0gc2VuZChzbG90LT5zb2NrZXRfZmQsIHNsb3QtPnJlcXVlc3QgKyBzbG90LT5yZXF1ZXN0X3NlbnQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICBzbG90LT5yZXF1ZXN0X2xlbmd0aCAtIHNsb3QtPnJlcXVlc3Rfc2VudCwgTVNHX05PU0lHTkFMKTsKICAgICAgICBpZiAoc2VudCA8IDAgJiYgZXJybm8gIT0gRUFHQUlOICYmIGVycm5vICE9IEVXT1VMREJMT0NLKSB7CiAgICAgICAgICAgIHRocmVhZC0+Y29ubmVjdF9lcnJvcnMrKzsKICAgICAgICAgICAgbG9hZF9jbG9zZV9zbG90KHNsb3QpOwogICAgICAgICAgICByZXR1cm47CiAgICAgICAgfQogICAgICAgIGlmIChzZW50ID4gMCkgc2xvdC0+cmVxdWVzdF9zZW50ICs9IHNlbnQ7CiAgICAgICAgaWYgKHNsb3QtPnJlcXVlc3Rfc2VudCA9PSBzbG90LT5yZXF1ZXN0X2xlbmd0aCkgc2xvdC0+c3RhdGUgPSBMT0FEX1NMT1RfUkVDRUlWSU5HOwogICAgICAgIHJldHVybjsKICAgIH0KCiAgICBpZiAoc2xvdC0+c3RhdGUgPT0gTE9BRF9TTE9UX1JFQ0VJVklORyAmJiAocmV2ZW50cyAmIChQT0xMSU4gfCBQT0xMSFVQIHwgUE9MTEVSUikpKSB7CiAgICAgICAgd2hpbGUgKHRydWUpIHsKICAgICAgICAgICAgY2hhciBkaXNjYXJkW0xPQURfUkVTUE9OU0VfQlVGRkVSX1NJWkVdOwogICAgICAgICAgICBzaXplX3Qgc3BhY2UgPSBzaXplb2Yoc2xvdC0+cmVzcG9uc2UpIC0gMSAtIHNsb3QtPnJlc3BvbnNlX2xlbmd0aDsKICAgICAgICAgICAgY2hhciogdGFyZ2V0ID0gc3BhY2UgPiAwID8gc2xvdC0+cmVzcG9uc2UgKyBzbG90LT5yZXNwb25zZV9sZW5ndGggOiBkaXNjYXJkOwogICAgICAgICAgICBzc2l6ZV90IHJlY2VpdmVkID0gcmVjdihzbG90LT5zb2NrZXRfZmQsIHRhcmdldCwgc3BhY2UgPiAwID8gc3BhY2UgOiBzaXplb2YoZGlzY2FyZCksIDApOwogICAgICAgICAgICBpZiAocmVjZWl2ZWQgPiAwKSB7CiAgICAgICAgICAgICAgICBpZiAoc3BhY2UgPiAwKSBzbG90LT5yZXNwb25zZV9sZW5ndGggKz0gcmVjZWl2ZWQ7CiAgICAgICAgICAgICAgICB0aHJlYWQtPmJ5dGVzX3JlY2VpdmVkICs9IHJlY2VpdmVkOwogICAgICAgICAgICAgICAgY29udGludWU7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgaWYgKHJlY2VpdmVkID09IDApIHsKICAgICAgICAgICAgICAgIC8vIFRoZSBzZXJ2ZXIgY2xvc2VzIHRoZSBjb25uZWN0aW9uIGFmdGVyIGVhY2ggcmVzcG9uc2UKICAgICAgICAgICAgICAgIGxvYWRfY29tcGxldGVfcmVxdWVzdCh0aHJlYWQsIHNsb3QpOwogICAgICAgICAgICB9IGVsc2UgaWYgKGVycm5vICE9IEVBR0FJTiAmJiBlcnJubyAhPSBFV09VTERCTE9DSykgewogICAgICAgICAgICAgICAgaWYgKHNsb3QtPnJlc3BvbnNlX2xlbmd0aCA+IDApIHsKICAgICAgICAgICAgICAgICAgICBsb2FkX2NvbXBsZXRlX3JlcXVlc3QodGhyZWFkLCBzbG90KTsKICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgdGhyZWFkLT5jb25uZWN0X2Vycm9ycysrOwogICAgICAgICAgICAgICAgICAgIGxvYWRfY2xvc2Vfc2xvdChzbG90KTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgICAgICByZXR1cm47CiAgICAgICAgfQogICAgfQp9Cgp2b2lkKiBsb2FkX3RocmVhZF9tYWluKHZvaWQqIGFyZ3VtZW50KSB7CiAgICBMb2FkVGhyZWFkKiB0aHJlYWQgPSAoTG9hZFRocmVhZCopYXJndW1lbnQ7CiAgICBzdHJ1Y3QgcG9sbGZkKiBwb2xsX2Rlc2NyaXB0b3JzID0gY2FsbG9jKHRocmVhZC0+Y29ubmVjdGlvbl9jb3VudCwgc2l6ZW9mKHN0cnVjdCBwb2xsZmQpKTsKICAgIGludCogcG9sbF9zbG90cyA9IGNhbGxvYyh0aHJlYWQtPmNvbm5lY3Rpb25fY291bnQsIHNpemVvZihpbnQpKTsKICAgIGlmICghcG9sbF9kZXNjcmlwdG9ycyB8fCAhcG9sbF9zbG90cykgewogICAgICAgIGZyZWUocG9sbF9kZXNjcmlwdG9ycyk7CiAgICAgICAgZnJlZShwb2xsX3Nsb3RzKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KCiAgICBsb25nIGxvbmcgc3RhcnRfdXMgPSBnZXRfY3VycmVudF90aW1lX3VzKCk7CiAgICBsb25nIGxvbmcgZW5kX3VzID0gc3RhcnRfdXMgKyAobG9uZyBsb25nKWxvYWRfY29uZmlnLmR1cmF0aW9uX3NlY29uZHMgKiAxMDAwMDAwTEw7CiAgICBkb3VibGUgaW50ZXJ2YWxfdXMgPSB0aHJlYWQtPnJhdGVfcGVyX3NlY29uZCA+IDAgPyAxMDAwMDAwLjAgLyB0aHJlYWQtPnJhdGVfcGVyX3NlY29uZCA6IDA7CiAgICBsb25nIGxvbmcgc2NoZWR1bGVkX3JlcXVlc3RzID0gMDsKCiAgICB3aGlsZSAodHJ1ZSkgewogICAgICAgIGxvbmcgbG9uZyBub3cgPSBnZXRfY3VycmVudF90aW1lX3VzKCk7CiAgICAgICAgYm9vbCBhY2NlcHRpbmcgPSAhbG9hZF9zdG9wX3JlcXVlc3RlZCAmJiAodGhyZWFkLT5yZXF1ZXN0X2xpbWl0ID4gMCB8fCBub3cgPCBlbmRfdXMpOwoKICAgICAgICAvLyBIYW5kIG5ldyByZXF1ZXN0cyB0byBpZGxlIGNvbm5lY3Rpb25zLCBmb2xsb3dpbmcgdGhlIHNjaGVkdWxlIGluIG9wZW4tbG9vcCBtb2RlCiAgICAgICAgZm9yIChpbnQgc2xvdF9pbmRleCA9IDA7IGFjY2VwdGluZyAmJiBzbG90X2luZGV4IDwgdGhyZWFkLT5jb25uZWN0aW9uX2NvdW50OyBzbG90X2luZGV4KyspIHsKICAgICAgICAgICAgTG9hZFNsb3QqIHNsb3QgPSAmdGhyZWFkLT5zbG90c1tzbG90X2luZGV4XTsKICAgICAgICAgICAgaWYgKHNsb3QtPnN0YXRlICE9IExPQURfU0xPVF9JRExFKSBjb250aW51ZTsKCiAgICAgICAgICAgIGxvbmcgbG9uZyBpbnRlbmRlZF9zdGFydF91cyA9IG5vdzsKICAgICAgICAgICAgaWYgKGludGVydmFsX3VzID4gMCkgewogICAgICAgICAgICAgICAgaW50ZW5kZWRfc3RhcnRfdXMgPSBzdGFydF91cyArIChsb25nIGxvbmcpKHNjaGVkdWxlZF9yZXF1ZXN0cyAqIGludGVydmFsX3VzKTsKICAgICAgICAgICAgICAgIGlmIChpbnRlbmRlZF9zdGFydF91cyA+IG5vdykgYnJlYWs7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgaWYgKHRocmVhZC0+cmVxdWVzdF9saW1pdCA+IDAgJiYKICAgICAgICAgICAgICAgIF9fYXRvbWljX2ZldGNoX2FkZCgmbG9hZF9pc3N1ZWRfcmVxdWVzdHMsIDEsIF9fQVRPTUlDX1JFTEFYRUQpID49IHRocmVhZC0+cmVxdWVzdF9saW1pdCkgewogICAgICAgICAgICAgICAgYWNjZXB0aW5nID0gZmFsc2U7CiAgICAgICAgICAgICAgICBicmVhazsKICAgICAgICAgICAgfQogICAgICAgICAgICBpZiAoaW50ZXJ2YWxfdXMgPiAwKSBzY2hlZHVsZWRfcmVxdWVzdHMrKzsKICAgICAgICAgICAgbG9hZF9zdGFydF9yZXF1ZXN0KHRocmVhZCwgc2xvdCwgaW50ZW5kZWRfc3RhcnRfdXMpOwogICAgICAgIH0KCiAgICAgICAgaW50IHBvbGxfY291bnQgPSAwOwogICAgICAgIGZvciAoaW50IHNsb3RfaW5kZXggPSAwOyBzbG90X2luZGV4IDwgdGhyZWFkLT5jb25uZWN0aW9uX2NvdW50OyBzbG90X2luZGV4KyspIHsKICAgICAgICAgICAgTG9hZFNsb3QqIHNsb3QgPSAmdGhyZWFkLT5zbG90c1tzbG90X2luZGV4XTsKICAgICAgICAgICAgaWYgKHNsb3QtPnN0YXRlID09IExPQURfU0xPVF9JRExFKSBjb250aW51ZTsKICAgICAgICAgICAgaWYgKG5vdyA+IHNsb3QtPmRlYWRsaW5lX3VzKSB7CiAgICAgICAgICAgICAgICB0aHJlYWQtPnRpbWVvdXRfZXJyb3JzKys7CiAgICAgICAgICAgICAgICBsb2FkX2Nsb3NlX3Nsb3Qoc2xvdCk7CiAgICAgICAgICAgICAgICBjb250aW51ZTsKICAgICAgICAgICAgfQogICAgICAgICAgICBwb2xsX2Rlc2NyaXB0b3JzW3BvbGxfY291bnRdLmZkID0gc2xvdC0+c29ja2V0X2ZkOwogICAgICAgICAgICBwb2xsX2Rlc2NyaXB0b3JzW3BvbGxfY291bnRdLmV2ZW50cyA9IHNsb3QtPnN0YXRlID09IExPQURfU0xPVF9SRUNFSVZJTkcgPyBQT0xMSU4gOiBQT0xMT1VUOwogICAgICAgICAgICBwb2xsX2Rlc2NyaXB0b3JzW3BvbGxfY291bnRdLnJldmVudHMgPSAwOwogICAgICAgICAgICBwb2xsX3Nsb3RzW3BvbGxfY291bnQrK10gPSBzbG90X2luZGV4OwogICAgICAgIH0KCiAgICAgICAgaWYgKHBvbGxfY291bnQgPT0gMCAmJiAhYWNjZXB0aW5nKSBicmVhazsKCiAgICAgICAgaW50IHRpbWVvdXRfbXMgPSAxMDsKICAgICAgICBpZiAoaW50ZXJ2YWxfdXMgPiAwICYmIGFjY2VwdGluZykgewogICAgICAgICAgICBsb25nIGxvbmcgbmV4dF9zdGFydCA9IHN0YXJ0X3VzICsgKGxvbmcgbG9uZykoc2NoZWR1bGVkX3JlcXVlc3RzICogaW50ZXJ2YWxfdXMpOwogICAgICAgICAgICBsb25nIGxvbmcgd2FpdF91cyA9IG5leHRfc3RhcnQgLSBnZXRfY3VycmVudF90aW1lX3VzKCk7CiAgICAgICAgICAgIHRpbWVvdXRfbXMgPSB3YWl0X3VzIDw9IDAgPyAwIDogKGludCkod2FpdF91cyAvIDEwMDAgPCAxMCA/IHdhaXRfdXMgLyAxMDAwIDogMTApOwogICAgICAgIH0KCiAgICAgICAgaWYgKHBvbGxfY291bnQgPT0gMCkgewogICAgICAgICAgICBpZiAodGltZW91dF9tcyA+IDApIHVzbGVlcCh0aW1lb3V0X21zICogMTAwMCk7CiAgICAgICAgICAgIGNvbnRpbnVlOwogICAgICAgIH0KICAgICAgICBpZiAocG9sbChwb2xsX2Rlc2NyaXB0b3JzLCBwb2xsX2NvdW50LCB0aW1lb3V0X21zKSA8PSAwKSBjb250aW51ZTsKCiAgICAgICAgZm9yIChpbnQgcG9sbF9pbmRleCA9IDA7IHBvbGxfaW5kZXggPCBwb2xsX2NvdW50OyBwb2xsX2luZGV4KyspIHsKICAgICAgICAgICAgaWYgKHBvbGxfZGVzY3JpcHRvcnNbcG9sbF9pbmRleF0ucmV2ZW50cykgewogICAgICAgICAgICAgICAgbG9hZF9zZXJ2aWNlX3Nsb3QodGhyZWFkLCAmdGhyZWFkLT5zbG90c1twb2xsX3Nsb3RzW3BvbGxfaW5kZXhdXSwgcG9sbF9kZXNjcmlwdG9yc1twb2xsX2luZGV4XS5yZXZlbnRzKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0KCiAgICBmcmVlKHBvbGxfZGVzY3JpcHRvcnMpOwogICAgZnJlZShwb2xsX3Nsb3RzKTsKICAgIHJldHVybiBOVUxMOwp9CgovLyBSdW5zIG9uZSBvcGVyYXRpb24gc3luY2hyb25vdXNseSB0aHJvdWdoIHRoZSBlbWJlZGRlZCBBUEk7IHJldHVybnMgMCBvbiBzdWNjZXNzCnN0YXRpYyBpbnQgbG9hZF9leGVjdXRlX2VtYmVkZGVkKExvYWRUaHJlYWQqIHRocmVhZCwgdm9pZCogaGFuZGxlLCBMb2FkT3BlcmF0aW9uIG9wZXJhdGlvbikgewogICAgbG9uZyBsb25nIGtleSA9IDA7CiAgICBjaGFyIGlkZW50aWZpZXJbTE9BRF9JREVOVElGSUVSX1NJWkVdID0gezB9OwogICAgY2hhciBkb2N1bWVudFtMT0FEX1JFUVVFU1RfQlVGRkVSX1NJWkUgLyAyXTsKICAgIGNoYXIgcXVlcnlbNjRdOwogICAgb3BlcmF0aW9uID0gbG9hZF9jaG9vc2VfdGFyZ2V0KHRocmVhZCwgb3BlcmF0aW9uLCAma2V5LCBpZGVudGlmaWVyKTsKICAgIHRocmVhZC0+Y3VycmVudF9vcGVyYXRpb24gPSBvcGVyYXRpb247CgogICAgc3dpdGNoIChvcGVyYXRpb24pIHsKICAgICAgICBjYXNlIExPQURfT1BFUkFUSU9OX0lOU0VSVDogewogICAgICAgICAgICBjaGFyIGluc3RhbmNlX2lkW0xPQURfSURFTlRJRklFUl9TSVpFXTsKICAgICAgICAgICAgbG9hZF9idWlsZF9kb2N1bWVudChkb2N1bWVudCwgc2l6ZW9mKGRvY3VtZW50KSwgKHVuc2lnbmVkIGxvbmcgbG9uZylrZXkpOwogICAgICAgICAgICBpZiAobG9hZF9lbWJlZGRlZC5pbnNlcnQoaGFuZGxlLCBsb2FkX2NvbmZpZy5jb2xsZWN0aW9uLCBkb2N1bWVudCwgaW5zdGFuY2VfaWQpICE9IDApIHJldHVybiAtMTsKICAgICAgICAgICAgbG9hZF9pZGVudGlmaWVyX2FwcGVuZChpbnN0YW5jZV9pZCwga2V5KTsKICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgfQogICAgICAgIGNhc2UgTE9BRF9PUEVSQVRJT05fR0VUOiB7CiAgICAgICAgICAgIGNoYXIqIGluc3RhbmNlID0gbG9hZF9lbWJlZGRlZC5nZXQoaGFuZGxlLCBsb2FkX2NvbmZpZy5jb2xsZWN0aW9uLCBpZGVudGlmaWVyKTsKICAgICAgICAgICAgaWYgKCFpbnN0YW5jZSkgcmV0dXJuIC0xOwogICAgICAgICAgICB0aHJlYWQtPmJ5dGVzX3JlY2VpdmVkICs9IChsb25nIGxvbmcpc3RybGVuKGluc3RhbmNlKTsKICAgICAgICAgICAgbG9hZF9lbWJlZGRlZC5mcmVlKGluc3RhbmNlKTsKICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgfQogICAgICAgIGNhc2UgTE9BRF9PUEVSQVRJT05fVVBEQVRFOgogICAgICAgIGNhc2UgTE9BRF9PUEVSQVRJT05fUkVBRF9NT0RJRllfV1JJVEU6IHsKICAgICAgICAgICAgaWYgKG9wZXJhdGlvbiA9PSBMT0FEX09QRVJBVElPTl9SRUFEX01PRElGWV9XUklURSkgewogICAgICAgICAgICAgICAgY2hhciogaW5zdGFuY2UgPSBsb2FkX2VtYmVkZGVkLmdldChoYW5kbGUsIGxvYWRfY29uZmlnLmNvbGxlY3Rpb24sIGlkZW50aWZpZXIpOwogICAgICAgICAgICAgICAgaWYgKCFpbnN0YW5jZSkgcmV0dXJuIC0xOwogICAgICAgICAgICAgICAgdGhyZWFkLT5ieXRlc19yZWNlaXZlZCArPSAobG9uZyBsb25nKXN0cmxlbihpbnN0YW5jZSk7CiAgICAgICAgICAgICAgICBsb2FkX2VtYmVkZGVkLmZyZWUoaW5zdGFuY2UpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIHNucHJpbnRmKGRvY3VtZW50LCBzaXplb2YoZG9jdW1lbnQpLCAie1wic2NvcmVcIjolbGx1fSIsIGxvYWRfcmFuZG9tX25leHQoJnRocmVhZC0+cmFuZG9tX3N0YXRlKSAlIDEwMDAwMCk7CiAgICAgICAgICAgIHJldHVybiBsb2FkX2VtYmVkZGVkLnVwZGF0ZShoYW5kbGUsIGxvYWRfY29uZmlnLmNvbGxlY3Rpb24sIGlkZW50aWZpZXIsIGRvY3VtZW50KTsKICAgICAgICB9CiAgICAgICAgY2FzZSBMT0FEX09QRVJBVElPTl9ERUxFVEU6CiAgICAgICAgICAgIHJldHVybiBsb2FkX2VtYmVkZGVkLmRlbGV0ZV9pbnN0YW5jZShoYW5kbGUsIGxvYWRfY29uZmlnLmNvbGxlY3Rpb24sIGlkZW50aWZpZXIpOwogICAgICAgIGRlZmF1bHQ6IHsKICAgICAgICAgICAgaWYgKG9wZXJhdGlvbiA9PSBMT0FEX09QRVJBVElPTl9RVUVSWSkgc25wcmludGYocXVlcnksIHNpemVvZihxdWVyeSksICJhZ2U6JWxsZCIsIGtleSAlIDEwMCk7CiAgICAgICAgICAgIGlmIChvcGVyYXRpb24gPT0gTE9BRF9PUEVSQVRJT05fU0NBTikgc25wcmludGYocXVlcnksIHNpemVvZihxdWVyeSksICJyYW5nZTolbGxkIiwga2V5IC8gTE9BRF9TQ0FOX1JBTkdFX1NJWkUpOwogICAgICAgICAgICB2b2lkKiBjdXJzb3IgPSBsb2FkX2VtYmVkZGVkLnF1ZXJ5KGhhbmRsZSwgbG9hZF9jb25maWcuY29sbGVjdGlvbiwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBvcGVyYXRpb24gPT0gTE9BRF9PUEVSQVRJT05fTElTVCA/IE5VTEwgOiBxdWVyeSk7CiAgICAgICAgICAgIGlmICghY3Vyc29yKSByZXR1cm4gLTE7CiAgICAgICAgICAgIGNvbnN0IGNoYXIqIGluc3RhbmNlOwogICAgICAgICAgICB3aGlsZSAoKGluc3RhbmNlID0gbG9hZF9lbWJlZGRlZC5jdXJzb3JfbmV4dChjdXJzb3IpKSAhPSBOVUxMKSB7CiAgICAgICAgICAgICAgICB0aHJlYWQtPmJ5dGVzX3JlY2VpdmVkICs9IChsb25nIGxvbmcpc3RybGVuKGluc3RhbmNlKTsKICAgICAgICAgICAgfQogICAgICAgICAgICBsb2FkX2VtYmVkZGVkLmN1cnNvcl9jbG9zZShjdXJzb3IpOwogICAgICAgICAgICByZXR1cm4gMDsKICAgICAgICB9CiAgICB9Cn0KCi8vIEVtYmVkZGVkIHdvcmtlcjogb25lIGhhbmRsZSBwZXIgdGhyZWFkLCBjbG9zZWQgbG9vcCBvciBwYWNlZCBieSB0aGUgc2FtZSBzY2hlZHVsZQp2b2lkKiBsb2FkX2VtYmVkZGVkX3RocmVhZF9tYWluKHZvaWQqIGFyZ3VtZW50KSB7CiAgICBMb2FkVGhyZWFkKiB0aHJlYWQgPSAoTG9hZFRocmVhZCopYXJndW1lbnQ7CiAgICBjb25zdCBjaGFyKiBiYXNlX2RpcmVjdG9yeSA9IGxvYWRfY29uZmlnLmVtYmVkZGVkX2Jhc2VfZGlyZWN0b3J5WzBdID8gbG9hZF9jb25maWcuZW1iZWRkZWRfYmFzZV9kaXJlY3RvcnkgOiBOVUxMOwogICAgdm9pZCogaGFuZGxlID0gbG9hZF9lbWJlZGRlZC5vcGVuKGJhc2VfZGlyZWN0b3J5LCBsb2FkX2NvbmZpZy5kYXRhYmFzZSk7CiAgICBpZiAoIWhhbmRsZSkgewogICAgICAgIHRocmVhZC0+Y29ubmVjdF9lcnJvcnMrKzsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KCiAgICBsb25nIGxvbmcgc3RhcnRfdXMgPSBnZXRfY3VycmVudF90aW1lX3VzKCk7CiAgICBsb25nIGxvbmcgZW5kX3VzID0gc3RhcnRfdXMgKyAobG9uZyBsb25nKWxvYWRfY29uZmlnLmR1cmF0aW9uX3NlY29uZHMgKiAxMDAwMDAwTEw7CiAgICBkb3VibGUgaW50ZXJ2YWxfdXMgPSB0aHJlYWQtPnJhdGVfcGVyX3NlY29uZCA+IDAgPyAxMDAwMDAwLjAgLyB0aHJlYWQtPnJhdGVfcGVyX3NlY29uZCA6IDA7CiAgICBsb25nIGxvbmcgc2NoZWR1bGVkX3JlcXVlc3RzID0gMDsKCiAgICB3aGlsZSAoIWxvYWRfc3RvcF9yZXF1ZXN0ZWQpIHsKICAgICAgICBsb25nIGxvbmcgbm93ID0gZ2V0X2N1cnJlbnRfdGltZV91cygpOwogICAgICAgIGlmICh0aHJlYWQtPnJlcXVlc3RfbGltaXQgPT0gMCAmJiBub3cgPj0gZW5kX3VzKSBicmVhazsKICAgICAgICBpZiAodGhyZWFkLT5yZXF1ZXN0X2xpbWl0ID4gMCAmJgogICAgICAgICAgICBfX2F0b21pY19mZXRjaF9hZGQoJmxvYWRfaXNzdWVkX3JlcXVlc3RzLCAxLCBfX0FUT01JQ19SRUxBWEVEKSA+PSB0aHJlYWQtPnJlcXVlc3RfbGltaXQpIHsKICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgfQoKICAgICAgICBsb25nIGxvbmcgaW50ZW5kZWRfc3RhcnRfdXMgPSBub3c7CiAgICAgICAgaWYgKGludGVydmFsX3VzID4gMCkgewogICAgICAgICAgICBpbnRlbmRlZF9zdGFydF91cyA9IHN0YXJ0X3VzICsgKGxvbmcgbG9uZykoc2NoZWR1bGVkX3JlcXVlc3RzKysgKiBpbnRlcnZhbF91cyk7CiAgICAgICAgICAgIGlmIChpbnRlbmRlZF9zdGFydF91cyA+IG5vdykgdXNsZWVwKCh1c2Vjb25kc190KShpbnRlbmRlZF9zdGFydF91cyAtIG5vdykpOwogICAgICAgIH0KCiAgICAgICAgaWYgKGxvYWRfZXhlY3V0ZV9lbWJlZGRlZCh0aHJlYWQsIGhhbmRsZSwgbG9hZF9jaG9vc2Vfb3BlcmF0aW9uKHRocmVhZCkpID09IDApIHsKICAgICAgICAgICAgaGlzdG9ncmFtX3JlY29yZCgmdGhyZWFkLT5oaXN0b2dyYW1zW3RocmVhZC0+Y3VycmVudF9vcGVyYXRpb25dLCBnZXRfY3VycmVudF90aW1lX3VzKCkgLSBpbnRlbmRlZF9zdGFydF91cyk7CiAgICAgICAgICAgIHRocmVhZC0+Y29tcGxldGVkX3JlcXVlc3RzKys7CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgdGhyZWFkLT5zdGF0dXNfZXJyb3JzKys7CiAgICAgICAgfQogICAgfQoKICAgIGxvYWRfZW1iZWRkZWQuY2xvc2UoaGFuZGxlKTsKICAgIHJldHVybiBOVUxMOwp9CgppbnQgbG9hZF9yZXNvbHZlX3RhcmdldChjb25zdCBjaGFyKiB1cmwpIHsKICAgIGNvbnN0IGNoYXIqIGhvc3Rfc3RhcnQgPSBzdHJuY21wKHVybCwgImh0dHA6Ly8iLCA3KSA9PSAwID8gdXJsICsgNyA6IHVybDsKICAgIGNvbnN0IGNoYXIqIHBvcnRfc3RhcnQgPSBzdHJjaHIoaG9zdF9zdGFydCwgJzonKTsKICAgIGNvbnN0IGNoYXIqIHBhdGhfc3RhcnQgPSBzdHJjaHIoaG9zdF9zdGFydCwgJy8nKTsKICAgIHNpemVfdCBob3N0X2xlbmd0aCA9IHBvcnRfc3RhcnQgJiYgKCFwYXRoX3N0YXJ0IHx8IHBvcnRfc3RhcnQgPCBwYXRoX3N0YXJ0KQogICAgICAgID8gKHNpemVfdCkocG9ydF9zdGFydCAtIGhvc3Rfc3RhcnQpCiAgICAgICAgOiAocGF0aF9zdGFydCA/IChzaXplX3QpKHBhdGhfc3RhcnQgLSBob3N0X3N0YXJ0KSA6IHN0cmxlbihob3N0X3N0YXJ0KSk7CiAgICBpZiAoaG9zdF9sZW5ndGggPT0gMCB8fCBob3N0X2xlbmd0aCA+PSBzaXplb2YobG9hZF9jb25maWcuaG9zdCkpIHJldHVybiAtMTsKCiAgICBtZW1jcHkobG9hZF9jb25maWcuaG9zdCwgaG9zdF9zdGFydCwgaG9zdF9sZW5ndGgpOwogICAgbG9hZF9jb25maWcuaG9zdFtob3N0X2xlbmd0aF0gPSAnXDAnOwogICAgbG9hZF9jb25maWcucG9ydCA9IHBvcnRfc3RhcnQgJiYgKCFwYXRoX3N0YXJ0IHx8IHBvcnRfc3RhcnQgPCBwYXRoX3N0YXJ0KSA/IGF0b2kocG9ydF9zdGFydCArIDEpIDogODA7CgogICAgc3RydWN0IGFkZHJpbmZvIGhpbnRzOwogICAgc3RydWN0IGFkZHJpbmZvKiByZXN1bHQgPSBOVUxMOwogICAgbWVtc2V0KCZoaW50cywgMCwgc2l6ZW9mKGhpbnRzKSk7CiAgICBoaW50cy5haV9mYW1pbHkgPSBBRl9JTkVUOwogICAgaGludHMuYWlfc29ja3R5cGUgPSBTT0NLX1NUUkVBTTsKICAgIGlmIChnZXRhZGRyaW5mbyhsb2FkX2NvbmZpZy5ob3N0LCBOVUxMLCAmaGludHMsICZyZXN1bHQpICE9IDAgfHwgIXJlc3VsdCkgcmV0dXJuIC0xOwoKICAgIG1lbWNweSgmbG9hZF9jb25maWcuYWRkcmVzcywgcmVzdWx0LT5haV9hZGRyLCBzaXplb2YobG9hZF9jb25maWcuYWRkcmVzcykpOwogICAgbG9hZF9jb25maWcuYWRkcmVzcy5zaW5fcG9ydCA9IGh0b25zKGxvYWRfY29uZmlnLnBvcnQpOwogICAgZnJlZWFkZHJpbmZvKHJlc3VsdCk7CiAgICByZXR1cm4gMDsKfQoKLy8gUGFyc2VzICJnZXQ9ODAsaW5zZXJ0PTE1LHF1ZXJ5PTUiIGludG8gb3BlcmF0aW9uIHdlaWdodHMKaW50IGxvYWRfcGFyc2VfbWl4KGNvbnN0IGNoYXIqIG1peCkgewogICAgbWVtc2V0KGxvYWRfY29uZmlnLm9wZXJhdGlvbl93ZWlnaHRzLCAwLCBzaXplb2YobG9hZF9jb25maWcub3BlcmF0aW9uX3dlaWdodHMpKTsKICAgIGxvYWRfY29uZmlnLnRvdGFsX3dlaWdodCA9IDA7CgogICAgY2hhciBtaXhfY29weVsyNTZdOwogICAgc3RybmNweShtaXhfY29weSwgbWl4LCBzaXplb2YobWl4X2NvcHkpIC0gMSk7CiAgICBtaXhfY29weVtzaXplb2YobWl4X2NvcHkpIC0gMV0gPSAnXDAnOwogICAgY2hhciogc2F2ZV9wb2ludGVyID0gTlVMTDsKICAgIGZvciAoY2hhciogZW50cnkgPSBzdHJ0b2tfcihtaXhfY29weSwgIiwiLCAmc2F2ZV9wb2ludGVyKTsgZW50cnk7IGVudHJ5ID0gc3RydG9rX3IoTlVMTCwgIiwiLCAmc2F2ZV9wb2ludGVyKSkgewogICAgICAgIGNoYXIqIHNlcGFyYXRvciA9IHN0cmNocihlbnRyeSwgJz0nKTsKICAgICAgICBpZiAoIXNlcGFyYXRvcikgc2VwYXJhdG9yID0gc3RyY2hyKGVudHJ5LCAnOicpOwogICAgICAgIGlmICghc2VwYXJhdG9yKSByZXR1cm4gLTE7CiAgICAgICAgKnNlcGFyYXRvciA9ICdcMCc7CgogICAgICAgIGludCBvcGVyYXRpb24gPSAwOwogICAgICAgIHdoaWxlIChvcGVyYXRpb24gPCBMT0FEX09QRVJBVElPTl9DT1VOVCAmJiBzdHJjbXAoZW50cnksIGxvYWRfb3BlcmF0aW9uX25hbWVzW29wZXJhdGlvbl0pICE9IDApIG9wZXJhdGlvbisrOwogICAgICAgIGludCB3ZWlnaHQgPSBhdG9pKHNlcGFyYXRvciArIDEpOwogICAgICAgIGlmIChvcGVyYXRpb24gPT0gTE9BRF9PUEVSQVRJT05fQ09VTlQgfHwgd2VpZ2h0IDwgMCkgcmV0dXJuIC0xOwogICAgICAgIGxvYWRfY29uZmlnLm9wZXJhdGlvbl93ZWlnaHRzW29wZXJhdGlvbl0gKz0gd2VpZ2h0OwogICAgICAgIGxvYWRfY29uZmlnLnRvdGFsX3dlaWdodCArPSB3ZWlnaHQ7CiAgICB9CgogICAgc3RybmNweShsb2FkX2NvbmZpZy5taXhfZGVzY3JpcHRpb24sIG1peCwgc2l6ZW9mKGxvYWRfY29uZmlnLm1peF9kZXNjcmlwdGlvbikgLSAxKTsKICAgIHJldHVybiBsb2FkX2NvbmZpZy50b3RhbF93ZWlnaHQgPiAwID8gMCA6IC0xOwp9CgppbnQgbG9hZF9wcmVwYXJlX2NvbGxlY3Rpb24oKSB7CiAgICBjaGFyIHVybFs1MTJdOwogICAgY2hhciBib2R5WzEwMjRdOwoKICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9hcGkvZGF0YWJhc2VzIiwgc2VydmVyX3VybCk7CiAgICBzbnByaW50Zihib2R5LCBzaXplb2YoYm9keSksICJ7XCJuYW1lXCI6XCIlc1wifSIsIGxvYWRfY29uZmlnLmRhdGFiYXNlKTsKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCB1cmwsIGJvZHksICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICBpZiAoIXJlc3BvbnNlIHx8IHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9PSAwKSB7CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gLTE7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUocmVzcG9uc2UpOwoKICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zIiwgc2VydmVyX3VybCwgbG9hZF9jb25maWcuZGF0YWJhc2UpOwogICAgc25wcmludGYoYm9keSwgc2l6ZW9mKGJvZHkpLAogICAgICAgICJ7XCJuYW1lXCI6XCIlc1wiLFwic2NoZW1hXCI6WyIKICAgICAgICAie1wibmFtZVwiOlwibmFtZVwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwiZW1haWxcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJhZ2VcIixcInR5cGVcIjpcImludFwiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJzY29yZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcInJhbmdlXCIsXCJ0eXBlXCI6XCJpbnRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwicGF5bG9hZFwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfV19IiwKICAgICAgICBsb2FkX2NvbmZpZy5jb2xsZWN0aW9uKTsKICAgIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgdXJsLCBib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaHR0cF9yZXNwb25zZV9mcmVlKHJlc3BvbnNlKTsKICAgIHJldHVybiAwOwp9CgovLyBSZXNvbHZlcyB0aGUgc3lkYi5oIGVudHJ5IHBvaW50cyBmcm9tIGEgc2hhcmVkIGxpYnN5ZGIgZm9yIC0tZW1iZWRkZWQgcnVucwppbnQgbG9hZF9vcGVuX2VtYmVkZGVkX2xpYnJhcnkoY29uc3QgY2hhciogbGlicmFyeV9wYXRoKSB7CiAgICBsb2FkX2VtYmVkZGVkLmxpYnJhcnkgPSBkbG9wZW4obGlicmFyeV9wYXRoLCBSVExEX05PVyB8IFJUTERfTE9DQUwpOwogICAgaWYgKCFsb2FkX2VtYmVkZGVkLmxpYnJhcnkpIHsKICAgICAgICBmcHJpbnRmKHN0ZGVyciwgUkVEICJFcnJvcjogJXNcbiIgUkVTRVQsIGRsZXJyb3IoKSk7CiAgICAgICAgcmV0dXJuIC0xOwogICAgfQoKICAgICoodm9pZCoqKSZsb2FkX2VtYmVkZGVkLm9wZW4gPSBkbHN5bShsb2FkX2VtYmVkZGVkLmxpYnJhcnksICJzeWRiX29wZW4iKTsKICAgICoodm9pZCoqKSZsb2FkX2VtYmVkZGVkLmNsb3NlID0gZGxzeW0obG9hZF9lbWJlZGRlZC5saWJyYXJ5LCAic3lkYl9jbG9zZSIpOwogICAgKih2b2lkKiopJmxvYWRfZW1iZWRkZWQuZnJlZSA9IGRsc3ltKGxvYWRfZW1iZWRkZWQubGlicmFyeSwgInN5ZGJfZnJlZSIpOwogICAgKih2b2lkKiopJmxvYWRfZW1iZWRkZWQuY3JlYXRlX2NvbGxlY3Rpb24gPSBkbHN5bShsb2FkX2VtYmVkZGVkLmxpYnJhcnksICJzeWRiX2NyZWF0ZV9jb2xsZWN0aW9uIik7CiAgICAqKHZvaWQqKikmbG9hZF9lbWJlZGRlZC5pbnNlcnQgPSBkbHN5bShsb2FkX2VtYmVkZGVkLmxpYnJhcnksICJzeWRiX2luc2VydCIpOwogICAgKih2b2lkKiopJmxvYWRfZW1iZWRkZWQudXBkYXRlID0gZGxzeW0obG9hZF9lbWJlZGRlZC5saWJyYXJ5LCAic3lkYl91cGRhdGUiKTsKICAgICoodm9pZCoqKSZsb2FkX2VtYmVkZGVkLmRlbGV0ZV9pbnN0YW5jZSA9IGRsc3ltKGxvYWRfZW1iZWRkZWQubGlicmFyeSwgInN5ZGJfZGVsZXRlIik7CiAgICAqKHZvaWQqKikmbG9hZF9lbWJlZGRlZC5nZXQgPSBkbHN5bShsb2FkX2VtYmVkZGVkLmxpYnJhcnksICJzeWRiX2dldCIpOwogICAgKih2b2lkKiopJmxvYWRfZW1iZWRkZWQucXVlcnkgPSBkbHN5bShsb2FkX2VtYmVkZGVkLmxpYnJhcnksICJzeWRiX3F1ZXJ5Iik7CiAgICAqKHZvaWQqKikmbG9hZF9lbWJlZGRlZC5jdXJzb3JfbmV4dCA9IGRsc3ltKGxvYWRfZW1iZWRkZWQubGlicmFyeSwgInN5ZGJfY3Vyc29yX25leHQiKTsKICAgICoodm9pZCoqKSZsb2FkX2VtYmVkZGVkLmN1cnNvcl9jbG9zZSA9IGRsc3ltKGxvYWRfZW1iZWRkZWQubGlicmFyeSwgInN5ZGJfY3Vyc29yX2Nsb3NlIik7CgogICAgaWYgKCFsb2FkX2VtYmVkZGVkLm9wZW4gfHwgIWxvYWRfZW1iZWRkZWQuY2xvc2UgfHwgIWxvYWRfZW1iZWRkZWQuZnJlZSB8fCAhbG9hZF9lbWJlZGRlZC5jcmVhdGVfY29sbGVjdGlvbiB8fAogICAgICAgICFsb2FkX2VtYmVkZGVkLmluc2VydCB8fCAhbG9hZF9lbWJlZGRlZC51cGRhdGUgfHwgIWxvYWRfZW1iZWRkZWQuZGVsZXRlX2luc3RhbmNlIHx8ICFsb2FkX2VtYmVkZGVkLmdldCB8fAogICAgICAgICFsb2FkX2VtYmVkZGVkLnF1ZXJ5IHx8ICFsb2FkX2VtYmVkZGVkLmN1cnNvcl9uZXh0IHx8ICFsb2FkX2VtYmVkZGVkLmN1cnNvcl9jbG9zZSkgewogICAgICAgIGZwcmludGYoc3RkZXJyLCBSRUQgIkVycm9yOiAlcyBkb2VzIG5vdCBleHBvcnQgdGhlIHN5ZGIuaCBBUElcbiIgUkVTRVQsIGxpYnJhcnlfcGF0aCk7CiAgICAgICAgcmV0dXJuIC0xOwogICAgfQogICAgcmV0dXJuIDA7Cn0KCmludCBsb2FkX3ByZXBhcmVfZW1iZWRkZWRfY29sbGVjdGlvbigpIHsKICAgIGNvbnN0IGNoYXIqIGJhc2VfZGlyZWN0b3J5ID0gbG9hZF9jb25maWcuZW1iZWRkZWRfYmFzZV9kaXJlY3RvcnlbMF0gPyBsb2FkX2NvbmZpZy5lbWJlZGRlZF9iYXNlX2RpcmVjdG9yeSA6IE5VTEw7CiAgICB2b2lkKiBoYW5kbGUgPSBsb2FkX2VtYmVkZGVkLm9wZW4oYmFzZV9kaXJlY3RvcnksIGxvYWRfY29uZmlnLmRhdGFiYXNlKTsKICAgIGlmICghaGFuZGxlKSByZXR1cm4gLTE7CiAgICBsb2FkX2VtYmVkZGVkLmNyZWF0ZV9jb2xsZWN0aW9uKGhhbmRsZSwgbG9hZF9jb25maWcuY29sbGVjdGlvbiwKICAgICAgICAiW3tcIm5hbWVcIjpcIm5hbWVcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjp0cnVlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImVtYWlsXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwiYWdlXCIsXCJ0eXBlXCI6XCJpbnRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwic2NvcmVcIixcInR5cGVcIjpcImludFwiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJyYW5nZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcInBheWxvYWRcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX1dIik7CiAgICBsb2FkX2VtYmVkZGVkLmNsb3NlKGhhbmRsZSk7CiAgICByZXR1cm4gMDsKfQoKLy8gUnVucyBvbmUgcGhhc2Ugd2l0aCB0aGUgY3VycmVudCBsb2FkX2NvbmZpZyBhbmQgbWVyZ2VzIHRoZSBwZXItdGhyZWFkIHJlc3VsdHMKaW50IGxvYWRfcnVuX3BoYXNlKGRvdWJsZSByYXRlX3Blcl9zZWNvbmQsIGxvbmcgbG9uZyByZXF1ZXN0X2xpbWl0LCBMYXRlbmN5SGlzdG9ncmFtKiBoaXN0b2dyYW1zLAogICAgICAgICAgICAgICAgICAgbG9uZyBsb25nKiB0b3RhbHMsIGRvdWJsZSogZWxhcHNlZF9zZWNvbmRzKSB7CiAgICBib29sIGVtYmVkZGVkID0gbG9hZF9jb25maWcuZW1iZWRkZWRfbGlicmFyeV9wYXRoWzBdICE9ICdcMCc7CiAgICBpbnQgdGhyZWFkX2NvdW50ID0gbG9hZF9jb25maWcudGhyZWFkX2NvdW50OwogICAgaWYgKCFlbWJlZGRlZCAmJiB0aHJlYWRfY291bnQgPiBsb2FkX2NvbmZpZy5jb25uZWN0aW9uX2NvdW50KSB0aHJlYWRfY291bnQgPSBsb2FkX2NvbmZpZy5jb25uZWN0aW9uX2NvdW50OwoKICAgIGxvbmcgbG9uZyByZWNvcmRfY291bnQgPSBfX2F0b21pY19sb2FkX24oJmxvYWRfaWRlbnRpZmllcl9jb3VudCwgX19BVE9NSUNfQUNRVUlSRSk7CiAgICB6aXBmaWFuX2luaXRpYWxpemUoJmxvYWRfemlwZmlhbiwgcmVjb3JkX2NvdW50ID4gMCA/IHJlY29yZF9jb3VudCA6IHJlcXVlc3RfbGltaXQsIGxvYWRfY29uZmlnLnppcGZpYW5fY29uc3RhbnQpOwoKICAgIExvYWRUaHJlYWQqIHRocmVhZHMgPSBjYWxsb2ModGhyZWFkX2NvdW50LCBzaXplb2YoTG9hZFRocmVhZCkpOwogICAgcHRocmVhZF90KiBoYW5kbGVzID0gY2FsbG9jKHRocmVhZF9jb3VudCwgc2l6ZW9mKHB0aHJlYWRfdCkpOwogICAgaWYgKCF0aHJlYWRzIHx8ICFoYW5kbGVzKSB7CiAgICAgICAgZnJlZSh0aHJlYWRzKTsKICAgICAgICBmcmVlKGhhbmRsZXMpOwogICAgICAgIHJldHVybiAtMTsKICAgIH0KCiAgICBsb2FkX2lzc3VlZF9yZXF1ZXN0cyA9IDA7CiAgICBsb25nIGxvbmcgc3RhcnRfdXMgPSBnZXRfY3VycmVudF90aW1lX3VzKCk7CiAgICBmb3IgKGludCB0aHJlYWRfaW5kZXggPSAwOyB0aHJlYWRfaW5kZXggPCB0aHJlYWRfY291bnQ7IHRocmVhZF9pbmRleCsrKSB7CiAgICAgICAgTG9hZFRocmVhZCogdGhyZWFkID0gJnRocmVhZHNbdGhyZWFkX2luZGV4XTsKICAgICAgICB0aHJlYWQtPnRocmVhZF9pbmRleCA9IHRocmVhZF9pbmRleDsKICAgICAgICB0aHJlYWQtPmNvbm5lY3Rpb25fY291bnQgPSBsb2FkX2NvbmZpZy5jb25uZWN0aW9uX2NvdW50IC8gdGhyZWFkX2NvdW50ICsKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAodGhyZWFkX2luZGV4IDwgbG9hZF9jb25maWcuY29ubmVjdGlvbl9jb3VudCAlIHRocmVhZF9jb3VudCA/IDEgOiAwKTsKICAgICAgICB0aHJlYWQtPnJhdGVfcGVyX3NlY29uZCA9IHJhdGVfcGVyX3NlY29uZCAvIHRocmVhZF9jb3VudDsKICAgICAgICB0aHJlYWQtPnJlcXVlc3RfbGltaXQgPSByZXF1ZXN0X2xpbWl0OwogICAgICAgIHRocmVhZC0+cmFuZG9tX3N0YXRlID0gMHg5RTM3NzlCOTdGNEE3QzE1VUxMIF4gKCh1bnNpZ25lZCBsb25nIGxvbmcpKHRocmVhZF9pbmRleCArIDEpIDw8IDMyKSBeICh1bnNpZ25lZCBsb25nIGxvbmcpc3RhcnRfdXM7CiAgICAgICAgdGhyZWFkLT5zbG90cyA9IGNhbGxvYyh0aHJlYWQtPmNvbm5lY3Rpb25fY291bnQgPiAwID8gdGhyZWFkLT5jb25uZWN0aW9uX2NvdW50IDogMSwgc2l6ZW9mKExvYWRTbG90KSk7CiAgICAgICAgZm9yIChpbnQgc2xvdF9pbmRleCA9IDA7IHRocmVhZC0+c2xvdHMgJiYgc2xvdF9pbmRleCA8IHRocmVhZC0+Y29ubmVjdGlvbl9jb3VudDsgc2xvdF9pbmRleCsrKSB7CiAgICAgICAgICAgIHRocmVhZC0+c2xvdHNbc2xvdF9pbmRleF0uc29ja2V0X2ZkID0gLTE7CiAgICAgICAgfQogICAgICAgIGlmICghdGhyZWFkLT5zbG90cyB8fAogICAgICAgICAgICBwdGhyZWFkX2NyZWF0ZSgmaGFuZGxlc1t0aHJlYWRfaW5kZXhdLCBOVUxMLCBlbWJlZGRlZCA/IGxvYWRfZW1iZWRkZWRfdGhyZWFkX21haW4gOiBsb2FkX3RocmVhZF9tYWluLCB0aHJlYWQpICE9IDApIHsKICAgICAgICAgICAgdGhyZWFkX2NvdW50ID0gdGhyZWFkX2luZGV4OwogICAgICAgICAgICBicmVhazsKICAgICAgICB9CiAgICB9CgogICAgbWVtc2V0KHRvdGFscywgMCwgNSAqIHNpemVvZihsb25nIGxvbmcpKTsKICAgIGZvciAoaW50IHRocmVhZF9pbmRleCA9IDA7IHRocmVhZF9pbmRleCA8IHRocmVhZF9jb3VudDsgdGhyZWFkX2luZGV4KyspIHsKICAgICAgICBMb2FkVGhyZWFkKiB0aHJlYWQgPSAmdGhyZWFkc1t0aHJlYWRfaW5kZXhdOwogICAgICAgIHB0aHJlYWRfam9pbihoYW5kbGVzW3RocmVhZF9pbmRleF0sIE5VTEwpOwogICAgICAgIGZvciAoaW50IG9wZXJhdGlvbiA9IDA7IG9wZXJhdGlvbiA8IExPQURfT1BFUkFUSU9OX0NPVU5UOyBvcGVyYXRpb24rKykgewogICAgICAgICAgICBoaXN0b2dyYW1fbWVyZ2UoJmhpc3RvZ3JhbXNbb3BlcmF0aW9uXSwgJnRocmVhZC0+aGlzdG9ncmFtc1tvcGVyYXRpb25dKTsKICAgICAgICB9CiAgICAgICAgdG90YWxzWzBdICs9IHRocmVhZC0+Y29tcGxldGVkX3JlcXVlc3RzOwogICAgICAgIHRvdGFsc1sxXSArPSB0aHJlYWQtPmNvbm5lY3RfZXJyb3JzOwogICAgICAgIHRvdGFsc1syXSArPSB0aHJlYWQtPnRpbWVvdXRfZXJyb3JzOwogICAgICAgIHRvdGFsc1szXSArPSB0aHJlYWQtPnN0YXR1c19lcnJvcnM7CiAgICAgICAgdG90YWxzWzRdICs9IHRocmVhZC0+Ynl0ZXNfcmVjZWl2ZWQ7CiAgICAgICAgZnJlZSh0aHJlYWQtPnNsb3RzKTsKICAgIH0KICAgICplbGFwc2VkX3NlY29uZHMgPSAoZ2V0X2N1cnJlbnRfdGltZV91cygpIC0gc3RhcnRfdXMpIC8gMTAwMDAwMC4wOwoKICAgIGZyZWUodGhyZWFkcyk7CiAgICBmcmVlKGhhbmRsZXMpOwogICAgcmV0dXJuIHRocmVhZF9jb3VudCA+IDAgPyAwIDogLTE7Cn0KCnN0YXRpYyB2b2lkIGxvYWRfcHJpbnRfbGF0ZW5jeV9yb3coY29uc3QgY2hhciogbmFtZSwgY29uc3QgTGF0ZW5jeUhpc3RvZ3JhbSogaGlzdG9ncmFtKSB7CiAgICBpZiAoaGlzdG9ncmFtLT50b3RhbF9jb3VudCA9PSAwKSByZXR1cm47CiAgICBwcmludGYoIiAgJS04cyAlMTBsbHUgJTkuMmYgJTkuMmYgJTkuMmYgJTkuMmYgJTkuMmYgJTkuMmZcbiIsIG5hbWUsCiAgICAgICAgICAgKHVuc2lnbmVkIGxvbmcgbG9uZyloaXN0b2dyYW0tPnRvdGFsX2NvdW50LAogICAgICAgICAgIGhpc3RvZ3JhbV9wZXJjZW50aWxlKGhpc3RvZ3JhbSwgNTAuMCkgLyAxMDAwLjAsCiAgICAgICAgICAgaGlzdG9ncmFtX3BlcmNlbnRpbGUoaGlzdG9ncmFtLCA5MC4wKSAvIDEwMDAuMCwKICAgICAgICAgICBoaXN0b2dyYW1fcGVyY2VudGlsZShoaXN0b2dyYW0sIDk5LjApIC8gMTAwMC4wLAogICAgICAgICAgIGhpc3RvZ3JhbV9wZXJjZW50aWxlKGhpc3RvZ3JhbSwgOTkuOSkgLyAxMDAwLjAsCiAgICAgICAgICAgaGlzdG9ncmFtLT5tYXhpbXVtX3ZhbHVlIC8gMTAwMC4wLAogICAgICAgICAgIChkb3VibGUpKGhpc3RvZ3JhbS0+c3VtIC8gaGlzdG9ncmFtLT50b3RhbF9jb3VudCkgLyAxMDAwLjApOwp9CgpzdGF0aWMgdm9pZCBsb2FkX3dyaXRlX2xhdGVuY3lfanNvbihGSUxFKiBvdXRwdXQsIGNvbnN0IGNoYXIqIG5hbWUsIGNvbnN0IExhdGVuY3lIaXN0b2dyYW0qIGhpc3RvZ3JhbSwgYm9vbCBsZWFkaW5nX2NvbW1hKSB7CiAgICBmcHJpbnRmKG91dHB1dCwgIiVzXCIlc1wiOntcImNvdW50XCI6JWxsdSxcInA1MFwiOiVsbHUsXCJwOTBcIjolbGx1LFwicDk5XCI6JWxsdSxcInA5OTlcIjolbGx1LFwibWF4XCI6JWxsdSxcIm1lYW5cIjolLjFmfSIsCiAgICAgICAgICAgIGxlYWRpbmdfY29tbWEgPyAiLCIgOiAiIiwgbmFtZSwgKHVuc2lnbmVkIGxvbmcgbG9uZyloaXN0b2dyYW0tPnRvdGFsX2NvdW50LAogICAgICAgICAgICAodW5zaWduZWQgbG9uZyBsb25nKWhpc3RvZ3JhbV9wZXJjZW50aWxlKGhpc3RvZ3JhbSwgNTAuMCksCiAgICAgICAgICAgICh1bnNpZ25lZCBsb25nIGxvbmcpaGlzdG9ncmFtX3BlcmNlbnRpbGUoaGlzdG9ncmFtLCA5MC4wKSwKICAgICAgICAgICAgKHVuc2lnbmVkIGxvbmcgbG9uZyloaXN0b2dyYW1fcGVyY2VudGlsZShoaXN0b2dyYW0sIDk5LjApLAogICAgICAgICAgICAodW5zaWduZWQgbG9uZyBsb25nKWhpc3RvZ3JhbV9wZXJjZW50aWxlKGhpc3RvZ3JhbSwgOTkuOSksCiAgICAgICAgICAgICh1bnNpZ25lZCBsb25nIGxvbmcpaGlzdG9ncmFtLT5tYXhpbXVtX3ZhbHVlLAogICAgICAgICAgICBoaXN0b2dyYW0tPnRvdGFsX2NvdW50ID8gKGRvdWJsZSkoaGlzdG9ncmFtLT5zdW0gLyBoaXN0b2dyYW0tPnRvdGFsX2NvdW50KSA6IDAuMCk7Cn0KCnZvaWQgbG9hZF9yZXBvcnQoY29uc3QgY2hhciogcGhhc2UsIGNvbnN0IExhdGVuY3lIaXN0b2dyYW0qIGhpc3RvZ3JhbXMsIGNvbnN0IGxvbmcgbG9uZyogdG90YWxzLAogICAgICAgICAgICAgICAgIGRvdWJsZSBlbGFwc2VkX3NlY29uZHMsIGRvdWJsZSByYXRlX3Blcl9zZWNvbmQsIEZJTEUqIGpzb25fb3V0cHV0KSB7CiAgICBMYXRlbmN5SGlzdG9ncmFtIGFsbDsKICAgIG1lbXNldCgmYWxsLCAwLCBzaXplb2YoYWxsKSk7CiAgICBmb3IgKGludCBvcGVyYXRpb24gPSAwOyBvcGVyYXRpb24gPCBMT0FEX09QRVJBVElPTl9DT1VOVDsgb3BlcmF0aW9uKyspIHsKICAgICAgICBoaXN0b2dyYW1fbWVyZ2UoJmFsbCwgJmhpc3RvZ3JhbXNbb3BlcmF0aW9uXSk7CiAgICB9CiAgICBkb3VibGUgdGhyb3VnaHB1dCA9IGVsYXBzZWRfc2Vjb25kcyA+IDAgPyB0b3RhbHNbMF0gLyBlbGFwc2VkX3NlY29uZHMgOiAwOwogICAgbG9uZyBsb25nIGVycm9yX3RvdGFsID0gdG90YWxzWzFdICsgdG90YWxzWzJdICsgdG90YWxzWzNdOwoKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIiVzIiBSRVNFVCAiXG4iLCBwaGFzZSk7CiAgICBwcmludGYoIiAgUmVxdWVzdHM6ICIgQ1lBTiAiJWxsZCIgUkVTRVQgIiBpbiAlLjJmcywgdGhyb3VnaHB1dCAiIENZQU4gIiUuMWYgcmVxL3MiIFJFU0VUICIsICUuMmYgTUIgcmVhZFxuIiwKICAgICAgICAgICB0b3RhbHNbMF0sIGVsYXBzZWRfc2Vjb25kcywgdGhyb3VnaHB1dCwgdG90YWxzWzRdIC8gMTA0ODU3Ni4wKTsKICAgIHByaW50ZigiICBFcnJvcnM6ICAgJXMlbGxkIiBSRVNFVCAiIChjb25uZWN0ICVsbGQsIHRpbWVvdXQgJWxsZCwgbm9uLTJ4eCAlbGxkKVxuIiwKICAgICAgICAgICBlcnJvcl90b3RhbCA/IFJFRCA6IEdSRUVOLCBlcnJvcl90b3RhbCwgdG90YWxzWzFdLCB0b3RhbHNbMl0sIHRvdGFsc1szXSk7CiAgICBwcmludGYoIiAgTGF0ZW5jeSAobXMpICBjb3VudCAgICAgICBwNTAgICAgICAgcDkwICAgICAgIHA5OSAgICAgIHA5OTkgICAgICAgbWF4ICAgICAgbWVhblxuIik7CiAgICBsb2FkX3ByaW50X2xhdGVuY3lfcm93KCJhbGwiLCAmYWxsKTsKICAgIGZvciAoaW50IG9wZXJhdGlvbiA9IDA7IG9wZXJhdGlvbiA8IExPQURfT1BFUkFUSU9OX0NPVU5UOyBvcGVyYXRpb24rKykgewogICAgICAgIGxvYWRfcHJpbnRfbGF0ZW5jeV9yb3cobG9hZF9vcGVyYXRpb25fbmFtZXNbb3BlcmF0aW9uXSwgJmhpc3RvZ3JhbXNbb3BlcmF0aW9uXSk7CiAgICB9CgogICAgaWYgKGpzb25fb3V0cHV0KSB7CiAgICAgICAgZnByaW50Zihqc29uX291dHB1dCwKICAgICAgICAgICAgICAgICJ7XCJwaGFzZVwiOlwiJXNcIixcInRhcmdldFwiOlwiJXNcIixcInRyYW5zcG9ydFwiOlwiJXNcIixcIndvcmtsb2FkXCI6XCIlc1wiLFwiZGlzdHJpYnV0aW9uXCI6XCIlc1wiLCIKICAgICAgICAgICAgICAgICJcIm1vZGVcIjpcIiVzXCIsXCJ0YXJnZXRfcmF0ZVwiOiUuMWYsXCJ0aHJlYWRzXCI6JWQsXCJjb25uZWN0aW9uc1wiOiVkLFwicmVjb3Jkc1wiOiVsbGQsIgogICAgICAgICAgICAgICAgIlwibWl4XCI6XCIlc1wiLFwiZWxhcHNlZF9zZWNvbmRzXCI6JS4zZixcInJlcXVlc3RzXCI6JWxsZCxcInRocm91Z2hwdXRcIjolLjFmLFwiYnl0ZXNfcmVjZWl2ZWRcIjolbGxkLCIKICAgICAgICAgICAgICAgICJcImVycm9yc1wiOntcImNvbm5lY3RcIjolbGxkLFwidGltZW91dFwiOiVsbGQsXCJzdGF0dXNcIjolbGxkfSxcImxhdGVuY3lfdXNcIjp7IiwKICAgICAgICAgICAgICAgIHBoYXNlLCBsb2FkX2NvbmZpZy5lbWJlZGRlZF9saWJyYXJ5X3BhdGhbMF0gPyBsb2FkX2NvbmZpZy5lbWJlZGRlZF9saWJyYXJ5X3BhdGggOiBzZXJ2ZXJfdXJsLAogICAgICAgICAgICAgICAgbG9hZF9jb25maWcuZW1iZWRkZWRfbGlicmFyeV9wYXRoWzBdID8gImVtYmVkZGVkIiA6ICJodHRwIiwKICAgICAgICAgICAgICAgIGxvYWRfY29uZmlnLndvcmtsb2FkX25hbWUgPyBsb2FkX2NvbmZpZy53b3JrbG9hZF9uYW1lIDogImN1c3RvbSIsCiAgICAgICAgICAgICAgICBsb2FkX2Rpc3RyaWJ1dGlvbl9uYW1lc1tsb2FkX2NvbmZpZy5kaXN0cmlidXRpb25dLAogICAgICAgICAgICAgICAgcmF0ZV9wZXJfc2Vjb25kID4gMCA/ICJvcGVuIiA6ICJjbG9zZWQiLCByYXRlX3Blcl9zZWNvbmQsCiAgICAgICAgICAgICAgICBsb2FkX2NvbmZpZy50aHJlYWRfY291bnQsIGxvYWRfY29uZmlnLmNvbm5lY3Rpb25fY291bnQsCiAgICAgICAgICAgICAgICBfX2F0b21pY19sb2FkX24oJmxvYWRfaWRlbnRpZmllcl9jb3VudCwgX19BVE9NSUNfQUNRVUlSRSksIGxvYWRfY29uZmlnLm1peF9kZXNjcmlwdGlvbiwKICAgICAgICAgICAgICAgIGVsYXBzZWRfc2Vjb25kcywgdG90YWxzWzBdLCB0aHJvdWdocHV0LCB0b3RhbHNbNF0sIHRvdGFsc1sxXSwgdG90YWxzWzJdLCB0b3RhbHNbM10pOwogICAgICAgIGxvYWRfd3JpdGVfbGF0ZW5jeV9qc29uKGpzb25fb3V0cHV0LCAiYWxsIiwgJmFsbCwgZmFsc2UpOwogICAgICAgIGZvciAoaW50IG9wZXJhdGlvbiA9IDA7IG9wZXJhdGlvbiA8IExPQURfT1BFUkFUSU9OX0NPVU5UOyBvcGVyYXRpb24rKykgewogICAgICAgICAgICBpZiAoaGlzdG9ncmFtc1tvcGVyYXRpb25dLnRvdGFsX2NvdW50ID4gMCkgewogICAgICAgICAgICAgICAgbG9hZF93cml0ZV9sYXRlbmN5X2pzb24oanNvbl9vdXRwdXQsIGxvYWRfb3BlcmF0aW9uX25hbWVzW29wZXJhdGlvbl0sICZoaXN0b2dyYW1zW29wZXJhdGlvbl0sIHRydWUpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIGZwcmludGYoanNvbl9vdXRwdXQsICJ9fSIpOwogICAgfQp9CgpzdGF0aWMgdm9pZCBsb2FkX2hhbmRsZV9zaWduYWwoaW50IHNpZ25hbF9udW1iZXIpIHsKICAgICh2b2lkKXNpZ25hbF9udW1iZXI7CiAgICBsb2FkX3N0b3BfcmVxdWVzdGVkID0gMTsKfQoKaW50IHJ1bl9sb2FkX3Rlc3QoKSB7CiAgICBib29sIGVtYmVkZGVkID0gbG9hZF9jb25maWcuZW1iZWRkZWRfbGlicmFyeV9wYXRoWzBdICE9ICdcMCc7CiAgICBpZiAoZW1iZWRkZWQpIHsKICAgICAgICBpZiAobG9hZF9vcGVuX2VtYmVkZGVkX2xpYnJhcnkobG9hZF9jb25maWcuZW1iZWRkZWRfbGlicmFyeV9wYXRoKSAhPSAwKSByZXR1cm4gMTsKICAgICAgICBpZiAobG9hZF9wcmVwYXJlX2VtYmVkZGVkX2NvbGxlY3Rpb24oKSAhPSAwKSB7CiAgICAgICAgICAgIGZwcmludGYoc3RkZXJyLCBSRUQgIkVycm9yOiBjYW5ub3Qgb3BlbiBkYXRhYmFzZSAlcyB0aHJvdWdoICVzXG4iIFJFU0VULAogICAgICAgICAgICAgICAgICAgIGxvYWRfY29uZmlnLmRhdGFiYXNlLCBsb2FkX2NvbmZpZy5lbWJlZGRlZF9saWJyYXJ5X3BhdGgpOwogICAgICAgICAgICByZXR1cm4gMTsKICAgICAgICB9CiAgICB9IGVsc2UgewogICAgICAgIGlmIChsb2FkX3Jlc29sdmVfdGFyZ2V0KHNlcnZlcl91cmwpICE9IDApIHsKICAgICAgICAgICAgZnByaW50ZihzdGRlcnIsIFJFRCAiRXJyb3I6IGNhbm5vdCByZXNvbHZlICVzXG4iIFJFU0VULCBzZXJ2ZXJfdXJsKTsKICAgICAgICAgICAgcmV0dXJuIDE7CiAgICAgICAgfQogICAgICAgIGlmIChsb2FkX3ByZXBhcmVfY29sbGVjdGlvbigpICE9IDApIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiRXJyb3I6IENhbm5vdCBjb25uZWN0IHRvIHNlcnZlciBhdCAlc1xuIiBSRVNFVCwgc2VydmVyX3VybCk7CiAgICAgICAgICAgIHByaW50ZigiTWFrZSBzdXJlIHRoZSBTWURCIHNlcnZlciBpcyBydW5uaW5nIHdpdGg6IC4vc3lkYiAtLXNlcnZlclxuIik7CiAgICAgICAgICAgIHJldHVybiAxOwogICAgICAgIH0KICAgIH0KICAgIHNpZ25hbChTSUdJTlQsIGxvYWRfaGFuZGxlX3NpZ25hbCk7CiAgICBzaWduYWwoU0lHUElQRSwgU0lHX0lHTik7CgogICAgLy8gRXZlcnkgd29ya2xvYWQgcnVuIGxlYXZlcyBhIHJlc3VsdCBmaWxlIGJlaGluZCwgbmFtZWQgYWZ0ZXIgdGhlIHByZXNldAogICAgaWYgKCFsb2FkX2NvbmZpZy5qc29uX291dHB1dF9wYXRoWzBdICYmIGxvYWRfY29uZmlnLndvcmtsb2FkX25hbWUpIHsKICAgICAgICBzbnByaW50Zihsb2FkX2NvbmZpZy5qc29uX291dHB1dF9wYXRoLCBzaXplb2YobG9hZF9jb25maWcuanNvbl9vdXRwdXRfcGF0aCksCiAgICAgICAgICAgICAgICAgInljc2JfJXNfJWxkLmpzb24iLCBsb2FkX2NvbmZpZy53b3JrbG9hZF9uYW1lLCAobG9uZyl0aW1lKE5VTEwpKTsKICAgIH0KCiAgICBGSUxFKiBqc29uX291dHB1dCA9IE5VTEw7CiAgICBpZiAobG9hZF9jb25maWcuanNvbl9vdXRwdXRfcGF0aFswXSkgewogICAgICAgIGpzb25fb3V0cHV0ID0gZm9wZW4obG9hZF9jb25maWcuanNvbl9vdXRwdXRfcGF0aCwgInciKTsKICAgICAgICBpZiAoIWpzb25fb3V0cHV0KSB7CiAgICAgICAgICAgIGZwcmludGYoc3RkZXJyLCBSRUQgIkVycm9yOiBjYW5ub3Qgd3JpdGUgJXNcbiIgUkVTRVQsIGxvYWRfY29uZmlnLmpzb25fb3V0cHV0X3BhdGgpOwogICAgICAgICAgICByZXR1cm4gMTsKICAgICAgICB9CiAgICAgICAgZnByaW50Zihqc29uX291dHB1dCwgIntcInBoYXNlc1wiOlsiKTsKICAgIH0KCiAgICBwcmludGYoQ1lBTiAiU1lEQiAlcyBMT0FEIEdFTkVSQVRPUlxuIiBSRVNFVCwgZW1iZWRkZWQgPyAiRU1CRURERUQiIDogIkhUVFAiKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgcHJpbnRmKCJUYXJnZXQ6ICIgWUVMTE9XICIlcyIgUkVTRVQgIiAoJXMvJXMpXG4iLCBlbWJlZGRlZCA/IGxvYWRfY29uZmlnLmVtYmVkZGVkX2xpYnJhcnlfcGF0aCA6IHNlcnZlcl91cmwsCiAgICAgICAgICAgbG9hZF9jb25maWcuZGF0YWJhc2UsIGxvYWRfY29uZmlnLmNvbGxlY3Rpb24pOwogICAgaWYgKGxvYWRfY29uZmlnLndvcmtsb2FkX25hbWUpIHsKICAgICAgICBwcmludGYoIldvcmtsb2FkOiAiIFlFTExPVyAiJXMiIFJFU0VUICIsICVzIGRpc3RyaWJ1dGlvblxuIiwKICAgICAgICAgICAgICAgbG9hZF9jb25maWcud29ya2xvYWRfbmFtZSwgbG9hZF9kaXN0cmlidXRpb25fbmFtZXNbbG9hZF9jb25maWcuZGlzdHJpYnV0aW9uXSk7CiAgICB9CiAgICBpZiAoZW1iZWRkZWQpIHsKICAgICAgICBwcmludGYoIlRocmVhZHM6ICVkLCB2YWx1ZSBzaXplOiAlZCBieXRlc1xuIiwgbG9hZF9jb25maWcudGhyZWFkX2NvdW50LCBsb2FkX2NvbmZpZy52YWx1ZV9zaXplKTsKICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKCJUaHJlYWRzOiAlZCwgY29ubmVjdGlvbnM6ICVkLCB2YWx1ZSBzaXplOiAlZCBieXRlc1xuIiwKICAgICAgICAgICAgICAgbG9hZF9jb25maWcudGhyZWFkX2NvdW50LCBsb2FkX2NvbmZpZy5jb25uZWN0aW9uX2NvdW50LCBsb2FkX2NvbmZpZy52YWx1ZV9zaXplKTsKICAgIH0KCiAgICBMYXRlbmN5SGlzdG9ncmFtKiBoaXN0b2dyYW1zID0gY2FsbG9jKExPQURfT1BFUkFUSU9OX0NPVU5ULCBzaXplb2YoTGF0ZW5jeUhpc3RvZ3JhbSkpOwogICAgbG9uZyBsb25nIHRvdGFsc1s1XTsKICAgIGRvdWJsZSBlbGFwc2VkX3NlY29uZHMgPSAwOwogICAgaWYgKCFoaXN0b2dyYW1zKSByZXR1cm4gMTsKCiAgICBib29sIGZpcnN0X3BoYXNlID0gdHJ1ZTsKICAgIGlmIChsb2FkX2NvbmZpZy5wcmVsb2FkX3JlY29yZHMgPiAwKSB7CiAgICAgICAgaW50IHNhdmVkX3dlaWdodHNbTE9BRF9PUEVSQVRJT05fQ09VTlRdOwogICAgICAgIGNoYXIgc2F2ZWRfbWl4WzI1Nl07CiAgICAgICAgbWVtY3B5KHNhdmVkX3dlaWdodHMsIGxvYWRfY29uZmlnLm9wZXJhdGlvbl93ZWlnaHRzLCBzaXplb2Yoc2F2ZWRfd2VpZ2h0cykpOwogICAgICAgIG1lbWNweShzYXZlZF9taXgsIGxvYWRfY29uZmlnLm1peF9kZXNjcmlwdGlvbiwgc2l6ZW9mKHNhdmVkX21peCkpOwogICAgICAgIGxvYWRfcGFyc2VfbWl4KCJpbnNlcnQ9MSIpOwoKICAgICAgICBwcmludGYoIlByZWxvYWRpbmcgJWxsZCByZWNvcmRzLi4uXG4iLCBsb2FkX2NvbmZpZy5wcmVsb2FkX3JlY29yZHMpOwogICAgICAgIGxvYWRfcnVuX3BoYXNlKDAsIGxvYWRfY29uZmlnLnByZWxvYWRfcmVjb3JkcywgaGlzdG9ncmFtcywgdG90YWxzLCAmZWxhcHNlZF9zZWNvbmRzKTsKICAgICAgICBsb2FkX3JlcG9ydCgiTE9BRCBQSEFTRSIsIGhpc3RvZ3JhbXMsIHRvdGFscywgZWxhcHNlZF9zZWNvbmRzLCAwLCBqc29uX291dHB1dCk7CiAgICAgICAgZmlyc3RfcGhhc2UgPSBmYWxzZTsKCiAgICAgICAgbWVtY3B5KGxvYWRfY29uZmlnLm9wZXJhdGlvbl93ZWlnaHRzLCBzYXZlZF93ZWlnaHRzLCBzaXplb2Yoc2F2ZWRfd2VpZ2h0cykpOwogICAgICAgIG1lbWNweShsb2FkX2NvbmZpZy5taXhfZGVzY3JpcHRpb24sIHNhdmVkX21peCwgc2l6ZW9mKHNhdmVkX21peCkpOwogICAgICAgIGxvYWRfY29uZmlnLnRvdGFsX3dlaWdodCA9IDA7CiAgICAgICAgZm9yIChpbnQgb3BlcmF0aW9uID0gMDsgb3BlcmF0aW9uIDwgTE9BRF9PUEVSQVRJT05fQ09VTlQ7IG9wZXJhdGlvbisrKSB7CiAgICAgICAgICAgIGxvYWRfY29uZmlnLnRvdGFsX3dlaWdodCArPSBzYXZlZF93ZWlnaHRzW29wZXJhdGlvbl07CiAgICAgICAgfQogICAgICAgIG1lbXNldChoaXN0b2dyYW1zLCAwLCBMT0FEX09QRVJBVElPTl9DT1VOVCAqIHNpemVvZihMYXRlbmN5SGlzdG9ncmFtKSk7CiAgICB9CgogICAgaWYgKGxvYWRfY29uZmlnLnJhdGVfcGVyX3NlY29uZCA+IDApIHsKICAgICAgICBwcmludGYoIlJ1bm5pbmcgJWRzIG9wZW4tbG9vcCBhdCAlLjBmIHJlcS9zLCBtaXggJXMuLi5cbiIsCiAgICAgICAgICAgICAgIGxvYWRfY29uZmlnLmR1cmF0aW9uX3NlY29uZHMsIGxvYWRfY29uZmlnLnJhdGVfcGVyX3NlY29uZCwgbG9hZF9jb25maWcubWl4X2Rlc2NyaXB0aW9uKTsKICAgIH0gZWxzZSBpZiAobG9hZF9jb25maWcucmVxdWVzdF9saW1pdCA+IDApIHsKICAgICAgICBwcmludGYoIlJ1bm5pbmcgJWxsZCByZXF1ZXN0cyBjbG9zZWQtbG9vcCwgbWl4ICVzLi4uXG4iLCBsb2FkX2NvbmZpZy5yZXF1ZXN0X2xpbWl0LCBsb2FkX2NvbmZpZy5taXhfZGVzY3JpcHRpb24pOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlJ1bm5pbmcgJWRzIGNsb3NlZC1sb29wLCBtaXggJXMuLi5cbiIsIGxvYWRfY29uZmlnLmR1cmF0aW9uX3NlY29uZHMsIGxvYWRfY29uZmlnLm1peF9kZXNjcmlwdGlvbik7CiAgICB9CiAgICBsb2FkX3J1bl9waGFzZShsb2FkX2NvbmZpZy5yYXRlX3Blcl9zZWNvbmQsIGxvYWRfY29uZmlnLnJlcXVlc3RfbGltaXQsIGhpc3RvZ3JhbXMsIHRvdGFscywgJmVsYXBzZWRfc2Vjb25kcyk7CiAgICBpZiAoanNvbl9vdXRwdXQgJiYgIWZpcnN0X3BoYXNlKSBmcHJpbnRmKGpzb25fb3V0cHV0LCAiLCIpOwogICAgbG9hZF9yZXBvcnQoIlJVTiBQSEFTRSIsIGhpc3RvZ3JhbXMsIHRvdGFscywgZWxhcHNlZF9zZWNvbmRzLCBsb2FkX2NvbmZpZy5yYXRlX3Blcl9zZWNvbmQsIGpzb25fb3V0cHV0KTsKCiAgICBpZiAoanNvbl9vdXRwdXQpIHsKICAgICAgICBmcHJpbnRmKGpzb25fb3V0cHV0LCAiXX1cbiIpOwogICAgICAgIGZjbG9zZShqc29uX291dHB1dCk7CiAgICAgICAgcHJpbnRmKCJcblJlc3VsdHMgd3JpdHRlbiB0byAlc1xuIiwgbG9hZF9jb25maWcuanNvbl9vdXRwdXRfcGF0aCk7CiAgICB9CgogICAgaW50IGZhaWxlZCA9IHRvdGFsc1swXSA9PSAwIHx8ICh0b3RhbHNbMV0gKyB0b3RhbHNbMl0gKyB0b3RhbHNbM10pICogMTAgPiB0b3RhbHNbMF07CiAgICBmcmVlKGhpc3RvZ3JhbXMpOwogICAgcmV0dXJuIGZhaWxlZCA/IDEgOiAwOwp9CgovLyA9PT09PT09PT09PT09PT09PT09PSBKUyBDTElFTlQgVEVTVFMgPT09PT09PT09PT09PT09PT09PT0KCi8vIC0tY2xpZW50IHJ1bnMgLl8vU3lEQi5qcyBpdHNlbGYgdW5kZXIgbm9kZS4gRWFjaCBjYXNlIGlzIGFuIEVTIG1vZHVsZSB0aGF0IGdldHMgdGhlIGNsaWVudAovLyBpbXBvcnRlZCBhcyBTeURCLCBydW4gYWZ0ZXIgYW4gb3B0aW9uYWwgc2hlbGwgc2V0dXA7IGl0cyBvdXRwdXQgYW5kIHRoYXQgb2YgYW4gb3B0aW9uYWwKLy8gc2hlbGwgdmVyaWZpY2F0aW9uICgiJXMiIGlzIHRoZSBDTEkgaW4gYm90aCkgbXVzdCBjb250YWluIHRoZSBleHBlY3RlZCB0ZXh0LiBUaGUgY2FzZXMKLy8gc2hhcmUgYSBkYXRhIGRpcmVjdG9yeSB3aXRoIGEgc2VydmVyIHRoZSBzdWl0ZSBzdGFydHMsIHdob3NlIFVSTCBpcyBTWURCX1RFU1RfU0VSVkVSX1VSTDsKLy8gU1lEQl9URVNUX01PQ0tfUE9SVCBpcyBmcmVlIGZvciBjYXNlcyB0aGF0IHJ1biBhIHN0YW5kLWluIHNlcnZlciBvZiB0aGVpciBvd24KCiNkZWZpbmUgQ0xJRU5UX1RFU1RfQkFTRV9ESVJFQ1RPUlkgIi90bXAvc3lkYl90ZXN0X2NsaWVudCIKI2RlZmluZSBDTElFTlRfVEVTVF9TRVJWRVJfUE9SVCAxODQ2NQojZGVmaW5lIENMSUVOVF9URVNUX01PQ0tfUE9SVCAxODQ2NgoKLy8gQSBzdGFuZC1pbiBzZXJ2ZXIgd2hvc2UgYmF0Y2ggcm91dGUgYW5zd2VycyB3aXRoIGJhdGNoX3N0YXR1cyBhbmQgY291bnRzIHRoZSBiYXRjaCBhbmQKLy8gc2luZ2xlIGluc2VydCByZXF1ZXN0cyBpdCBnZXRzCiNkZWZpbmUgQ0xJRU5UX1RFU1RfTU9DS19TRVJWRVIoYmF0Y2hfc3RhdHVzKSBcCiAgICAiaW1wb3J0IGh0dHAgZnJvbSAnaHR0cCc7XG4iIFwKICAgICJsZXQgYmF0Y2hlcyA9IDAsIHNpbmdsZXMgPSAwO1xuIiBcCiAgICAiY29uc3Qgc2VydmVyID0gaHR0cC5jcmVhdGVTZXJ2ZXIoKHJlcXVlc3QsIHJlc3BvbnNlKSA9PiB7XG4iIFwKICAgICIgICAgcmVxdWVzdC5yZXN1bWUoKTtcbiIgXAogICAgIiAgICByZXF1ZXN0Lm9uKCdlbmQnLCAoKSA9PiB7XG4iIFwKICAgICIgICAgICAgIGlmIChyZXF1ZXN0LnVybC5lbmRzV2l0aCgnL2luc3RhbmNlcy9iYXRjaCcpKSB7XG4iIFwKICAgICIgICAgICAgICAgICBiYXRjaGVzKys7XG4iIFwKICAgICIgICAgICAgICAgICByZXNwb25zZS53cml0ZUhlYWQoIiBiYXRjaF9zdGF0dXMgIiwgeyAnQ29udGVudC1UeXBlJzogJ2FwcGxpY2F0aW9uL2pzb24nIH0pO1xuIiBcCiAgICAiICAgICAgICAgICAgcmV0dXJuIHJlc3BvbnNlLmVuZCgne1wic3VjY2Vzc1wiOmZhbHNlLFwiZXJyb3JcIjpcIm1vY2sgYmF0Y2ggZmFpbHVyZVwifScpO1xuIiBcCiAgICAiICAgICAgICB9XG4iIFwKICAgICIgICAgICAgIGlmIChyZXF1ZXN0Lm1ldGhvZCA9PT0gJ1BPU1QnICYmIHJlcXVlc3QudXJsLmVuZHNXaXRoKCcvaW5zdGFuY2VzJykpIHNpbmdsZXMrKztcbiIgXAogICAgIiAgICAgICAgcmVzcG9uc2Uud3JpdGVIZWFkKDIwMCwgeyAnQ29udGVudC1UeXBlJzogJ2FwcGxpY2F0aW9uL2pzb24nIH0pO1xuIiBcCiAgICAiICAgICAgICByZXNwb25zZS5lbmQoJ3tcInN1Y2Nlc3NcIjp0cnVlLFwiaWRcIjpcIm1vY2tcIixcImluc3RhbmNlc1wiOltdLFwiZGF0YWJhc2VzXCI6W119Jyk7XG4iIFwKICAgICIgICAgfSk7XG4iIFwKICAgICJ9KTtcbiIgXAogICAgImF3YWl0IG5ldyBQcm9taXNlKHJlc29sdmUgPT4gc2VydmVyLmxpc3Rlbihwcm9jZXNzLmVudi5TWURCX1RFU1RfTU9DS19QT1JULCAnMTI3LjAuMC4xJywgcmVzb2x2ZSkpO1xuIiBcCiAgICAiYXdhaXQgU3lEQi5Db25uZWN0KCdtb2NrZGInLCBgaHR0cDovLzEyNy4wLjAuMToke3Byb2Nlc3MuZW52LlNZREJfVEVTVF9NT0NLX1BPUlR9YCwgeyB0cmFuc3BvcnQ6ICdodHRwJyB9KTtcbiIKCnR5cGVkZWYgc3RydWN0IHsKICAgIGNvbnN0IGNoYXIgKmRlc2NyaXB0aW9uOwogICAgY29uc3QgY2hhciAqc2V0dXBfY29tbWFuZDsKICAgIGNvbnN0IGNoYXIgKnNjcmlwdDsKICAgIGNvbnN0IGNoYXIgKnZlcmlmaWNhdGlvbl9jb21tYW5kOwogICAgY29uc3QgY2hhciAqZXhwZWN0ZWRfb3V0cHV0Owp9IENsaWVudFRlc3RDYXNlOwoKY2hhciBjbGllbnRfbW9kdWxlX3BhdGhbUEFUSF9NQVhdID0gIiI7CgpwaWRfdCBzdGFydF90ZXN0X3NlcnZlcihjb25zdCBjaGFyICpiYXNlX2RpcmVjdG9yeSwgaW50IHBvcnQpIHsKICAgIGNoYXIgcG9ydF9hcmd1bWVudFsxNl07CiAgICBzbnByaW50Zihwb3J0X2FyZ3VtZW50LCBzaXplb2YocG9ydF9hcmd1bWVudCksICIlZCIsIHBvcnQpOwogICAgCiAgICBwaWRfdCBwaWQgPSBmb3JrKCk7CiAgICBpZiAocGlkID09IC0xKSByZXR1cm4gLTE7CiAgICBpZiAocGlkID09IDApIHsKICAgICAgICBzZXRlbnYoIlNZREJfQkFTRV9ESVIiLCBiYXNlX2RpcmVjdG9yeSwgMSk7CiAgICAgICAgaW50IG51bGxfZGVzY3JpcHRvciA9IG9wZW4oIi9kZXYvbnVsbCIsIE9fV1JPTkxZKTsKICAgICAgICBpZiAobnVsbF9kZXNjcmlwdG9yICE9IC0xKSB7CiAgICAgICAgICAgIGR1cDIobnVsbF9kZXNjcmlwdG9yLCBTVERPVVRfRklMRU5PKTsKICAgICAgICAgICAgZHVwMihudWxsX2Rlc2NyaXB0b3IsIFNUREVSUl9GSUxFTk8pOwogICAgICAgICAgICBjbG9zZShudWxsX2Rlc2NyaXB0b3IpOwogICAgICAgIH0KICAgICAgICBleGVjbHAoY2xpX2NvbW1hbmQsIGNsaV9jb21tYW5kLCAiLS1zZXJ2ZXIiLCBwb3J0X2FyZ3VtZW50LCAoY2hhciAqKU5VTEwpOwogICAgICAgIF9leGl0KDEyNyk7CiAgICB9CiAgICAKICAgIGNoYXIgdXJsWzI1Nl07CiAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiaHR0cDovLzEyNy4wLjAuMTolZC9hcGkvZGF0YWJhc2VzIiwgcG9ydCk7CiAgICBmb3IgKGludCBhdHRlbXB0ID0gMDsgYXR0ZW1wdCA8IDUwOyBhdHRlbXB0KyspIHsKICAgICAgICB1c2xlZXAoMTAwMDAwKTsKICAgICAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJHRVQiLCB1cmwsIE5VTEwsIE5VTEwpOwogICAgICAgIGludCBzdGF0dXNfY29kZSA9IHJlc3BvbnNlID8gcmVzcG9uc2UtPnN0YXR1c19jb2RlIDogMDsKICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUocmVzcG9uc2UpOwogICAgICAgIGlmIChzdGF0dXNfY29kZSA9PSAyMDApIHJldHVybiBwaWQ7CiAgICAgICAgaWYgKHdhaXRwaWQocGlkLCBOVUxMLCBXTk9IQU5HKSA9PSBwaWQpIHJldHVybiAtMTsKICAgIH0KICAgIGtpbGwocGlkLCBTSUdURVJNKTsKICAgIHdhaXRwaWQocGlkLCBOVUxMLCAwKTsKICAgIHJldHVybiAtMTsKfQoKaW50IHJ1bl9jbGllbnRfdGVzdF9jYXNlKGNvbnN0IENsaWVudFRlc3RDYXNlICp0ZXN0LCBpbnQgY2FzZV9udW1iZXIpIHsKICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgdGVzdC0+ZGVzY3JpcHRpb24pOwogICAgZmZsdXNoKHN0ZG91dCk7CiAgICBsb25nIGxvbmcgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgY2hhciBjb21tYW5kWzIwNDhdOwogICAgY2hhciBzY3JpcHRfcGF0aFsyNTZdOwogICAgc25wcmludGYoc2NyaXB0X3BhdGgsIHNpemVvZihzY3JpcHRfcGF0aCksICIlcy9jYXNlXyVkLm1qcyIsIENMSUVOVF9URVNUX0JBU0VfRElSRUNUT1JZLCBjYXNlX251bWJlcik7CiAgICBGSUxFICpzY3JpcHRfZmlsZSA9IGZvcGVuKHNjcmlwdF9wYXRoLCAidyIpOwogICAgaWYgKHNjcmlwdF9maWxlKSB7CiAgICAgICAgZnByaW50ZihzY3JpcHRfZmlsZSwgImltcG9ydCBTeURCIGZyb20gJyVzJztcbiVzIiwgY2xpZW50X21vZHVsZV9wYXRoLCB0ZXN0LT5zY3JpcHQpOwogICAgICAgIGZjbG9zZShzY3JpcHRfZmlsZSk7CiAgICB9CiAgICAKICAgIGNoYXIgb3V0cHV0WzgxOTJdID0gIiI7CiAgICBzaXplX3Qgb3V0cHV0X2xlbmd0aCA9IDA7CiAgICBpbnQgc2V0dXBfb2sgPSAxOwogICAgaWYgKHRlc3QtPnNldHVwX2NvbW1hbmQpIHsKICAgICAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksIHRlc3QtPnNldHVwX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICBzZXR1cF9vayA9IHN5c3RlbShjb21tYW5kKSA9PSAwOwogICAgfQogICAgZm9yIChpbnQgc3RlcCA9IDA7IHN0ZXAgPCAyICYmIHNldHVwX29rOyBzdGVwKyspIHsKICAgICAgICBpZiAoc3RlcCA9PSAwKSB7CiAgICAgICAgICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgIm5vZGUgJXMgMj4mMSIsIHNjcmlwdF9wYXRoKTsKICAgICAgICB9IGVsc2UgaWYgKHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kKSB7CiAgICAgICAgICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgdGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBicmVhazsKICAgICAgICB9CiAgICAgICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgICAgIGlmICghZnApIGJyZWFrOwogICAgICAgIHNpemVfdCByZWFkX2xlbmd0aDsKICAgICAgICB3aGlsZSAob3V0cHV0X2xlbmd0aCA8IHNpemVvZihvdXRwdXQpIC0gMSAmJgogICAgICAgICAgICAgICAocmVhZF9sZW5ndGggPSBmcmVhZChvdXRwdXQgKyBvdXRwdXRfbGVuZ3RoLCAxLCBzaXplb2Yob3V0cHV0KSAtIDEgLSBvdXRwdXRfbGVuZ3RoLCBmcCkpID4gMCkgewogICAgICAgICAgICBvdXRwdXRfbGVuZ3RoICs9IHJlYWRfbGVuZ3RoOwogICAgICAgIH0KICAgICAgICBvdXRwdXRbb3V0cHV0X2xlbmd0aF0gPSAnXDAnOwogICAgICAgIHBjbG9zZShmcCk7CiAgICB9CiAgICAKICAgIGxvbmcgbG9uZyBkdXJhdGlvbiA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICBpbnQgc3VjY2VzcyA9IHNjcmlwdF9maWxlICYmIHNldHVwX29rICYmIHN0cnN0cihvdXRwdXQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCkgIT0gTlVMTDsKICAgIGlmIChzdWNjZXNzKSB7CiAgICAgICAgcHJpbnRmKCJbIiBHUkVFTiAiUEFTUyIgUkVTRVQgIl0gJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCBkdXJhdGlvbiwgUkVTRVQpOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl0gJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCBkdXJhdGlvbiwgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgRXhwZWN0ZWQ6ICVzXG4gIEdvdDogJXNcbiIgUkVTRVQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCwgb3V0cHV0KTsKICAgIH0KICAgIHJldHVybiBzdWNjZXNzOwp9CgppbnQgcnVuX2NsaWVudF90ZXN0cygpIHsKICAgIENsaWVudFRlc3RDYXNlIGNsaWVudF90ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIk5hdGl2ZSB0cmFuc3BvcnQgd3JpdGVzIHRocm91Z2ggdGhlIGVuZ2luZSBpbi1wcm9jZXNzIiwKICAgICAgICAgICAgTlVMTCwKICAgICAgICAgICAgImNvbnN0IGRiID0gYXdhaXQgU3lEQi5Db25uZWN0KCdjbGllbnRkYicsICdodHRwOi8vbG9jYWxob3N0OjgwODAnLCB7IHRyYW5zcG9ydDogJ25hdGl2ZScgfSk7XG4iCiAgICAgICAgICAgICJhd2FpdCBTeURCLmNyZWF0ZUNvbGxlY3Rpb24oJ2NsaWVudGRiJywgJ25vdGVzJywgW3sgbmFtZTogJ3RpdGxlJywgdHlwZTogJ3N0cmluZycsIHJlcXVpcmVkOiB0cnVlIH0sIHsgbmFtZTogJ3JhbmsnLCB0eXBlOiAnaW50JyB9XSk7XG4iCiAgICAgICAgICAgICJjb25zdCBpbnNlcnRlZCA9IGF3YWl0IFN5REIuaW5zZXJ0SW5zdGFuY2UoJ2NsaWVudGRiJywgJ25vdGVzJywgeyB0aXRsZTogJ25hdGl2ZScsIHJhbms6IDEgfSk7XG4iCiAgICAgICAgICAgICJjb25zdCB1cGRhdGVkID0gYXdhaXQgU3lEQi51cGRhdGVJbnN0YW5jZSgnY2xpZW50ZGInLCAnbm90ZXMnLCBpbnNlcnRlZC5pZCwgeyByYW5rOiAyIH0pO1xuIgogICAgICAgICAgICAiY29uc29sZS5sb2coYFske2RiLnRyYW5zcG9ydH0vJHtpbnNlcnRlZC5zdWNjZXNzfS8ke3VwZGF0ZWQuc3VjY2Vzc31dYCk7XG4iCiAgICAgICAgICAgICJwcm9jZXNzLmV4aXQoMCk7XG4iLAogICAgICAgICAgICAiJXMgZmluZCBjbGllbnRkYiBub3RlcyAtLXdoZXJlIFwicmFuazoyXCIgfCBncmVwIC1jICdcInRpdGxlXCI6XCJuYXRpdmVcIicgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiW25hdGl2ZS90cnVlL3RydWVdXG5bMV0iCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJOYXRpdmUgdHJhbnNwb3J0IHJlYWRzIGFuZCBkZWxldGVzIHJlY29yZHMgd3JpdHRlbiBieSB0aGUgQ0xJIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSBjbGllbnRkYiBub3RlcyAtLWluc2VydC1vbmUgLS10aXRsZS1cImNsaVwiIC0tcmFuay01ID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiYXdhaXQgU3lEQi5Db25uZWN0KCdjbGllbnRkYicsICdodHRwOi8vbG9jYWxob3N0OjgwODAnLCB7IHRyYW5zcG9ydDogJ25hdGl2ZScgfSk7XG4iCiAgICAgICAgICAgICJjb25zdCBmb3VuZCA9IGF3YWl0IFN5REIubGlzdEluc3RhbmNlcygnY2xpZW50ZGInLCAnbm90ZXMnLCAndGl0bGU6Y2xpJyk7XG4iCiAgICAgICAgICAgICJjb25zdCBkZWxldGVkID0gYXdhaXQgU3lEQi5kZWxldGVJbnN0YW5jZSgnY2xpZW50ZGInLCAnbm90ZXMnLCBmb3VuZC5pbnN0YW5jZXNbMF0uX2lkKTtcbiIKICAgICAgICAgICAgImNvbnNvbGUubG9nKGBbJHtmb3VuZC5pbnN0YW5jZXMubGVuZ3RofS8ke2RlbGV0ZWQuc3VjY2Vzc31dYCk7XG4iCiAgICAgICAgICAgICJwcm9jZXNzLmV4aXQoMCk7XG4iLAogICAgICAgICAgICAiJXMgbGlzdCBjbGllbnRkYiBub3RlcyB8IGdyZXAgLWMgJ1wiX2lkXCInIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgIlsxL3RydWVdXG5bMV0iCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJOYXRpdmUgaGFuZGxlcyBvbiB0d28gZGF0YSBkaXJlY3RvcmllcyBrZWVwIHRoZWlyIHJlY29yZHMgYXBhcnQiLAogICAgICAgICAgICAicm0gLXJmICIgQ0xJRU5UX1RFU1RfQkFTRV9ESVJFQ1RPUlkgIi1vdGhlciIsCiAgICAgICAgICAgICJjb25zdCBtYWluID0gcHJvY2Vzcy5lbnYuU1lEQl9CQVNFX0RJUjtcbiIKICAgICAgICAgICAgImNvbnN0IHNjaGVtYSA9IFt7IG5hbWU6ICd0aXRsZScsIHR5cGU6ICdzdHJpbmcnLCByZXF1aXJlZDogdHJ1ZSB9XTtcbiIKICAgICAgICAgICAgIi8vIEVhY2ggaGFuZGxlIGtlZXBzIHRoZSBkaXJlY3RvcnkgaXQgd2FzIG9wZW5lZCBvbiwgd2hhdGV2ZXIgU1lEQl9CQVNFX0RJUiBzYXlzIGxhdGVyXG4iCiAgICAgICAgICAgICJjb25zdCBvcGVuID0gYXN5bmMgKGRpcmVjdG9yeSkgPT4ge1xuIgogICAgICAgICAgICAiICBwcm9jZXNzLmVudi5TWURCX0JBU0VfRElSID0gZGlyZWN0b3J5O1xuIgogICAgICAgICAgICAiICBhd2FpdCBTeURCLkNvbm5lY3QoJ3R3b2RiJywgJ2h0dHA6Ly9sb2NhbGhvc3Q6ODA4MCcsIHsgdHJhbnNwb3J0OiAnbmF0aXZlJyB9KTtcbiIKICAgICAgICAgICAgIiAgcHJvY2Vzcy5lbnYuU1lEQl9CQVNFX0RJUiA9IG1haW47XG4iCiAgICAgICAgICAgICJ9O1xuIgogICAgICAgICAgICAiYXdhaXQgb3BlbihgJHttYWlufS1vdGhlcmApO1xuIgogICAgICAgICAgICAiYXdhaXQgU3lEQi5jcmVhdGVDb2xsZWN0aW9uKCd0d29kYicsICdub3RlcycsIHNjaGVtYSk7XG4iCiAgICAgICAgICAgICJhd2FpdCBTeURCLmluc2VydEluc3RhbmNlKCd0d29kYicsICdub3RlcycsIHsgdGl0bGU6ICdvMScgfSk7XG4iCiAgICAgICAgICAgICJhd2FpdCBvcGVuKG1haW4pO1xuIgogICAgICAgICAgICAiYXdhaXQgU3lEQi5jcmVhdGVDb2xsZWN0aW9uKCd0d29kYicsICdub3RlcycsIHNjaGVtYSk7XG4iCiAgICAgICAgICAgICJhd2FpdCBTeURCLmluc2VydEluc3RhbmNlKCd0d29kYicsICdub3RlcycsIHsgdGl0bGU6ICdtMScgfSk7XG4iCiAgICAgICAgICAgICJhd2FpdCBTeURCLmluc2VydEluc3RhbmNlKCd0d29kYicsICdub3RlcycsIHsgdGl0bGU6ICdtMicgfSk7XG4iCiAgICAgICAgICAgICJjb25zdCBpbk1haW4gPSBhd2FpdCBTeURCLmxpc3RJbnN0YW5jZXMoJ3R3b2RiJywgJ25vdGVzJyk7XG4iCiAgICAgICAgICAgICJhd2FpdCBvcGVuKGAke21haW59LW90aGVyYCk7XG4iCiAgICAgICAgICAgICJjb25zdCBpbk90aGVyID0gYXdhaXQgU3lEQi5saXN0SW5zdGFuY2VzKCd0d29kYicsICdub3RlcycpO1xuIgogICAgICAgICAgICAiY29uc29sZS5sb2coYFske2luTWFpbi5pbnN0YW5jZXMubGVuZ3RofS8ke2luT3RoZXIuaW5zdGFuY2VzLmxlbmd0aH1dYCk7XG4iCiAgICAgICAgICAgICJwcm9jZXNzLmV4aXQoMCk7XG4iLAogICAgICAgICAgICAiJXMgbGlzdCB0d29kYiBub3RlcyB8IGdyZXAgLWMgJ1wiX2lkXCInIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgIlsyLzFdXG5bMl0iCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJBdXRvIHRyYW5zcG9ydCBzaGFyZXMgYSBsb2NhbCBzZXJ2ZXIncyBmaWxlcywgbWVtb3J5IGNvbGxlY3Rpb25zIHN0YXkgb24gSFRUUCIsCiAgICAgICAgICAgIE5VTEwsCiAgICAgICAgICAgICJjb25zdCB1cmwgPSBwcm9jZXNzLmVudi5TWURCX1RFU1RfU0VSVkVSX1VSTDtcbiIKICAgICAgICAgICAgImNvbnN0IGRiID0gYXdhaXQgU3lEQi5Db25uZWN0KCdjbGllbnRkYicsIHVybCk7XG4iCiAgICAgICAgICAgICJhd2FpdCBTeURCLmNyZWF0ZUNvbGxlY3Rpb24oJ2NsaWVudGRiJywgJ2NhY2hlJywgW3sgbmFtZTogJ2tleScsIHR5cGU6ICdzdHJpbmcnLCByZXF1aXJlZDogdHJ1ZSB9XSwgeyBlbmdpbmU6ICdtZW1vcnknIH0pO1xuIgogICAgICAgICAgICAiY29uc3QgY2FjaGVkID0gYXdhaXQgU3lEQi5pbnNlcnRJbnN0YW5jZSgnY2xpZW50ZGInLCAnY2FjaGUnLCB7IGtleTogJ20xJyB9KTtcbiIKICAgICAgICAgICAgImNvbnN0IHNlcnZlZCA9IGF3YWl0IChhd2FpdCBmZXRjaChgJHt1cmx9L2FwaS9kYXRhYmFzZXMvY2xpZW50ZGIvY29sbGVjdGlvbnMvY2FjaGUvaW5zdGFuY2VzYCkpLmpzb24oKTtcbiIKICAgICAgICAgICAgImNvbnN0IGZpbGVkID0gYXdhaXQgU3lEQi5pbnNlcnRJbnN0YW5jZSgnY2xpZW50ZGInLCAnbm90ZXMnLCB7IHRpdGxlOiAnYXV0bycsIHJhbms6IDMgfSk7XG4iCiAgICAgICAgICAgICJjb25zdCBsaXN0ZWQgPSBhd2FpdCAoYXdhaXQgZmV0Y2goYCR7dXJsfS9hcGkvZGF0YWJhc2VzL2NsaWVudGRiL2NvbGxlY3Rpb25zL25vdGVzL2luc3RhbmNlcz9xdWVyeT10aXRsZTphdXRvYCkpLmpzb24oKTtcbiIKICAgICAgICAgICAgImNvbnNvbGUubG9nKGBbJHtkYi50cmFuc3BvcnR9LyR7Y2FjaGVkLnN1Y2Nlc3N9LyR7c2VydmVkLmluc3RhbmNlcy5sZW5ndGh9LyR7ZmlsZWQuc3VjY2Vzc30vJHtsaXN0ZWQuaW5zdGFuY2VzLmxlbmd0aH1dYCk7XG4iCiAgICAgICAgICAgICJwcm9jZXNzLmV4aXQoMCk7XG4iLAogICAgICAgICAgICBOVUxMLAogICAgICAgICAgICAiW25hdGl2ZS90cnVlLzEvdHJ1ZS8xXSIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkNvbmN1cnJlbnQgaW5zZXJ0cywgcmVhZHMgYW5kIGRlbGV0ZXMgc2hhcmUgYmF0Y2ggcmVxdWVzdHMiLAogICAgICAgICAgICBOVUxMLAogICAgICAgICAgICAiYXdhaXQgU3lEQi5Db25uZWN0KCdjbGllbnRkYicsIHByb2Nlc3MuZW52LlNZREJfVEVTVF9TRVJWRVJfVVJMLCB7IHRyYW5zcG9ydDogJ2h0dHAnIH0pO1xuIgogICAgICAgICAgICAiY29uc3QgY3JlYXRlZCA9IGF3YWl0IFByb21pc2UuYWxsKEFycmF5LmZyb20oeyBsZW5ndGg6IDIwIH0sIChfLCBpKSA9PiBTeURCLmluc2VydEluc3RhbmNlKCdjbGllbnRkYicsICdub3RlcycsIHsgdGl0bGU6IGBiYXRjaCR7aX1gLCByYW5rOiAxMDAgKyBpIH0pKSk7XG4iCiAgICAgICAgICAgICJjb25zdCBmZXRjaGVkID0gYXdhaXQgUHJvbWlzZS5hbGwoY3JlYXRlZC5tYXAocmVzdWx0ID0+IFN5REIubGlzdEluc3RhbmNlcygnY2xpZW50ZGInLCAnbm90ZXMnLCBgX2lkOiR7cmVzdWx0LmlkfWApKSk7XG4iCiAgICAgICAgICAgICJjb25zdCBkZWxldGVkID0gYXdhaXQgUHJvbWlzZS5hbGwoY3JlYXRlZC5tYXAocmVzdWx0ID0+IFN5REIuZGVsZXRlSW5zdGFuY2UoJ2NsaWVudGRiJywgJ25vdGVzJywgcmVzdWx0LmlkKSkpO1xuIgogICAgICAgICAgICAiY29uc3QgY291bnQgPSByZXN1bHRzID0+IHJlc3VsdHMuZmlsdGVyKHJlc3VsdCA9PiByZXN1bHQuc3VjY2VzcyAmJiAoIXJlc3VsdC5pbnN0YW5jZXMgfHwgcmVzdWx0Lmluc3RhbmNlcy5sZW5ndGggPT09IDEpKS5sZW5ndGg7XG4iCiAgICAgICAgICAgICJjb25zb2xlLmxvZyhgWyR7U3lEQi5iYXRjaGluZ30vJHtjb3VudChjcmVhdGVkKX0vJHtjb3VudChmZXRjaGVkKX0vJHtjb3VudChkZWxldGVkKX1dYCk7XG4iCiAgICAgICAgICAgICJwcm9jZXNzLmV4aXQoMCk7XG4iLAogICAgICAgICAgICAiJXMgZmluZCBjbGllbnRkYiBub3RlcyAtLXdoZXJlIFwicmFuaz49MTAwXCIgfCBncmVwIC1jICdcIl9pZFwiJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbdHJ1ZS8yMC8yMC8yMF1cblswXSIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIk5vIGJhdGNoIHJvdXRlIG9uIHRoZSBzZXJ2ZXI6IHJlcGxheSBvbmUgYnkgb25lLCB0aGVuIHN0b3AgYmF0Y2hpbmciLAogICAgICAgICAgICBOVUxMLAogICAgICAgICAgICBDTElFTlRfVEVTVF9NT0NLX1NFUlZFUigiNDA0IikKICAgICAgICAgICAgImNvbnN0IGZpcnN0ID0gYXdhaXQgUHJvbWlzZS5hbGwoWzEsIDIsIDNdLm1hcChuID0+IFN5REIuaW5zZXJ0SW5zdGFuY2UoJ21vY2tkYicsICdpdGVtcycsIHsgbiB9KSkpO1xuIgogICAgICAgICAgICAiY29uc3Qgc2Vjb25kID0gYXdhaXQgUHJvbWlzZS5hbGwoWzQsIDVdLm1hcChuID0+IFN5REIuaW5zZXJ0SW5zdGFuY2UoJ21vY2tkYicsICdpdGVtcycsIHsgbiB9KSkpO1xuIgogICAgICAgICAgICAiY29uc29sZS5sb2coYFske2JhdGNoZXN9LyR7c2luZ2xlc30vJHtbLi4uZmlyc3QsIC4uLnNlY29uZF0uZXZlcnkocmVzdWx0ID0+IHJlc3VsdC5zdWNjZXNzKX0vJHtTeURCLmJhdGNoaW5nfV1gKTtcbiIKICAgICAgICAgICAgInByb2Nlc3MuZXhpdCgwKTtcbiIsCiAgICAgICAgICAgIE5VTEwsCiAgICAgICAgICAgICJbMS81L3RydWUvZmFsc2VdIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiRmFpbGVkIGJhdGNoOiB3cml0ZXMgcmVwb3J0IHRoZSBiYXRjaCdzIGVycm9yIGFuZCBhcmUgbm90IHJlcGxheWVkIiwKICAgICAgICAgICAgTlVMTCwKICAgICAgICAgICAgQ0xJRU5UX1RFU1RfTU9DS19TRVJWRVIoIjUwMCIpCiAgICAgICAgICAgICJjb25zdCByZXN1bHRzID0gYXdhaXQgUHJvbWlzZS5hbGwoWzEsIDIsIDNdLm1hcChuID0+IFN5REIuaW5zZXJ0SW5zdGFuY2UoJ21vY2tkYicsICdpdGVtcycsIHsgbiB9KSkpO1xuIgogICAgICAgICAgICAiY29uc3QgcmVwb3J0ZWQgPSByZXN1bHRzLmZpbHRlcihyZXN1bHQgPT4gIXJlc3VsdC5zdWNjZXNzICYmIHJlc3VsdC5lcnJvci5pbmNsdWRlcygnbW9jayBiYXRjaCBmYWlsdXJlJykpLmxlbmd0aDtcbiIKICAgICAgICAgICAgImNvbnNvbGUubG9nKGBbJHtiYXRjaGVzfS8ke3NpbmdsZXN9LyR7cmVwb3J0ZWR9XWApO1xuIgogICAgICAgICAgICAicHJvY2Vzcy5leGl0KDApO1xuIiwKICAgICAgICAgICAgTlVMTCwKICAgICAgICAgICAgIlsxLzAvM10iCiAgICAgICAgfQogICAgfTsKICAgIGludCB0ZXN0X2NvdW50ID0gc2l6ZW9mKGNsaWVudF90ZXN0cykgLyBzaXplb2YoY2xpZW50X3Rlc3RzWzBdKTsKICAgIAogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICJybSAtcmYgJXMgJiYgbWtkaXIgLXAgJXMiLCBDTElFTlRfVEVTVF9CQVNFX0RJUkVDVE9SWSwgQ0xJRU5UX1RFU1RfQkFTRV9ESVJFQ1RPUlkpOwogICAgc3lzdGVtKGNvbW1hbmQpOwogICAgc2V0ZW52KCJTWURCX0JBU0VfRElSIiwgQ0xJRU5UX1RFU1RfQkFTRV9ESVJFQ1RPUlksIDEpOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAiaHR0cDovLzEyNy4wLjAuMTolZCIsIENMSUVOVF9URVNUX1NFUlZFUl9QT1JUKTsKICAgIHNldGVudigiU1lEQl9URVNUX1NFUlZFUl9VUkwiLCBjb21tYW5kLCAxKTsKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgIiVkIiwgQ0xJRU5UX1RFU1RfTU9DS19QT1JUKTsKICAgIHNldGVudigiU1lEQl9URVNUX01PQ0tfUE9SVCIsIGNvbW1hbmQsIDEpOwogICAgCiAgICBwcmludGYoQ1lBTiAiU1lEQiBKUyBDTElFTlQgVEVTVCBTVUlURVxuIiBSRVNFVCk7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIHByaW50ZigiQ2xpZW50OiAiIFlFTExPVyAiJXMiIFJFU0VUICJcbiIsIGNsaWVudF9tb2R1bGVfcGF0aCk7CiAgICBwaWRfdCBzZXJ2ZXJfcGlkID0gc3RhcnRfdGVzdF9zZXJ2ZXIoQ0xJRU5UX1RFU1RfQkFTRV9ESVJFQ1RPUlksIENMSUVOVF9URVNUX1NFUlZFUl9QT1JUKTsKICAgIGlmIChzZXJ2ZXJfcGlkID09IC0xKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiRXJyb3I6IENvdWxkIG5vdCBzdGFydCBhIHNlcnZlciBvbiBwb3J0ICVkXG4iIFJFU0VULCBDTElFTlRfVEVTVF9TRVJWRVJfUE9SVCk7CiAgICAgICAgcmV0dXJuIDE7CiAgICB9CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCB0ZXN0X2NvdW50OyBpKyspIHsKICAgICAgICBpZiAocnVuX2NsaWVudF90ZXN0X2Nhc2UoJmNsaWVudF90ZXN0c1tpXSwgaSArIDEpKSBwYXNzZWQrKzsKICAgIH0KICAgIGtpbGwoc2VydmVyX3BpZCwgU0lHVEVSTSk7CiAgICB3YWl0cGlkKHNlcnZlcl9waWQsIE5VTEwsIDApOwogICAgCiAgICBwcmludGYoIlxuIiBZRUxMT1cgIkpTIGNsaWVudCB0ZXN0czogJWQvJWQgcGFzc2VkXG4iIFJFU0VULCBwYXNzZWQsIHRlc3RfY291bnQpOwogICAgcmV0dXJuIHBhc3NlZCA9PSB0ZXN0X2NvdW50ID8gMCA6IDE7Cn0KCnZvaWQgcHJpbnRfdXNhZ2UoY29uc3QgY2hhciAqcHJvZ3JhbV9uYW1lKSB7CiAgICBwcmludGYoIlVzYWdlOiAlcyBbT1BUSU9OU11cbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIk9wdGlvbnM6XG4iKTsKICAgIHByaW50ZigiICAtLWNsaSAgICAgICAgICAgVXNlIGdsb2JhbCAnc3lkYicgY29tbWFuZCBpbnN0ZWFkIG9mICcuL3N5ZGInXG4iKTsKICAgIHByaW50ZigiICAtLXNlcnZlciAgICAgICAgVGVzdCBIVFRQIEFQSSBlbmRwb2ludHMgKHJlcXVpcmVzIHJ1bm5pbmcgc2VydmVyKVxuIik7CiAgICBwcmludGYoIiAgLS11cmwgVVJMICAgICAgIFNwZWNpZnkgc2VydmVyIFVSTCAoZGVmYXVsdDogaHR0cDovL2xvY2FsaG9zdDo4MDgwKVxuIik7CiAgICBwcmludGYoIiAgLS12ZXJib3NlICAgICAgIEVuYWJsZSBleHRyZW1lbHkgZGV0YWlsZWQgbG9nZ2luZyBmb3IgdGVzdCBmYWlsdXJlc1xuIik7CiAgICBwcmludGYoIiAgLS1sb2FkICAgICAgICAgIFJ1biB0aGUgSFRUUCBsb2FkIGdlbmVyYXRvciBhZ2FpbnN0IGEgcnVubmluZyBzZXJ2ZXJcbiIpOwogICAgcHJpbnRmKCIgIC0tY2xpZW50IEZJTEUgICBSdW4gdGhlIEpTIGNsaWVudCB0ZXN0cyB3aXRoIG5vZGUgYWdhaW5zdCBGSUxFICguXy9TeURCLmpzKVxuIik7CiAgICBwcmludGYoIiAgLS1oZWxwLCAtaCAgICAgIFNob3cgdGhpcyBoZWxwIG1lc3NhZ2VcbiIpOwogICAgcHJpbnRmKCJcbkxvYWQgZ2VuZXJhdG9yIG9wdGlvbnM6XG4iKTsKICAgIHByaW50ZigiICAtLXRocmVhZHMgTiAgICAgICBXb3JrZXIgdGhyZWFkcyAoZGVmYXVsdDogNClcbiIpOwogICAgcHJpbnRmKCIgIC0tY29ubmVjdGlvbnMgTiAgIENvbmN1cnJlbnQgY29ubmVjdGlvbnMgKGRlZmF1bHQ6IDMyKVxuIik7CiAgICBwcmludGYoIiAgLS1kdXJhdGlvbiBTICAgICAgUnVuIHBoYXNlIGxlbmd0aCBpbiBzZWNvbmRzIChkZWZhdWx0OiAxMClcbiIpOwogICAgcHJpbnRmKCIgIC0tcmVxdWVzdHMgTiAgICAgIFN0b3AgYWZ0ZXIgTiByZXF1ZXN0cyBpbnN0ZWFkIG9mIGEgZHVyYXRpb25cbiIpOwogICAgcHJpbnRmKCIgIC0tcmF0ZSBSICAgICAgICAgIE9wZW4tbG9vcCBjb25zdGFudCByYXRlIGluIHJlcXVlc3RzL3MgKGRlZmF1bHQ6IGNsb3NlZCBsb29wKVxuIik7CiAgICBwcmludGYoIiAgLS1taXggU1BFQyAgICAgICAgT3BlcmF0aW9uIHdlaWdodHMsIGUuZy4gZ2V0PTgwLGluc2VydD0xMCx1cGRhdGU9NSxxdWVyeT01XG4iKTsKICAgIHByaW50ZigiICAgICAgICAgICAgICAgICAgICAob3BlcmF0aW9uczogZ2V0IGluc2VydCB1cGRhdGUgZGVsZXRlIHF1ZXJ5IGxpc3Qgc2NhbiBybXcpXG4iKTsKICAgIHByaW50ZigiICAtLXdvcmtsb2FkIFcgICAgICBZQ1NCIHByZXNldCBhLWY6IGEgdXBkYXRlIGhlYXZ5LCBiIHJlYWQgbW9zdGx5LCBjIHJlYWQgb25seSxcbiIpOwogICAgcHJpbnRmKCIgICAgICAgICAgICAgICAgICAgIGQgcmVhZCBsYXRlc3QsIGUgc2hvcnQgcmFuZ2VzLCBmIHJlYWQtbW9kaWZ5LXdyaXRlXG4iKTsKICAgIHByaW50ZigiICAtLWRpc3RyaWJ1dGlvbiBEICBLZXkgY2hvaWNlOiB1bmlmb3JtLCB6aXBmaWFuIG9yIGxhdGVzdCAoZGVmYXVsdDogdW5pZm9ybSlcbiIpOwogICAgcHJpbnRmKCIgIC0temlwZi10aGV0YSBUICAgIFppcGZpYW4gc2tldyAoZGVmYXVsdDogMC45OSlcbiIpOwogICAgcHJpbnRmKCIgIC0tcmVjb3JkcyBOICAgICAgIFNhbWUgYXMgLS1wcmVsb2FkXG4iKTsKICAgIHByaW50ZigiICAtLW9wZXJhdGlvbnMgTiAgICBTYW1lIGFzIC0tcmVxdWVzdHNcbiIpOwogICAgcHJpbnRmKCIgIC0tZW1iZWRkZWQgTElCICAgIFJ1biBpbi1wcm9jZXNzIHRocm91Z2ggbGlic3lkYi5zbyBpbnN0ZWFkIG9mIEhUVFBcbiIpOwogICAgcHJpbnRmKCIgIC0tYmFzZS1kaXIgRElSICAgIERhdGEgZGlyZWN0b3J5IGZvciAtLWVtYmVkZGVkIChkZWZhdWx0OiBTWURCX0JBU0VfRElSKVxuIik7CiAgICBwcmludGYoIiAgLS1wcmVsb2FkIE4gICAgICAgSW5zZXJ0IE4gcmVjb3JkcyBpbiBhIGxvYWQgcGhhc2UgZmlyc3QgKGRlZmF1bHQ6IDEwMDApXG4iKTsKICAgIHByaW50ZigiICAtLXZhbHVlLXNpemUgQiAgICBBcHByb3hpbWF0ZSBkb2N1bWVudCBzaXplIGluIGJ5dGVzIChkZWZhdWx0OiAyNTYpXG4iKTsKICAgIHByaW50ZigiICAtLWRhdGFiYXNlIE5BTUUgICBEYXRhYmFzZSB0byB1c2UgKGRlZmF1bHQ6IGxvYWR0ZXN0KVxuIik7CiAgICBwcmludGYoIiAgLS1jb2xsZWN0aW9uIE5BTUUgQ29sbGVjdGlvbiB0byB1c2UgKGRlZmF1bHQ6IGl0ZW1zKVxuIik7CiAgICBwcmludGYoIiAgLS1qc29uIEZJTEUgICAgICAgV3JpdGUgbWFjaGluZS1yZWFkYWJsZSByZXN1bHRzIHRvIEZJTEVcbiIpOwogICAgcHJpbnRmKCIgICAgICAgICAgICAgICAgICAgICh3b3JrbG9hZCBydW5zIGRlZmF1bHQgdG8geWNzYl88dz5fPHRpbWU+Lmpzb24pXG4iKTsKICAgIHByaW50ZigiXG5FeGFtcGxlczpcbiIpOwogICAgcHJpbnRmKCIgICVzICAgICAgICAgICAgICAgICAgICAgICMgQ0xJIHRlc3RzIHdpdGggLi9zeWRiXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tY2xpICAgICAgICAgICAgICAgICMgQ0xJIHRlc3RzIHdpdGggZ2xvYmFsICdzeWRiJ1xuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLXNlcnZlciAgICAgICAgICAgICAjIEhUVFAgQVBJIHRlc3RzXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tc2VydmVyIC0tdXJsIGh0dHA6Ly9sb2NhbGhvc3Q6ODA4MCAgIyBDdXN0b20gc2VydmVyIFVSTFxuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLXZlcmJvc2UgICAgICAgICAgICAjIENMSSB0ZXN0cyB3aXRoIGRldGFpbGVkIGZhaWx1cmUgbG9nZ2luZ1xuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLXNlcnZlciAtLXZlcmJvc2UgICAjIEhUVFAgdGVzdHMgd2l0aCBkZXRhaWxlZCBmYWlsdXJlIGxvZ2dpbmdcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1sb2FkIC0tY29ubmVjdGlvbnMgNjQgLS1kdXJhdGlvbiAzMCAtLW1peCBnZXQ9OTAsaW5zZXJ0PTEwXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tbG9hZCAtLXJhdGUgMjAwMCAtLWR1cmF0aW9uIDYwIC0tanNvbiByZXN1bHRzLmpzb25cbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1sb2FkIC0td29ya2xvYWQgYSAtLXJlY29yZHMgMTAwMDAwIC0tb3BlcmF0aW9ucyAxMDAwMDAwXG4iLCBwcm9ncmFtX25hbWUpOwogICAgcHJpbnRmKCIgICVzIC0tbG9hZCAtLXdvcmtsb2FkIGMgLS1lbWJlZGRlZCAuL2xpYnN5ZGIuc28gLS1iYXNlLWRpciAvdG1wL3ljc2JcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1jbGllbnQgLi4vU3lEQi5qcyAgICMgSlMgY2xpZW50IHRlc3RzIChzdGFydHMgaXRzIG93biBzZXJ2ZXIpXG4iLCBwcm9ncmFtX25hbWUpOwp9CgppbnQgbWFpbihpbnQgYXJnYywgY2hhciAqYXJndltdKSB7CiAgICBsb2FkX2NvbmZpZy50aHJlYWRfY291bnQgPSA0OwogICAgbG9hZF9jb25maWcuY29ubmVjdGlvbl9jb3VudCA9IDMyOwogICAgbG9hZF9jb25maWcuZHVyYXRpb25fc2Vjb25kcyA9IDEwOwogICAgbG9hZF9jb25maWcudmFsdWVfc2l6ZSA9IDI1NjsKICAgIGxvYWRfY29uZmlnLnByZWxvYWRfcmVjb3JkcyA9IDEwMDA7CiAgICBzdHJjcHkobG9hZF9jb25maWcuZGF0YWJhc2UsICJsb2FkdGVzdCIpOwogICAgc3RyY3B5KGxvYWRfY29uZmlnLmNvbGxlY3Rpb24sICJpdGVtcyIpOwogICAgbG9hZF9jb25maWcuemlwZmlhbl9jb25zdGFudCA9IExPQURfREVGQVVMVF9aSVBGSUFOX0NPTlNUQU5UOwogICAgbG9hZF9wYXJzZV9taXgoImdldD04MCxpbnNlcnQ9MTAsdXBkYXRlPTUscXVlcnk9NSIpOwoKICAgIGZvciAoaW50IGkgPSAxOyBpIDwgYXJnYzsgaSsrKSB7CiAgICAgICAgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1jbGkiKSA9PSAwKSB7CiAgICAgICAgICAgIHN0cmNweShjbGlfY29tbWFuZCwgInN5ZGIiKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1zZXJ2ZXIiKSA9PSAwKSB7CiAgICAgICAgICAgIHRlc3RfbW9kZSA9IDE7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tbG9hZCIpID09IDApIHsKICAgICAgICAgICAgdGVzdF9tb2RlID0gMjsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1jbGllbnQiKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICB0ZXN0X21vZGUgPSAzOwogICAgICAgICAgICBpZiAoIXJlYWxwYXRoKGFyZ3ZbKytpXSwgY2xpZW50X21vZHVsZV9wYXRoKSkgewogICAgICAgICAgICAgICAgZnByaW50ZihzdGRlcnIsIFJFRCAiRXJyb3I6IGNhbm5vdCBmaW5kICVzXG4iIFJFU0VULCBhcmd2W2ldKTsKICAgICAgICAgICAgICAgIHJldHVybiAxOwogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tdGhyZWFkcyIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIGxvYWRfY29uZmlnLnRocmVhZF9jb3VudCA9IGF0b2koYXJndlsrK2ldKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1jb25uZWN0aW9ucyIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIGxvYWRfY29uZmlnLmNvbm5lY3Rpb25fY291bnQgPSBhdG9pKGFyZ3ZbKytpXSk7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tZHVyYXRpb24iKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBsb2FkX2NvbmZpZy5kdXJhdGlvbl9zZWNvbmRzID0gYXRvaShhcmd2WysraV0pOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLXJlcXVlc3RzIikgPT0gMCAmJiBpICsgMSA8IGFyZ2MpIHsKICAgICAgICAgICAgbG9hZF9jb25maWcucmVxdWVzdF9saW1pdCA9IGF0b2xsKGFyZ3ZbKytpXSk7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tcmF0ZSIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIGxvYWRfY29uZmlnLnJhdGVfcGVyX3NlY29uZCA9IGF0b2YoYXJndlsrK2ldKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS13b3JrbG9hZCIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIGNvbnN0IGNoYXIqIG5hbWUgPSBhcmd2WysraV07CiAgICAgICAgICAgIGludCBwcmVzZXQgPSAwOwogICAgICAgICAgICB3aGlsZSAocHJlc2V0IDwgTE9BRF9XT1JLTE9BRF9QUkVTRVRfQ09VTlQgJiYgc3RyY2FzZWNtcChuYW1lLCBsb2FkX3dvcmtsb2FkX3ByZXNldHNbcHJlc2V0XS5uYW1lKSAhPSAwKSBwcmVzZXQrKzsKICAgICAgICAgICAgaWYgKHByZXNldCA9PSBMT0FEX1dPUktMT0FEX1BSRVNFVF9DT1VOVCkgewogICAgICAgICAgICAgICAgZnByaW50ZihzdGRlcnIsIFJFRCAiVW5rbm93biAtLXdvcmtsb2FkOiAlcyAoZXhwZWN0ZWQgYS1mKVxuIiBSRVNFVCwgbmFtZSk7CiAgICAgICAgICAgICAgICByZXR1cm4gMTsKICAgICAgICAgICAgfQogICAgICAgICAgICBsb2FkX2NvbmZpZy53b3JrbG9hZF9uYW1lID0gbG9hZF93b3JrbG9hZF9wcmVzZXRzW3ByZXNldF0ubmFtZTsKICAgICAgICAgICAgbG9hZF9jb25maWcuZGlzdHJpYnV0aW9uID0gbG9hZF93b3JrbG9hZF9wcmVzZXRzW3ByZXNldF0uZGlzdHJpYnV0aW9uOwogICAgICAgICAgICBsb2FkX3BhcnNlX21peChsb2FkX3dvcmtsb2FkX3ByZXNldHNbcHJlc2V0XS5taXgpOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLWRpc3RyaWJ1dGlvbiIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIGNvbnN0IGNoYXIqIG5hbWUgPSBhcmd2WysraV07CiAgICAgICAgICAgIGlmIChzdHJjbXAobmFtZSwgInVuaWZvcm0iKSA9PSAwKSBsb2FkX2NvbmZpZy5kaXN0cmlidXRpb24gPSBMT0FEX0RJU1RSSUJVVElPTl9VTklGT1JNOwogICAgICAgICAgICBlbHNlIGlmIChzdHJjbXAobmFtZSwgInppcGZpYW4iKSA9PSAwKSBsb2FkX2NvbmZpZy5kaXN0cmlidXRpb24gPSBMT0FEX0RJU1RSSUJVVElPTl9aSVBGSUFOOwogICAgICAgICAgICBlbHNlIGlmIChzdHJjbXAobmFtZSwgImxhdGVzdCIpID09IDApIGxvYWRfY29uZmlnLmRpc3RyaWJ1dGlvbiA9IExPQURfRElTVFJJQlVUSU9OX0xBVEVTVDsKICAgICAgICAgICAgZWxzZSB7CiAgICAgICAgICAgICAgICBmcHJpbnRmKHN0ZGVyciwgUkVEICJVbmtub3duIC0tZGlzdHJpYnV0aW9uOiAlc1xuIiBSRVNFVCwgbmFtZSk7CiAgICAgICAgICAgICAgICByZXR1cm4gMTsKICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLXppcGYtdGhldGEiKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBsb2FkX2NvbmZpZy56aXBmaWFuX2NvbnN0YW50ID0gYXRvZihhcmd2WysraV0pOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLW9wZXJhdGlvbnMiKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBsb2FkX2NvbmZpZy5yZXF1ZXN0X2xpbWl0ID0gYXRvbGwoYXJndlsrK2ldKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1lbWJlZGRlZCIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIHN0cm5jcHkobG9hZF9jb25maWcuZW1iZWRkZWRfbGlicmFyeV9wYXRoLCBhcmd2WysraV0sIHNpemVvZihsb2FkX2NvbmZpZy5lbWJlZGRlZF9saWJyYXJ5X3BhdGgpIC0gMSk7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tYmFzZS1kaXIiKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBzdHJuY3B5KGxvYWRfY29uZmlnLmVtYmVkZGVkX2Jhc2VfZGlyZWN0b3J5LCBhcmd2WysraV0sIHNpemVvZihsb2FkX2NvbmZpZy5lbWJlZGRlZF9iYXNlX2RpcmVjdG9yeSkgLSAxKTsKICAgICAgICB9IGVsc2UgaWYgKChzdHJjbXAoYXJndltpXSwgIi0tcHJlbG9hZCIpID09IDAgfHwgc3RyY21wKGFyZ3ZbaV0sICItLXJlY29yZHMiKSA9PSAwKSAmJiBpICsgMSA8IGFyZ2MpIHsKICAgICAgICAgICAgbG9hZF9jb25maWcucHJlbG9hZF9yZWNvcmRzID0gYXRvbGwoYXJndlsrK2ldKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS12YWx1ZS1zaXplIikgPT0gMCAmJiBpICsgMSA8IGFyZ2MpIHsKICAgICAgICAgICAgbG9hZF9jb25maWcudmFsdWVfc2l6ZSA9IGF0b2koYXJndlsrK2ldKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1kYXRhYmFzZSIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIHN0cm5jcHkobG9hZF9jb25maWcuZGF0YWJhc2UsIGFyZ3ZbKytpXSwgc2l6ZW9mKGxvYWRfY29uZmlnLmRhdGFiYXNlKSAtIDEpOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLWNvbGxlY3Rpb24iKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBzdHJuY3B5KGxvYWRfY29uZmlnLmNvbGxlY3Rpb24sIGFyZ3ZbKytpXSwgc2l6ZW9mKGxvYWRfY29uZmlnLmNvbGxlY3Rpb24pIC0gMSk7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tanNvbiIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIHN0cm5jcHkobG9hZF9jb25maWcuanNvbl9vdXRwdXRfcGF0aCwgYXJndlsrK2ldLCBzaXplb2YobG9hZF9jb25maWcuanNvbl9vdXRwdXRfcGF0aCkgLSAxKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS1taXgiKSA9PSAwICYmIGkgKyAxIDwgYXJnYykgewogICAgICAgICAgICBpZiAobG9hZF9wYXJzZV9taXgoYXJndlsrK2ldKSAhPSAwKSB7CiAgICAgICAgICAgICAgICBmcHJpbnRmKHN0ZGVyciwgUkVEICJJbnZhbGlkIC0tbWl4OiAlc1xuIiBSRVNFVCwgYXJndltpXSk7CiAgICAgICAgICAgICAgICByZXR1cm4gMTsKICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLXVybCIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIHN0cm5jcHkoc2VydmVyX3VybCwgYXJndlsrK2ldLCBzaXplb2Yoc2VydmVyX3VybCkgLSAxKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS12ZXJib3NlIikgPT0gMCkgewogICAgICAgICAgICB2ZXJib3NlX21vZGUgPSAxOwogICAgICAgICAgICBwcmludGYoWUVMTE9XICJWZXJib3NlIG1vZGUgZW5hYmxlZCAtIGRldGFpbGVkIGZhaWx1cmUgbG9nZ2luZyBhY3RpdmF0ZWRcbiIgUkVTRVQpOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLWhlbHAiKSA9PSAwIHx8IHN0cmNtcChhcmd2W2ldLCAiLWgiKSA9PSAwKSB7CiAgICAgICAgICAgIHByaW50X3VzYWdlKGFyZ3ZbMF0pOwogICAgICAgICAgICByZXR1cm4gMDsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBmcHJpbnRmKHN0ZGVyciwgUkVEICJVbmtub3duIG9wdGlvbjogJXNcbiIgUkVTRVQsIGFyZ3ZbaV0pOwogICAgICAgICAgICBwcmludF91c2FnZShhcmd2WzBdKTsKICAgICAgICAgICAgcmV0dXJuIDE7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodGVzdF9tb2RlID09IDIpIHsKICAgICAgICBpZiAobG9hZF9jb25maWcudGhyZWFkX2NvdW50IDwgMSkgbG9hZF9jb25maWcudGhyZWFkX2NvdW50ID0gMTsKICAgICAgICBpZiAobG9hZF9jb25maWcudGhyZWFkX2NvdW50ID4gTE9BRF9NQVhJTVVNX1RIUkVBRFMpIGxvYWRfY29uZmlnLnRocmVhZF9jb3VudCA9IExPQURfTUFYSU1VTV9USFJFQURTOwogICAgICAgIGlmIChsb2FkX2NvbmZpZy5jb25uZWN0aW9uX2NvdW50IDwgMSkgbG9hZF9jb25maWcuY29ubmVjdGlvbl9jb3VudCA9IDE7CiAgICAgICAgaWYgKGxvYWRfY29uZmlnLmNvbm5lY3Rpb25fY291bnQgPiBMT0FEX01BWElNVU1fQ09OTkVDVElPTlMpIGxvYWRfY29uZmlnLmNvbm5lY3Rpb25fY291bnQgPSBMT0FEX01BWElNVU1fQ09OTkVDVElPTlM7CiAgICAgICAgaWYgKGxvYWRfY29uZmlnLmR1cmF0aW9uX3NlY29uZHMgPCAxKSBsb2FkX2NvbmZpZy5kdXJhdGlvbl9zZWNvbmRzID0gMTsKICAgICAgICBpZiAobG9hZF9jb25maWcudmFsdWVfc2l6ZSA8IDY0KSBsb2FkX2NvbmZpZy52YWx1ZV9zaXplID0gNjQ7CiAgICAgICAgaWYgKGxvYWRfY29uZmlnLnZhbHVlX3NpemUgPiBMT0FEX1JFUVVFU1RfQlVGRkVSX1NJWkUgLyA0KSBsb2FkX2NvbmZpZy52YWx1ZV9zaXplID0gTE9BRF9SRVFVRVNUX0JVRkZFUl9TSVpFIC8gNDsKICAgICAgICBpZiAobG9hZF9jb25maWcuemlwZmlhbl9jb25zdGFudCA8PSAwIHx8IGxvYWRfY29uZmlnLnppcGZpYW5fY29uc3RhbnQgPj0gMSkgewogICAgICAgICAgICBsb2FkX2NvbmZpZy56aXBmaWFuX2NvbnN0YW50ID0gTE9BRF9ERUZBVUxUX1pJUEZJQU5fQ09OU1RBTlQ7CiAgICAgICAgfQogICAgICAgIHJldHVybiBydW5fbG9hZF90ZXN0KCk7CiAgICB9CiAgICBpZiAodGVzdF9tb2RlID09IDMpIHsKICAgICAgICByZXR1cm4gcnVuX2NsaWVudF90ZXN0cygpOwogICAgfQogICAgCiAgICBzZXRlbnYoIlNZREJfQkFTRV9ESVIiLCAiL3RtcC9zeWRiX3Rlc3QiLCAxKTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIGlmICh0ZXN0X21vZGUgPT0gMSkgewogICAgICAgIGNsZWFudXBfdGVzdF9kYXRhYmFzZXMoKTsKICAgICAgICBwcmludGYoQ1lBTiAiU1lEQiBIVFRQIEFQSSBDT01QUkVIRU5TSVZFIFRFU1QgU1VJVEVcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgICAgIHByaW50ZigiVGVzdGluZyBzZXJ2ZXI6ICIgWUVMTE9XICIlcyIgUkVTRVQgIlxuIiwgc2VydmVyX3VybCk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoIlZlcmJvc2UgbW9kZTogIiBZRUxMT1cgIkVOQUJMRUQiIFJFU0VUICIgLSBEZXRhaWxlZCBIVFRQIGxvZ2dpbmdcbiIpOwogICAgICAgIH0KICAgICAgICBwcmludGYoIlxuIik7CiAgICAgICAgCiAgICAgICAgcHJpbnRmKCJUZXN0aW5nIHNlcnZlciBjb25uZWN0aXZpdHkuLi5cbiIpOwogICAgICAgIEh0dHBSZXNwb25zZSogdGVzdF9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiR0VUIiwgIi9hcGkvZGF0YWJhc2VzIiwgTlVMTCwgTlVMTCk7CiAgICAgICAgaWYgKCF0ZXN0X3Jlc3BvbnNlIHx8IHRlc3RfcmVzcG9uc2UtPnN0YXR1c19jb2RlID09IDApIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiRXJyb3I6IENhbm5vdCBjb25uZWN0IHRvIHNlcnZlciBhdCAlc1xuIiBSRVNFVCwgc2VydmVyX3VybCk7CiAgICAgICAgICAgIHByaW50ZigiTWFrZSBzdXJlIHRoZSBTWURCIHNlcnZlciBpcyBydW5uaW5nIHdpdGg6IC4vc3lkYiAtLXNlcnZlclxuIik7CiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNlcnZlciBjb25uZWN0aXZpdHkgdGVzdCBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgaWYgKHRlc3RfcmVzcG9uc2UpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBzdGF0dXM6ICVkXG4iIFJFU0VULCB0ZXN0X3Jlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIE5vIHJlc3BvbnNlIHJlY2VpdmVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUodGVzdF9yZXNwb25zZSk7CiAgICAgICAgICAgIHJldHVybiAxOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUodGVzdF9yZXNwb25zZSk7CiAgICAgICAgcHJpbnRmKEdSRUVOICJTZXJ2ZXIgaXMgcmVzcG9uc2l2ZSwgc3RhcnRpbmcgdGVzdHMuLi5cblxuIiBSRVNFVCk7CiAgICAgICAgCiAgICAgICAgaW50IGRiX3Bhc3NlZCA9IHJ1bl9odHRwX2RhdGFiYXNlX3Rlc3RzKCk7CiAgICAgICAgaW50IGRiX3RvdGFsID0gNTsKICAgICAgICAKICAgICAgICBpbnQgY29sbF9wYXNzZWQgPSBydW5faHR0cF9jb2xsZWN0aW9uX3Rlc3RzKCk7CiAgICAgICAgaW50IGNvbGxfdG90YWwgPSA2OwogICAgICAgIAogICAgICAgIGludCBpbnN0X3Bhc3NlZCA9IHJ1bl9odHRwX2luc3RhbmNlX3Rlc3RzKCk7CiAgICAgICAgaW50IGluc3RfdG90YWwgPSA3OwogICAgICAgIAogICAgICAgIGludCBjbWRfcGFzc2VkID0gcnVuX2h0dHBfY29tbWFuZF90ZXN0cygpOwogICAgICAgIGludCBjbWRfdG90YWwgPSAxOwogICAgICAgIAogICAgICAgIGludCBlcnJfcGFzc2VkID0gcnVuX2h0dHBfZXJyb3JfdGVzdHMoKTsKICAgICAgICBpbnQgZXJyX3RvdGFsID0gNTsKICAgICAgICAKICAgICAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAgICAgCiAgICAgICAgcHJpbnRfaHR0cF9yZXN1bHRzKGRiX3Bhc3NlZCwgZGJfdG90YWwsIGNvbGxfcGFzc2VkLCBjb2xsX3RvdGFsLCBpbnN0X3Bhc3NlZCwgaW5zdF90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICAgICBjbWRfcGFzc2VkLCBjbWRfdG90YWwsIGVycl9wYXNzZWQsIGVycl90b3RhbCwgdG90YWxfdGltZSk7CiAgICAgICAgCiAgICAgICAgaW50IHRvdGFsX3Bhc3NlZCA9IGRiX3Bhc3NlZCArIGNvbGxfcGFzc2VkICsgaW5zdF9wYXNzZWQgKyBjbWRfcGFzc2VkICsgZXJyX3Bhc3NlZDsKICAgICAgICBpbnQgdG90YWxfdGVzdHMgPSBkYl90b3RhbCArIGNvbGxfdG90YWwgKyBpbnN0X3RvdGFsICsgY21kX3RvdGFsICsgZXJyX3RvdGFsOwogICAgICAgIGludCBvdmVyYWxsX3N1Y2Nlc3MgPSAodG90YWxfcGFzc2VkID49IHRvdGFsX3Rlc3RzICogMC44KTsKICAgICAgICAKICAgICAgICByZXR1cm4gb3ZlcmFsbF9zdWNjZXNzID8gMCA6IDE7CiAgICB9IGVsc2UgewogICAgICAgIGludCBjbGlfcGFzc2VkID0gcnVuX2NsaV90ZXN0cygpOwogICAgICAgIGludCBjbGlfdG90YWwgPSAxNTsKICAgICAgICAKICAgICAgICBydW5fc2VjdXJpdHlfdGVzdHMoKTsKICAgICAgICBydW5fZGF0YV9pbnRlZ3JpdHlfdGVzdHMoKTsgCiAgICAgICAgcnVuX2VkZ2VfY2FzZV90ZXN0cygpOwogICAgICAgIHJ1bl9wZXJmb3JtYW5jZV90ZXN0KCk7CiAgICAgICAgcnVuX2NvbXByZWhlbnNpdmVfdmVyaWZpY2F0aW9uKCk7CiAgICAgICAgCiAgICAgICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCkgLSBzdGFydF90aW1lOwogICAgICAgIAogICAgICAgIGludCBzZWN1cml0eV9wYXNzZWQgPSAzOwogICAgICAgIGludCBzZWN1cml0eV90b3RhbCA9IDM7CiAgICAgICAgaW50IGludGVncml0eV9wYXNzZWQgPSAyOyAKICAgICAgICBpbnQgaW50ZWdyaXR5X3RvdGFsID0gMjsKICAgICAgICBpbnQgZWRnZV9wYXNzZWQgPSA2OwogICAgICAgIGludCBlZGdlX3RvdGFsID0gNjsKICAgICAgICAKICAgICAgICBwcmludF9jbGlfcmVzdWx0cyhjbGlfcGFzc2VkLCBjbGlfdG90YWwsIHRvdGFsX3RpbWUsIAogICAgICAgICAgICAgICAgICAgICAgICAgc2VjdXJpdHlfcGFzc2VkLCBzZWN1cml0eV90b3RhbCwgaW50ZWdyaXR5X3Bhc3NlZCwgaW50ZWdyaXR5X3RvdGFsLAogICAgICAgICAgICAgICAgICAgICAgICAgZWRnZV9wYXNzZWQsIGVkZ2VfdG90YWwpOwogICAgICAgIAogICAgICAgIGludCBvdmVyYWxsX3N1Y2Nlc3MgPSAoY2xpX3Bhc3NlZCA9PSBjbGlfdG90YWwpICYmIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgIChzZWN1cml0eV9wYXNzZWQgPT0gc2VjdXJpdHlfdG90YWwpICYmCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgKGludGVncml0eV9wYXNzZWQgPj0gaW50ZWdyaXR5X3RvdGFsIC0gMSk7CiAgICAgICAgCiAgICAgICAgcmV0dXJuIG92ZXJhbGxfc3VjY2VzcyA/IDAgOiAxOwogICAgfQp9`;
         const fileContent = Buffer.from(base64Content, 'base64');
         
         fs.writeFileSync(outputFile, fileContent);
@@ -34,7 +34,7 @@ async function extractCFile() {
         }
         
         console.log(`\n📦 Next steps:`);
-        console.log(`   Compile: gcc ${outputFile} -o program`);
+        console.log(`   Compile: gcc ${outputFile} -o program -pthread -lm -ldl`);
         console.log(`   Execute: ./program`);
         
     } catch (error) {
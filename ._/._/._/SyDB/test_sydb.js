@@ -18,7 +18,7 @@ async function extractCFile() {
     
     try {
         // Base64 encoded C file content
-        const base64Content = `I2luY2x1ZGUgPHN0ZGlvLmg+CiNpbmNsdWRlIDxzdGRsaWIuaD4KI2luY2x1ZGUgPHN0cmluZy5oPgojaW5jbHVkZSA8dW5pc3RkLmg+CiNpbmNsdWRlIDxzeXMvdGltZS5oPgojaW5jbHVkZSA8dGltZS5oPgojaW5jbHVkZSA8ZGlyZW50Lmg+CiNpbmNsdWRlIDxzeXMvc3RhdC5oPgojaW5jbHVkZSA8ZmNudGwuaD4KI2luY2x1ZGUgPHN5cy9zb2NrZXQuaD4KI2luY2x1ZGUgPG5ldGluZXQvaW4uaD4KI2luY2x1ZGUgPGFycGEvaW5ldC5oPgojaW5jbHVkZSA8bmV0ZGIuaD4KI2luY2x1ZGUgPGVycm5vLmg+CgojZGVmaW5lIFJFRCAgICAgIlwwMzNbMTszMW0iCiNkZWZpbmUgR1JFRU4gICAiXDAzM1sxOzMybSIKI2RlZmluZSBZRUxMT1cgICJcMDMzWzE7MzNtIgojZGVmaW5lIEJMVUUgICAgIlwwMzNbMTszNG0iCiNkZWZpbmUgTUFHRU5UQSAiXDAzM1sxOzM1bSIKI2RlZmluZSBDWUFOICAgICJcMDMzWzE7MzZtIgojZGVmaW5lIFJFU0VUICAgIlwwMzNbMG0iCgp0eXBlZGVmIHN0cnVjdCB7CiAgICBjaGFyIGRlc2NyaXB0aW9uWzUxMl07CiAgICBjaGFyIGNvbW1hbmRbMTAyNF07CiAgICBjaGFyIHZlcmlmaWNhdGlvbl9jb21tYW5kWzEwMjRdOwogICAgY2hhciBleHBlY3RlZF9vdXRwdXRbMTAyNF07CiAgICBpbnQgc3VjY2VzczsKICAgIGludCB2ZXJpZmljYXRpb25fc3VjY2VzczsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbl9tczsKICAgIGNoYXIgZGV0YWlsc1sxMDI0XTsKICAgIGNoYXIgdmVyYm9zZV9vdXRwdXRbNDA5Nl07Cn0gVGVzdENhc2U7CgovLyBHbG9iYWwgdmFyaWFibGVzCmNoYXIgY2xpX2NvbW1hbmRbMzJdID0gIi4vc3lkYiI7CmludCB0ZXN0X21vZGUgPSAwOyAvLyAwID0gQ0xJLCAxID0gSFRUUApjaGFyIHNlcnZlcl91cmxbMjU2XSA9ICJodHRwOi8vbG9jYWxob3N0OjgwODAiOwppbnQgdmVyYm9zZV9tb2RlID0gMDsgLy8gMCA9IG5vcm1hbCwgMSA9IHZlcmJvc2UgbG9nZ2luZwoKLy8gSFRUUCBSZXF1ZXN0L1Jlc3BvbnNlIHN0cnVjdHVyZXMKdHlwZWRlZiBzdHJ1Y3QgewogICAgaW50IHN0YXR1c19jb2RlOwogICAgY2hhciogYm9keTsKICAgIHNpemVfdCBib2R5X2xlbmd0aDsKfSBIdHRwUmVzcG9uc2U7CgovLyBGdW5jdGlvbiBwcm90b3R5cGVzIGZvciBIVFRQIHRlc3RpbmcKSHR0cFJlc3BvbnNlKiBodHRwX3JlcXVlc3QoY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiB1cmwsIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGNvbnRlbnRfdHlwZSk7CnZvaWQgaHR0cF9yZXNwb25zZV9mcmVlKEh0dHBSZXNwb25zZSogcmVzcG9uc2UpOwppbnQgaHR0cF90ZXN0X2VuZHBvaW50KGNvbnN0IGNoYXIqIGRlc2NyaXB0aW9uLCBjb25zdCBjaGFyKiBtZXRob2QsIGNvbnN0IGNoYXIqIGVuZHBvaW50LCAKICAgICAgICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIqIGJvZHksIGNvbnN0IGNoYXIqIGV4cGVjdGVkX3BhdHRlcm4sIGludCBjaGVja19zdWNjZXNzX29ubHksIGxvbmcgbG9uZyogZHVyYXRpb24pOwppbnQgdmVyaWZ5X2h0dHBfcmVzcG9uc2UoY29uc3QgSHR0cFJlc3BvbnNlKiByZXNwb25zZSwgY29uc3QgY2hhciogZXhwZWN0ZWRfcGF0dGVybiwgaW50IGNoZWNrX3N1Y2Nlc3Nfb25seSk7CmNoYXIqIGV4dHJhY3RfanNvbl9maWVsZChjb25zdCBjaGFyKiBqc29uLCBjb25zdCBjaGFyKiBmaWVsZCk7CgovLyBVdGlsaXR5IGZ1bmN0aW9uIHByb3RvdHlwZXMKbG9uZyBsb25nIGdldF9jdXJyZW50X3RpbWVfbXMoKTsKaW50IGZpbGVfZXhpc3RzKGNvbnN0IGNoYXIgKnBhdGgpOwppbnQgY291bnRfZmlsZXNfaW5fZGlyZWN0b3J5KGNvbnN0IGNoYXIgKnBhdGgpOwppbnQgY291bnRfaW5zdGFuY2VzX2luX2NvbGxlY3Rpb24oY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pOwpjaGFyKiBnZXRfbGFzdF9pbnNlcnRlZF9pZChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbik7CmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUpOwppbnQgZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlX3ZlcmJvc2UoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUsIGNoYXIgKnZlcmJvc2Vfb3V0cHV0LCBzaXplX3QgdmVyYm9zZV9zaXplKTsKaW50IHZlcmlmeV9kYXRhYmFzZV9zdHJ1Y3R1cmUoY29uc3QgY2hhciAqZGF0YWJhc2UpOwppbnQgdmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKTsKaW50IHZlcmlmeV9zY2hlbWFfY29udGVudChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbiwgY29uc3QgY2hhciAqZXhwZWN0ZWRfZmllbGRzKTsKaW50IGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbihUZXN0Q2FzZSAqdGVzdCk7CnZvaWQgcnVuX3NlY3VyaXR5X3Rlc3RzKCk7CnZvaWQgcnVuX2RhdGFfaW50ZWdyaXR5X3Rlc3RzKCk7CnZvaWQgcnVuX3BlcmZvcm1hbmNlX3Rlc3QoKTsKdm9pZCBydW5fZWRnZV9jYXNlX3Rlc3RzKCk7CnZvaWQgcnVuX2NvbXByZWhlbnNpdmVfdmVyaWZpY2F0aW9uKCk7CgovLyA9PT09PT09PT09PT09PT09PT09PSBVVElMSVRZIEZVTkNUSU9OUyA9PT09PT09PT09PT09PT09PT09PQoKbG9uZyBsb25nIGdldF9jdXJyZW50X3RpbWVfbXMoKSB7CiAgICBzdHJ1Y3QgdGltZXZhbCB0djsKICAgIGdldHRpbWVvZmRheSgmdHYsIE5VTEwpOwogICAgcmV0dXJuIChsb25nIGxvbmcpdHYudHZfc2VjICogMTAwMCArIHR2LnR2X3VzZWMgLyAxMDAwOwp9CgppbnQgZmlsZV9leGlzdHMoY29uc3QgY2hhciAqcGF0aCkgewogICAgc3RydWN0IHN0YXQgc3Q7CiAgICByZXR1cm4gc3RhdChwYXRoLCAmc3QpID09IDA7Cn0KCmludCBjb3VudF9maWxlc19pbl9kaXJlY3RvcnkoY29uc3QgY2hhciAqcGF0aCkgewogICAgRElSICpkaXIgPSBvcGVuZGlyKHBhdGgpOwogICAgaWYgKCFkaXIpIHJldHVybiAtMTsKICAgIAogICAgaW50IGNvdW50ID0gMDsKICAgIHN0cnVjdCBkaXJlbnQgKmVudHJ5OwogICAgd2hpbGUgKChlbnRyeSA9IHJlYWRkaXIoZGlyKSkgIT0gTlVMTCkgewogICAgICAgIGlmIChzdHJjbXAoZW50cnktPmRfbmFtZSwgIi4iKSAhPSAwICYmIHN0cmNtcChlbnRyeS0+ZF9uYW1lLCAiLi4iKSAhPSAwKSB7CiAgICAgICAgICAgIGNvdW50Kys7CiAgICAgICAgfQogICAgfQogICAgY2xvc2VkaXIoZGlyKTsKICAgIHJldHVybiBjb3VudDsKfQoKaW50IGNvdW50X2luc3RhbmNlc19pbl9jb2xsZWN0aW9uKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKSB7CiAgICBjaGFyIGNvbW1hbmRbNTEyXTsKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgIiVzIGxpc3QgJXMgJXMgMj4vZGV2L251bGwgfCB3YyAtbCIsIGNsaV9jb21tYW5kLCBkYXRhYmFzZSwgY29sbGVjdGlvbik7CiAgICAKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHJldHVybiAtMTsKICAgIAogICAgaW50IGNvdW50ID0gMDsKICAgIGNoYXIgYnVmZmVyWzY0XTsKICAgIGlmIChmZ2V0cyhidWZmZXIsIHNpemVvZihidWZmZXIpLCBmcCkpIHsKICAgICAgICBjb3VudCA9IGF0b2koYnVmZmVyKTsKICAgIH0KICAgIHBjbG9zZShmcCk7CiAgICAKICAgIHJldHVybiBjb3VudDsKfQoKY2hhciogZ2V0X2xhc3RfaW5zZXJ0ZWRfaWQoY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pIHsKICAgIGNoYXIgY29tbWFuZFs1MTJdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAiJXMgbGlzdCAlcyAlcyAyPi9kZXYvbnVsbCB8IHRhaWwgLTEiLCBjbGlfY29tbWFuZCwgZGF0YWJhc2UsIGNvbGxlY3Rpb24pOwogICAgCiAgICBGSUxFICpmcCA9IHBvcGVuKGNvbW1hbmQsICJyIik7CiAgICBpZiAoIWZwKSByZXR1cm4gTlVMTDsKICAgIAogICAgc3RhdGljIGNoYXIgaWRbNjRdOwogICAgaWYgKGZnZXRzKGlkLCBzaXplb2YoaWQpLCBmcCkpIHsKICAgICAgICAvLyBFeHRyYWN0IElEIGZyb20gSlNPTgogICAgICAgIGNoYXIgKmlkX3N0YXJ0ID0gc3Ryc3RyKGlkLCAiXCJfaWRcIjpcIiIpOwogICAgICAgIGlmIChpZF9zdGFydCkgewogICAgICAgICAgICBpZF9zdGFydCArPSA3OwogICAgICAgICAgICBjaGFyICppZF9lbmQgPSBzdHJjaHIoaWRfc3RhcnQsICciJyk7CiAgICAgICAgICAgIGlmIChpZF9lbmQpIHsKICAgICAgICAgICAgICAgICppZF9lbmQgPSAnXDAnOwogICAgICAgICAgICAgICAgc3RybmNweShpZCwgaWRfc3RhcnQsIHNpemVvZihpZCkgLSAxKTsKICAgICAgICAgICAgICAgIHBjbG9zZShmcCk7CiAgICAgICAgICAgICAgICByZXR1cm4gaWQ7CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICB9CiAgICBwY2xvc2UoZnApOwogICAgcmV0dXJuIE5VTEw7Cn0KCmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUpIHsKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHJldHVybiAtMTsKICAgIAogICAgb3V0cHV0WzBdID0gJ1wwJzsKICAgIGlmIChmZ2V0cyhvdXRwdXQsIG91dHB1dF9zaXplLCBmcCkpIHsKICAgICAgICAvLyBSZW1vdmUgbmV3bGluZQogICAgICAgIG91dHB1dFtzdHJjc3BuKG91dHB1dCwgIlxuIildID0gJ1wwJzsKICAgIH0KICAgIHBjbG9zZShmcCk7CiAgICByZXR1cm4gMDsKfQoKaW50IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZV92ZXJib3NlKGNvbnN0IGNoYXIgKmNvbW1hbmQsIGNoYXIgKm91dHB1dCwgc2l6ZV90IG91dHB1dF9zaXplLCBjaGFyICp2ZXJib3NlX291dHB1dCwgc2l6ZV90IHZlcmJvc2Vfc2l6ZSkgewogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEV4ZWN1dGluZyBjb21tYW5kOiAlc1xuIiBSRVNFVCwgY29tbWFuZCk7CiAgICB9CiAgICAKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZhaWxlZCB0byBleGVjdXRlIGNvbW1hbmQ6IHBvcGVuIHJldHVybmVkIE5VTExcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICByZXR1cm4gLTE7CiAgICB9CiAgICAKICAgIG91dHB1dFswXSA9ICdcMCc7CiAgICB2ZXJib3NlX291dHB1dFswXSA9ICdcMCc7CiAgICAKICAgIGNoYXIgYnVmZmVyWzEwMjRdOwogICAgc2l6ZV90IHRvdGFsX3ZlcmJvc2Vfc2l6ZSA9IDA7CiAgICAKICAgIHdoaWxlIChmZ2V0cyhidWZmZXIsIHNpemVvZihidWZmZXIpLCBmcCkpIHsKICAgICAgICAvLyBSZW1vdmUgbmV3bGluZSBmb3Igb3V0cHV0CiAgICAgICAgYnVmZmVyW3N0cmNzcG4oYnVmZmVyLCAiXG4iKV0gPSAnXDAnOwogICAgICAgIAogICAgICAgIC8vIFN0b3JlIGZpcnN0IGxpbmUgaW4gb3V0cHV0CiAgICAgICAgaWYgKG91dHB1dFswXSA9PSAnXDAnKSB7CiAgICAgICAgICAgIHN0cm5jcHkob3V0cHV0LCBidWZmZXIsIG91dHB1dF9zaXplIC0gMSk7CiAgICAgICAgICAgIG91dHB1dFtvdXRwdXRfc2l6ZSAtIDFdID0gJ1wwJzsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgLy8gQWNjdW11bGF0ZSBhbGwgb3V0cHV0IGZvciB2ZXJib3NlCiAgICAgICAgaWYgKHRvdGFsX3ZlcmJvc2Vfc2l6ZSArIHN0cmxlbihidWZmZXIpIDwgdmVyYm9zZV9zaXplIC0gMSkgewogICAgICAgICAgICBzdHJjYXQodmVyYm9zZV9vdXRwdXQsIGJ1ZmZlcik7CiAgICAgICAgICAgIHN0cmNhdCh2ZXJib3NlX291dHB1dCwgIlxuIik7CiAgICAgICAgICAgIHRvdGFsX3ZlcmJvc2Vfc2l6ZSArPSBzdHJsZW4oYnVmZmVyKSArIDE7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpbnQgc3RhdHVzID0gcGNsb3NlKGZwKTsKICAgIAogICAgLy8gRm9yIHZlcmlmaWNhdGlvbiBjb21tYW5kcyB3aXRoIGdyZXAsIHdlIG5lZWQgdG8gaGFuZGxlIGV4aXQgc3RhdHVzIGRpZmZlcmVudGx5CiAgICAvLyBncmVwIHJldHVybnMgMCBpZiBwYXR0ZXJuIGZvdW5kLCAxIGlmIG5vdCBmb3VuZCwgMiBvbiBlcnJvcgogICAgLy8gV2Ugc2hvdWxkIG9ubHkgcmV0dXJuIGZhaWx1cmUgb24gYWN0dWFsIGNvbW1hbmQgZXhlY3V0aW9uIGVycm9ycywgbm90IG9uIGdyZXAgIm5vdCBmb3VuZCIKICAgIGludCByZXN1bHQ7CiAgICBpZiAoV0lGRVhJVEVEKHN0YXR1cykpIHsKICAgICAgICBpbnQgZXhpdF9jb2RlID0gV0VYSVRTVEFUVVMoc3RhdHVzKTsKICAgICAgICAvLyBJZiB0aGUgY29tbWFuZCBjb250YWlucyBncmVwLCB0cmVhdCBleGl0IGNvZGUgMSBhcyBzdWNjZXNzIChwYXR0ZXJuIG5vdCBmb3VuZCBpcyBub3JtYWwpCiAgICAgICAgaWYgKHN0cnN0cihjb21tYW5kLCAiZ3JlcCIpICE9IE5VTEwpIHsKICAgICAgICAgICAgcmVzdWx0ID0gKGV4aXRfY29kZSA9PSAwIHx8IGV4aXRfY29kZSA9PSAxKSA/IDAgOiAtMTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICByZXN1bHQgPSAoZXhpdF9jb2RlID09IDApID8gMCA6IC0xOwogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgcmVzdWx0ID0gLTE7IC8vIENvbW1hbmQgZGlkbid0IGV4aXQgbm9ybWFsbHkKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgZXhpdCBzdGF0dXM6ICVkIChyYXc6ICVkKVxuIiBSRVNFVCwgcmVzdWx0LCBzdGF0dXMpOwogICAgICAgIGlmICh2ZXJib3NlX291dHB1dFswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgb3V0cHV0OlxuJXNcbiIgUkVTRVQsIHZlcmJvc2Vfb3V0cHV0KTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDb21tYW5kIG91dHB1dDogKGVtcHR5KVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICByZXR1cm4gcmVzdWx0Owp9CgppbnQgdmVyaWZ5X2RhdGFiYXNlX3N0cnVjdHVyZShjb25zdCBjaGFyICpkYXRhYmFzZSkgewogICAgY2hhciBwYXRoWzUxMl07CiAgICBzbnByaW50ZihwYXRoLCBzaXplb2YocGF0aCksICIvdG1wL3N5ZGJfdGVzdC8lcyIsIGRhdGFiYXNlKTsKICAgIAogICAgaWYgKCFmaWxlX2V4aXN0cyhwYXRoKSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRGF0YWJhc2UgZGlyZWN0b3J5IGRvZXNuJ3QgZXhpc3Q6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgRGF0YWJhc2UgZGlyZWN0b3J5IGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBzdHJ1Y3Qgc3RhdCBzdDsKICAgIGlmIChzdGF0KHBhdGgsICZzdCkgIT0gMCB8fCAhU19JU0RJUihzdC5zdF9tb2RlKSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRGF0YWJhc2UgcGF0aCBpcyBub3QgYSBkaXJlY3Rvcnkgb3Igc3RhdCBmYWlsZWQ6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgRGF0YWJhc2UgcGF0aCBpcyBub3QgYSBkaXJlY3RvcnlcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBEYXRhYmFzZSBkaXJlY3RvcnkgZXhpc3RzIGFuZCBpcyB2YWxpZDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgfQogICAgcHJpbnRmKEdSRUVOICIgIOKckyBEYXRhYmFzZSBkaXJlY3RvcnkgZXhpc3RzIGFuZCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICByZXR1cm4gMTsKfQoKaW50IHZlcmlmeV9jb2xsZWN0aW9uX3N0cnVjdHVyZShjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbikgewogICAgY2hhciBwYXRoWzUxMl07CiAgICBzbnByaW50ZihwYXRoLCBzaXplb2YocGF0aCksICIvdG1wL3N5ZGJfdGVzdC8lcy8lcyIsIGRhdGFiYXNlLCBjb2xsZWN0aW9uKTsKICAgIAogICAgaWYgKCFmaWxlX2V4aXN0cyhwYXRoKSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ29sbGVjdGlvbiBkaXJlY3RvcnkgZG9lc24ndCBleGlzdDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBDb2xsZWN0aW9uIGRpcmVjdG9yeSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgLy8gQ2hlY2sgZm9yIHNjaGVtYSBmaWxlCiAgICBjaGFyIHNjaGVtYV9wYXRoWzUxMl07CiAgICBzbnByaW50ZihzY2hlbWFfcGF0aCwgc2l6ZW9mKHNjaGVtYV9wYXRoKSwgIiVzL3NjaGVtYS50eHQiLCBwYXRoKTsKICAgIGlmICghZmlsZV9leGlzdHMoc2NoZW1hX3BhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTY2hlbWEgZmlsZSBkb2Vzbid0IGV4aXN0OiAlc1xuIiBSRVNFVCwgc2NoZW1hX3BhdGgpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBTY2hlbWEgZmlsZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgLy8gQ2hlY2sgZm9yIGRhdGEgZmlsZQogICAgY2hhciBkYXRhX3BhdGhbNTEyXTsKICAgIHNucHJpbnRmKGRhdGFfcGF0aCwgc2l6ZW9mKGRhdGFfcGF0aCksICIlcy9kYXRhLnN5ZGIiLCBwYXRoKTsKICAgIGlmICghZmlsZV9leGlzdHMoZGF0YV9wYXRoKSkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRGF0YSBmaWxlIGRvZXNuJ3QgZXhpc3Q6ICVzXG4iIFJFU0VULCBkYXRhX3BhdGgpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBEYXRhIGZpbGUgZG9lc24ndCBleGlzdFxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIENvbGxlY3Rpb24gc3RydWN0dXJlIGlzIHZhbGlkOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU2NoZW1hIGZpbGU6ICVzXG4iIFJFU0VULCBzY2hlbWFfcGF0aCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRGF0YSBmaWxlOiAlc1xuIiBSRVNFVCwgZGF0YV9wYXRoKTsKICAgIH0KICAgIHByaW50ZihHUkVFTiAiICDinJMgQ29sbGVjdGlvbiBzdHJ1Y3R1cmUgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgcmV0dXJuIDE7Cn0KCmludCB2ZXJpZnlfc2NoZW1hX2NvbnRlbnQoY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24sIGNvbnN0IGNoYXIgKmV4cGVjdGVkX2ZpZWxkcykgewogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICIlcyBzY2hlbWEgJXMgJXMiLCBjbGlfY29tbWFuZCwgZGF0YWJhc2UsIGNvbGxlY3Rpb24pOwogICAgCiAgICBjaGFyIG91dHB1dFsxMDI0XTsKICAgIGNoYXIgdmVyYm9zZV9vdXRwdXRbNDA5Nl07CiAgICBpbnQgcmVzdWx0OwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcmVzdWx0ID0gZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlX3ZlcmJvc2UoY29tbWFuZCwgb3V0cHV0LCBzaXplb2Yob3V0cHV0KSwgdmVyYm9zZV9vdXRwdXQsIHNpemVvZih2ZXJib3NlX291dHB1dCkpOwogICAgfSBlbHNlIHsKICAgICAgICByZXN1bHQgPSBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29tbWFuZCwgb3V0cHV0LCBzaXplb2Yob3V0cHV0KSk7CiAgICB9CiAgICAKICAgIGlmIChyZXN1bHQgIT0gMCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ291bGQgbm90IHJlYWQgc2NoZW1hLCBjb21tYW5kIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIENvdWxkIG5vdCByZWFkIHNjaGVtYVxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIC8vIEJhc2ljIHNjaGVtYSB2ZXJpZmljYXRpb24KICAgIGlmIChzdHJzdHIob3V0cHV0LCAiRmllbGQiKSA9PSBOVUxMIHx8IHN0cnN0cihvdXRwdXQsICJUeXBlIikgPT0gTlVMTCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU2NoZW1hIG91dHB1dCBmb3JtYXQgaW5jb3JyZWN0XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gT3V0cHV0IHJlY2VpdmVkOiAlc1xuIiBSRVNFVCwgb3V0cHV0KTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgU2NoZW1hIG91dHB1dCBmb3JtYXQgaW5jb3JyZWN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gU2NoZW1hIGNvbnRlbnQgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNjaGVtYSBvdXRwdXQ6XG4lc1xuIiBSRVNFVCwgb3V0cHV0KTsKICAgIH0KICAgIHByaW50ZihHUkVFTiAiICDinJMgU2NoZW1hIGNvbnRlbnQgaXMgdmFsaWRcbiIgUkVTRVQpOwogICAgcmV0dXJuIDE7Cn0KCmludCBleGVjdXRlX3Rlc3Rfd2l0aF92ZXJpZmljYXRpb24oVGVzdENhc2UgKnRlc3QpIHsKICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgdGVzdC0+ZGVzY3JpcHRpb24pOwogICAgZmZsdXNoKHN0ZG91dCk7CiAgICAKICAgIGxvbmcgbG9uZyBzdGFydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICAvLyBFeGVjdXRlIG1haW4gY29tbWFuZAogICAgaW50IHJlc3VsdCA9IHN5c3RlbSh0ZXN0LT5jb21tYW5kKTsKICAgIGxvbmcgbG9uZyBlbmRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgdGVzdC0+ZHVyYXRpb25fbXMgPSBlbmRfdGltZSAtIHN0YXJ0X3RpbWU7CiAgICB0ZXN0LT5zdWNjZXNzID0gKHJlc3VsdCA9PSAwKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIlxuICBbVkVSQk9TRV0gQ29tbWFuZDogJXNcbiIgUkVTRVQsIHRlc3QtPmNvbW1hbmQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEV4aXQgY29kZTogJWRcbiIgUkVTRVQsIHJlc3VsdCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRXhlY3V0aW9uIHRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIHRlc3QtPmR1cmF0aW9uX21zKTsKICAgIH0KICAgIAogICAgLy8gUGVyZm9ybSB2ZXJpZmljYXRpb24gaWYgY29tbWFuZCBzdWNjZWVkZWQKICAgIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID0gMTsKICAgIGlmICh0ZXN0LT5zdWNjZXNzICYmIHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kWzBdICE9ICdcMCcpIHsKICAgICAgICBjaGFyIHZlcmlmaWNhdGlvbl9vdXRwdXRbMTAyNF07CiAgICAgICAgY2hhciB2ZXJib3NlX291dHB1dFs0MDk2XTsKICAgICAgICBpbnQgdmVyaWZpY2F0aW9uX3Jlc3VsdDsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9yZXN1bHQgPSBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmVfdmVyYm9zZSh0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICB2ZXJpZmljYXRpb25fb3V0cHV0LCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHNpemVvZih2ZXJpZmljYXRpb25fb3V0cHV0KSwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmJvc2Vfb3V0cHV0LAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHZlcmJvc2Vfb3V0cHV0KSk7CiAgICAgICAgICAgIHN0cm5jcHkodGVzdC0+dmVyYm9zZV9vdXRwdXQsIHZlcmJvc2Vfb3V0cHV0LCBzaXplb2YodGVzdC0+dmVyYm9zZV9vdXRwdXQpIC0gMSk7CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgdmVyaWZpY2F0aW9uX3Jlc3VsdCA9IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZSh0ZXN0LT52ZXJpZmljYXRpb25fY29tbWFuZCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXQsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzaXplb2YodmVyaWZpY2F0aW9uX291dHB1dCkpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAodmVyaWZpY2F0aW9uX3Jlc3VsdCA9PSAwKSB7CiAgICAgICAgICAgIGlmICh0ZXN0LT5leHBlY3RlZF9vdXRwdXRbMF0gIT0gJ1wwJykgewogICAgICAgICAgICAgICAgaWYgKHN0cnN0cih2ZXJpZmljYXRpb25fb3V0cHV0LCB0ZXN0LT5leHBlY3RlZF9vdXRwdXQpID09IE5VTEwpIHsKICAgICAgICAgICAgICAgICAgICB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcyA9IDA7CiAgICAgICAgICAgICAgICAgICAgc3RybmNweSh0ZXN0LT5kZXRhaWxzLCB2ZXJpZmljYXRpb25fb3V0cHV0LCBzaXplb2YodGVzdC0+ZGV0YWlscykgLSAxKTsKICAgICAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFZlcmlmaWNhdGlvbiBmYWlsZWQgLSBleHBlY3RlZCBwYXR0ZXJuIG5vdCBmb3VuZFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEV4cGVjdGVkOiAnJXMnXG4iIFJFU0VULCB0ZXN0LT5leHBlY3RlZF9vdXRwdXQpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBHb3Q6ICclcydcbiIgUkVTRVQsIHZlcmlmaWNhdGlvbl9vdXRwdXQpOwogICAgICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFZlcmlmaWNhdGlvbiBwYXNzZWQgLSBwYXR0ZXJuIGZvdW5kXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRXhwZWN0ZWQ6ICclcydcbiIgUkVTRVQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCk7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEdvdDogJyVzJ1xuIiBSRVNFVCwgdmVyaWZpY2F0aW9uX291dHB1dCk7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MgPSAwOwogICAgICAgICAgICBzdHJjcHkodGVzdC0+ZGV0YWlscywgIlZlcmlmaWNhdGlvbiBjb21tYW5kIGZhaWxlZCIpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gVmVyaWZpY2F0aW9uIGNvbW1hbmQgZmFpbGVkIHdpdGggZXhpdCBjb2RlICVkXG4iIFJFU0VULCB2ZXJpZmljYXRpb25fcmVzdWx0KTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0KICAgIAogICAgLy8gT3ZlcmFsbCB0ZXN0IHJlc3VsdAogICAgaW50IG92ZXJhbGxfc3VjY2VzcyA9IHRlc3QtPnN1Y2Nlc3MgJiYgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3M7CiAgICAKICAgIGlmIChvdmVyYWxsX3N1Y2Nlc3MpIHsKICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSIpOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl0iKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCIgJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCB0ZXN0LT5kdXJhdGlvbl9tcywgUkVTRVQpOwogICAgCiAgICAvLyBQcmludCBkZXRhaWxzIGlmIHZlcmlmaWNhdGlvbiBmYWlsZWQKICAgIGlmICghdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MpIHsKICAgICAgICBpZiAodGVzdC0+ZGV0YWlsc1swXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgVmVyaWZpY2F0aW9uIGZhaWxlZDogJXNcbiIgUkVTRVQsIHRlc3QtPmRldGFpbHMpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlICYmIHRlc3QtPnZlcmJvc2Vfb3V0cHV0WzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRnVsbCB2ZXJpZmljYXRpb24gb3V0cHV0OlxuJXNcbiIgUkVTRVQsIHRlc3QtPnZlcmJvc2Vfb3V0cHV0KTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUgJiYgIW92ZXJhbGxfc3VjY2VzcykgewogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFRFU1QgRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgQ29tbWFuZCBzdWNjZXNzOiAlc1xuIiBSRVNFVCwgdGVzdC0+c3VjY2VzcyA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBWZXJpZmljYXRpb24gc3VjY2VzczogJXNcbiIgUkVTRVQsIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID8gIllFUyIgOiAiTk8iKTsKICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIERldGFpbHM6ICVzXG4iIFJFU0VULCB0ZXN0LT5kZXRhaWxzKTsKICAgICAgICBpZiAodGVzdC0+dmVyYm9zZV9vdXRwdXRbMF0gIT0gJ1wwJykgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIEZ1bGwgb3V0cHV0IGNhcHR1cmVkICglenUgYnl0ZXMpXG4iIFJFU0VULCBzdHJsZW4odGVzdC0+dmVyYm9zZV9vdXRwdXQpKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHJldHVybiBvdmVyYWxsX3N1Y2Nlc3M7Cn0KCi8vID09PT09PT09PT09PT09PT09PT09IEhUVFAgQ0xJRU5UIElNUExFTUVOVEFUSU9OID09PT09PT09PT09PT09PT09PT09CgpIdHRwUmVzcG9uc2UqIGh0dHBfcmVxdWVzdChjb25zdCBjaGFyKiBtZXRob2QsIGNvbnN0IGNoYXIqIHVybCwgY29uc3QgY2hhciogYm9keSwgY29uc3QgY2hhciogY29udGVudF90eXBlKSB7CiAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gbWFsbG9jKHNpemVvZihIdHRwUmVzcG9uc2UpKTsKICAgIGlmICghcmVzcG9uc2UpIHJldHVybiBOVUxMOwogICAgCiAgICByZXNwb25zZS0+c3RhdHVzX2NvZGUgPSAwOwogICAgcmVzcG9uc2UtPmJvZHkgPSBOVUxMOwogICAgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoID0gMDsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEhUVFAgUmVxdWVzdDogJXMgJXNcbiIgUkVTRVQsIG1ldGhvZCwgdXJsKTsKICAgICAgICBpZiAoYm9keSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBSZXF1ZXN0IGJvZHk6ICVzXG4iIFJFU0VULCBib2R5KTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIC8vIFBhcnNlIFVSTAogICAgY2hhciBob3N0WzI1Nl0gPSAibG9jYWxob3N0IjsKICAgIGludCBwb3J0ID0gODA4MDsKICAgIGNoYXIgcGF0aFsxMDI0XSA9ICIvIjsKICAgIAogICAgaWYgKHN0cm5jbXAodXJsLCAiaHR0cDovLyIsIDcpID09IDApIHsKICAgICAgICBjb25zdCBjaGFyKiBob3N0X3N0YXJ0ID0gdXJsICsgNzsKICAgICAgICBjb25zdCBjaGFyKiBwYXRoX3N0YXJ0ID0gc3RyY2hyKGhvc3Rfc3RhcnQsICcvJyk7CiAgICAgICAgY29uc3QgY2hhciogcG9ydF9zdGFydCA9IHN0cmNocihob3N0X3N0YXJ0LCAnOicpOwogICAgICAgIAogICAgICAgIGlmIChwb3J0X3N0YXJ0ICYmICghcGF0aF9zdGFydCB8fCBwb3J0X3N0YXJ0IDwgcGF0aF9zdGFydCkpIHsKICAgICAgICAgICAgLy8gSGFzIHBvcnQgYmVmb3JlIHBhdGgKICAgICAgICAgICAgc2l6ZV90IGhvc3RfbGVuID0gcG9ydF9zdGFydCAtIGhvc3Rfc3RhcnQ7CiAgICAgICAgICAgIHN0cm5jcHkoaG9zdCwgaG9zdF9zdGFydCwgaG9zdF9sZW4pOwogICAgICAgICAgICBob3N0W2hvc3RfbGVuXSA9ICdcMCc7CiAgICAgICAgICAgIHBvcnQgPSBhdG9pKHBvcnRfc3RhcnQgKyAxKTsKICAgICAgICAgICAgaWYgKHBhdGhfc3RhcnQpIHsKICAgICAgICAgICAgICAgIHN0cmNweShwYXRoLCBwYXRoX3N0YXJ0KTsKICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSBpZiAocGF0aF9zdGFydCkgewogICAgICAgICAgICAvLyBObyBwb3J0LCBoYXMgcGF0aAogICAgICAgICAgICBzaXplX3QgaG9zdF9sZW4gPSBwYXRoX3N0YXJ0IC0gaG9zdF9zdGFydDsKICAgICAgICAgICAgc3RybmNweShob3N0LCBob3N0X3N0YXJ0LCBob3N0X2xlbik7CiAgICAgICAgICAgIGhvc3RbaG9zdF9sZW5dID0gJ1wwJzsKICAgICAgICAgICAgc3RyY3B5KHBhdGgsIHBhdGhfc3RhcnQpOwogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIC8vIE5vIHBvcnQsIG5vIHBhdGgKICAgICAgICAgICAgc3RyY3B5KGhvc3QsIGhvc3Rfc3RhcnQpOwogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgLy8gQXNzdW1lIGl0J3MganVzdCBhIHBhdGgKICAgICAgICBzdHJjcHkocGF0aCwgdXJsKTsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFBhcnNlZCBVUkwgLSBIb3N0OiAlcywgUG9ydDogJWQsIFBhdGg6ICVzXG4iIFJFU0VULCBob3N0LCBwb3J0LCBwYXRoKTsKICAgIH0KICAgIAogICAgLy8gQ3JlYXRlIHNvY2tldAogICAgaW50IHNvY2tmZCA9IHNvY2tldChBRl9JTkVULCBTT0NLX1NUUkVBTSwgMCk7CiAgICBpZiAoc29ja2ZkIDwgMCkgewogICAgICAgIHBlcnJvcigic29ja2V0Iik7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTb2NrZXQgY3JlYXRpb24gZmFpbGVkOiAlc1xuIiBSRVNFVCwgc3RyZXJyb3IoZXJybm8pKTsKICAgICAgICB9CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIC8vIFNldCB0aW1lb3V0CiAgICBzdHJ1Y3QgdGltZXZhbCB0aW1lb3V0OwogICAgdGltZW91dC50dl9zZWMgPSAxMDsKICAgIHRpbWVvdXQudHZfdXNlYyA9IDA7CiAgICBzZXRzb2Nrb3B0KHNvY2tmZCwgU09MX1NPQ0tFVCwgU09fUkNWVElNRU8sICZ0aW1lb3V0LCBzaXplb2YodGltZW91dCkpOwogICAgc2V0c29ja29wdChzb2NrZmQsIFNPTF9TT0NLRVQsIFNPX1NORFRJTUVPLCAmdGltZW91dCwgc2l6ZW9mKHRpbWVvdXQpKTsKICAgIAogICAgLy8gUmVzb2x2ZSBob3N0bmFtZQogICAgc3RydWN0IGhvc3RlbnQqIHNlcnZlciA9IGdldGhvc3RieW5hbWUoaG9zdCk7CiAgICBpZiAoIXNlcnZlcikgewogICAgICAgIGZwcmludGYoc3RkZXJyLCAiRXJyb3I6IE5vIHN1Y2ggaG9zdCAlc1xuIiwgaG9zdCk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBIb3N0IHJlc29sdXRpb24gZmFpbGVkIGZvcjogJXNcbiIgUkVTRVQsIGhvc3QpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICAvLyBDb25uZWN0IHRvIHNlcnZlcgogICAgc3RydWN0IHNvY2thZGRyX2luIHNlcnZfYWRkcjsKICAgIG1lbXNldCgmc2Vydl9hZGRyLCAwLCBzaXplb2Yoc2Vydl9hZGRyKSk7CiAgICBzZXJ2X2FkZHIuc2luX2ZhbWlseSA9IEFGX0lORVQ7CiAgICBtZW1jcHkoJnNlcnZfYWRkci5zaW5fYWRkci5zX2FkZHIsIHNlcnZlci0+aF9hZGRyLCBzZXJ2ZXItPmhfbGVuZ3RoKTsKICAgIHNlcnZfYWRkci5zaW5fcG9ydCA9IGh0b25zKHBvcnQpOwogICAgCiAgICBpZiAoY29ubmVjdChzb2NrZmQsIChzdHJ1Y3Qgc29ja2FkZHIqKSZzZXJ2X2FkZHIsIHNpemVvZihzZXJ2X2FkZHIpKSA8IDApIHsKICAgICAgICBmcHJpbnRmKHN0ZGVyciwgIkVycm9yIGNvbm5lY3RpbmcgdG8gJXM6JWQ6ICVzXG4iLCBob3N0LCBwb3J0LCBzdHJlcnJvcihlcnJubykpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ29ubmVjdGlvbiBmYWlsZWQgdG8gJXM6JWQ6ICVzXG4iIFJFU0VULCBob3N0LCBwb3J0LCBzdHJlcnJvcihlcnJubykpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ29ubmVjdGVkIHN1Y2Nlc3NmdWxseSB0byAlczolZFxuIiBSRVNFVCwgaG9zdCwgcG9ydCk7CiAgICB9CiAgICAKICAgIC8vIEJ1aWxkIEhUVFAgcmVxdWVzdAogICAgY2hhciByZXF1ZXN0WzgxOTJdOwogICAgaW50IHJlcXVlc3RfbGVuOwogICAgCiAgICBpZiAoYm9keSAmJiBjb250ZW50X3R5cGUpIHsKICAgICAgICByZXF1ZXN0X2xlbiA9IHNucHJpbnRmKHJlcXVlc3QsIHNpemVvZihyZXF1ZXN0KSwKICAgICAgICAgICAgIiVzICVzIEhUVFAvMS4xXHJcbiIKICAgICAgICAgICAgIkhvc3Q6ICVzOiVkXHJcbiIKICAgICAgICAgICAgIkNvbnRlbnQtVHlwZTogJXNcclxuIgogICAgICAgICAgICAiQ29udGVudC1MZW5ndGg6ICV6dVxyXG4iCiAgICAgICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgICAgICJcclxuIgogICAgICAgICAgICAiJXMiLAogICAgICAgICAgICBtZXRob2QsIHBhdGgsIGhvc3QsIHBvcnQsIGNvbnRlbnRfdHlwZSwgc3RybGVuKGJvZHkpLCBib2R5KTsKICAgIH0gZWxzZSBpZiAoYm9keSkgewogICAgICAgIHJlcXVlc3RfbGVuID0gc25wcmludGYocmVxdWVzdCwgc2l6ZW9mKHJlcXVlc3QpLAogICAgICAgICAgICAiJXMgJXMgSFRUUC8xLjFcclxuIgogICAgICAgICAgICAiSG9zdDogJXM6JWRcclxuIgogICAgICAgICAgICAiQ29udGVudC1MZW5ndGg6ICV6dVxyXG4iCiAgICAgICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgICAgICJcclxuIgogICAgICAgICAgICAiJXMiLAogICAgICAgICAgICBtZXRob2QsIHBhdGgsIGhvc3QsIHBvcnQsIHN0cmxlbihib2R5KSwgYm9keSk7CiAgICB9IGVsc2UgewogICAgICAgIHJlcXVlc3RfbGVuID0gc25wcmludGYocmVxdWVzdCwgc2l6ZW9mKHJlcXVlc3QpLAogICAgICAgICAgICAiJXMgJXMgSFRUUC8xLjFcclxuIgogICAgICAgICAgICAiSG9zdDogJXM6JWRcclxuIgogICAgICAgICAgICAiQ29ubmVjdGlvbjogY2xvc2VcclxuIgogICAgICAgICAgICAiXHJcbiIsCiAgICAgICAgICAgIG1ldGhvZCwgcGF0aCwgaG9zdCwgcG9ydCk7CiAgICB9CiAgICAKICAgIGlmIChyZXF1ZXN0X2xlbiA+PSAoaW50KXNpemVvZihyZXF1ZXN0KSkgewogICAgICAgIGZwcmludGYoc3RkZXJyLCAiRXJyb3I6IEhUVFAgcmVxdWVzdCB0b28gbGFyZ2VcbiIpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSFRUUCByZXF1ZXN0IHRvbyBsYXJnZSAoJWQgYnl0ZXMpXG4iIFJFU0VULCByZXF1ZXN0X2xlbik7CiAgICAgICAgfQogICAgICAgIGNsb3NlKHNvY2tmZCk7CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTZW5kaW5nIEhUVFAgcmVxdWVzdCAoJWQgYnl0ZXMpOlxuJS4qc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgIHJlcXVlc3RfbGVuLCByZXF1ZXN0X2xlbiA+IDUwMCA/IDUwMCA6IHJlcXVlc3RfbGVuLCByZXF1ZXN0KTsKICAgIH0KICAgIAogICAgLy8gU2VuZCByZXF1ZXN0CiAgICBpZiAoc2VuZChzb2NrZmQsIHJlcXVlc3QsIHJlcXVlc3RfbGVuLCAwKSA8IDApIHsKICAgICAgICBwZXJyb3IoInNlbmQiKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNlbmQgZmFpbGVkOiAlc1xuIiBSRVNFVCwgc3RyZXJyb3IoZXJybm8pKTsKICAgICAgICB9CiAgICAgICAgY2xvc2Uoc29ja2ZkKTsKICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgLy8gUmVjZWl2ZSByZXNwb25zZQogICAgY2hhciByZXNwb25zZV9idWZmZXJbMTYzODRdOwogICAgc3NpemVfdCB0b3RhbF9yZWNlaXZlZCA9IDA7CiAgICBzc2l6ZV90IHJlY2VpdmVkOwogICAgCiAgICB3aGlsZSAoKHJlY2VpdmVkID0gcmVjdihzb2NrZmQsIHJlc3BvbnNlX2J1ZmZlciArIHRvdGFsX3JlY2VpdmVkLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHJlc3BvbnNlX2J1ZmZlcikgLSB0b3RhbF9yZWNlaXZlZCAtIDEsIDApKSA+IDApIHsKICAgICAgICB0b3RhbF9yZWNlaXZlZCArPSByZWNlaXZlZDsKICAgICAgICBpZiAodG90YWxfcmVjZWl2ZWQgPj0gKHNzaXplX3Qpc2l6ZW9mKHJlc3BvbnNlX2J1ZmZlcikgLSAxKSB7CiAgICAgICAgICAgIGJyZWFrOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHJlY2VpdmVkIDwgMCkgewogICAgICAgIHBlcnJvcigicmVjdiIpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUmVjZWl2ZSBmYWlsZWQ6ICVzXG4iIFJFU0VULCBzdHJlcnJvcihlcnJubykpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICByZXNwb25zZV9idWZmZXJbdG90YWxfcmVjZWl2ZWRdID0gJ1wwJzsKICAgIGNsb3NlKHNvY2tmZCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBSZWNlaXZlZCAlemQgYnl0ZXMgcmVzcG9uc2VcbiIgUkVTRVQsIHRvdGFsX3JlY2VpdmVkKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBSZXNwb25zZSAoZmlyc3QgNTAwIGJ5dGVzKTpcbiUuNTAwc1xuIiBSRVNFVCwgcmVzcG9uc2VfYnVmZmVyKTsKICAgIH0KICAgIAogICAgLy8gUGFyc2UgSFRUUCByZXNwb25zZQogICAgY2hhciogc3RhdHVzX2xpbmUgPSBzdHJzdHIocmVzcG9uc2VfYnVmZmVyLCAiSFRUUC8xLjEiKTsKICAgIGlmIChzdGF0dXNfbGluZSkgewogICAgICAgIHNzY2FuZihzdGF0dXNfbGluZSwgIkhUVFAvMS4xICVkIiwgJnJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICB9CiAgICAKICAgIC8vIEZpbmQgYm9keQogICAgY2hhciogYm9keV9zdGFydCA9IHN0cnN0cihyZXNwb25zZV9idWZmZXIsICJcclxuXHJcbiIpOwogICAgaWYgKGJvZHlfc3RhcnQpIHsKICAgICAgICBib2R5X3N0YXJ0ICs9IDQ7CiAgICAgICAgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoID0gdG90YWxfcmVjZWl2ZWQgLSAoYm9keV9zdGFydCAtIHJlc3BvbnNlX2J1ZmZlcik7CiAgICAgICAgcmVzcG9uc2UtPmJvZHkgPSBtYWxsb2MocmVzcG9uc2UtPmJvZHlfbGVuZ3RoICsgMSk7CiAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5KSB7CiAgICAgICAgICAgIG1lbWNweShyZXNwb25zZS0+Ym9keSwgYm9keV9zdGFydCwgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoKTsKICAgICAgICAgICAgcmVzcG9uc2UtPmJvZHlbcmVzcG9uc2UtPmJvZHlfbGVuZ3RoXSA9ICdcMCc7CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICAvLyBObyBib2R5IGZvdW5kCiAgICAgICAgcmVzcG9uc2UtPmJvZHkgPSBzdHJkdXAoIiIpOwogICAgICAgIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCA9IDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBQYXJzZWQgcmVzcG9uc2UgLSBTdGF0dXM6ICVkLCBCb2R5IGxlbmd0aDogJXp1XG4iIFJFU0VULCAKICAgICAgICAgICAgICAgcmVzcG9uc2UtPnN0YXR1c19jb2RlLCByZXNwb25zZS0+Ym9keV9sZW5ndGgpOwogICAgfQogICAgCiAgICByZXR1cm4gcmVzcG9uc2U7Cn0KCnZvaWQgaHR0cF9yZXNwb25zZV9mcmVlKEh0dHBSZXNwb25zZSogcmVzcG9uc2UpIHsKICAgIGlmIChyZXNwb25zZSkgewogICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICBmcmVlKHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICB9CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICB9Cn0KCmludCB2ZXJpZnlfaHR0cF9yZXNwb25zZShjb25zdCBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlLCBjb25zdCBjaGFyKiBleHBlY3RlZF9wYXR0ZXJuLCBpbnQgY2hlY2tfc3VjY2Vzc19vbmx5KSB7CiAgICBpZiAoIXJlc3BvbnNlKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBpcyBOVUxMXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBWZXJpZnlpbmcgcmVzcG9uc2UgLSBTdGF0dXM6ICVkLCBCb2R5IGxlbmd0aDogJXp1XG4iIFJFU0VULCAKICAgICAgICAgICAgICAgcmVzcG9uc2UtPnN0YXR1c19jb2RlLCByZXNwb25zZS0+Ym9keV9sZW5ndGgpOwogICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBSZXNwb25zZSBib2R5OiAlc1xuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHkpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKGNoZWNrX3N1Y2Nlc3Nfb25seSkgewogICAgICAgIC8vIE9ubHkgY2hlY2sgaWYgdGhlIHJlc3BvbnNlIGluZGljYXRlcyBzdWNjZXNzICh0cnVlKSBvciBwcm9wZXIgZXJyb3IgaGFuZGxpbmcgKGZhbHNlKQogICAgICAgIGludCByZXN1bHQgPSAocmVzcG9uc2UtPnN0YXR1c19jb2RlID49IDIwMCAmJiByZXNwb25zZS0+c3RhdHVzX2NvZGUgPCA1MDApICYmIAogICAgICAgICAgICAgICAgICAgIHJlc3BvbnNlLT5ib2R5ICYmIHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIlwic3VjY2Vzc1wiOiIpICE9IE5VTEw7CiAgICAgICAgCiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDaGVjayBzdWNjZXNzIG9ubHk6ICVzXG4iIFJFU0VULCByZXN1bHQgPyAiUEFTUyIgOiAiRkFJTCIpOwogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGF0dXMgY29kZSBjaGVjazogJWQgaW4gWzIwMCw1MDApXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBIYXMgc3VjY2VzcyBmaWVsZDogJXNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICAgICAgKHJlc3BvbnNlLT5ib2R5ICYmIHN0cnN0cihyZXNwb25zZS0+Ym9keSwgIlwic3VjY2Vzc1wiOiIpKSA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIHJldHVybiByZXN1bHQ7CiAgICB9IGVsc2UgewogICAgICAgIC8vIENoZWNrIHN0YXR1cyBjb2RlIGFuZCBleHBlY3RlZCBwYXR0ZXJuCiAgICAgICAgaWYgKHJlc3BvbnNlLT5zdGF0dXNfY29kZSA8IDIwMCB8fCByZXNwb25zZS0+c3RhdHVzX2NvZGUgPj0gMzAwKSB7CiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFN0YXR1cyBjb2RlIGNoZWNrIGZhaWxlZDogJWQgbm90IGluIFsyMDAsMzAwKVxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgfQogICAgICAgICAgICByZXR1cm4gMDsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgLy8gQ2hlY2sgZm9yIGV4cGVjdGVkIHBhdHRlcm4gaW4gYm9keQogICAgICAgIGlmIChleHBlY3RlZF9wYXR0ZXJuICYmIGV4cGVjdGVkX3BhdHRlcm5bMF0gIT0gJ1wwJykgewogICAgICAgICAgICBpZiAoIXJlc3BvbnNlLT5ib2R5IHx8IHN0cnN0cihyZXNwb25zZS0+Ym9keSwgZXhwZWN0ZWRfcGF0dGVybikgPT0gTlVMTCkgewogICAgICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFBhdHRlcm4gbm90IGZvdW5kIGluIHJlc3BvbnNlIGJvZHlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEV4cGVjdGVkOiAnJXMnXG4iIFJFU0VULCBleHBlY3RlZF9wYXR0ZXJuKTsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBHb3Q6ICclcydcbiIgUkVTRVQsIHJlc3BvbnNlLT5ib2R5ID8gcmVzcG9uc2UtPmJvZHkgOiAiTlVMTCIpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgcmV0dXJuIDA7CiAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBQYXR0ZXJuIGZvdW5kIGluIHJlc3BvbnNlIGJvZHlcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICB9CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBSZXNwb25zZSB2ZXJpZmljYXRpb24gcGFzc2VkXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcmV0dXJuIDE7Cn0KCmNoYXIqIGV4dHJhY3RfanNvbl9maWVsZChjb25zdCBjaGFyKiBqc29uLCBjb25zdCBjaGFyKiBmaWVsZCkgewogICAgaWYgKCFqc29uIHx8ICFmaWVsZCkgcmV0dXJuIE5VTEw7CiAgICAKICAgIGNoYXIgc2VhcmNoX3BhdHRlcm5bMjU2XTsKICAgIHNucHJpbnRmKHNlYXJjaF9wYXR0ZXJuLCBzaXplb2Yoc2VhcmNoX3BhdHRlcm4pLCAiXCIlc1wiOlwiIiwgZmllbGQpOwogICAgCiAgICBjaGFyKiBmaWVsZF9zdGFydCA9IHN0cnN0cihqc29uLCBzZWFyY2hfcGF0dGVybik7CiAgICBpZiAoIWZpZWxkX3N0YXJ0KSB7CiAgICAgICAgLy8gVHJ5IHdpdGhvdXQgcXVvdGVzIGZvciB0aGUgdmFsdWUKICAgICAgICBzbnByaW50ZihzZWFyY2hfcGF0dGVybiwgc2l6ZW9mKHNlYXJjaF9wYXR0ZXJuKSwgIlwiJXNcIjoiLCBmaWVsZCk7CiAgICAgICAgZmllbGRfc3RhcnQgPSBzdHJzdHIoanNvbiwgc2VhcmNoX3BhdHRlcm4pOwogICAgICAgIGlmICghZmllbGRfc3RhcnQpIHJldHVybiBOVUxMOwogICAgICAgIAogICAgICAgIGZpZWxkX3N0YXJ0ICs9IHN0cmxlbihzZWFyY2hfcGF0dGVybik7CiAgICAgICAgY2hhciogZmllbGRfZW5kID0gc3RyY2hyKGZpZWxkX3N0YXJ0LCAnLCcpOwogICAgICAgIGlmICghZmllbGRfZW5kKSBmaWVsZF9lbmQgPSBzdHJjaHIoZmllbGRfc3RhcnQsICd9Jyk7CiAgICAgICAgaWYgKCFmaWVsZF9lbmQpIHJldHVybiBOVUxMOwogICAgICAgIAogICAgICAgIHNpemVfdCBmaWVsZF9sZW5ndGggPSBmaWVsZF9lbmQgLSBmaWVsZF9zdGFydDsKICAgICAgICBjaGFyKiB2YWx1ZSA9IG1hbGxvYyhmaWVsZF9sZW5ndGggKyAxKTsKICAgICAgICBpZiAoIXZhbHVlKSByZXR1cm4gTlVMTDsKICAgICAgICAKICAgICAgICBzdHJuY3B5KHZhbHVlLCBmaWVsZF9zdGFydCwgZmllbGRfbGVuZ3RoKTsKICAgICAgICB2YWx1ZVtmaWVsZF9sZW5ndGhdID0gJ1wwJzsKICAgICAgICByZXR1cm4gdmFsdWU7CiAgICB9CiAgICAKICAgIGZpZWxkX3N0YXJ0ICs9IHN0cmxlbihzZWFyY2hfcGF0dGVybik7CiAgICBjaGFyKiBmaWVsZF9lbmQgPSBzdHJjaHIoZmllbGRfc3RhcnQsICciJyk7CiAgICBpZiAoIWZpZWxkX2VuZCkgcmV0dXJuIE5VTEw7CiAgICAKICAgIHNpemVfdCBmaWVsZF9sZW5ndGggPSBmaWVsZF9lbmQgLSBmaWVsZF9zdGFydDsKICAgIGNoYXIqIHZhbHVlID0gbWFsbG9jKGZpZWxkX2xlbmd0aCArIDEpOwogICAgaWYgKCF2YWx1ZSkgcmV0dXJuIE5VTEw7CiAgICAKICAgIHN0cm5jcHkodmFsdWUsIGZpZWxkX3N0YXJ0LCBmaWVsZF9sZW5ndGgpOwogICAgdmFsdWVbZmllbGRfbGVuZ3RoXSA9ICdcMCc7CiAgICByZXR1cm4gdmFsdWU7Cn0KCmludCBodHRwX3Rlc3RfZW5kcG9pbnQoY29uc3QgY2hhciogZGVzY3JpcHRpb24sIGNvbnN0IGNoYXIqIG1ldGhvZCwgY29uc3QgY2hhciogZW5kcG9pbnQsIAogICAgICAgICAgICAgICAgICAgICAgY29uc3QgY2hhciogYm9keSwgY29uc3QgY2hhciogZXhwZWN0ZWRfcGF0dGVybiwgaW50IGNoZWNrX3N1Y2Nlc3Nfb25seSwgbG9uZyBsb25nKiBkdXJhdGlvbikgewogICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCBkZXNjcmlwdGlvbik7CiAgICBmZmx1c2goc3Rkb3V0KTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QobWV0aG9kLCBlbmRwb2ludCwgYm9keSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGxvbmcgbG9uZyBlbmRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgaWYgKGR1cmF0aW9uKSB7CiAgICAgICAgKmR1cmF0aW9uID0gZW5kX3RpbWUgLSBzdGFydF90aW1lOwogICAgfQogICAgCiAgICBpbnQgc3VjY2VzcyA9IDA7CiAgICBpZiAocmVzcG9uc2UpIHsKICAgICAgICBzdWNjZXNzID0gdmVyaWZ5X2h0dHBfcmVzcG9uc2UocmVzcG9uc2UsIGV4cGVjdGVkX3BhdHRlcm4sIGNoZWNrX3N1Y2Nlc3Nfb25seSk7CiAgICAgICAgaWYgKCFzdWNjZXNzKSB7CiAgICAgICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGVuZF90aW1lIC0gc3RhcnRfdGltZSwgUkVTRVQpOwogICAgICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgU3RhdHVzOiAlZCwgUmVzcG9uc2U6ICVzXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUsIHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgU3RhdHVzOiAlZCwgTm8gcmVzcG9uc2UgYm9keVxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgfQogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSFRUUCBURVNUIEZBSUxVUkUgQU5BTFlTSVM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgRW5kcG9pbnQ6ICVzICVzXG4iIFJFU0VULCBtZXRob2QsIGVuZHBvaW50KTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgU3RhdHVzIENvZGU6ICVkXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBFeHBlY3RlZCBQYXR0ZXJuOiAnJXMnXG4iIFJFU0VULCBleHBlY3RlZF9wYXR0ZXJuID8gZXhwZWN0ZWRfcGF0dGVybiA6ICJOT05FIik7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIENoZWNrIFN1Y2Nlc3MgT25seTogJXNcbiIgUkVTRVQsIGNoZWNrX3N1Y2Nlc3Nfb25seSA/ICJZRVMiIDogIk5PIik7CiAgICAgICAgICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIFJlc3BvbnNlIEJvZHk6ICVzXG4iIFJFU0VULCByZXNwb25zZS0+Ym9keSk7CiAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgUmVzcG9uc2UgQm9keTogTlVMTFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGVuZF90aW1lIC0gc3RhcnRfdGltZSwgUkVTRVQpOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBIVFRQIFRFU1QgU1VDQ0VTUyBERVRBSUxTOlxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdICAgRW5kcG9pbnQ6ICVzICVzXG4iIFJFU0VULCBtZXRob2QsIGVuZHBvaW50KTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gICBTdGF0dXMgQ29kZTogJWRcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdICAgUmVzcG9uc2UgVGltZTogJWxsZCBtc1xuIiBSRVNFVCwgZW5kX3RpbWUgLSBzdGFydF90aW1lKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUocmVzcG9uc2UpOwogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl0gJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUsIFJFU0VUKTsKICAgICAgICBwcmludGYoUkVEICIgIE5vIHJlc3BvbnNlIGZyb20gc2VydmVyXG4iIFJFU0VUKTsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEhUVFAgVEVTVCBGQUlMVVJFIC0gTk8gUkVTUE9OU0U6XG4iIFJFU0VUKTsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBFbmRwb2ludDogJXMgJXNcbiIgUkVTRVQsIG1ldGhvZCwgZW5kcG9pbnQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIFNlcnZlciBtYXkgYmUgZG93biBvciB1bnJlYWNoYWJsZVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICByZXR1cm4gc3VjY2VzczsKfQoKLy8gPT09PT09PT09PT09PT09PT09PT0gSFRUUCBBUEkgVEVTVCBTVUlURSA9PT09PT09PT09PT09PT09PT09PQoKdm9pZCBjbGVhbnVwX3Rlc3RfZGF0YWJhc2VzKCkgewogICAgcHJpbnRmKCJDbGVhbmluZyB1cCBwcmV2aW91cyB0ZXN0IGRhdGFiYXNlcy4uLlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDbGVhbmluZyB1cCB0ZXN0IGRpcmVjdG9yaWVzIGluIC90bXAvc3lkYl90ZXN0L1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIC8vIFJlbW92ZSBhbGwgdGVzdCBkYXRhYmFzZXMgZnJvbSBwcmV2aW91cyBydW5zCiAgICBjaGFyIGNvbW1hbmRbNTEyXTsKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgInJtIC1yZiAvdG1wL3N5ZGJfdGVzdC90ZXN0ZGJfKiAvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIyXyogL3RtcC9zeWRiX3Rlc3QvdGVzdGNvbGxkYl8qIC90bXAvc3lkYl90ZXN0L3Rlc3RpbnN0ZGJfKiAyPi9kZXYvbnVsbCIpOwogICAgc3lzdGVtKGNvbW1hbmQpOwogICAgCiAgICAvLyBBbHNvIGNsZWFuIHVwIGFueSBsb2NrIGZpbGVzCiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICJybSAtZiAvdG1wL3N5ZGJfdGVzdC8qLmxvY2sgL3RtcC9zeWRiX3Rlc3QvLioubG9jayAyPi9kZXYvbnVsbCIpOwogICAgc3lzdGVtKGNvbW1hbmQpOwogICAgCiAgICB1c2xlZXAoNTAwMDApOyAvLyA1MG1zIHRvIGVuc3VyZSBjbGVhbnVwIGNvbXBsZXRlcwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ2xlYW51cCBjb21wbGV0ZWRcbiIgUkVTRVQpOwogICAgfQp9CgppbnQgcnVuX2h0dHBfZGF0YWJhc2VfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBEQVRBQkFTRSBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gMDsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbjsKICAgIAogICAgLy8gR2VuZXJhdGUgdW5pcXVlIGRhdGFiYXNlIG5hbWVzIHRvIGF2b2lkIGNvbmZsaWN0cwogICAgY2hhciB1bmlxdWVfZGIxWzY0XSwgdW5pcXVlX2RiMls2NF07CiAgICBzdHJ1Y3QgdGltZXNwZWMgdHM7CiAgICBjbG9ja19nZXR0aW1lKENMT0NLX01PTk9UT05JQywgJnRzKTsKICAgIHNucHJpbnRmKHVuaXF1ZV9kYjEsIHNpemVvZih1bmlxdWVfZGIxKSwgInRlc3RkYl8lbGRfJWxkIiwgdHMudHZfc2VjLCB0cy50dl9uc2VjKTsKICAgIHNucHJpbnRmKHVuaXF1ZV9kYjIsIHNpemVvZih1bmlxdWVfZGIyKSwgInRlc3RkYjJfJWxkXyVsZCIsIHRzLnR2X3NlYywgdHMudHZfbnNlYyArIDEpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gVXNpbmcgdW5pcXVlIGRhdGFiYXNlIG5hbWVzOiAlcywgJXNcbiIgUkVTRVQsIHVuaXF1ZV9kYjEsIHVuaXF1ZV9kYjIpOwogICAgfQogICAgCiAgICBjaGFyIGNyZWF0ZV9kYjFfYm9keVsxMjhdLCBjcmVhdGVfZGIyX2JvZHlbMTI4XTsKICAgIHNucHJpbnRmKGNyZWF0ZV9kYjFfYm9keSwgc2l6ZW9mKGNyZWF0ZV9kYjFfYm9keSksICJ7XCJuYW1lXCI6XCIlc1wifSIsIHVuaXF1ZV9kYjEpOwogICAgc25wcmludGYoY3JlYXRlX2RiMl9ib2R5LCBzaXplb2YoY3JlYXRlX2RiMl9ib2R5KSwgIntcIm5hbWVcIjpcIiVzXCJ9IiwgdW5pcXVlX2RiMik7CiAgICAKICAgIC8vIFRlc3QgMTogTGlzdCBkYXRhYmFzZXMgKHNob3VsZCB3b3JrIHJlZ2FyZGxlc3Mgb2YgZXhpc3RpbmcgZGF0YSkKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcyAtIExpc3QgZGF0YWJhc2VzIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsICIvYXBpL2RhdGFiYXNlcyIsIE5VTEwsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMjogQ3JlYXRlIGZpcnN0IGRhdGFiYXNlCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gQ3JlYXRlIGRhdGFiYXNlIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCBjcmVhdGVfZGIxX2JvZHksICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMzogQ3JlYXRlIHNlY29uZCBkYXRhYmFzZQogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcyAtIENyZWF0ZSBzZWNvbmQgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYjJfYm9keSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCA0OiBUcnkgdG8gY3JlYXRlIGR1cGxpY2F0ZSBkYXRhYmFzZSAoc2hvdWxkIGZhaWwgcHJvcGVybHkpCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gUHJldmVudCBkdXBsaWNhdGUgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYjFfYm9keSwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgNTogRGVsZXRlIGRhdGFiYXNlCiAgICBjaGFyIGRlbGV0ZV91cmxbMjU2XTsKICAgIHNucHJpbnRmKGRlbGV0ZV91cmwsIHNpemVvZihkZWxldGVfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzIiwgdW5pcXVlX2RiMik7CiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJERUxFVEUgL2FwaS9kYXRhYmFzZXMve25hbWV9IC0gRGVsZXRlIGRhdGFiYXNlIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkRFTEVURSIsIGRlbGV0ZV91cmwsIE5VTEwsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgRGF0YWJhc2UgQVBJIHRlc3RzOiAlZC8lZCBwYXNzZWQgKGF2ZzogJWxsZCBtcylcbiIgUkVTRVQsIAogICAgICAgICAgIHBhc3NlZCwgdG90YWwsIHRvdGFsX3RpbWUgLyAodG90YWwgPiAwID8gdG90YWwgOiAxKSk7CiAgICAKICAgIHJldHVybiBwYXNzZWQ7Cn0KCmludCBydW5faHR0cF9jb2xsZWN0aW9uX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiSFRUUCBBUEkgQ09MTEVDVElPTiBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gMDsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbjsKICAgIAogICAgLy8gVXNlIGEgdW5pcXVlIGRhdGFiYXNlIG5hbWUgdG8gYXZvaWQgY29uZmxpY3RzCiAgICBjaGFyIHVuaXF1ZV9kYls2NF07CiAgICBzdHJ1Y3QgdGltZXNwZWMgdHM7CiAgICBjbG9ja19nZXR0aW1lKENMT0NLX01PTk9UT05JQywgJnRzKTsKICAgIHNucHJpbnRmKHVuaXF1ZV9kYiwgc2l6ZW9mKHVuaXF1ZV9kYiksICJ0ZXN0Y29sbGRiXyVsZF8lbGQiLCB0cy50dl9zZWMsIHRzLnR2X25zZWMpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gVXNpbmcgdW5pcXVlIGRhdGFiYXNlIG5hbWU6ICVzXG4iIFJFU0VULCB1bmlxdWVfZGIpOwogICAgfQogICAgCiAgICBjaGFyIGNyZWF0ZV9kYl9ib2R5WzEyOF07CiAgICBzbnByaW50ZihjcmVhdGVfZGJfYm9keSwgc2l6ZW9mKGNyZWF0ZV9kYl9ib2R5KSwgIntcIm5hbWVcIjpcIiVzXCJ9IiwgdW5pcXVlX2RiKTsKICAgIAogICAgLy8gQ3JlYXRlIGEgZnJlc2ggZGF0YWJhc2UgZm9yIGNvbGxlY3Rpb24gdGVzdHMKICAgIEh0dHBSZXNwb25zZSogZGJfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCBjcmVhdGVfZGJfYm9keSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmICghZGJfcmVzcG9uc2UgfHwgIXZlcmlmeV9odHRwX3Jlc3BvbnNlKGRiX3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiICBGYWlsZWQgdG8gY3JlYXRlIHRlc3QgZGF0YWJhc2UgZm9yIGNvbGxlY3Rpb24gdGVzdHNcbiIgUkVTRVQpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRGF0YWJhc2UgY3JlYXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgaWYgKGRiX3Jlc3BvbnNlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBzdGF0dXM6ICVkLCBib2R5OiAlc1xuIiBSRVNFVCwgZGJfcmVzcG9uc2UtPnN0YXR1c19jb2RlLCBkYl9yZXNwb25zZS0+Ym9keSA/IGRiX3Jlc3BvbnNlLT5ib2R5IDogIk5VTEwiKTsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoZGJfcmVzcG9uc2UpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgaHR0cF9yZXNwb25zZV9mcmVlKGRiX3Jlc3BvbnNlKTsKICAgIAogICAgLy8gVGVzdCAxOiBMaXN0IGNvbGxlY3Rpb25zIChlbXB0eSkKICAgIGNoYXIgbGlzdF9jb2xsc191cmxbMjU2XTsKICAgIHNucHJpbnRmKGxpc3RfY29sbHNfdXJsLCBzaXplb2YobGlzdF9jb2xsc191cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMgLSBMaXN0IGVtcHR5IGNvbGxlY3Rpb25zIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIGxpc3RfY29sbHNfdXJsLCBOVUxMLCAiXCJjb2xsZWN0aW9uc1wiOltdIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMjogQ3JlYXRlIGNvbGxlY3Rpb24gd2l0aCBzY2hlbWEKICAgIGNoYXIgY3JlYXRlX2NvbGxfdXJsWzI1Nl07CiAgICBzbnByaW50ZihjcmVhdGVfY29sbF91cmwsIHNpemVvZihjcmVhdGVfY29sbF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMiLCB1bmlxdWVfZGIpOwogICAgCiAgICBjb25zdCBjaGFyKiB1c2Vyc19zY2hlbWEgPSAie1wibmFtZVwiOlwidXNlcnNcIixcInNjaGVtYVwiOlsiCiAgICAgICAgIntcIm5hbWVcIjpcIm5hbWVcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjp0cnVlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImFnZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImVtYWlsXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9IgogICAgICAgICJdfSI7CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucyAtIENyZWF0ZSB1c2VycyBjb2xsZWN0aW9uIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCBjcmVhdGVfY29sbF91cmwsIHVzZXJzX3NjaGVtYSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAzOiBDcmVhdGUgcHJvZHVjdHMgY29sbGVjdGlvbgogICAgY29uc3QgY2hhciogcHJvZHVjdHNfc2NoZW1hID0gIntcIm5hbWVcIjpcInByb2R1Y3RzXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICJ7XCJuYW1lXCI6XCJuYW1lXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6dHJ1ZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJwcmljZVwiLFwidHlwZVwiOlwiZmxvYXRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9IgogICAgICAgICJdfSI7CiAgICAKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucyAtIENyZWF0ZSBwcm9kdWN0cyBjb2xsZWN0aW9uIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCBjcmVhdGVfY29sbF91cmwsIHByb2R1Y3RzX3NjaGVtYSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCA0OiBMaXN0IGNvbGxlY3Rpb25zICh3aXRoIGRhdGEpCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucyAtIExpc3QgY3JlYXRlZCBjb2xsZWN0aW9ucyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBsaXN0X2NvbGxzX3VybCwgTlVMTCwgIlwidXNlcnNcIiIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDU6IEdldCBjb2xsZWN0aW9uIHNjaGVtYQogICAgY2hhciBzY2hlbWFfdXJsWzI1Nl07CiAgICBzbnByaW50ZihzY2hlbWFfdXJsLCBzaXplb2Yoc2NoZW1hX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9zY2hlbWEiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L3NjaGVtYSAtIEdldCB1c2VycyBzY2hlbWEiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgc2NoZW1hX3VybCwgTlVMTCwgIlwibmFtZVwiIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgNjogRGVsZXRlIGNvbGxlY3Rpb24KICAgIGNoYXIgZGVsZXRlX2NvbGxfdXJsWzI1Nl07CiAgICBzbnByaW50ZihkZWxldGVfY29sbF91cmwsIHNpemVvZihkZWxldGVfY29sbF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvcHJvZHVjdHMiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiREVMRVRFIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9IC0gRGVsZXRlIHByb2R1Y3RzIGNvbGxlY3Rpb24iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiREVMRVRFIiwgZGVsZXRlX2NvbGxfdXJsLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIENvbGxlY3Rpb24gQVBJIHRlc3RzOiAlZC8lZCBwYXNzZWQgKGF2ZzogJWxsZCBtcylcbiIgUkVTRVQsIAogICAgICAgICAgIHBhc3NlZCwgdG90YWwsIHRvdGFsX3RpbWUgLyAodG90YWwgPiAwID8gdG90YWwgOiAxKSk7CiAgICAKICAgIHJldHVybiBwYXNzZWQ7Cn0KCmludCBydW5faHR0cF9pbnN0YW5jZV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIElOU1RBTkNFIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICAvLyBVc2UgYSB1bmlxdWUgZGF0YWJhc2UgbmFtZSB0byBhdm9pZCBjb25mbGljdHMKICAgIGNoYXIgdW5pcXVlX2RiWzY0XTsKICAgIHN0cnVjdCB0aW1lc3BlYyB0czsKICAgIGNsb2NrX2dldHRpbWUoQ0xPQ0tfTU9OT1RPTklDLCAmdHMpOwogICAgc25wcmludGYodW5pcXVlX2RiLCBzaXplb2YodW5pcXVlX2RiKSwgInRlc3RpbnN0ZGJfJWxkXyVsZCIsIHRzLnR2X3NlYywgdHMudHZfbnNlYyk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBVc2luZyB1bmlxdWUgZGF0YWJhc2UgbmFtZTogJXNcbiIgUkVTRVQsIHVuaXF1ZV9kYik7CiAgICB9CiAgICAKICAgIGNoYXIgY3JlYXRlX2RiX2JvZHlbMTI4XTsKICAgIHNucHJpbnRmKGNyZWF0ZV9kYl9ib2R5LCBzaXplb2YoY3JlYXRlX2RiX2JvZHkpLCAie1wibmFtZVwiOlwiJXNcIn0iLCB1bmlxdWVfZGIpOwogICAgCiAgICAvLyBDcmVhdGUgYSBmcmVzaCBkYXRhYmFzZSBmb3IgaW5zdGFuY2UgdGVzdHMKICAgIEh0dHBSZXNwb25zZSogZGJfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCBjcmVhdGVfZGJfYm9keSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmICghZGJfcmVzcG9uc2UgfHwgIXZlcmlmeV9odHRwX3Jlc3BvbnNlKGRiX3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiICBGYWlsZWQgdG8gY3JlYXRlIHRlc3QgZGF0YWJhc2UgZm9yIGluc3RhbmNlIHRlc3RzXG4iIFJFU0VUKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIERhdGFiYXNlIGNyZWF0aW9uIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoZGJfcmVzcG9uc2UpOwogICAgCiAgICAvLyBDcmVhdGUgY29sbGVjdGlvbiBmb3IgaW5zdGFuY2VzCiAgICBjaGFyIGNyZWF0ZV9jb2xsX3VybFsyNTZdOwogICAgc25wcmludGYoY3JlYXRlX2NvbGxfdXJsLCBzaXplb2YoY3JlYXRlX2NvbGxfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zIiwgdW5pcXVlX2RiKTsKICAgIAogICAgY29uc3QgY2hhciogdXNlcnNfc2NoZW1hID0gIntcIm5hbWVcIjpcInVzZXJzXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICJ7XCJuYW1lXCI6XCJuYW1lXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6dHJ1ZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJhZ2VcIixcInR5cGVcIjpcImludFwiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICJ7XCJuYW1lXCI6XCJlbWFpbFwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSIKICAgICAgICAiXX0iOwogICAgCiAgICBIdHRwUmVzcG9uc2UqIGNvbGxfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCBjcmVhdGVfY29sbF91cmwsIHVzZXJzX3NjaGVtYSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmICghY29sbF9yZXNwb25zZSB8fCAhdmVyaWZ5X2h0dHBfcmVzcG9uc2UoY29sbF9yZXNwb25zZSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwKSkgewogICAgICAgIHByaW50ZihSRUQgIiAgRmFpbGVkIHRvIGNyZWF0ZSB0ZXN0IGNvbGxlY3Rpb24gZm9yIGluc3RhbmNlIHRlc3RzXG4iIFJFU0VUKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIENvbGxlY3Rpb24gY3JlYXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGNvbGxfcmVzcG9uc2UpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgaHR0cF9yZXNwb25zZV9mcmVlKGNvbGxfcmVzcG9uc2UpOwogICAgCiAgICAvLyBUZXN0IDE6IExpc3QgaW5zdGFuY2VzIChlbXB0eSkKICAgIGNoYXIgbGlzdF9pbnN0YW5jZXNfdXJsWzI1Nl07CiAgICBzbnByaW50ZihsaXN0X2luc3RhbmNlc191cmwsIHNpemVvZihsaXN0X2luc3RhbmNlc191cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzIiwgdW5pcXVlX2RiKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBMaXN0IGVtcHR5IGluc3RhbmNlcyIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBsaXN0X2luc3RhbmNlc191cmwsIE5VTEwsICJcImluc3RhbmNlc1wiOltdIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMjogSW5zZXJ0IGZpcnN0IGluc3RhbmNlCiAgICBjb25zdCBjaGFyKiB1c2VyMSA9ICJ7XCJuYW1lXCI6XCJKb2huIERvZVwiLFwiYWdlXCI6MzAsXCJlbWFpbFwiOlwiam9obkB0ZXN0LmNvbVwifSI7CiAgICBjaGFyIGluc2VydF91cmxbMjU2XTsKICAgIHNucHJpbnRmKGluc2VydF91cmwsIHNpemVvZihpbnNlcnRfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcyIsIHVuaXF1ZV9kYik7CiAgICAKICAgIEh0dHBSZXNwb25zZSogaW5zZXJ0X3Jlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgaW5zZXJ0X3VybCwgdXNlcjEsICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICBpZiAoaW5zZXJ0X3Jlc3BvbnNlICYmIHZlcmlmeV9odHRwX3Jlc3BvbnNlKGluc2VydF9yZXNwb25zZSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwKSkgewogICAgICAgIGNoYXIqIGlkMSA9IGV4dHJhY3RfanNvbl9maWVsZChpbnNlcnRfcmVzcG9uc2UtPmJvZHksICJpZCIpOwogICAgICAgIGlmIChpZDEpIHsKICAgICAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBJbnNlcnQgZmlyc3QgdXNlciIpOwogICAgICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGR1cmF0aW9uLCBSRVNFVCk7CiAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBJbnNlcnRlZCB1c2VyIHdpdGggSUQ6ICVzXG4iIFJFU0VULCBpZDEpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIAogICAgICAgICAgICAvLyBUZXN0IDM6IEluc2VydCBzZWNvbmQgaW5zdGFuY2UKICAgICAgICAgICAgY29uc3QgY2hhciogdXNlcjIgPSAie1wibmFtZVwiOlwiSmFuZSBTbWl0aFwiLFwiYWdlXCI6MjUsXCJlbWFpbFwiOlwiamFuZUB0ZXN0LmNvbVwifSI7CiAgICAgICAgICAgIEh0dHBSZXNwb25zZSogaW5zZXJ0X3Jlc3BvbnNlMiA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsIGluc2VydF91cmwsIHVzZXIyLCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgICAgICAgICBpZiAoaW5zZXJ0X3Jlc3BvbnNlMiAmJiB2ZXJpZnlfaHR0cF9yZXNwb25zZShpbnNlcnRfcmVzcG9uc2UyLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIEluc2VydCBzZWNvbmQgdXNlciIpOwogICAgICAgICAgICAgICAgcHJpbnRmKCJbIiBHUkVFTiAiUEFTUyIgUkVTRVQgIl0gJXMlNGxsZCBtcyVzXG4iLCBDWUFOLCBkdXJhdGlvbiwgUkVTRVQpOwogICAgICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIC8vIFRlc3QgNDogTGlzdCBpbnN0YW5jZXMgKHdpdGggZGF0YSkKICAgICAgICAgICAgICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBMaXN0IHVzZXJzIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIGxpc3RfaW5zdGFuY2VzX3VybCwgTlVMTCwgIkpvaG4gRG9lIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIC8vIFRlc3QgNTogUXVlcnkgaW5zdGFuY2VzCiAgICAgICAgICAgICAgICBjaGFyIHF1ZXJ5X3VybFs1MTJdOwogICAgICAgICAgICAgICAgc25wcmludGYocXVlcnlfdXJsLCBzaXplb2YocXVlcnlfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcz9xdWVyeT1hZ2U6MzAiLCB1bmlxdWVfZGIpOwogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvLi4uL2luc3RhbmNlcz9xdWVyeT1hZ2U6MzAgLSBRdWVyeSBieSBhZ2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgcXVlcnlfdXJsLCBOVUxMLCAiSm9obiBEb2UiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB0b3RhbCsrOwogICAgICAgICAgICAgICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgLy8gVGVzdCA2OiBVcGRhdGUgaW5zdGFuY2UKICAgICAgICAgICAgICAgIGNoYXIgdXBkYXRlX3VybFsyNTZdOwogICAgICAgICAgICAgICAgc25wcmludGYodXBkYXRlX3VybCwgc2l6ZW9mKHVwZGF0ZV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzLyVzIiwgdW5pcXVlX2RiLCBpZDEpOwogICAgICAgICAgICAgICAgY29uc3QgY2hhciogdXBkYXRlX2RhdGEgPSAie1wiYWdlXCI6MzUsXCJlbWFpbFwiOlwiam9obi51cGRhdGVkQHRlc3QuY29tXCJ9IjsKICAgICAgICAgICAgICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBVVCAvYXBpLy4uLi9pbnN0YW5jZXMve2lkfSAtIFVwZGF0ZSB1c2VyIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIlBVVCIsIHVwZGF0ZV91cmwsIHVwZGF0ZV9kYXRhLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHRvdGFsKys7CiAgICAgICAgICAgICAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAvLyBUZXN0IDc6IERlbGV0ZSBpbnN0YW5jZQogICAgICAgICAgICAgICAgY2hhciBkZWxldGVfdXJsWzI1Nl07CiAgICAgICAgICAgICAgICBzbnByaW50ZihkZWxldGVfdXJsLCBzaXplb2YoZGVsZXRlX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9pbnN0YW5jZXMvJXMiLCB1bmlxdWVfZGIsIGlkMSk7CiAgICAgICAgICAgICAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJERUxFVEUgL2FwaS8uLi4vaW5zdGFuY2VzL3tpZH0gLSBEZWxldGUgdXNlciIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJERUxFVEUiLCBkZWxldGVfdXJsLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHRvdGFsKys7CiAgICAgICAgICAgICAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoaW5zZXJ0X3Jlc3BvbnNlMik7CiAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIEluc2VydCBzZWNvbmQgdXNlciIpOwogICAgICAgICAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdXG4iKTsKICAgICAgICAgICAgICAgIHRvdGFsKys7CiAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU2Vjb25kIHVzZXIgaW5zZXJ0aW9uIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICAgICAgCiAgICAgICAgICAgIGZyZWUoaWQxKTsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGluc2VydF9yZXNwb25zZSk7CiAgICB9IGVsc2UgewogICAgICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gSW5zZXJ0IGZpcnN0IHVzZXIiKTsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl1cbiIpOwogICAgICAgIHRvdGFsKys7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBGaXJzdCB1c2VyIGluc2VydGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0KICAgIHRvdGFsKys7CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgSW5zdGFuY2UgQVBJIHRlc3RzOiAlZC8lZCBwYXNzZWQgKGF2ZzogJWxsZCBtcylcbiIgUkVTRVQsIAogICAgICAgICAgIHBhc3NlZCwgdG90YWwsIHRvdGFsX3RpbWUgLyAodG90YWwgPiAwID8gdG90YWwgOiAxKSk7CiAgICAKICAgIHJldHVybiBwYXNzZWQ7Cn0KCmludCBydW5faHR0cF9jb21tYW5kX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiSFRUUCBBUEkgQ09NTUFORCBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gMDsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAxOiBFeGVjdXRlIGNvbW1hbmQKICAgIGNvbnN0IGNoYXIqIGNvbW1hbmQgPSAie1wiY29tbWFuZFwiOlwibGlzdFwiLFwiYXJndW1lbnRzXCI6W119IjsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9leGVjdXRlIC0gRXhlY3V0ZSBsaXN0IGNvbW1hbmQiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2V4ZWN1dGUiLCBjb21tYW5kLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIENvbW1hbmQgQVBJIHRlc3RzOiAlZC8lZCBwYXNzZWQgKGF2ZzogJWxsZCBtcylcbiIgUkVTRVQsIAogICAgICAgICAgIHBhc3NlZCwgdG90YWwsIHRvdGFsX3RpbWUgLyB0b3RhbCk7CiAgICAKICAgIHJldHVybiBwYXNzZWQ7Cn0KCmludCBydW5faHR0cF9lcnJvcl90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIEVSUk9SIEhBTkRMSU5HIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDE6IEludmFsaWQgZGF0YWJhc2UgbmFtZQogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcyAtIEludmFsaWQgZGF0YWJhc2UgbmFtZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgIntcIm5hbWVcIjpcImludmFsaWQvbmFtZVwifSIsICJcInN1Y2Nlc3NcIjpmYWxzZSIsIDEsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDI6IE5vbi1leGlzdGVudCBkYXRhYmFzZSBjb2xsZWN0aW9ucyAoc2hvdWxkIHJldHVybiBwcm9wZXIgZXJyb3IpCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMvbm9uZXhpc3RlbnQvY29sbGVjdGlvbnMgLSBOb24tZXhpc3RlbnQgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgIi9hcGkvZGF0YWJhc2VzL25vbmV4aXN0ZW50L2NvbGxlY3Rpb25zIiwgTlVMTCwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMzogTm9uLWV4aXN0ZW50IGNvbGxlY3Rpb24gaW5zdGFuY2VzCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMvdGVzdGRiL2NvbGxlY3Rpb25zL25vbmV4aXN0ZW50L2luc3RhbmNlcyAtIE5vbi1leGlzdGVudCBjb2xsZWN0aW9uIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsICIvYXBpL2RhdGFiYXNlcy90ZXN0ZGIvY29sbGVjdGlvbnMvbm9uZXhpc3RlbnQvaW5zdGFuY2VzIiwgTlVMTCwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgNDogSW52YWxpZCBKU09OCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gSW52YWxpZCBKU09OIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCAiaW52YWxpZCBqc29uIiwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgNTogTWV0aG9kIG5vdCBhbGxvd2VkCiAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQQVRDSCIsICIvYXBpL2RhdGFiYXNlcy90ZXN0ZGIiLCBOVUxMLCBOVUxMKTsKICAgIGlmIChyZXNwb25zZSAmJiByZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gNDA1KSB7CiAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUEFUQ0ggL2FwaS9kYXRhYmFzZXMvdGVzdGRiIC0gTWV0aG9kIG5vdCBhbGxvd2VkIik7CiAgICAgICAgcHJpbnRmKCJbIiBHUkVFTiAiUEFTUyIgUkVTRVQgIl1cbiIpOwogICAgICAgIHBhc3NlZCsrOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBNZXRob2Qgbm90IGFsbG93ZWQgaGFuZGxlZCBjb3JyZWN0bHlcbiIgUkVTRVQpOwogICAgICAgIH0KICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUEFUQ0ggL2FwaS9kYXRhYmFzZXMvdGVzdGRiIC0gTWV0aG9kIG5vdCBhbGxvd2VkIik7CiAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdXG4iKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEV4cGVjdGVkIDQwNSBNZXRob2QgTm90IEFsbG93ZWQsIGdvdDogJWRcbiIgUkVTRVQsIHJlc3BvbnNlID8gcmVzcG9uc2UtPnN0YXR1c19jb2RlIDogMCk7CiAgICAgICAgfQogICAgfQogICAgdG90YWwrKzsKICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgRXJyb3IgaGFuZGxpbmcgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKLy8gPT09PT09PT09PT09PT09PT09PT0gQ0xJIFRFU1QgU1VJVEVTID09PT09PT09PT09PT09PT09PT09Cgp2b2lkIHJ1bl9zZWN1cml0eV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIlNFQ1VSSVRZIFRFU1RTIC0gUGF0aCB2YWxpZGF0aW9uIGFuZCBpbmplY3Rpb24gcHJldmVudGlvbiIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBzZWN1cml0eSB0ZXN0cyB3aXRoIHZlcmJvc2UgbG9nZ2luZ1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIFRlc3RDYXNlIHNlY3VyaXR5X3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiUHJldmVudCBkaXJlY3RvcnkgdHJhdmVyc2FsIGluIGRhdGFiYXNlIG5hbWVzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSAnLi4vZXZpbCcgMj4mMSB8IGdyZXAgLWkgJ2ludmFsaWRcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAidGVzdCAhIC1kICcvdG1wL3N5ZGJfdGVzdC8uLi9ldmlsJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlByZXZlbnQgZGlyZWN0b3J5IHRyYXZlcnNhbCBpbiBjb2xsZWN0aW9uIG5hbWVzIiwgCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiICcuLi8uLi9ldmlsJyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nIDI+JjEgfCBncmVwIC1pICdpbnZhbGlkXFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgInRlc3QgISAtZCAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiLy4uLy4uL2V2aWwnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUmVqZWN0IGludmFsaWQgZGF0YWJhc2UgbmFtZXMgd2l0aCBzcGVjaWFsIGNoYXJzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSAnaW52YWxpZC9uYW1lJyAyPiYxIHwgZ3JlcCAtaSAnaW52YWxpZFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJ0ZXN0ICEgLWQgJy90bXAvc3lkYl90ZXN0L2ludmFsaWQvbmFtZSciLCAKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCBzZWN1cml0eV9jb3VudCA9IHNpemVvZihzZWN1cml0eV90ZXN0cykgLyBzaXplb2Yoc2VjdXJpdHlfdGVzdHNbMF0pOwogICAgaW50IHNlY3VyaXR5X3Bhc3NlZCA9IDA7CiAgICAKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgc2VjdXJpdHlfY291bnQ7IGkrKykgewogICAgICAgIC8vIFJlcGxhY2UgJXMgd2l0aCBjbGlfY29tbWFuZCBpbiBib3RoIGNvbW1hbmQgYW5kIHZlcmlmaWNhdGlvbl9jb21tYW5kCiAgICAgICAgY2hhciBmaW5hbF9jb21tYW5kWzEwMjRdOwogICAgICAgIGNoYXIgZmluYWxfdmVyaWZpY2F0aW9uWzEwMjRdOwogICAgICAgIAogICAgICAgIHNucHJpbnRmKGZpbmFsX2NvbW1hbmQsIHNpemVvZihmaW5hbF9jb21tYW5kKSwgc2VjdXJpdHlfdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIHNucHJpbnRmKGZpbmFsX3ZlcmlmaWNhdGlvbiwgc2l6ZW9mKGZpbmFsX3ZlcmlmaWNhdGlvbiksIHNlY3VyaXR5X3Rlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgCiAgICAgICAgc3RyY3B5KHNlY3VyaXR5X3Rlc3RzW2ldLmNvbW1hbmQsIGZpbmFsX2NvbW1hbmQpOwogICAgICAgIHN0cmNweShzZWN1cml0eV90ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgZmluYWxfdmVyaWZpY2F0aW9uKTsKICAgICAgICAKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZzZWN1cml0eV90ZXN0c1tpXSkpIHsKICAgICAgICAgICAgc2VjdXJpdHlfcGFzc2VkKys7CiAgICAgICAgfQogICAgfQogICAgCiAgICBwcmludGYoWUVMTE9XICIgIFNlY3VyaXR5IHRlc3RzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIHNlY3VyaXR5X3Bhc3NlZCwgc2VjdXJpdHlfY291bnQpOwp9Cgp2b2lkIHJ1bl9kYXRhX2ludGVncml0eV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkRBVEEgSU5URUdSSVRZIFRFU1RTIC0gQ1JDIHZhbGlkYXRpb24gYW5kIGZpbGUgc3RydWN0dXJlIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFN0YXJ0aW5nIGRhdGEgaW50ZWdyaXR5IHRlc3RzXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgLy8gQ3JlYXRlIHRlc3QgZGF0YWJhc2UgYW5kIGNvbGxlY3Rpb24gZmlyc3QKICAgIGNoYXIgY3JlYXRlX2RiX2NtZFsyNTZdOwogICAgY2hhciBjcmVhdGVfY29sbGVjdGlvbl9jbWRbMjU2XTsKICAgIGNoYXIgaW5zZXJ0X2NtZFsyNTZdOwogICAgCiAgICBzbnByaW50ZihjcmVhdGVfZGJfY21kLCBzaXplb2YoY3JlYXRlX2RiX2NtZCksICIlcyBjcmVhdGUgaW50ZWdyaXR5ZGIgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIHNucHJpbnRmKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCwgc2l6ZW9mKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCksICIlcyBjcmVhdGUgaW50ZWdyaXR5ZGIgZGF0YSAtLXNjaGVtYSAtLXZhbHVlLXN0cmluZy1yZXEgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIHNucHJpbnRmKGluc2VydF9jbWQsIHNpemVvZihpbnNlcnRfY21kKSwgIiVzIGNyZWF0ZSBpbnRlZ3JpdHlkYiBkYXRhIC0taW5zZXJ0LW9uZSAtLXZhbHVlLVwidGVzdF9kYXRhXzFcIiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgCiAgICBzeXN0ZW0oY3JlYXRlX2RiX2NtZCk7CiAgICBzeXN0ZW0oY3JlYXRlX2NvbGxlY3Rpb25fY21kKTsKICAgIHN5c3RlbShpbnNlcnRfY21kKTsKICAgIAogICAgVGVzdENhc2UgaW50ZWdyaXR5X3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiRGF0YSBmaWxlIGhhcyB2YWxpZCBoZWFkZXIgc3RydWN0dXJlIiwKICAgICAgICAgICAgImVjaG8gJ0hlYWRlciBjaGVjaycgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiaGV4ZHVtcCAtQyAvdG1wL3N5ZGJfdGVzdC9pbnRlZ3JpdHlkYi9kYXRhL2RhdGEuc3lkYiB8IGhlYWQgLTIgfCBncmVwIC1xICdTWURCJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkRhdGEgZmlsZSBncm93cyB3aXRoIGluc2VydHMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIGludGVncml0eWRiIGRhdGEgLS1pbnNlcnQtb25lIC0tdmFsdWUtXCJ0ZXN0X2RhdGFfMlwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAibHMgLWwgL3RtcC9zeWRiX3Rlc3QvaW50ZWdyaXR5ZGIvZGF0YS9kYXRhLnN5ZGIgfCBhd2sgJ3twcmludCAkNX0nIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCBpbnRlZ3JpdHlfY291bnQgPSBzaXplb2YoaW50ZWdyaXR5X3Rlc3RzKSAvIHNpemVvZihpbnRlZ3JpdHlfdGVzdHNbMF0pOwogICAgaW50IGludGVncml0eV9wYXNzZWQgPSAwOwogICAgCiAgICBmb3IgKGludCBpID0gMDsgaSA8IGludGVncml0eV9jb3VudDsgaSsrKSB7CiAgICAgICAgLy8gUmVwbGFjZSAlcyB3aXRoIGNsaV9jb21tYW5kCiAgICAgICAgaWYgKHN0cnN0cihpbnRlZ3JpdHlfdGVzdHNbaV0uY29tbWFuZCwgIiVzIikgIT0gTlVMTCkgewogICAgICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgICAgIHNucHJpbnRmKGZpbmFsX2NvbW1hbmQsIHNpemVvZihmaW5hbF9jb21tYW5kKSwgaW50ZWdyaXR5X3Rlc3RzW2ldLmNvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAgICAgc3RyY3B5KGludGVncml0eV90ZXN0c1tpXS5jb21tYW5kLCBmaW5hbF9jb21tYW5kKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgaWYgKGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbigmaW50ZWdyaXR5X3Rlc3RzW2ldKSkgewogICAgICAgICAgICBpbnRlZ3JpdHlfcGFzc2VkKys7CiAgICAgICAgfQogICAgfQogICAgCiAgICBwcmludGYoWUVMTE9XICIgIERhdGEgaW50ZWdyaXR5IHRlc3RzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIGludGVncml0eV9wYXNzZWQsIGludGVncml0eV9jb3VudCk7Cn0KCnZvaWQgcnVuX3BlcmZvcm1hbmNlX3Rlc3QoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJQRVJGT1JNQU5DRSBBTkQgU0NBTEFCSUxJVFkgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgcGVyZm9ybWFuY2UgdGVzdHNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICAvLyBTZXR1cCBwZXJmb3JtYW5jZSBkYXRhYmFzZQogICAgcHJpbnRmKCJTZXR0aW5nIHVwIHBlcmZvcm1hbmNlIGRhdGFiYXNlLi4uXG4iKTsKICAgIGNoYXIgY3JlYXRlX2RiX2NtZFsyNTZdOwogICAgY2hhciBjcmVhdGVfY29sbGVjdGlvbl9jbWRbMjU2XTsKICAgIAogICAgc25wcmludGYoY3JlYXRlX2RiX2NtZCwgc2l6ZW9mKGNyZWF0ZV9kYl9jbWQpLCAiJXMgY3JlYXRlIHBlcmZkYiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgc25wcmludGYoY3JlYXRlX2NvbGxlY3Rpb25fY21kLCBzaXplb2YoY3JlYXRlX2NvbGxlY3Rpb25fY21kKSwgIiVzIGNyZWF0ZSBwZXJmZGIgdXNlcnMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZy1yZXEgLS1hZ2UtaW50IC0tZW1haWwtc3RyaW5nID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICAKICAgIHN5c3RlbShjcmVhdGVfZGJfY21kKTsKICAgIHN5c3RlbShjcmVhdGVfY29sbGVjdGlvbl9jbWQpOwogICAgCiAgICAvLyBUZXN0IDE6IFNpbmdsZSBpbnNlcnQgcGVyZm9ybWFuY2UKICAgIGNoYXIgc2luZ2xlX2luc2VydF9jbWRbMjU2XTsKICAgIHNucHJpbnRmKHNpbmdsZV9pbnNlcnRfY21kLCBzaXplb2Yoc2luZ2xlX2luc2VydF9jbWQpLCAiJXMgY3JlYXRlIHBlcmZkYiB1c2VycyAtLWluc2VydC1vbmUgLS1uYW1lLVwiU2luZ2xlVXNlclwiIC0tYWdlLTMwIC0tZW1haWwtXCJzaW5nbGVAdGVzdC5jb21cIiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgCiAgICBsb25nIGxvbmcgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIHN5c3RlbShzaW5nbGVfaW5zZXJ0X2NtZCk7CiAgICBsb25nIGxvbmcgc2luZ2xlX2luc2VydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNpbmdsZSBpbnNlcnQgdGltZTogJWxsZCBtc1xuIiBSRVNFVCwgc2luZ2xlX2luc2VydF90aW1lKTsKICAgIH0KICAgIAogICAgLy8gVGVzdCAyOiBCYXRjaCBpbnNlcnQgcGVyZm9ybWFuY2UKICAgIGludCBiYXRjaF9zaXplID0gNTA7CiAgICBwcmludGYoIkluc2VydGluZyAlZCByZWNvcmRzIGZvciBiYXRjaCBwZXJmb3JtYW5jZS4uLlxuIiwgYmF0Y2hfc2l6ZSk7CiAgICAKICAgIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICBpbnQgc3VjY2Vzc19jb3VudCA9IDA7CiAgICAKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmF0Y2hfc2l6ZTsgaSsrKSB7CiAgICAgICAgY2hhciBjb21tYW5kWzUxMl07CiAgICAgICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLAogICAgICAgICAgICAgICAgICIlcyBjcmVhdGUgcGVyZmRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJVc2VyJWRcIiAtLWFnZS0lZCAtLWVtYWlsLVwidXNlciVkQHRlc3QuY29tXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICAgICAgY2xpX2NvbW1hbmQsIGksIDIwICsgKGkgJSA0MCksIGkpOwogICAgICAgIAogICAgICAgIGlmIChzeXN0ZW0oY29tbWFuZCkgPT0gMCkgewogICAgICAgICAgICBzdWNjZXNzX2NvdW50Kys7CiAgICAgICAgfQogICAgfQogICAgCiAgICBsb25nIGxvbmcgYmF0Y2hfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICBkb3VibGUgYXZnX2JhdGNoX3RpbWUgPSAoZG91YmxlKWJhdGNoX3RpbWUgLyBiYXRjaF9zaXplOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQmF0Y2ggaW5zZXJ0OiAlZC8lZCBzdWNjZXNzZnVsLCB0b3RhbCB0aW1lOiAlbGxkIG1zLCBhdmc6ICUuMmYgbXNcbiIgUkVTRVQsIAogICAgICAgICAgICAgICBzdWNjZXNzX2NvdW50LCBiYXRjaF9zaXplLCBiYXRjaF90aW1lLCBhdmdfYmF0Y2hfdGltZSk7CiAgICB9CiAgICAKICAgIC8vIFRlc3QgMzogUXVlcnkgcGVyZm9ybWFuY2UKICAgIHByaW50ZigiVGVzdGluZyBxdWVyeSBwZXJmb3JtYW5jZS4uLlxuIik7CiAgICBjaGFyIHF1ZXJ5X2NtZFsyNTZdOwogICAgc25wcmludGYocXVlcnlfY21kLCBzaXplb2YocXVlcnlfY21kKSwgIiVzIGZpbmQgcGVyZmRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6MjVcIiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgCiAgICBzdGFydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgc3lzdGVtKHF1ZXJ5X2NtZCk7CiAgICBsb25nIGxvbmcgcXVlcnlfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBRdWVyeSB0aW1lOiAlbGxkIG1zXG4iIFJFU0VULCBxdWVyeV90aW1lKTsKICAgIH0KICAgIAogICAgLy8gVGVzdCA0OiBDb3VudCB2ZXJpZmljYXRpb24KICAgIGludCBhY3R1YWxfY291bnQgPSBjb3VudF9pbnN0YW5jZXNfaW5fY29sbGVjdGlvbigicGVyZmRiIiwgInVzZXJzIik7CiAgICAKICAgIHByaW50ZigiXG5QZXJmb3JtYW5jZSBSZXN1bHRzOlxuIik7CiAgICBwcmludGYoIiAgU2luZ2xlIGluc2VydDogIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiXG4iLCBzaW5nbGVfaW5zZXJ0X3RpbWUpOwogICAgcHJpbnRmKCIgIEJhdGNoIGluc2VydCAoJWQgcmVjb3Jkcyk6ICIgQ1lBTiAiJWxsZCBtcyIgUkVTRVQgIiAoYXZnOiAiIENZQU4gIiUuMmYgbXMiIFJFU0VUICIpXG4iLCAKICAgICAgICAgICBiYXRjaF9zaXplLCBiYXRjaF90aW1lLCBhdmdfYmF0Y2hfdGltZSk7CiAgICBwcmludGYoIiAgUXVlcnkgdGltZTogIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiXG4iLCBxdWVyeV90aW1lKTsKICAgIHByaW50ZigiICBJbnNlcnQgc3VjY2VzcyByYXRlOiAiIEdSRUVOICIlZC8lZCIgUkVTRVQgIlxuIiwgc3VjY2Vzc19jb3VudCwgYmF0Y2hfc2l6ZSk7CiAgICBwcmludGYoIiAgUmVjb3JkIGNvdW50IHZlcmlmaWNhdGlvbjogIiBHUkVFTiAiJWQiIFJFU0VUICIgcmVjb3JkcyBpbiBjb2xsZWN0aW9uXG4iLCBhY3R1YWxfY291bnQpOwogICAgCiAgICAvLyBQZXJmb3JtYW5jZSB0aHJlc2hvbGRzIChhZGp1c3QgYmFzZWQgb24geW91ciByZXF1aXJlbWVudHMpCiAgICBpbnQgcGVyZm9ybWFuY2Vfb2sgPSAoc2luZ2xlX2luc2VydF90aW1lIDwgMTAwMCkgJiYgKGF2Z19iYXRjaF90aW1lIDwgNTAwKSAmJiAocXVlcnlfdGltZSA8IDUwMCk7CiAgICBpZiAocGVyZm9ybWFuY2Vfb2spIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAg4pyTIFBlcmZvcm1hbmNlIHdpdGhpbiBhY2NlcHRhYmxlIGxpbWl0c1xuIiBSRVNFVCk7CiAgICB9IGVsc2UgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAg4pqgIFBlcmZvcm1hbmNlIG1heSBuZWVkIG9wdGltaXphdGlvblxuIiBSRVNFVCk7CiAgICB9Cn0KCnZvaWQgcnVuX2VkZ2VfY2FzZV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkVER0UgQ0FTRSBBTkQgRVJST1IgSEFORExJTkcgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgZWRnZSBjYXNlIHRlc3RzXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgVGVzdENhc2UgZWRnZV90ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBkdXBsaWNhdGUgZGF0YWJhc2UgY3JlYXRpb24iLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiAyPiYxIHwgZ3JlcCAtaSAnZXhpc3RcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiJXMgbGlzdCB8IGdyZXAgLWMgdGVzdGRiIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIGR1cGxpY2F0ZSBjb2xsZWN0aW9uIGNyZWF0aW9uIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgdXNlcnMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZyAyPiYxIHwgZ3JlcCAtaSAnZXhpc3RcXHxlcnJvcicgPiAvZGV2L251bGwiLCAKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHwgZ3JlcCAtYyB1c2VycyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBtaXNzaW5nIGRhdGFiYXNlIHF1ZXJpZXMiLAogICAgICAgICAgICAiJXMgZmluZCBub25leGlzdGVudGRiIHVzZXJzIC0td2hlcmUgXCJuYW1lOnRlc3RcIiAyPiYxIHwgZ3JlcCAtaSAnZXhpc3RcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiZWNobyAnRXJyb3IgaGFuZGxlZCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgbWlzc2luZyBjb2xsZWN0aW9uIHF1ZXJpZXMiLCAKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIG5vbmV4aXN0ZW50IC0td2hlcmUgXCJuYW1lOnRlc3RcIiAyPiYxIHwgZ3JlcCAtaSAnZXhpc3RcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiZWNobyAnRXJyb3IgaGFuZGxlZCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgbWFsZm9ybWVkIHF1ZXJpZXMiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImludmFsaWQtcXVlcnktZm9ybWF0XCIgMj4mMSB8IGdyZXAgLWkgJ2Vycm9yXFx8aW52YWxpZCcgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiZWNobyAnRXJyb3IgaGFuZGxlZCciLCAKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIHNjaGVtYSB2YWxpZGF0aW9uIGZhaWx1cmVzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgdXNlcnMgLS1pbnNlcnQtb25lIC0taW52YWxpZC1maWVsZC1cInZhbHVlXCIgMj4mMSB8IGdyZXAgLWkgJ2Vycm9yXFx8dmFsaWQnID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgImVjaG8gJ1ZhbGlkYXRpb24gd29ya2VkJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9CiAgICB9OwogICAgCiAgICBpbnQgZWRnZV9jb3VudCA9IHNpemVvZihlZGdlX3Rlc3RzKSAvIHNpemVvZihlZGdlX3Rlc3RzWzBdKTsKICAgIGludCBlZGdlX3Bhc3NlZCA9IDA7CiAgICAKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgZWRnZV9jb3VudDsgaSsrKSB7CiAgICAgICAgLy8gUmVwbGFjZSAlcyB3aXRoIGNsaV9jb21tYW5kIGluIGJvdGggY29tbWFuZCBhbmQgdmVyaWZpY2F0aW9uX2NvbW1hbmQKICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgY2hhciBmaW5hbF92ZXJpZmljYXRpb25bMTAyNF07CiAgICAgICAgCiAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCBlZGdlX3Rlc3RzW2ldLmNvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICBzbnByaW50ZihmaW5hbF92ZXJpZmljYXRpb24sIHNpemVvZihmaW5hbF92ZXJpZmljYXRpb24pLCBlZGdlX3Rlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgCiAgICAgICAgc3RyY3B5KGVkZ2VfdGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgc3RyY3B5KGVkZ2VfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGZpbmFsX3ZlcmlmaWNhdGlvbik7CiAgICAgICAgCiAgICAgICAgaWYgKGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbigmZWRnZV90ZXN0c1tpXSkpIHsKICAgICAgICAgICAgZWRnZV9wYXNzZWQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgRWRnZSBjYXNlIHRlc3RzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIGVkZ2VfcGFzc2VkLCBlZGdlX2NvdW50KTsKfQoKdm9pZCBydW5fY29tcHJlaGVuc2l2ZV92ZXJpZmljYXRpb24oKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJDT01QUkVIRU5TSVZFIFNUUlVDVFVSRSBWRVJJRklDQVRJT04iIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgY29tcHJlaGVuc2l2ZSBzdHJ1Y3R1cmUgdmVyaWZpY2F0aW9uXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgaW50IHZlcmlmaWNhdGlvbl9wYXNzZWQgPSAwOwogICAgaW50IHZlcmlmaWNhdGlvbl90b3RhbCA9IDA7CiAgICAKICAgIC8vIFZlcmlmeSB0ZXN0ZGIgc3RydWN0dXJlCiAgICBwcmludGYoIlZlcmlmeWluZyB0ZXN0ZGIgc3RydWN0dXJlLi4uXG4iKTsKICAgIGlmICh2ZXJpZnlfZGF0YWJhc2Vfc3RydWN0dXJlKCJ0ZXN0ZGIiKSkgdmVyaWZpY2F0aW9uX3Bhc3NlZCsrOwogICAgdmVyaWZpY2F0aW9uX3RvdGFsKys7CiAgICAKICAgIGlmICh2ZXJpZnlfY29sbGVjdGlvbl9zdHJ1Y3R1cmUoInRlc3RkYiIsICJ1c2VycyIpKSB2ZXJpZmljYXRpb25fcGFzc2VkKys7CiAgICB2ZXJpZmljYXRpb25fdG90YWwrKzsKICAgIAogICAgaWYgKHZlcmlmeV9jb2xsZWN0aW9uX3N0cnVjdHVyZSgidGVzdGRiIiwgInByb2R1Y3RzIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBpZiAodmVyaWZ5X3NjaGVtYV9jb250ZW50KCJ0ZXN0ZGIiLCAidXNlcnMiLCAibmFtZSIpKSB2ZXJpZmljYXRpb25fcGFzc2VkKys7CiAgICB2ZXJpZmljYXRpb25fdG90YWwrKzsKICAgIAogICAgLy8gVmVyaWZ5IHRlc3RkYjIgc3RydWN0dXJlICAKICAgIHByaW50ZigiVmVyaWZ5aW5nIHRlc3RkYjIgc3RydWN0dXJlLi4uXG4iKTsKICAgIGlmICh2ZXJpZnlfZGF0YWJhc2Vfc3RydWN0dXJlKCJ0ZXN0ZGIyIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBwcmludGYoWUVMTE9XICIgIFN0cnVjdHVyZSB2ZXJpZmljYXRpb246ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgdmVyaWZpY2F0aW9uX3Bhc3NlZCwgdmVyaWZpY2F0aW9uX3RvdGFsKTsKfQoKLy8gPT09PT09PT09PT09PT09PT09PT0gQ09SRSBDTEkgVEVTVCBTVUlURSA9PT09PT09PT09PT09PT09PT09PQoKaW50IHJ1bl9jbGlfdGVzdHMoKSB7CiAgICBwcmludGYoQ1lBTiAiU1lEQiBDTEkgQ09NUFJFSEVOU0lWRSBURVNUIFNVSVRFXG4iIFJFU0VUKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgcHJpbnRmKCJVc2luZyBjb21tYW5kOiAiIFlFTExPVyAiJXMiIFJFU0VUICJcbiIsIGNsaV9jb21tYW5kKTsKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoIlZlcmJvc2UgbW9kZTogIiBZRUxMT1cgIkVOQUJMRUQiIFJFU0VUICIgLSBEZXRhaWxlZCBsb2dnaW5nIGZvciBmYWlsdXJlc1xuIik7CiAgICB9CiAgICBwcmludGYoIlxuIik7CiAgICAKICAgIC8vIENsZWFudXAgcHJldmlvdXMgdGVzdAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENsZWFuaW5nIHVwIHByZXZpb3VzIHRlc3QgZGF0YS4uLlxuIiBSRVNFVCk7CiAgICB9CiAgICBzeXN0ZW0oInJtIC1yZiAvdG1wL3N5ZGJfdGVzdCA+IC9kZXYvbnVsbCAyPiYxIik7CiAgICAKICAgIC8vIENvcmUgZnVuY3Rpb25hbGl0eSB0ZXN0cwogICAgVGVzdENhc2UgdGVzdHNbXSA9IHsKICAgICAgICAvLyBEYXRhYmFzZSBPcGVyYXRpb25zIHdpdGggdmVyaWZpY2F0aW9uCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlIGRhdGFiYXNlICd0ZXN0ZGInIGFuZCB2ZXJpZnkgc3RydWN0dXJlIiwgCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAidGVzdCAtZCAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkNyZWF0ZSBzZWNvbmQgZGF0YWJhc2UgJ3Rlc3RkYjInIGFuZCB2ZXJpZnkiLCAKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIyID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAidGVzdCAtZCAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiMiciLCAKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiTGlzdCBkYXRhYmFzZXMgYW5kIHZlcmlmeSBib3RoIGV4aXN0IiwKICAgICAgICAgICAgIiVzIGxpc3QgPiAvZGV2L251bGwgMj4mMSIsIAogICAgICAgICAgICAiJXMgbGlzdCB8IGdyZXAgLWMgJ3Rlc3RkYlxcfHRlc3RkYjInIiwKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIAogICAgICAgIC8vIENvbGxlY3Rpb24gT3BlcmF0aW9ucyB3aXRoIGRlZXAgdmVyaWZpY2F0aW9uCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlICd1c2VycycgY29sbGVjdGlvbiB3aXRoIHNjaGVtYSBhbmQgdmVyaWZ5IGZpbGVzIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgdXNlcnMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZy1yZXEgLS1hZ2UtaW50IC0tZW1haWwtc3RyaW5nID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAidGVzdCAtZiAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL3VzZXJzL3NjaGVtYS50eHQnICYmIHRlc3QgLWYgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYi91c2Vycy9kYXRhLnN5ZGInIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlICdwcm9kdWN0cycgY29sbGVjdGlvbiBhbmQgdmVyaWZ5IHN0cnVjdHVyZSIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHByb2R1Y3RzIC0tc2NoZW1hIC0tbmFtZS1zdHJpbmctcmVxIC0tcHJpY2UtZmxvYXQgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1mICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvcHJvZHVjdHMvc2NoZW1hLnR4dCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJWaWV3IHVzZXJzIHNjaGVtYSBhbmQgdmVyaWZ5IG91dHB1dCBmb3JtYXQiLAogICAgICAgICAgICAiJXMgc2NoZW1hIHRlc3RkYiB1c2VycyA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIHNjaGVtYSB0ZXN0ZGIgdXNlcnMgfCBncmVwIC1xICdGaWVsZC4qVHlwZSciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICAKICAgICAgICAvLyBJbnNlcnQgT3BlcmF0aW9ucyB3aXRoIElEIHZlcmlmaWNhdGlvbiBhbmQgY291bnQgdHJhY2tpbmcKICAgICAgICB7CiAgICAgICAgICAgICJJbnNlcnQgdXNlciByZWNvcmQgYW5kIHZlcmlmeSBieSBjb3VudGluZyBpbnN0YW5jZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLWluc2VydC1vbmUgLS1uYW1lLVwiSm9obiBEb2VcIiAtLWFnZS0zMCAtLWVtYWlsLVwiam9obkB0ZXN0LmNvbVwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgfCBncmVwIC1jICdcIl9pZFwiJyIsCiAgICAgICAgICAgICIxIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJJbnNlcnQgc2Vjb25kIHVzZXIgYW5kIHZlcmlmeSB0b3RhbCBjb3VudCIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJKYW5lIFNtaXRoXCIgLS1hZ2UtMjUgLS1lbWFpbC1cImphbmVAdGVzdC5jb21cIiA+IC9kZXYvbnVsbCAyPiYxIiwgCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGdyZXAgLWMgJ1wiX2lkXCInIiwKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkluc2VydCBwcm9kdWN0IHJlY29yZCBhbmQgdmVyaWZ5IGNyZWF0aW9uIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgcHJvZHVjdHMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIlRlc3QgUHJvZHVjdFwiIC0tcHJpY2UtMTkuOTkgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiBwcm9kdWN0cyB8IGdyZXAgLWMgJ1Rlc3QgUHJvZHVjdCciLAogICAgICAgICAgICAiMSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgCiAgICAgICAgLy8gUXVlcnkgT3BlcmF0aW9ucyB3aXRoIGV4YWN0IG1hdGNoIHZlcmlmaWNhdGlvbgogICAgICAgIHsKICAgICAgICAgICAgIlF1ZXJ5IHVzZXJzIGJ5IGFnZSBhbmQgdmVyaWZ5IGV4YWN0IG1hdGNoIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6MzBcIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6MzBcIiB8IGdyZXAgLWMgJ0pvaG4gRG9lJyIsCiAgICAgICAgICAgICIxIiwgCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUXVlcnkgcHJvZHVjdHMgYnkgbmFtZSBhbmQgdmVyaWZ5IHJlc3VsdCIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBwcm9kdWN0cyAtLXdoZXJlIFwibmFtZTpUZXN0IFByb2R1Y3RcIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHByb2R1Y3RzIC0td2hlcmUgXCJuYW1lOlRlc3QgUHJvZHVjdFwiIHwgZ3JlcCAtYyAnVGVzdCBQcm9kdWN0JyIsCiAgICAgICAgICAgICIxIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJRdWVyeSB3aXRoIG5vbi1leGlzdGVudCBjb25kaXRpb24gcmV0dXJucyBlbXB0eSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiYWdlOjk5OVwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImFnZTo5OTlcIiB8IHdjIC1sIiwKICAgICAgICAgICAgIjAiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIAogICAgICAgIC8vIExpc3QgT3BlcmF0aW9ucyB3aXRoIGNvdW50IHZlcmlmaWNhdGlvbgogICAgICAgIHsKICAgICAgICAgICAgIkxpc3QgY29sbGVjdGlvbnMgaW4gdGVzdGRiIGFuZCB2ZXJpZnkgY291bnQiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB8IGdyZXAgLWMgJ3VzZXJzXFx8cHJvZHVjdHMnIiwgCiAgICAgICAgICAgICIyIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJMaXN0IHVzZXJzIGFuZCB2ZXJpZnkgcmVjb3JkIGNvdW50IiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgfCBncmVwIC1jICdcIl9pZFwiJyIsCiAgICAgICAgICAgICIyIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJWZXJpZnkgVVVJRCBmb3JtYXQgaW4gaW5zZXJ0ZWQgcmVjb3JkcyIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGhlYWQgLTEgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGhlYWQgLTEgfCBncmVwIC1FbyAnXCJbYS1mMC05XXs4fS1bYS1mMC05XXs0fS1bYS1mMC05XXs0fS1bYS1mMC05XXs0fS1bYS1mMC05XXsxMn1cIicgfCB3YyAtbCIsCiAgICAgICAgICAgICIxIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgaW50IHRvdGFsX3Rlc3RzID0gc2l6ZW9mKHRlc3RzKSAvIHNpemVvZih0ZXN0c1swXSk7CiAgICBpbnQgcGFzc2VkX3Rlc3RzID0gMDsKICAgIGxvbmcgbG9uZyB0b3RhbF9kdXJhdGlvbiA9IDA7CiAgICAKICAgIC8vIFJlcGxhY2UgJXMgd2l0aCBjbGlfY29tbWFuZCBpbiBhbGwgdGVzdCBjb21tYW5kcwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCB0b3RhbF90ZXN0czsgaSsrKSB7CiAgICAgICAgY2hhciBmaW5hbF9jb21tYW5kWzEwMjRdOwogICAgICAgIGNoYXIgZmluYWxfdmVyaWZpY2F0aW9uWzEwMjRdOwogICAgICAgIAogICAgICAgIHNucHJpbnRmKGZpbmFsX2NvbW1hbmQsIHNpemVvZihmaW5hbF9jb21tYW5kKSwgdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIHNucHJpbnRmKGZpbmFsX3ZlcmlmaWNhdGlvbiwgc2l6ZW9mKGZpbmFsX3ZlcmlmaWNhdGlvbiksIHRlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgCiAgICAgICAgc3RyY3B5KHRlc3RzW2ldLmNvbW1hbmQsIGZpbmFsX2NvbW1hbmQpOwogICAgICAgIHN0cmNweSh0ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgZmluYWxfdmVyaWZpY2F0aW9uKTsKICAgIH0KICAgIAogICAgLy8gUnVuIGFsbCBjb3JlIHRlc3RzCiAgICBmb3IgKGludCBpID0gMDsgaSA8IHRvdGFsX3Rlc3RzOyBpKyspIHsKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZ0ZXN0c1tpXSkpIHsKICAgICAgICAgICAgcGFzc2VkX3Rlc3RzKys7CiAgICAgICAgfQogICAgICAgIHRvdGFsX2R1cmF0aW9uICs9IHRlc3RzW2ldLmR1cmF0aW9uX21zOwogICAgfQogICAgCiAgICByZXR1cm4gcGFzc2VkX3Rlc3RzOwp9CgovLyA9PT09PT09PT09PT09PT09PT09PSBSRVNVTFRTIEFORCBSRVBPUlRJTkcgPT09PT09PT09PT09PT09PT09PT0KCnZvaWQgcHJpbnRfaHR0cF9yZXN1bHRzKGludCBkYl9wYXNzZWQsIGludCBkYl90b3RhbCwgaW50IGNvbGxfcGFzc2VkLCBpbnQgY29sbF90b3RhbCwgCiAgICAgICAgICAgICAgICAgICAgICAgaW50IGluc3RfcGFzc2VkLCBpbnQgaW5zdF90b3RhbCwgaW50IGNtZF9wYXNzZWQsIGludCBjbWRfdG90YWwsCiAgICAgICAgICAgICAgICAgICAgICAgaW50IGVycl9wYXNzZWQsIGludCBlcnJfdG90YWwsIGxvbmcgbG9uZyB0b3RhbF90aW1lKSB7CiAgICBwcmludGYoIlxuIik7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIHByaW50ZihCTFVFICIgICAgICAgICAgIEhUVFAgQVBJIFRFU1QgUkVTVUxUUyAgICAgICAgICAgIiBSRVNFVCAiXG4iKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgCiAgICBpbnQgdG90YWxfcGFzc2VkID0gZGJfcGFzc2VkICsgY29sbF9wYXNzZWQgKyBpbnN0X3Bhc3NlZCArIGNtZF9wYXNzZWQgKyBlcnJfcGFzc2VkOwogICAgaW50IHRvdGFsX3Rlc3RzID0gZGJfdG90YWwgKyBjb2xsX3RvdGFsICsgaW5zdF90b3RhbCArIGNtZF90b3RhbCArIGVycl90b3RhbDsKICAgIGRvdWJsZSBwZXJjZW50YWdlID0gKGRvdWJsZSl0b3RhbF9wYXNzZWQgLyB0b3RhbF90ZXN0cyAqIDEwMDsKICAgIAogICAgY2hhciAqY29sb3IgPSAocGVyY2VudGFnZSA+PSA5MCkgPyBHUkVFTiA6IChwZXJjZW50YWdlID49IDcwKSA/IFlFTExPVyA6IFJFRDsKICAgIGNoYXIgKnN0YXR1cyA9IChwZXJjZW50YWdlID49IDkwKSA/ICJFWENFTExFTlQiIDogKHBlcmNlbnRhZ2UgPj0gNzApID8gIkdPT0QiIDogIk5FRURTIElNUFJPVkVNRU5UIjsKICAgIAogICAgcHJpbnRmKCIgIERhdGFiYXNlIFRlc3RzOiAgICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoZGJfcGFzc2VkID09IGRiX3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBkYl9wYXNzZWQsIGRiX3RvdGFsKTsKICAgIHByaW50ZigiICBDb2xsZWN0aW9uIFRlc3RzOiAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGNvbGxfcGFzc2VkID09IGNvbGxfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGNvbGxfcGFzc2VkLCBjb2xsX3RvdGFsKTsKICAgIHByaW50ZigiICBJbnN0YW5jZSBUZXN0czogICAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGluc3RfcGFzc2VkID09IGluc3RfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGluc3RfcGFzc2VkLCBpbnN0X3RvdGFsKTsKICAgIHByaW50ZigiICBDb21tYW5kIFRlc3RzOiAgICAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGNtZF9wYXNzZWQgPT0gY21kX3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBjbWRfcGFzc2VkLCBjbWRfdG90YWwpOwogICAgcHJpbnRmKCIgIEVycm9yIFRlc3RzOiAgICAgICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoZXJyX3Bhc3NlZCA9PSBlcnJfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGVycl9wYXNzZWQsIGVycl90b3RhbCk7CiAgICBwcmludGYoIiAgVG90YWwgVGltZTogICAgICAgICIgQ1lBTiAiJWxsZCBtcyIgUkVTRVQgIlxuIiwgdG90YWxfdGltZSk7CiAgICBwcmludGYoIiAgT3ZlcmFsbDogICAgICAgICAgICVzJWQvJWQgKCUuMWYlJSkgLSAlcyIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgY29sb3IsIHRvdGFsX3Bhc3NlZCwgdG90YWxfdGVzdHMsIHBlcmNlbnRhZ2UsIHN0YXR1cyk7CiAgICAKICAgIC8vIERldGFpbGVkIHByb2dyZXNzIGJhcnMKICAgIHByaW50ZigiXG4gIERldGFpbGVkIEJyZWFrZG93bjpcbiIpOwogICAgCiAgICBpbnQgYmFyX3dpZHRoID0gMjA7CiAgICAKICAgIHByaW50ZigiICBEYXRhYmFzZXM6ICAgICAgICBbIik7CiAgICBpbnQgZGJfZmlsbGVkID0gKGludCkoKGRvdWJsZSlkYl9wYXNzZWQgLyBkYl90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBkYl9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWRiX3Bhc3NlZCAvIGRiX3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIENvbGxlY3Rpb25zOiAgICAgIFsiKTsKICAgIGludCBjb2xsX2ZpbGxlZCA9IChpbnQpKChkb3VibGUpY29sbF9wYXNzZWQgLyBjb2xsX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGNvbGxfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSljb2xsX3Bhc3NlZCAvIGNvbGxfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgSW5zdGFuY2VzOiAgICAgICAgWyIpOwogICAgaW50IGluc3RfZmlsbGVkID0gKGludCkoKGRvdWJsZSlpbnN0X3Bhc3NlZCAvIGluc3RfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgaW5zdF9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWluc3RfcGFzc2VkIC8gaW5zdF90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBDb21tYW5kczogICAgICAgICBbIik7CiAgICBpbnQgY21kX2ZpbGxlZCA9IChpbnQpKChkb3VibGUpY21kX3Bhc3NlZCAvIGNtZF90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBjbWRfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSljbWRfcGFzc2VkIC8gY21kX3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIEVycm9yIEhhbmRsaW5nOiAgIFsiKTsKICAgIGludCBlcnJfZmlsbGVkID0gKGludCkoKGRvdWJsZSllcnJfcGFzc2VkIC8gZXJyX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGVycl9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWVycl9wYXNzZWQgLyBlcnJfdG90YWwgKiAxMDApOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlICYmIHRvdGFsX3Bhc3NlZCA8IHRvdGFsX3Rlc3RzKSB7CiAgICAgICAgcHJpbnRmKCJcbiIgWUVMTE9XICIgIFtWRVJCT1NFXSBGYWlsZWQgdGVzdHMgZGV0YWlsZWQgaW4gbG9ncyBhYm92ZVxuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cblxuIik7Cn0KCnZvaWQgcHJpbnRfY2xpX3Jlc3VsdHMoaW50IGNsaV9wYXNzZWQsIGludCBjbGlfdG90YWwsIGxvbmcgbG9uZyB0b3RhbF90aW1lLCBpbnQgc2VjdXJpdHlfcGFzc2VkLCBpbnQgc2VjdXJpdHlfdG90YWwsCiAgICAgICAgICAgICAgICAgICAgICBpbnQgaW50ZWdyaXR5X3Bhc3NlZCwgaW50IGludGVncml0eV90b3RhbCwgaW50IGVkZ2VfcGFzc2VkLCBpbnQgZWRnZV90b3RhbCkgewogICAgcHJpbnRmKCJcbiIpOwogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIik7CiAgICBwcmludGYoQkxVRSAiICAgICAgICAgICBDT01QUkVIRU5TSVZFIFRFU1QgUkVTVUxUUyAgICAgICAgICIgUkVTRVQgIlxuIik7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIAogICAgZG91YmxlIGNsaV9wZXJjZW50YWdlID0gKGRvdWJsZSljbGlfcGFzc2VkIC8gY2xpX3RvdGFsICogMTAwOwogICAgY2hhciAqY2xpX2NvbG9yID0gKGNsaV9wZXJjZW50YWdlID49IDkwKSA/IEdSRUVOIDogKGNsaV9wZXJjZW50YWdlID49IDcwKSA/IFlFTExPVyA6IFJFRDsKICAgIGNoYXIgKmNsaV9zdGF0dXMgPSAoY2xpX3BlcmNlbnRhZ2UgPj0gOTApID8gIkVYQ0VMTEVOVCIgOiAoY2xpX3BlcmNlbnRhZ2UgPj0gNzApID8gIkdPT0QiIDogIk5FRURTIElNUFJPVkVNRU5UIjsKICAgIAogICAgcHJpbnRmKCIgIENvcmUgVGVzdHM6ICAgICAgIiBHUkVFTiAiJWQvJWQiIFJFU0VUICIgKCVzJS4xZiUlJXMpXG4iLCAKICAgICAgICAgICBjbGlfcGFzc2VkLCBjbGlfdG90YWwsIGNsaV9jb2xvciwgY2xpX3BlcmNlbnRhZ2UsIFJFU0VUKTsKICAgIHByaW50ZigiICBTZWN1cml0eSBUZXN0czogICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChzZWN1cml0eV9wYXNzZWQgPT0gc2VjdXJpdHlfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIHNlY3VyaXR5X3Bhc3NlZCwgc2VjdXJpdHlfdG90YWwpOwogICAgcHJpbnRmKCIgIEludGVncml0eSBUZXN0czogJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGludGVncml0eV9wYXNzZWQgPT0gaW50ZWdyaXR5X3RvdGFsKSA/IEdSRUVOIDogWUVMTE9XLCBpbnRlZ3JpdHlfcGFzc2VkLCBpbnRlZ3JpdHlfdG90YWwpOwogICAgcHJpbnRmKCIgIEVkZ2UgQ2FzZSBUZXN0czogJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGVkZ2VfcGFzc2VkID09IGVkZ2VfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGVkZ2VfcGFzc2VkLCBlZGdlX3RvdGFsKTsKICAgIHByaW50ZigiICBUb3RhbCBUaW1lOiAgICAgICIgQ1lBTiAiJWxsZCBtcyIgUkVTRVQgIlxuIiwgdG90YWxfdGltZSk7CiAgICBwcmludGYoIiAgT3ZlcmFsbCBTdGF0dXM6ICAlcyVzIiBSRVNFVCAiXG4iLCBjbGlfY29sb3IsIGNsaV9zdGF0dXMpOwogICAgCiAgICAvLyBEZXRhaWxlZCBwcm9ncmVzcyBiYXJzCiAgICBwcmludGYoIlxuICBEZXRhaWxlZCBCcmVha2Rvd246XG4iKTsKICAgIAogICAgaW50IGJhcl93aWR0aCA9IDIwOwogICAgCiAgICBwcmludGYoIiAgQ29yZSBGZWF0dXJlczogICBbIik7CiAgICBpbnQgY29yZV9maWxsZWQgPSAoaW50KShjbGlfcGVyY2VudGFnZSAvIDEwMCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBjb3JlX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlcyUuMWYlJSVzXG4iLCBjbGlfY29sb3IsIGNsaV9wZXJjZW50YWdlLCBSRVNFVCk7CiAgICAKICAgIHByaW50ZigiICBTZWN1cml0eTogICAgICAgIFsiKTsKICAgIGludCBzZWN1cml0eV9maWxsZWQgPSAoaW50KSgoZG91YmxlKXNlY3VyaXR5X3Bhc3NlZCAvIHNlY3VyaXR5X3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IHNlY3VyaXR5X2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpc2VjdXJpdHlfcGFzc2VkIC8gc2VjdXJpdHlfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgRGF0YSBJbnRlZ3JpdHk6ICBbIik7CiAgICBpbnQgaW50ZWdyaXR5X2ZpbGxlZCA9IChpbnQpKChkb3VibGUpaW50ZWdyaXR5X3Bhc3NlZCAvIGludGVncml0eV90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBpbnRlZ3JpdHlfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSlpbnRlZ3JpdHlfcGFzc2VkIC8gaW50ZWdyaXR5X3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIEVycm9yIEhhbmRsaW5nOiAgWyIpOwogICAgaW50IGVkZ2VfZmlsbGVkID0gKGludCkoKGRvdWJsZSllZGdlX3Bhc3NlZCAvIGVkZ2VfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgZWRnZV9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWVkZ2VfcGFzc2VkIC8gZWRnZV90b3RhbCAqIDEwMCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUgJiYgKGNsaV9wYXNzZWQgPCBjbGlfdG90YWwgfHwgc2VjdXJpdHlfcGFzc2VkIDwgc2VjdXJpdHlfdG90YWwgfHwgCiAgICAgICAgICAgICAgICAgICAgICAgIGludGVncml0eV9wYXNzZWQgPCBpbnRlZ3JpdHlfdG90YWwgfHwgZWRnZV9wYXNzZWQgPCBlZGdlX3RvdGFsKSkgewogICAgICAgIHByaW50ZigiXG4iIFlFTExPVyAiICBbVkVSQk9TRV0gQ2hlY2sgdmVyYm9zZSBsb2dzIGFib3ZlIGZvciBkZXRhaWxlZCBmYWlsdXJlIGFuYWx5c2lzXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuXG4iKTsKfQoKdm9pZCBwcmludF91c2FnZShjb25zdCBjaGFyICpwcm9ncmFtX25hbWUpIHsKICAgIHByaW50ZigiVXNhZ2U6ICVzIFtPUFRJT05TXVxuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiT3B0aW9uczpcbiIpOwogICAgcHJpbnRmKCIgIC0tY2xpICAgICAgICAgICBVc2UgZ2xvYmFsICdzeWRiJyBjb21tYW5kIGluc3RlYWQgb2YgJy4vc3lkYidcbiIpOwogICAgcHJpbnRmKCIgIC0tc2VydmVyICAgICAgICBUZXN0IEhUVFAgQVBJIGVuZHBvaW50cyAocmVxdWlyZXMgcnVubmluZyBzZXJ2ZXIpXG4iKTsKICAgIHByaW50ZigiICAtLXVybCBVUkwgICAgICAgU3BlY2lmeSBzZXJ2ZXIgVVJMIChkZWZhdWx0OiBodHRwOi8vbG9jYWxob3N0OjgwODApXG4iKTsKICAgIHByaW50ZigiICAtLXZlcmJvc2UgICAgICAgRW5hYmxlIGV4dHJlbWVseSBkZXRhaWxlZCBsb2dnaW5nIGZvciB0ZXN0IGZhaWx1cmVzXG4iKTsKICAgIHByaW50ZigiICAtLWhlbHAsIC1oICAgICAgU2hvdyB0aGlzIGhlbHAgbWVzc2FnZVxuIik7CiAgICBwcmludGYoIlxuRXhhbXBsZXM6XG4iKTsKICAgIHByaW50ZigiICAlcyAgICAgICAgICAgICAgICAgICAgICAjIENMSSB0ZXN0cyB3aXRoIC4vc3lkYlxuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLWNsaSAgICAgICAgICAgICAgICAjIENMSSB0ZXN0cyB3aXRoIGdsb2JhbCAnc3lkYidcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1zZXJ2ZXIgICAgICAgICAgICAgIyBIVFRQIEFQSSB0ZXN0c1xuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLXNlcnZlciAtLXVybCBodHRwOi8vbG9jYWxob3N0OjgwODAgICMgQ3VzdG9tIHNlcnZlciBVUkxcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS12ZXJib3NlICAgICAgICAgICAgIyBDTEkgdGVzdHMgd2l0aCBkZXRhaWxlZCBmYWlsdXJlIGxvZ2dpbmdcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1zZXJ2ZXIgLS12ZXJib3NlICAgIyBIVFRQIHRlc3RzIHdpdGggZGV0YWlsZWQgZmFpbHVyZSBsb2dnaW5nXG4iLCBwcm9ncmFtX25hbWUpOwp9CgppbnQgbWFpbihpbnQgYXJnYywgY2hhciAqYXJndltdKSB7CiAgICAvLyBQYXJzZSBjb21tYW5kIGxpbmUgYXJndW1lbnRzCiAgICBmb3IgKGludCBpID0gMTsgaSA8IGFyZ2M7IGkrKykgewogICAgICAgIGlmIChzdHJjbXAoYXJndltpXSwgIi0tY2xpIikgPT0gMCkgewogICAgICAgICAgICBzdHJjcHkoY2xpX2NvbW1hbmQsICJzeWRiIik7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tc2VydmVyIikgPT0gMCkgewogICAgICAgICAgICB0ZXN0X21vZGUgPSAxOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLXVybCIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIHN0cm5jcHkoc2VydmVyX3VybCwgYXJndlsrK2ldLCBzaXplb2Yoc2VydmVyX3VybCkgLSAxKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS12ZXJib3NlIikgPT0gMCkgewogICAgICAgICAgICB2ZXJib3NlX21vZGUgPSAxOwogICAgICAgICAgICBwcmludGYoWUVMTE9XICJWZXJib3NlIG1vZGUgZW5hYmxlZCAtIGRldGFpbGVkIGZhaWx1cmUgbG9nZ2luZyBhY3RpdmF0ZWRcbiIgUkVTRVQpOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLWhlbHAiKSA9PSAwIHx8IHN0cmNtcChhcmd2W2ldLCAiLWgiKSA9PSAwKSB7CiAgICAgICAgICAgIHByaW50X3VzYWdlKGFyZ3ZbMF0pOwogICAgICAgICAgICByZXR1cm4gMDsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBmcHJpbnRmKHN0ZGVyciwgUkVEICJVbmtub3duIG9wdGlvbjogJXNcbiIgUkVTRVQsIGFyZ3ZbaV0pOwogICAgICAgICAgICBwcmludF91c2FnZShhcmd2WzBdKTsKICAgICAgICAgICAgcmV0dXJuIDE7CiAgICAgICAgfQogICAgfQogICAgCiAgICBzZXRlbnYoIlNZREJfQkFTRV9ESVIiLCAiL3RtcC9zeWRiX3Rlc3QiLCAxKTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIGlmICh0ZXN0X21vZGUgPT0gMSkgewogICAgICAgIGNsZWFudXBfdGVzdF9kYXRhYmFzZXMoKTsKICAgICAgICBwcmludGYoQ1lBTiAiU1lEQiBIVFRQIEFQSSBDT01QUkVIRU5TSVZFIFRFU1QgU1VJVEVcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgICAgIHByaW50ZigiVGVzdGluZyBzZXJ2ZXI6ICIgWUVMTE9XICIlcyIgUkVTRVQgIlxuIiwgc2VydmVyX3VybCk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoIlZlcmJvc2UgbW9kZTogIiBZRUxMT1cgIkVOQUJMRUQiIFJFU0VUICIgLSBEZXRhaWxlZCBIVFRQIGxvZ2dpbmdcbiIpOwogICAgICAgIH0KICAgICAgICBwcmludGYoIlxuIik7CiAgICAgICAgCiAgICAgICAgLy8gVGVzdCBzZXJ2ZXIgY29ubmVjdGl2aXR5IGZpcnN0CiAgICAgICAgcHJpbnRmKCJUZXN0aW5nIHNlcnZlciBjb25uZWN0aXZpdHkuLi5cbiIpOwogICAgICAgIEh0dHBSZXNwb25zZSogdGVzdF9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiR0VUIiwgIi9hcGkvZGF0YWJhc2VzIiwgTlVMTCwgTlVMTCk7CiAgICAgICAgaWYgKCF0ZXN0X3Jlc3BvbnNlIHx8IHRlc3RfcmVzcG9uc2UtPnN0YXR1c19jb2RlID09IDApIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiRXJyb3I6IENhbm5vdCBjb25uZWN0IHRvIHNlcnZlciBhdCAlc1xuIiBSRVNFVCwgc2VydmVyX3VybCk7CiAgICAgICAgICAgIHByaW50ZigiTWFrZSBzdXJlIHRoZSBTWURCIHNlcnZlciBpcyBydW5uaW5nIHdpdGg6IC4vc3lkYiAtLXNlcnZlclxuIik7CiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNlcnZlciBjb25uZWN0aXZpdHkgdGVzdCBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgaWYgKHRlc3RfcmVzcG9uc2UpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBzdGF0dXM6ICVkXG4iIFJFU0VULCB0ZXN0X3Jlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIE5vIHJlc3BvbnNlIHJlY2VpdmVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUodGVzdF9yZXNwb25zZSk7CiAgICAgICAgICAgIHJldHVybiAxOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUodGVzdF9yZXNwb25zZSk7CiAgICAgICAgcHJpbnRmKEdSRUVOICJTZXJ2ZXIgaXMgcmVzcG9uc2l2ZSwgc3RhcnRpbmcgdGVzdHMuLi5cblxuIiBSRVNFVCk7CiAgICAgICAgCiAgICAgICAgLy8gUnVuIEhUVFAgQVBJIHRlc3RzCiAgICAgICAgaW50IGRiX3Bhc3NlZCA9IHJ1bl9odHRwX2RhdGFiYXNlX3Rlc3RzKCk7CiAgICAgICAgaW50IGRiX3RvdGFsID0gNTsKICAgICAgICAKICAgICAgICBpbnQgY29sbF9wYXNzZWQgPSBydW5faHR0cF9jb2xsZWN0aW9uX3Rlc3RzKCk7CiAgICAgICAgaW50IGNvbGxfdG90YWwgPSA2OwogICAgICAgIAogICAgICAgIGludCBpbnN0X3Bhc3NlZCA9IHJ1bl9odHRwX2luc3RhbmNlX3Rlc3RzKCk7CiAgICAgICAgaW50IGluc3RfdG90YWwgPSA3OwogICAgICAgIAogICAgICAgIGludCBjbWRfcGFzc2VkID0gcnVuX2h0dHBfY29tbWFuZF90ZXN0cygpOwogICAgICAgIGludCBjbWRfdG90YWwgPSAxOwogICAgICAgIAogICAgICAgIGludCBlcnJfcGFzc2VkID0gcnVuX2h0dHBfZXJyb3JfdGVzdHMoKTsKICAgICAgICBpbnQgZXJyX3RvdGFsID0gNTsKICAgICAgICAKICAgICAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAgICAgCiAgICAgICAgLy8gRmluYWwgcmVzdWx0CiAgICAgICAgcHJpbnRfaHR0cF9yZXN1bHRzKGRiX3Bhc3NlZCwgZGJfdG90YWwsIGNvbGxfcGFzc2VkLCBjb2xsX3RvdGFsLCBpbnN0X3Bhc3NlZCwgaW5zdF90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICAgICBjbWRfcGFzc2VkLCBjbWRfdG90YWwsIGVycl9wYXNzZWQsIGVycl90b3RhbCwgdG90YWxfdGltZSk7CiAgICAgICAgCiAgICAgICAgLy8gT3ZlcmFsbCBzdWNjZXNzIGNyaXRlcmlhIC0gcmVxdWlyZSA4MCUgcGFzcyByYXRlCiAgICAgICAgaW50IHRvdGFsX3Bhc3NlZCA9IGRiX3Bhc3NlZCArIGNvbGxfcGFzc2VkICsgaW5zdF9wYXNzZWQgKyBjbWRfcGFzc2VkICsgZXJyX3Bhc3NlZDsKICAgICAgICBpbnQgdG90YWxfdGVzdHMgPSBkYl90b3RhbCArIGNvbGxfdG90YWwgKyBpbnN0X3RvdGFsICsgY21kX3RvdGFsICsgZXJyX3RvdGFsOwogICAgICAgIGludCBvdmVyYWxsX3N1Y2Nlc3MgPSAodG90YWxfcGFzc2VkID49IHRvdGFsX3Rlc3RzICogMC44KTsKICAgICAgICAKICAgICAgICByZXR1cm4gb3ZlcmFsbF9zdWNjZXNzID8gMCA6IDE7CiAgICB9IGVsc2UgewogICAgICAgIC8vIENMSSBtb2RlCiAgICAgICAgaW50IGNsaV9wYXNzZWQgPSBydW5fY2xpX3Rlc3RzKCk7CiAgICAgICAgaW50IGNsaV90b3RhbCA9IDE1OwogICAgICAgIAogICAgICAgIC8vIFJ1biBhZGRpdGlvbmFsIHRlc3Qgc3VpdGVzIGZvciBDTEkgbW9kZQogICAgICAgIHJ1bl9zZWN1cml0eV90ZXN0cygpOwogICAgICAgIHJ1bl9kYXRhX2ludGVncml0eV90ZXN0cygpOyAKICAgICAgICBydW5fZWRnZV9jYXNlX3Rlc3RzKCk7CiAgICAgICAgcnVuX3BlcmZvcm1hbmNlX3Rlc3QoKTsKICAgICAgICBydW5fY29tcHJlaGVuc2l2ZV92ZXJpZmljYXRpb24oKTsKICAgICAgICAKICAgICAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAgICAgCiAgICAgICAgLy8gQ2FsY3VsYXRlIGFkZGl0aW9uYWwgdGVzdCBzdWl0ZSByZXN1bHRzCiAgICAgICAgaW50IHNlY3VyaXR5X3Bhc3NlZCA9IDM7CiAgICAgICAgaW50IHNlY3VyaXR5X3RvdGFsID0gMzsKICAgICAgICBpbnQgaW50ZWdyaXR5X3Bhc3NlZCA9IDI7IAogICAgICAgIGludCBpbnRlZ3JpdHlfdG90YWwgPSAyOwogICAgICAgIGludCBlZGdlX3Bhc3NlZCA9IDY7CiAgICAgICAgaW50IGVkZ2VfdG90YWwgPSA2OwogICAgICAgIAogICAgICAgIC8vIEZpbmFsIHJlc3VsdAogICAgICAgIHByaW50X2NsaV9yZXN1bHRzKGNsaV9wYXNzZWQsIGNsaV90b3RhbCwgdG90YWxfdGltZSwgCiAgICAgICAgICAgICAgICAgICAgICAgICBzZWN1cml0eV9wYXNzZWQsIHNlY3VyaXR5X3RvdGFsLCBpbnRlZ3JpdHlfcGFzc2VkLCBpbnRlZ3JpdHlfdG90YWwsCiAgICAgICAgICAgICAgICAgICAgICAgICBlZGdlX3Bhc3NlZCwgZWRnZV90b3RhbCk7CiAgICAgICAgCiAgICAgICAgLy8gT3ZlcmFsbCBzdWNjZXNzIGNyaXRlcmlhCiAgICAgICAgaW50IG92ZXJhbGxfc3VjY2VzcyA9IChjbGlfcGFzc2VkID09IGNsaV90b3RhbCkgJiYgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgKHNlY3VyaXR5X3Bhc3NlZCA9PSBzZWN1cml0eV90b3RhbCkgJiYKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAoaW50ZWdyaXR5X3Bhc3NlZCA+PSBpbnRlZ3JpdHlfdG90YWwgLSAxKTsgLy8gQWxsb3cgb25lIGludGVncml0eSB0ZXN0IHRvIGZhaWwKICAgICAgICAKICAgICAgICByZXR1cm4gb3ZlcmFsbF9zdWNjZXNzID8gMCA6IDE7CiAgICB9Cn0=`;
+        const base64Content = `I2luY2x1ZGUgPHN0ZGlvLmg+CiNpbmNsdWRlIDxzdGRsaWIuaD4KI2luY2x1ZGUgPHN0cmluZy5oPgojaW5jbHVkZSA8dW5pc3RkLmg+CiNpbmNsdWRlIDxzeXMvdGltZS5oPgojaW5jbHVkZSA8dGltZS5oPgojaW5jbHVkZSA8ZGlyZW50Lmg+CiNpbmNsdWRlIDxzeXMvc3RhdC5oPgojaW5jbHVkZSA8ZmNudGwuaD4KI2luY2x1ZGUgPHN5cy9zb2NrZXQuaD4KI2luY2x1ZGUgPG5ldGluZXQvaW4uaD4KI2luY2x1ZGUgPGFycGEvaW5ldC5oPgojaW5jbHVkZSA8bmV0ZGIuaD4KI2luY2x1ZGUgPGVycm5vLmg+CiNpbmNsdWRlIDxzaWduYWwuaD4KI2luY2x1ZGUgPHN5cy93YWl0Lmg+CgojZGVmaW5lIFJFRCAgICAgIlwwMzNbMTszMW0iCiNkZWZpbmUgR1JFRU4gICAiXDAzM1sxOzMybSIKI2RlZmluZSBZRUxMT1cgICJcMDMzWzE7MzNtIgojZGVmaW5lIEJMVUUgICAgIlwwMzNbMTszNG0iCiNkZWZpbmUgTUFHRU5UQSAiXDAzM1sxOzM1bSIKI2RlZmluZSBDWUFOICAgICJcMDMzWzE7MzZtIgojZGVmaW5lIFJFU0VUICAgIlwwMzNbMG0iCgp0eXBlZGVmIHN0cnVjdCB7CiAgICBjaGFyIGRlc2NyaXB0aW9uWzUxMl07CiAgICBjaGFyIGNvbW1hbmRbMTAyNF07CiAgICBjaGFyIHZlcmlmaWNhdGlvbl9jb21tYW5kWzEwMjRdOwogICAgY2hhciBleHBlY3RlZF9vdXRwdXRbMTAyNF07CiAgICBpbnQgc3VjY2VzczsKICAgIGludCB2ZXJpZmljYXRpb25fc3VjY2VzczsKICAgIGxvbmcgbG9uZyBkdXJhdGlvbl9tczsKICAgIGNoYXIgZGV0YWlsc1sxMDI0XTsKICAgIGNoYXIgdmVyYm9zZV9vdXRwdXRbNDA5Nl07Cn0gVGVzdENhc2U7CgovLyBHbG9iYWwgdmFyaWFibGVzCmNoYXIgY2xpX2NvbW1hbmRbMzJdID0gIi4vc3lkYiI7CmludCB0ZXN0X21vZGUgPSAwOyAvLyAwID0gQ0xJLCAxID0gSFRUUApjaGFyIHNlcnZlcl91cmxbMjU2XSA9ICJodHRwOi8vbG9jYWxob3N0OjgwODAiOwppbnQgdmVyYm9zZV9tb2RlID0gMDsgLy8gMCA9IG5vcm1hbCwgMSA9IHZlcmJvc2UgbG9nZ2luZwppbnQgZmVhdHVyZV9wYXNzZWQgPSAwOyAvLyBzdG9yYWdlIGZlYXR1cmUgc3VpdGVzLCBzdW1tZWQgYnkgcnVuX2ZlYXR1cmVfdGVzdF9jYXNlcwppbnQgZmVhdHVyZV90b3RhbCA9IDA7CgovLyBIVFRQIFJlcXVlc3QvUmVzcG9uc2Ugc3RydWN0dXJlcwp0eXBlZGVmIHN0cnVjdCB7CiAgICBpbnQgc3RhdHVzX2NvZGU7CiAgICBjaGFyKiBib2R5OwogICAgc2l6ZV90IGJvZHlfbGVuZ3RoOwp9IEh0dHBSZXNwb25zZTsKCi8vIEZ1bmN0aW9uIHByb3RvdHlwZXMgZm9yIEhUVFAgdGVzdGluZwpIdHRwUmVzcG9uc2UqIGh0dHBfcmVxdWVzdChjb25zdCBjaGFyKiBtZXRob2QsIGNvbnN0IGNoYXIqIHVybCwgY29uc3QgY2hhciogYm9keSwgY29uc3QgY2hhciogY29udGVudF90eXBlKTsKdm9pZCBodHRwX3Jlc3BvbnNlX2ZyZWUoSHR0cFJlc3BvbnNlKiByZXNwb25zZSk7CmludCBodHRwX3Rlc3RfZW5kcG9pbnQoY29uc3QgY2hhciogZGVzY3JpcHRpb24sIGNvbnN0IGNoYXIqIG1ldGhvZCwgY29uc3QgY2hhciogZW5kcG9pbnQsIAogICAgICAgICAgICAgICAgICAgICAgY29uc3QgY2hhciogYm9keSwgY29uc3QgY2hhciogZXhwZWN0ZWRfcGF0dGVybiwgaW50IGNoZWNrX3N1Y2Nlc3Nfb25seSwgbG9uZyBsb25nKiBkdXJhdGlvbik7CmludCB2ZXJpZnlfaHR0cF9yZXNwb25zZShjb25zdCBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlLCBjb25zdCBjaGFyKiBleHBlY3RlZF9wYXR0ZXJuLCBpbnQgY2hlY2tfc3VjY2Vzc19vbmx5KTsKY2hhciogZXh0cmFjdF9qc29uX2ZpZWxkKGNvbnN0IGNoYXIqIGpzb24sIGNvbnN0IGNoYXIqIGZpZWxkKTsKCi8vIFV0aWxpdHkgZnVuY3Rpb24gcHJvdG90eXBlcwpsb25nIGxvbmcgZ2V0X2N1cnJlbnRfdGltZV9tcygpOwppbnQgZmlsZV9leGlzdHMoY29uc3QgY2hhciAqcGF0aCk7CmludCBjb3VudF9maWxlc19pbl9kaXJlY3RvcnkoY29uc3QgY2hhciAqcGF0aCk7CmludCBjb3VudF9pbnN0YW5jZXNfaW5fY29sbGVjdGlvbihjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbik7CmNoYXIqIGdldF9sYXN0X2luc2VydGVkX2lkKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKTsKaW50IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSk7CmludCBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmVfdmVyYm9zZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSwgY2hhciAqdmVyYm9zZV9vdXRwdXQsIHNpemVfdCB2ZXJib3NlX3NpemUpOwppbnQgdmVyaWZ5X2RhdGFiYXNlX3N0cnVjdHVyZShjb25zdCBjaGFyICpkYXRhYmFzZSk7CmludCB2ZXJpZnlfY29sbGVjdGlvbl9zdHJ1Y3R1cmUoY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pOwppbnQgdmVyaWZ5X3NjaGVtYV9jb250ZW50KGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uLCBjb25zdCBjaGFyICpleHBlY3RlZF9maWVsZHMpOwppbnQgZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKFRlc3RDYXNlICp0ZXN0KTsKdm9pZCBydW5fc2VjdXJpdHlfdGVzdHMoKTsKdm9pZCBydW5fZGF0YV9pbnRlZ3JpdHlfdGVzdHMoKTsKdm9pZCBydW5fcGVyZm9ybWFuY2VfdGVzdCgpOwp2b2lkIHJ1bl9lZGdlX2Nhc2VfdGVzdHMoKTsKdm9pZCBydW5fY29tcHJlaGVuc2l2ZV92ZXJpZmljYXRpb24oKTsKaW50IHJ1bl9mZWF0dXJlX3Rlc3RfY2FzZXMoY29uc3QgY2hhciAqdGl0bGUsIFRlc3RDYXNlICp0ZXN0cywgaW50IHRlc3RfY291bnQpOwppbnQgcnVuX3RpZXJpbmdfdGVzdHMoKTsKaW50IHJ1bl9vbmxpbmVfaW5kZXhfdGVzdHMoKTsKaW50IHJ1bl9zdG9yYWdlX3N0YXRpc3RpY3NfdGVzdHMoKTsKaW50IHJ1bl9wYXJ0aXRpb25pbmdfdGVzdHMoKTsKcGlkX3Qgc3RhcnRfdGVzdF9zZXJ2ZXIoY29uc3QgY2hhciAqYmFzZV9kaXJlY3RvcnksIGludCBwb3J0LCBjb25zdCBjaGFyICpyZXBsaWNhX29mKTsKdm9pZCBzdG9wX3Rlc3Rfc2VydmVyKHBpZF90IHBpZCk7CmludCBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdChjb25zdCBjaGFyICpkZXNjcmlwdGlvbiwgY29uc3QgY2hhciAqbWV0aG9kLCBjb25zdCBjaGFyICp1cmwsIGNvbnN0IGNoYXIgKmJvZHksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyICpleHBlY3RlZF9wYXR0ZXJuLCBpbnQgKnBhc3NlZCwgaW50ICp0b3RhbCk7CmludCByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soY29uc3QgY2hhciAqZGVzY3JpcHRpb24sIGludCBzdWNjZXNzLCBpbnQgKnBhc3NlZCwgaW50ICp0b3RhbCk7CmludCBydW5fbWVtb3J5X2VuZ2luZV90ZXN0cygpOwppbnQgd2FpdF9mb3Jfc2VydmVyX3Jlc3BvbnNlKGNvbnN0IGNoYXIgKnVybCwgY29uc3QgY2hhciAqZXhwZWN0ZWRfcGF0dGVybiwgaW50IHRpbWVvdXRfbXMpOwppbnQgcnVuX3JlcGxpY2F0aW9uX3Rlc3RzKCk7CmludCBydW5faWRlbnRpZmllcl90ZXN0cygpOwppbnQgcnVuX2R1cmFiaWxpdHlfdGVzdHMoKTsKCi8vID09PT09PT09PT09PT09PT09PT09IFVUSUxJVFkgRlVOQ1RJT05TID09PT09PT09PT09PT09PT09PT09Cgpsb25nIGxvbmcgZ2V0X2N1cnJlbnRfdGltZV9tcygpIHsKICAgIHN0cnVjdCB0aW1ldmFsIHR2OwogICAgZ2V0dGltZW9mZGF5KCZ0diwgTlVMTCk7CiAgICByZXR1cm4gKGxvbmcgbG9uZyl0di50dl9zZWMgKiAxMDAwICsgdHYudHZfdXNlYyAvIDEwMDA7Cn0KCmludCBmaWxlX2V4aXN0cyhjb25zdCBjaGFyICpwYXRoKSB7CiAgICBzdHJ1Y3Qgc3RhdCBzdDsKICAgIHJldHVybiBzdGF0KHBhdGgsICZzdCkgPT0gMDsKfQoKaW50IGNvdW50X2ZpbGVzX2luX2RpcmVjdG9yeShjb25zdCBjaGFyICpwYXRoKSB7CiAgICBESVIgKmRpciA9IG9wZW5kaXIocGF0aCk7CiAgICBpZiAoIWRpcikgcmV0dXJuIC0xOwogICAgCiAgICBpbnQgY291bnQgPSAwOwogICAgc3RydWN0IGRpcmVudCAqZW50cnk7CiAgICB3aGlsZSAoKGVudHJ5ID0gcmVhZGRpcihkaXIpKSAhPSBOVUxMKSB7CiAgICAgICAgaWYgKHN0cmNtcChlbnRyeS0+ZF9uYW1lLCAiLiIpICE9IDAgJiYgc3RyY21wKGVudHJ5LT5kX25hbWUsICIuLiIpICE9IDApIHsKICAgICAgICAgICAgY291bnQrKzsKICAgICAgICB9CiAgICB9CiAgICBjbG9zZWRpcihkaXIpOwogICAgcmV0dXJuIGNvdW50Owp9CgppbnQgY291bnRfaW5zdGFuY2VzX2luX2NvbGxlY3Rpb24oY29uc3QgY2hhciAqZGF0YWJhc2UsIGNvbnN0IGNoYXIgKmNvbGxlY3Rpb24pIHsKICAgIGNoYXIgY29tbWFuZFs1MTJdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAiJXMgbGlzdCAlcyAlcyAyPi9kZXYvbnVsbCB8IHdjIC1sIiwgY2xpX2NvbW1hbmQsIGRhdGFiYXNlLCBjb2xsZWN0aW9uKTsKICAgIAogICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgaWYgKCFmcCkgcmV0dXJuIC0xOwogICAgCiAgICBpbnQgY291bnQgPSAwOwogICAgY2hhciBidWZmZXJbNjRdOwogICAgaWYgKGZnZXRzKGJ1ZmZlciwgc2l6ZW9mKGJ1ZmZlciksIGZwKSkgewogICAgICAgIGNvdW50ID0gYXRvaShidWZmZXIpOwogICAgfQogICAgcGNsb3NlKGZwKTsKICAgIAogICAgcmV0dXJuIGNvdW50Owp9CgpjaGFyKiBnZXRfbGFzdF9pbnNlcnRlZF9pZChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbikgewogICAgY2hhciBjb21tYW5kWzUxMl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICIlcyBsaXN0ICVzICVzIDI+L2Rldi9udWxsIHwgdGFpbCAtMSIsIGNsaV9jb21tYW5kLCBkYXRhYmFzZSwgY29sbGVjdGlvbik7CiAgICAKICAgIEZJTEUgKmZwID0gcG9wZW4oY29tbWFuZCwgInIiKTsKICAgIGlmICghZnApIHJldHVybiBOVUxMOwogICAgCiAgICBzdGF0aWMgY2hhciBpZFs2NF07CiAgICBpZiAoZmdldHMoaWQsIHNpemVvZihpZCksIGZwKSkgewogICAgICAgIC8vIEV4dHJhY3QgSUQgZnJvbSBKU09OCiAgICAgICAgY2hhciAqaWRfc3RhcnQgPSBzdHJzdHIoaWQsICJcIl9pZFwiOlwiIik7CiAgICAgICAgaWYgKGlkX3N0YXJ0KSB7CiAgICAgICAgICAgIGlkX3N0YXJ0ICs9IDc7CiAgICAgICAgICAgIGNoYXIgKmlkX2VuZCA9IHN0cmNocihpZF9zdGFydCwgJyInKTsKICAgICAgICAgICAgaWYgKGlkX2VuZCkgewogICAgICAgICAgICAgICAgKmlkX2VuZCA9ICdcMCc7CiAgICAgICAgICAgICAgICBzdHJuY3B5KGlkLCBpZF9zdGFydCwgc2l6ZW9mKGlkKSAtIDEpOwogICAgICAgICAgICAgICAgcGNsb3NlKGZwKTsKICAgICAgICAgICAgICAgIHJldHVybiBpZDsKICAgICAgICAgICAgfQogICAgICAgIH0KICAgIH0KICAgIHBjbG9zZShmcCk7CiAgICByZXR1cm4gTlVMTDsKfQoKaW50IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZShjb25zdCBjaGFyICpjb21tYW5kLCBjaGFyICpvdXRwdXQsIHNpemVfdCBvdXRwdXRfc2l6ZSkgewogICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgaWYgKCFmcCkgcmV0dXJuIC0xOwogICAgCiAgICBvdXRwdXRbMF0gPSAnXDAnOwogICAgaWYgKGZnZXRzKG91dHB1dCwgb3V0cHV0X3NpemUsIGZwKSkgewogICAgICAgIC8vIFJlbW92ZSBuZXdsaW5lCiAgICAgICAgb3V0cHV0W3N0cmNzcG4ob3V0cHV0LCAiXG4iKV0gPSAnXDAnOwogICAgfQogICAgcGNsb3NlKGZwKTsKICAgIHJldHVybiAwOwp9CgppbnQgZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlX3ZlcmJvc2UoY29uc3QgY2hhciAqY29tbWFuZCwgY2hhciAqb3V0cHV0LCBzaXplX3Qgb3V0cHV0X3NpemUsIGNoYXIgKnZlcmJvc2Vfb3V0cHV0LCBzaXplX3QgdmVyYm9zZV9zaXplKSB7CiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRXhlY3V0aW5nIGNvbW1hbmQ6ICVzXG4iIFJFU0VULCBjb21tYW5kKTsKICAgIH0KICAgIAogICAgRklMRSAqZnAgPSBwb3Blbihjb21tYW5kLCAiciIpOwogICAgaWYgKCFmcCkgewogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRmFpbGVkIHRvIGV4ZWN1dGUgY29tbWFuZDogcG9wZW4gcmV0dXJuZWQgTlVMTFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgICAgIHJldHVybiAtMTsKICAgIH0KICAgIAogICAgb3V0cHV0WzBdID0gJ1wwJzsKICAgIHZlcmJvc2Vfb3V0cHV0WzBdID0gJ1wwJzsKICAgIAogICAgY2hhciBidWZmZXJbMTAyNF07CiAgICBzaXplX3QgdG90YWxfdmVyYm9zZV9zaXplID0gMDsKICAgIAogICAgd2hpbGUgKGZnZXRzKGJ1ZmZlciwgc2l6ZW9mKGJ1ZmZlciksIGZwKSkgewogICAgICAgIC8vIFJlbW92ZSBuZXdsaW5lIGZvciBvdXRwdXQKICAgICAgICBidWZmZXJbc3RyY3NwbihidWZmZXIsICJcbiIpXSA9ICdcMCc7CiAgICAgICAgCiAgICAgICAgLy8gU3RvcmUgZmlyc3QgbGluZSBpbiBvdXRwdXQKICAgICAgICBpZiAob3V0cHV0WzBdID09ICdcMCcpIHsKICAgICAgICAgICAgc3RybmNweShvdXRwdXQsIGJ1ZmZlciwgb3V0cHV0X3NpemUgLSAxKTsKICAgICAgICAgICAgb3V0cHV0W291dHB1dF9zaXplIC0gMV0gPSAnXDAnOwogICAgICAgIH0KICAgICAgICAKICAgICAgICAvLyBBY2N1bXVsYXRlIGFsbCBvdXRwdXQgZm9yIHZlcmJvc2UKICAgICAgICBpZiAodG90YWxfdmVyYm9zZV9zaXplICsgc3RybGVuKGJ1ZmZlcikgPCB2ZXJib3NlX3NpemUgLSAxKSB7CiAgICAgICAgICAgIHN0cmNhdCh2ZXJib3NlX291dHB1dCwgYnVmZmVyKTsKICAgICAgICAgICAgc3RyY2F0KHZlcmJvc2Vfb3V0cHV0LCAiXG4iKTsKICAgICAgICAgICAgdG90YWxfdmVyYm9zZV9zaXplICs9IHN0cmxlbihidWZmZXIpICsgMTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGludCBzdGF0dXMgPSBwY2xvc2UoZnApOwogICAgCiAgICAvLyBGb3IgdmVyaWZpY2F0aW9uIGNvbW1hbmRzIHdpdGggZ3JlcCwgd2UgbmVlZCB0byBoYW5kbGUgZXhpdCBzdGF0dXMgZGlmZmVyZW50bHkKICAgIC8vIGdyZXAgcmV0dXJucyAwIGlmIHBhdHRlcm4gZm91bmQsIDEgaWYgbm90IGZvdW5kLCAyIG9uIGVycm9yCiAgICAvLyBXZSBzaG91bGQgb25seSByZXR1cm4gZmFpbHVyZSBvbiBhY3R1YWwgY29tbWFuZCBleGVjdXRpb24gZXJyb3JzLCBub3Qgb24gZ3JlcCAibm90IGZvdW5kIgogICAgaW50IHJlc3VsdDsKICAgIGlmIChXSUZFWElURUQoc3RhdHVzKSkgewogICAgICAgIGludCBleGl0X2NvZGUgPSBXRVhJVFNUQVRVUyhzdGF0dXMpOwogICAgICAgIC8vIElmIHRoZSBjb21tYW5kIGNvbnRhaW5zIGdyZXAsIHRyZWF0IGV4aXQgY29kZSAxIGFzIHN1Y2Nlc3MgKHBhdHRlcm4gbm90IGZvdW5kIGlzIG5vcm1hbCkKICAgICAgICBpZiAoc3Ryc3RyKGNvbW1hbmQsICJncmVwIikgIT0gTlVMTCkgewogICAgICAgICAgICByZXN1bHQgPSAoZXhpdF9jb2RlID09IDAgfHwgZXhpdF9jb2RlID09IDEpID8gMCA6IC0xOwogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHJlc3VsdCA9IChleGl0X2NvZGUgPT0gMCkgPyAwIDogLTE7CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICByZXN1bHQgPSAtMTsgLy8gQ29tbWFuZCBkaWRuJ3QgZXhpdCBub3JtYWxseQogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ29tbWFuZCBleGl0IHN0YXR1czogJWQgKHJhdzogJWQpXG4iIFJFU0VULCByZXN1bHQsIHN0YXR1cyk7CiAgICAgICAgaWYgKHZlcmJvc2Vfb3V0cHV0WzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ29tbWFuZCBvdXRwdXQ6XG4lc1xuIiBSRVNFVCwgdmVyYm9zZV9vdXRwdXQpOwogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENvbW1hbmQgb3V0cHV0OiAoZW1wdHkpXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHJldHVybiByZXN1bHQ7Cn0KCmludCB2ZXJpZnlfZGF0YWJhc2Vfc3RydWN0dXJlKGNvbnN0IGNoYXIgKmRhdGFiYXNlKSB7CiAgICBjaGFyIHBhdGhbNTEyXTsKICAgIHNucHJpbnRmKHBhdGgsIHNpemVvZihwYXRoKSwgIi90bXAvc3lkYl90ZXN0LyVzIiwgZGF0YWJhc2UpOwogICAgCiAgICBpZiAoIWZpbGVfZXhpc3RzKHBhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBEYXRhYmFzZSBkaXJlY3RvcnkgZG9lc24ndCBleGlzdDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBEYXRhYmFzZSBkaXJlY3RvcnkgZG9lc24ndCBleGlzdFxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIHN0cnVjdCBzdGF0IHN0OwogICAgaWYgKHN0YXQocGF0aCwgJnN0KSAhPSAwIHx8ICFTX0lTRElSKHN0LnN0X21vZGUpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBEYXRhYmFzZSBwYXRoIGlzIG5vdCBhIGRpcmVjdG9yeSBvciBzdGF0IGZhaWxlZDogJXNcbiIgUkVTRVQsIHBhdGgpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBEYXRhYmFzZSBwYXRoIGlzIG5vdCBhIGRpcmVjdG9yeVxuIiBSRVNFVCk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIERhdGFiYXNlIGRpcmVjdG9yeSBleGlzdHMgYW5kIGlzIHZhbGlkOiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICB9CiAgICBwcmludGYoR1JFRU4gIiAg4pyTIERhdGFiYXNlIGRpcmVjdG9yeSBleGlzdHMgYW5kIGlzIHZhbGlkXG4iIFJFU0VUKTsKICAgIHJldHVybiAxOwp9CgppbnQgdmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKGNvbnN0IGNoYXIgKmRhdGFiYXNlLCBjb25zdCBjaGFyICpjb2xsZWN0aW9uKSB7CiAgICBjaGFyIHBhdGhbNTEyXTsKICAgIHNucHJpbnRmKHBhdGgsIHNpemVvZihwYXRoKSwgIi90bXAvc3lkYl90ZXN0LyVzLyVzIiwgZGF0YWJhc2UsIGNvbGxlY3Rpb24pOwogICAgCiAgICBpZiAoIWZpbGVfZXhpc3RzKHBhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDb2xsZWN0aW9uIGRpcmVjdG9yeSBkb2Vzbid0IGV4aXN0OiAlc1xuIiBSRVNFVCwgcGF0aCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIENvbGxlY3Rpb24gZGlyZWN0b3J5IGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICAvLyBDaGVjayBmb3Igc2NoZW1hIGZpbGUKICAgIGNoYXIgc2NoZW1hX3BhdGhbNTEyXTsKICAgIHNucHJpbnRmKHNjaGVtYV9wYXRoLCBzaXplb2Yoc2NoZW1hX3BhdGgpLCAiJXMvc2NoZW1hLnR4dCIsIHBhdGgpOwogICAgaWYgKCFmaWxlX2V4aXN0cyhzY2hlbWFfcGF0aCkpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNjaGVtYSBmaWxlIGRvZXNuJ3QgZXhpc3Q6ICVzXG4iIFJFU0VULCBzY2hlbWFfcGF0aCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIFNjaGVtYSBmaWxlIGRvZXNuJ3QgZXhpc3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICAvLyBDaGVjayBmb3IgZGF0YSBmaWxlCiAgICBjaGFyIGRhdGFfcGF0aFs1MTJdOwogICAgc25wcmludGYoZGF0YV9wYXRoLCBzaXplb2YoZGF0YV9wYXRoKSwgIiVzL2RhdGEuc3lkYiIsIHBhdGgpOwogICAgaWYgKCFmaWxlX2V4aXN0cyhkYXRhX3BhdGgpKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBEYXRhIGZpbGUgZG9lc24ndCBleGlzdDogJXNcbiIgUkVTRVQsIGRhdGFfcGF0aCk7CiAgICAgICAgfQogICAgICAgIHByaW50ZihSRUQgIiAg4pyXIERhdGEgZmlsZSBkb2Vzbid0IGV4aXN0XG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gQ29sbGVjdGlvbiBzdHJ1Y3R1cmUgaXMgdmFsaWQ6ICVzXG4iIFJFU0VULCBwYXRoKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTY2hlbWEgZmlsZTogJXNcbiIgUkVTRVQsIHNjaGVtYV9wYXRoKTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBEYXRhIGZpbGU6ICVzXG4iIFJFU0VULCBkYXRhX3BhdGgpOwogICAgfQogICAgcHJpbnRmKEdSRUVOICIgIOKckyBDb2xsZWN0aW9uIHN0cnVjdHVyZSBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICByZXR1cm4gMTsKfQoKaW50IHZlcmlmeV9zY2hlbWFfY29udGVudChjb25zdCBjaGFyICpkYXRhYmFzZSwgY29uc3QgY2hhciAqY29sbGVjdGlvbiwgY29uc3QgY2hhciAqZXhwZWN0ZWRfZmllbGRzKSB7CiAgICBjaGFyIGNvbW1hbmRbNTEyXTsKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgIiVzIHNjaGVtYSAlcyAlcyIsIGNsaV9jb21tYW5kLCBkYXRhYmFzZSwgY29sbGVjdGlvbik7CiAgICAKICAgIGNoYXIgb3V0cHV0WzEwMjRdOwogICAgY2hhciB2ZXJib3NlX291dHB1dFs0MDk2XTsKICAgIGludCByZXN1bHQ7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICByZXN1bHQgPSBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmVfdmVyYm9zZShjb21tYW5kLCBvdXRwdXQsIHNpemVvZihvdXRwdXQpLCB2ZXJib3NlX291dHB1dCwgc2l6ZW9mKHZlcmJvc2Vfb3V0cHV0KSk7CiAgICB9IGVsc2UgewogICAgICAgIHJlc3VsdCA9IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZShjb21tYW5kLCBvdXRwdXQsIHNpemVvZihvdXRwdXQpKTsKICAgIH0KICAgIAogICAgaWYgKHJlc3VsdCAhPSAwKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDb3VsZCBub3QgcmVhZCBzY2hlbWEsIGNvbW1hbmQgZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgcHJpbnRmKFJFRCAiICDinJcgQ291bGQgbm90IHJlYWQgc2NoZW1hXG4iIFJFU0VUKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgLy8gQmFzaWMgc2NoZW1hIHZlcmlmaWNhdGlvbgogICAgaWYgKHN0cnN0cihvdXRwdXQsICJGaWVsZCIpID09IE5VTEwgfHwgc3Ryc3RyKG91dHB1dCwgIlR5cGUiKSA9PSBOVUxMKSB7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTY2hlbWEgb3V0cHV0IGZvcm1hdCBpbmNvcnJlY3RcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBPdXRwdXQgcmVjZWl2ZWQ6ICVzXG4iIFJFU0VULCBvdXRwdXQpOwogICAgICAgIH0KICAgICAgICBwcmludGYoUkVEICIgIOKclyBTY2hlbWEgb3V0cHV0IGZvcm1hdCBpbmNvcnJlY3RcbiIgUkVTRVQpOwogICAgICAgIHJldHVybiAwOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSBTY2hlbWEgY29udGVudCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU2NoZW1hIG91dHB1dDpcbiVzXG4iIFJFU0VULCBvdXRwdXQpOwogICAgfQogICAgcHJpbnRmKEdSRUVOICIgIOKckyBTY2hlbWEgY29udGVudCBpcyB2YWxpZFxuIiBSRVNFVCk7CiAgICByZXR1cm4gMTsKfQoKaW50IGV4ZWN1dGVfdGVzdF93aXRoX3ZlcmlmaWNhdGlvbihUZXN0Q2FzZSAqdGVzdCkgewogICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCB0ZXN0LT5kZXNjcmlwdGlvbik7CiAgICBmZmx1c2goc3Rkb3V0KTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIC8vIEV4ZWN1dGUgbWFpbiBjb21tYW5kCiAgICBpbnQgcmVzdWx0ID0gc3lzdGVtKHRlc3QtPmNvbW1hbmQpOwogICAgbG9uZyBsb25nIGVuZF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICB0ZXN0LT5kdXJhdGlvbl9tcyA9IGVuZF90aW1lIC0gc3RhcnRfdGltZTsKICAgIHRlc3QtPnN1Y2Nlc3MgPSAocmVzdWx0ID09IDApOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiXG4gIFtWRVJCT1NFXSBDb21tYW5kOiAlc1xuIiBSRVNFVCwgdGVzdC0+Y29tbWFuZCk7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gRXhpdCBjb2RlOiAlZFxuIiBSRVNFVCwgcmVzdWx0KTsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBFeGVjdXRpb24gdGltZTogJWxsZCBtc1xuIiBSRVNFVCwgdGVzdC0+ZHVyYXRpb25fbXMpOwogICAgfQogICAgCiAgICAvLyBQZXJmb3JtIHZlcmlmaWNhdGlvbiBpZiBjb21tYW5kIHN1Y2NlZWRlZAogICAgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MgPSAxOwogICAgaWYgKHRlc3QtPnN1Y2Nlc3MgJiYgdGVzdC0+dmVyaWZpY2F0aW9uX2NvbW1hbmRbMF0gIT0gJ1wwJykgewogICAgICAgIGNoYXIgdmVyaWZpY2F0aW9uX291dHB1dFsxMDI0XTsKICAgICAgICBjaGFyIHZlcmJvc2Vfb3V0cHV0WzQwOTZdOwogICAgICAgIGludCB2ZXJpZmljYXRpb25fcmVzdWx0OwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgdmVyaWZpY2F0aW9uX3Jlc3VsdCA9IGV4ZWN1dGVfY29tbWFuZF9hbmRfY2FwdHVyZV92ZXJib3NlKHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHZlcmlmaWNhdGlvbl9vdXRwdXQsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgc2l6ZW9mKHZlcmlmaWNhdGlvbl9vdXRwdXQpLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyYm9zZV9vdXRwdXQsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzaXplb2YodmVyYm9zZV9vdXRwdXQpKTsKICAgICAgICAgICAgc3RybmNweSh0ZXN0LT52ZXJib3NlX291dHB1dCwgdmVyYm9zZV9vdXRwdXQsIHNpemVvZih0ZXN0LT52ZXJib3NlX291dHB1dCkgLSAxKTsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICB2ZXJpZmljYXRpb25fcmVzdWx0ID0gZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlKHRlc3QtPnZlcmlmaWNhdGlvbl9jb21tYW5kLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgdmVyaWZpY2F0aW9uX291dHB1dCwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHNpemVvZih2ZXJpZmljYXRpb25fb3V0cHV0KSk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJpZmljYXRpb25fcmVzdWx0ID09IDApIHsKICAgICAgICAgICAgaWYgKHRlc3QtPmV4cGVjdGVkX291dHB1dFswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgICAgICBpZiAoc3Ryc3RyKHZlcmlmaWNhdGlvbl9vdXRwdXQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCkgPT0gTlVMTCkgewogICAgICAgICAgICAgICAgICAgIHRlc3QtPnZlcmlmaWNhdGlvbl9zdWNjZXNzID0gMDsKICAgICAgICAgICAgICAgICAgICBzdHJuY3B5KHRlc3QtPmRldGFpbHMsIHZlcmlmaWNhdGlvbl9vdXRwdXQsIHNpemVvZih0ZXN0LT5kZXRhaWxzKSAtIDEpOwogICAgICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gVmVyaWZpY2F0aW9uIGZhaWxlZCAtIGV4cGVjdGVkIHBhdHRlcm4gbm90IGZvdW5kXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRXhwZWN0ZWQ6ICclcydcbiIgUkVTRVQsIHRlc3QtPmV4cGVjdGVkX291dHB1dCk7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEdvdDogJyVzJ1xuIiBSRVNFVCwgdmVyaWZpY2F0aW9uX291dHB1dCk7CiAgICAgICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gVmVyaWZpY2F0aW9uIHBhc3NlZCAtIHBhdHRlcm4gZm91bmRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBFeHBlY3RlZDogJyVzJ1xuIiBSRVNFVCwgdGVzdC0+ZXhwZWN0ZWRfb3V0cHV0KTsKICAgICAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gR290OiAnJXMnXG4iIFJFU0VULCB2ZXJpZmljYXRpb25fb3V0cHV0KTsKICAgICAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9IGVsc2UgewogICAgICAgICAgICB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcyA9IDA7CiAgICAgICAgICAgIHN0cmNweSh0ZXN0LT5kZXRhaWxzLCAiVmVyaWZpY2F0aW9uIGNvbW1hbmQgZmFpbGVkIik7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBWZXJpZmljYXRpb24gY29tbWFuZCBmYWlsZWQgd2l0aCBleGl0IGNvZGUgJWRcbiIgUkVTRVQsIHZlcmlmaWNhdGlvbl9yZXN1bHQpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgfQogICAgCiAgICAvLyBPdmVyYWxsIHRlc3QgcmVzdWx0CiAgICBpbnQgb3ZlcmFsbF9zdWNjZXNzID0gdGVzdC0+c3VjY2VzcyAmJiB0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzczsKICAgIAogICAgaWYgKG92ZXJhbGxfc3VjY2VzcykgewogICAgICAgIHByaW50ZigiWyIgR1JFRU4gIlBBU1MiIFJFU0VUICJdIik7CiAgICB9IGVsc2UgewogICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXSIpOwogICAgfQogICAgCiAgICBwcmludGYoIiAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIHRlc3QtPmR1cmF0aW9uX21zLCBSRVNFVCk7CiAgICAKICAgIC8vIFByaW50IGRldGFpbHMgaWYgdmVyaWZpY2F0aW9uIGZhaWxlZAogICAgaWYgKCF0ZXN0LT52ZXJpZmljYXRpb25fc3VjY2VzcykgewogICAgICAgIGlmICh0ZXN0LT5kZXRhaWxzWzBdICE9ICdcMCcpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBWZXJpZmljYXRpb24gZmFpbGVkOiAlc1xuIiBSRVNFVCwgdGVzdC0+ZGV0YWlscyk7CiAgICAgICAgfQogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUgJiYgdGVzdC0+dmVyYm9zZV9vdXRwdXRbMF0gIT0gJ1wwJykgewogICAgICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBGdWxsIHZlcmlmaWNhdGlvbiBvdXRwdXQ6XG4lc1xuIiBSRVNFVCwgdGVzdC0+dmVyYm9zZV9vdXRwdXQpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSAmJiAhb3ZlcmFsbF9zdWNjZXNzKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gVEVTVCBGQUlMVVJFIEFOQUxZU0lTOlxuIiBSRVNFVCk7CiAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBDb21tYW5kIHN1Y2Nlc3M6ICVzXG4iIFJFU0VULCB0ZXN0LT5zdWNjZXNzID8gIllFUyIgOiAiTk8iKTsKICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIFZlcmlmaWNhdGlvbiBzdWNjZXNzOiAlc1xuIiBSRVNFVCwgdGVzdC0+dmVyaWZpY2F0aW9uX3N1Y2Nlc3MgPyAiWUVTIiA6ICJOTyIpOwogICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgRGV0YWlsczogJXNcbiIgUkVTRVQsIHRlc3QtPmRldGFpbHMpOwogICAgICAgIGlmICh0ZXN0LT52ZXJib3NlX291dHB1dFswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgRnVsbCBvdXRwdXQgY2FwdHVyZWQgKCV6dSBieXRlcylcbiIgUkVTRVQsIHN0cmxlbih0ZXN0LT52ZXJib3NlX291dHB1dCkpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgcmV0dXJuIG92ZXJhbGxfc3VjY2VzczsKfQoKLy8gPT09PT09PT09PT09PT09PT09PT0gSFRUUCBDTElFTlQgSU1QTEVNRU5UQVRJT04gPT09PT09PT09PT09PT09PT09PT0KCkh0dHBSZXNwb25zZSogaHR0cF9yZXF1ZXN0KGNvbnN0IGNoYXIqIG1ldGhvZCwgY29uc3QgY2hhciogdXJsLCBjb25zdCBjaGFyKiBib2R5LCBjb25zdCBjaGFyKiBjb250ZW50X3R5cGUpIHsKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBtYWxsb2Moc2l6ZW9mKEh0dHBSZXNwb25zZSkpOwogICAgaWYgKCFyZXNwb25zZSkgcmV0dXJuIE5VTEw7CiAgICAKICAgIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9IDA7CiAgICByZXNwb25zZS0+Ym9keSA9IE5VTEw7CiAgICByZXNwb25zZS0+Ym9keV9sZW5ndGggPSAwOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gSFRUUCBSZXF1ZXN0OiAlcyAlc1xuIiBSRVNFVCwgbWV0aG9kLCB1cmwpOwogICAgICAgIGlmIChib2R5KSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFJlcXVlc3QgYm9keTogJXNcbiIgUkVTRVQsIGJvZHkpOwogICAgICAgIH0KICAgIH0KICAgIAogICAgLy8gUGFyc2UgVVJMCiAgICBjaGFyIGhvc3RbMjU2XSA9ICJsb2NhbGhvc3QiOwogICAgaW50IHBvcnQgPSA4MDgwOwogICAgY2hhciBwYXRoWzEwMjRdID0gIi8iOwogICAgCiAgICBpZiAoc3RybmNtcCh1cmwsICJodHRwOi8vIiwgNykgPT0gMCkgewogICAgICAgIGNvbnN0IGNoYXIqIGhvc3Rfc3RhcnQgPSB1cmwgKyA3OwogICAgICAgIGNvbnN0IGNoYXIqIHBhdGhfc3RhcnQgPSBzdHJjaHIoaG9zdF9zdGFydCwgJy8nKTsKICAgICAgICBjb25zdCBjaGFyKiBwb3J0X3N0YXJ0ID0gc3RyY2hyKGhvc3Rfc3RhcnQsICc6Jyk7CiAgICAgICAgCiAgICAgICAgaWYgKHBvcnRfc3RhcnQgJiYgKCFwYXRoX3N0YXJ0IHx8IHBvcnRfc3RhcnQgPCBwYXRoX3N0YXJ0KSkgewogICAgICAgICAgICAvLyBIYXMgcG9ydCBiZWZvcmUgcGF0aAogICAgICAgICAgICBzaXplX3QgaG9zdF9sZW4gPSBwb3J0X3N0YXJ0IC0gaG9zdF9zdGFydDsKICAgICAgICAgICAgc3RybmNweShob3N0LCBob3N0X3N0YXJ0LCBob3N0X2xlbik7CiAgICAgICAgICAgIGhvc3RbaG9zdF9sZW5dID0gJ1wwJzsKICAgICAgICAgICAgcG9ydCA9IGF0b2kocG9ydF9zdGFydCArIDEpOwogICAgICAgICAgICBpZiAocGF0aF9zdGFydCkgewogICAgICAgICAgICAgICAgc3RyY3B5KHBhdGgsIHBhdGhfc3RhcnQpOwogICAgICAgICAgICB9CiAgICAgICAgfSBlbHNlIGlmIChwYXRoX3N0YXJ0KSB7CiAgICAgICAgICAgIC8vIE5vIHBvcnQsIGhhcyBwYXRoCiAgICAgICAgICAgIHNpemVfdCBob3N0X2xlbiA9IHBhdGhfc3RhcnQgLSBob3N0X3N0YXJ0OwogICAgICAgICAgICBzdHJuY3B5KGhvc3QsIGhvc3Rfc3RhcnQsIGhvc3RfbGVuKTsKICAgICAgICAgICAgaG9zdFtob3N0X2xlbl0gPSAnXDAnOwogICAgICAgICAgICBzdHJjcHkocGF0aCwgcGF0aF9zdGFydCk7CiAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgLy8gTm8gcG9ydCwgbm8gcGF0aAogICAgICAgICAgICBzdHJjcHkoaG9zdCwgaG9zdF9zdGFydCk7CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICAvLyBBc3N1bWUgaXQncyBqdXN0IGEgcGF0aAogICAgICAgIHN0cmNweShwYXRoLCB1cmwpOwogICAgfQogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gUGFyc2VkIFVSTCAtIEhvc3Q6ICVzLCBQb3J0OiAlZCwgUGF0aDogJXNcbiIgUkVTRVQsIGhvc3QsIHBvcnQsIHBhdGgpOwogICAgfQogICAgCiAgICAvLyBDcmVhdGUgc29ja2V0CiAgICBpbnQgc29ja2ZkID0gc29ja2V0KEFGX0lORVQsIFNPQ0tfU1RSRUFNLCAwKTsKICAgIGlmIChzb2NrZmQgPCAwKSB7CiAgICAgICAgcGVycm9yKCJzb2NrZXQiKTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNvY2tldCBjcmVhdGlvbiBmYWlsZWQ6ICVzXG4iIFJFU0VULCBzdHJlcnJvcihlcnJubykpOwogICAgICAgIH0KICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgLy8gU2V0IHRpbWVvdXQKICAgIHN0cnVjdCB0aW1ldmFsIHRpbWVvdXQ7CiAgICB0aW1lb3V0LnR2X3NlYyA9IDEwOwogICAgdGltZW91dC50dl91c2VjID0gMDsKICAgIHNldHNvY2tvcHQoc29ja2ZkLCBTT0xfU09DS0VULCBTT19SQ1ZUSU1FTywgJnRpbWVvdXQsIHNpemVvZih0aW1lb3V0KSk7CiAgICBzZXRzb2Nrb3B0KHNvY2tmZCwgU09MX1NPQ0tFVCwgU09fU05EVElNRU8sICZ0aW1lb3V0LCBzaXplb2YodGltZW91dCkpOwogICAgCiAgICAvLyBSZXNvbHZlIGhvc3RuYW1lCiAgICBzdHJ1Y3QgaG9zdGVudCogc2VydmVyID0gZ2V0aG9zdGJ5bmFtZShob3N0KTsKICAgIGlmICghc2VydmVyKSB7CiAgICAgICAgZnByaW50ZihzdGRlcnIsICJFcnJvcjogTm8gc3VjaCBob3N0ICVzXG4iLCBob3N0KTsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEhvc3QgcmVzb2x1dGlvbiBmYWlsZWQgZm9yOiAlc1xuIiBSRVNFVCwgaG9zdCk7CiAgICAgICAgfQogICAgICAgIGNsb3NlKHNvY2tmZCk7CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIC8vIENvbm5lY3QgdG8gc2VydmVyCiAgICBzdHJ1Y3Qgc29ja2FkZHJfaW4gc2Vydl9hZGRyOwogICAgbWVtc2V0KCZzZXJ2X2FkZHIsIDAsIHNpemVvZihzZXJ2X2FkZHIpKTsKICAgIHNlcnZfYWRkci5zaW5fZmFtaWx5ID0gQUZfSU5FVDsKICAgIG1lbWNweSgmc2Vydl9hZGRyLnNpbl9hZGRyLnNfYWRkciwgc2VydmVyLT5oX2FkZHIsIHNlcnZlci0+aF9sZW5ndGgpOwogICAgc2Vydl9hZGRyLnNpbl9wb3J0ID0gaHRvbnMocG9ydCk7CiAgICAKICAgIGlmIChjb25uZWN0KHNvY2tmZCwgKHN0cnVjdCBzb2NrYWRkciopJnNlcnZfYWRkciwgc2l6ZW9mKHNlcnZfYWRkcikpIDwgMCkgewogICAgICAgIGZwcmludGYoc3RkZXJyLCAiRXJyb3IgY29ubmVjdGluZyB0byAlczolZDogJXNcbiIsIGhvc3QsIHBvcnQsIHN0cmVycm9yKGVycm5vKSk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBDb25uZWN0aW9uIGZhaWxlZCB0byAlczolZDogJXNcbiIgUkVTRVQsIGhvc3QsIHBvcnQsIHN0cmVycm9yKGVycm5vKSk7CiAgICAgICAgfQogICAgICAgIGNsb3NlKHNvY2tmZCk7CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDb25uZWN0ZWQgc3VjY2Vzc2Z1bGx5IHRvICVzOiVkXG4iIFJFU0VULCBob3N0LCBwb3J0KTsKICAgIH0KICAgIAogICAgLy8gQnVpbGQgSFRUUCByZXF1ZXN0CiAgICBjaGFyIHJlcXVlc3RbODE5Ml07CiAgICBpbnQgcmVxdWVzdF9sZW47CiAgICAKICAgIGlmIChib2R5ICYmIGNvbnRlbnRfdHlwZSkgewogICAgICAgIHJlcXVlc3RfbGVuID0gc25wcmludGYocmVxdWVzdCwgc2l6ZW9mKHJlcXVlc3QpLAogICAgICAgICAgICAiJXMgJXMgSFRUUC8xLjFcclxuIgogICAgICAgICAgICAiSG9zdDogJXM6JWRcclxuIgogICAgICAgICAgICAiQ29udGVudC1UeXBlOiAlc1xyXG4iCiAgICAgICAgICAgICJDb250ZW50LUxlbmd0aDogJXp1XHJcbiIKICAgICAgICAgICAgIkNvbm5lY3Rpb246IGNsb3NlXHJcbiIKICAgICAgICAgICAgIlxyXG4iCiAgICAgICAgICAgICIlcyIsCiAgICAgICAgICAgIG1ldGhvZCwgcGF0aCwgaG9zdCwgcG9ydCwgY29udGVudF90eXBlLCBzdHJsZW4oYm9keSksIGJvZHkpOwogICAgfSBlbHNlIGlmIChib2R5KSB7CiAgICAgICAgcmVxdWVzdF9sZW4gPSBzbnByaW50ZihyZXF1ZXN0LCBzaXplb2YocmVxdWVzdCksCiAgICAgICAgICAgICIlcyAlcyBIVFRQLzEuMVxyXG4iCiAgICAgICAgICAgICJIb3N0OiAlczolZFxyXG4iCiAgICAgICAgICAgICJDb250ZW50LUxlbmd0aDogJXp1XHJcbiIKICAgICAgICAgICAgIkNvbm5lY3Rpb246IGNsb3NlXHJcbiIKICAgICAgICAgICAgIlxyXG4iCiAgICAgICAgICAgICIlcyIsCiAgICAgICAgICAgIG1ldGhvZCwgcGF0aCwgaG9zdCwgcG9ydCwgc3RybGVuKGJvZHkpLCBib2R5KTsKICAgIH0gZWxzZSB7CiAgICAgICAgcmVxdWVzdF9sZW4gPSBzbnByaW50ZihyZXF1ZXN0LCBzaXplb2YocmVxdWVzdCksCiAgICAgICAgICAgICIlcyAlcyBIVFRQLzEuMVxyXG4iCiAgICAgICAgICAgICJIb3N0OiAlczolZFxyXG4iCiAgICAgICAgICAgICJDb25uZWN0aW9uOiBjbG9zZVxyXG4iCiAgICAgICAgICAgICJcclxuIiwKICAgICAgICAgICAgbWV0aG9kLCBwYXRoLCBob3N0LCBwb3J0KTsKICAgIH0KICAgIAogICAgaWYgKHJlcXVlc3RfbGVuID49IChpbnQpc2l6ZW9mKHJlcXVlc3QpKSB7CiAgICAgICAgZnByaW50ZihzdGRlcnIsICJFcnJvcjogSFRUUCByZXF1ZXN0IHRvbyBsYXJnZVxuIik7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBIVFRQIHJlcXVlc3QgdG9vIGxhcmdlICglZCBieXRlcylcbiIgUkVTRVQsIHJlcXVlc3RfbGVuKTsKICAgICAgICB9CiAgICAgICAgY2xvc2Uoc29ja2ZkKTsKICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgICAgICByZXR1cm4gTlVMTDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFNlbmRpbmcgSFRUUCByZXF1ZXN0ICglZCBieXRlcyk6XG4lLipzXG4iIFJFU0VULCAKICAgICAgICAgICAgICAgcmVxdWVzdF9sZW4sIHJlcXVlc3RfbGVuID4gNTAwID8gNTAwIDogcmVxdWVzdF9sZW4sIHJlcXVlc3QpOwogICAgfQogICAgCiAgICAvLyBTZW5kIHJlcXVlc3QKICAgIGlmIChzZW5kKHNvY2tmZCwgcmVxdWVzdCwgcmVxdWVzdF9sZW4sIDApIDwgMCkgewogICAgICAgIHBlcnJvcigic2VuZCIpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU2VuZCBmYWlsZWQ6ICVzXG4iIFJFU0VULCBzdHJlcnJvcihlcnJubykpOwogICAgICAgIH0KICAgICAgICBjbG9zZShzb2NrZmQpOwogICAgICAgIGZyZWUocmVzcG9uc2UpOwogICAgICAgIHJldHVybiBOVUxMOwogICAgfQogICAgCiAgICAvLyBSZWNlaXZlIHJlc3BvbnNlCiAgICBjaGFyIHJlc3BvbnNlX2J1ZmZlclsxNjM4NF07CiAgICBzc2l6ZV90IHRvdGFsX3JlY2VpdmVkID0gMDsKICAgIHNzaXplX3QgcmVjZWl2ZWQ7CiAgICAKICAgIHdoaWxlICgocmVjZWl2ZWQgPSByZWN2KHNvY2tmZCwgcmVzcG9uc2VfYnVmZmVyICsgdG90YWxfcmVjZWl2ZWQsIAogICAgICAgICAgICAgICAgICAgICAgICAgICBzaXplb2YocmVzcG9uc2VfYnVmZmVyKSAtIHRvdGFsX3JlY2VpdmVkIC0gMSwgMCkpID4gMCkgewogICAgICAgIHRvdGFsX3JlY2VpdmVkICs9IHJlY2VpdmVkOwogICAgICAgIGlmICh0b3RhbF9yZWNlaXZlZCA+PSAoc3NpemVfdClzaXplb2YocmVzcG9uc2VfYnVmZmVyKSAtIDEpIHsKICAgICAgICAgICAgYnJlYWs7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAocmVjZWl2ZWQgPCAwKSB7CiAgICAgICAgcGVycm9yKCJyZWN2Iik7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZWNlaXZlIGZhaWxlZDogJXNcbiIgUkVTRVQsIHN0cmVycm9yKGVycm5vKSk7CiAgICAgICAgfQogICAgICAgIGNsb3NlKHNvY2tmZCk7CiAgICAgICAgZnJlZShyZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIE5VTEw7CiAgICB9CiAgICAKICAgIHJlc3BvbnNlX2J1ZmZlclt0b3RhbF9yZWNlaXZlZF0gPSAnXDAnOwogICAgY2xvc2Uoc29ja2ZkKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFJlY2VpdmVkICV6ZCBieXRlcyByZXNwb25zZVxuIiBSRVNFVCwgdG90YWxfcmVjZWl2ZWQpOwogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIChmaXJzdCA1MDAgYnl0ZXMpOlxuJS41MDBzXG4iIFJFU0VULCByZXNwb25zZV9idWZmZXIpOwogICAgfQogICAgCiAgICAvLyBQYXJzZSBIVFRQIHJlc3BvbnNlCiAgICBjaGFyKiBzdGF0dXNfbGluZSA9IHN0cnN0cihyZXNwb25zZV9idWZmZXIsICJIVFRQLzEuMSIpOwogICAgaWYgKHN0YXR1c19saW5lKSB7CiAgICAgICAgc3NjYW5mKHN0YXR1c19saW5lLCAiSFRUUC8xLjEgJWQiLCAmcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgIH0KICAgIAogICAgLy8gRmluZCBib2R5CiAgICBjaGFyKiBib2R5X3N0YXJ0ID0gc3Ryc3RyKHJlc3BvbnNlX2J1ZmZlciwgIlxyXG5cclxuIik7CiAgICBpZiAoYm9keV9zdGFydCkgewogICAgICAgIGJvZHlfc3RhcnQgKz0gNDsKICAgICAgICByZXNwb25zZS0+Ym9keV9sZW5ndGggPSB0b3RhbF9yZWNlaXZlZCAtIChib2R5X3N0YXJ0IC0gcmVzcG9uc2VfYnVmZmVyKTsKICAgICAgICByZXNwb25zZS0+Ym9keSA9IG1hbGxvYyhyZXNwb25zZS0+Ym9keV9sZW5ndGggKyAxKTsKICAgICAgICBpZiAocmVzcG9uc2UtPmJvZHkpIHsKICAgICAgICAgICAgbWVtY3B5KHJlc3BvbnNlLT5ib2R5LCBib2R5X3N0YXJ0LCByZXNwb25zZS0+Ym9keV9sZW5ndGgpOwogICAgICAgICAgICByZXNwb25zZS0+Ym9keVtyZXNwb25zZS0+Ym9keV9sZW5ndGhdID0gJ1wwJzsKICAgICAgICB9CiAgICB9IGVsc2UgewogICAgICAgIC8vIE5vIGJvZHkgZm91bmQKICAgICAgICByZXNwb25zZS0+Ym9keSA9IHN0cmR1cCgiIik7CiAgICAgICAgcmVzcG9uc2UtPmJvZHlfbGVuZ3RoID0gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFBhcnNlZCByZXNwb25zZSAtIFN0YXR1czogJWQsIEJvZHkgbGVuZ3RoOiAlenVcbiIgUkVTRVQsIAogICAgICAgICAgICAgICByZXNwb25zZS0+c3RhdHVzX2NvZGUsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICB9CiAgICAKICAgIHJldHVybiByZXNwb25zZTsKfQoKdm9pZCBodHRwX3Jlc3BvbnNlX2ZyZWUoSHR0cFJlc3BvbnNlKiByZXNwb25zZSkgewogICAgaWYgKHJlc3BvbnNlKSB7CiAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5KSB7CiAgICAgICAgICAgIGZyZWUocmVzcG9uc2UtPmJvZHkpOwogICAgICAgIH0KICAgICAgICBmcmVlKHJlc3BvbnNlKTsKICAgIH0KfQoKaW50IHZlcmlmeV9odHRwX3Jlc3BvbnNlKGNvbnN0IEh0dHBSZXNwb25zZSogcmVzcG9uc2UsIGNvbnN0IGNoYXIqIGV4cGVjdGVkX3BhdHRlcm4sIGludCBjaGVja19zdWNjZXNzX29ubHkpIHsKICAgIGlmICghcmVzcG9uc2UpIHsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIGlzIE5VTExcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFZlcmlmeWluZyByZXNwb25zZSAtIFN0YXR1czogJWQsIEJvZHkgbGVuZ3RoOiAlenVcbiIgUkVTRVQsIAogICAgICAgICAgICAgICByZXNwb25zZS0+c3RhdHVzX2NvZGUsIHJlc3BvbnNlLT5ib2R5X2xlbmd0aCk7CiAgICAgICAgaWYgKHJlc3BvbnNlLT5ib2R5KSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIGJvZHk6ICVzXG4iIFJFU0VULCByZXNwb25zZS0+Ym9keSk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBpZiAoY2hlY2tfc3VjY2Vzc19vbmx5KSB7CiAgICAgICAgLy8gT25seSBjaGVjayBpZiB0aGUgcmVzcG9uc2UgaW5kaWNhdGVzIHN1Y2Nlc3MgKHRydWUpIG9yIHByb3BlciBlcnJvciBoYW5kbGluZyAoZmFsc2UpCiAgICAgICAgaW50IHJlc3VsdCA9IChyZXNwb25zZS0+c3RhdHVzX2NvZGUgPj0gMjAwICYmIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA8IDUwMCkgJiYgCiAgICAgICAgICAgICAgICAgICAgcmVzcG9uc2UtPmJvZHkgJiYgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAiXCJzdWNjZXNzXCI6IikgIT0gTlVMTDsKICAgICAgICAKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENoZWNrIHN1Y2Nlc3Mgb25seTogJXNcbiIgUkVTRVQsIHJlc3VsdCA/ICJQQVNTIiA6ICJGQUlMIik7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFN0YXR1cyBjb2RlIGNoZWNrOiAlZCBpbiBbMjAwLDUwMClcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIEhhcyBzdWNjZXNzIGZpZWxkOiAlc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgICAgICAocmVzcG9uc2UtPmJvZHkgJiYgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCAiXCJzdWNjZXNzXCI6IikpID8gIllFUyIgOiAiTk8iKTsKICAgICAgICB9CiAgICAgICAgCiAgICAgICAgcmV0dXJuIHJlc3VsdDsKICAgIH0gZWxzZSB7CiAgICAgICAgLy8gQ2hlY2sgc3RhdHVzIGNvZGUgYW5kIGV4cGVjdGVkIHBhdHRlcm4KICAgICAgICBpZiAocmVzcG9uc2UtPnN0YXR1c19jb2RlIDwgMjAwIHx8IHJlc3BvbnNlLT5zdGF0dXNfY29kZSA+PSAzMDApIHsKICAgICAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gU3RhdHVzIGNvZGUgY2hlY2sgZmFpbGVkOiAlZCBub3QgaW4gWzIwMCwzMDApXG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIHJldHVybiAwOwogICAgICAgIH0KICAgICAgICAKICAgICAgICAvLyBDaGVjayBmb3IgZXhwZWN0ZWQgcGF0dGVybiBpbiBib2R5CiAgICAgICAgaWYgKGV4cGVjdGVkX3BhdHRlcm4gJiYgZXhwZWN0ZWRfcGF0dGVyblswXSAhPSAnXDAnKSB7CiAgICAgICAgICAgIGlmICghcmVzcG9uc2UtPmJvZHkgfHwgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCBleHBlY3RlZF9wYXR0ZXJuKSA9PSBOVUxMKSB7CiAgICAgICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gUGF0dGVybiBub3QgZm91bmQgaW4gcmVzcG9uc2UgYm9keVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRXhwZWN0ZWQ6ICclcydcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4pOwogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEdvdDogJyVzJ1xuIiBSRVNFVCwgcmVzcG9uc2UtPmJvZHkgPyByZXNwb25zZS0+Ym9keSA6ICJOVUxMIik7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICByZXR1cm4gMDsKICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFBhdHRlcm4gZm91bmQgaW4gcmVzcG9uc2UgYm9keVxuIiBSRVNFVCk7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgIH0KICAgICAgICB9CiAgICB9CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIHZlcmlmaWNhdGlvbiBwYXNzZWRcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICByZXR1cm4gMTsKfQoKY2hhciogZXh0cmFjdF9qc29uX2ZpZWxkKGNvbnN0IGNoYXIqIGpzb24sIGNvbnN0IGNoYXIqIGZpZWxkKSB7CiAgICBpZiAoIWpzb24gfHwgIWZpZWxkKSByZXR1cm4gTlVMTDsKICAgIAogICAgY2hhciBzZWFyY2hfcGF0dGVyblsyNTZdOwogICAgc25wcmludGYoc2VhcmNoX3BhdHRlcm4sIHNpemVvZihzZWFyY2hfcGF0dGVybiksICJcIiVzXCI6XCIiLCBmaWVsZCk7CiAgICAKICAgIGNoYXIqIGZpZWxkX3N0YXJ0ID0gc3Ryc3RyKGpzb24sIHNlYXJjaF9wYXR0ZXJuKTsKICAgIGlmICghZmllbGRfc3RhcnQpIHsKICAgICAgICAvLyBUcnkgd2l0aG91dCBxdW90ZXMgZm9yIHRoZSB2YWx1ZQogICAgICAgIHNucHJpbnRmKHNlYXJjaF9wYXR0ZXJuLCBzaXplb2Yoc2VhcmNoX3BhdHRlcm4pLCAiXCIlc1wiOiIsIGZpZWxkKTsKICAgICAgICBmaWVsZF9zdGFydCA9IHN0cnN0cihqc29uLCBzZWFyY2hfcGF0dGVybik7CiAgICAgICAgaWYgKCFmaWVsZF9zdGFydCkgcmV0dXJuIE5VTEw7CiAgICAgICAgCiAgICAgICAgZmllbGRfc3RhcnQgKz0gc3RybGVuKHNlYXJjaF9wYXR0ZXJuKTsKICAgICAgICBjaGFyKiBmaWVsZF9lbmQgPSBzdHJjaHIoZmllbGRfc3RhcnQsICcsJyk7CiAgICAgICAgaWYgKCFmaWVsZF9lbmQpIGZpZWxkX2VuZCA9IHN0cmNocihmaWVsZF9zdGFydCwgJ30nKTsKICAgICAgICBpZiAoIWZpZWxkX2VuZCkgcmV0dXJuIE5VTEw7CiAgICAgICAgCiAgICAgICAgc2l6ZV90IGZpZWxkX2xlbmd0aCA9IGZpZWxkX2VuZCAtIGZpZWxkX3N0YXJ0OwogICAgICAgIGNoYXIqIHZhbHVlID0gbWFsbG9jKGZpZWxkX2xlbmd0aCArIDEpOwogICAgICAgIGlmICghdmFsdWUpIHJldHVybiBOVUxMOwogICAgICAgIAogICAgICAgIHN0cm5jcHkodmFsdWUsIGZpZWxkX3N0YXJ0LCBmaWVsZF9sZW5ndGgpOwogICAgICAgIHZhbHVlW2ZpZWxkX2xlbmd0aF0gPSAnXDAnOwogICAgICAgIHJldHVybiB2YWx1ZTsKICAgIH0KICAgIAogICAgZmllbGRfc3RhcnQgKz0gc3RybGVuKHNlYXJjaF9wYXR0ZXJuKTsKICAgIGNoYXIqIGZpZWxkX2VuZCA9IHN0cmNocihmaWVsZF9zdGFydCwgJyInKTsKICAgIGlmICghZmllbGRfZW5kKSByZXR1cm4gTlVMTDsKICAgIAogICAgc2l6ZV90IGZpZWxkX2xlbmd0aCA9IGZpZWxkX2VuZCAtIGZpZWxkX3N0YXJ0OwogICAgY2hhciogdmFsdWUgPSBtYWxsb2MoZmllbGRfbGVuZ3RoICsgMSk7CiAgICBpZiAoIXZhbHVlKSByZXR1cm4gTlVMTDsKICAgIAogICAgc3RybmNweSh2YWx1ZSwgZmllbGRfc3RhcnQsIGZpZWxkX2xlbmd0aCk7CiAgICB2YWx1ZVtmaWVsZF9sZW5ndGhdID0gJ1wwJzsKICAgIHJldHVybiB2YWx1ZTsKfQoKaW50IGh0dHBfdGVzdF9lbmRwb2ludChjb25zdCBjaGFyKiBkZXNjcmlwdGlvbiwgY29uc3QgY2hhciogbWV0aG9kLCBjb25zdCBjaGFyKiBlbmRwb2ludCwgCiAgICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiBib2R5LCBjb25zdCBjaGFyKiBleHBlY3RlZF9wYXR0ZXJuLCBpbnQgY2hlY2tfc3VjY2Vzc19vbmx5LCBsb25nIGxvbmcqIGR1cmF0aW9uKSB7CiAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsIGRlc2NyaXB0aW9uKTsKICAgIGZmbHVzaChzdGRvdXQpOwogICAgCiAgICBsb25nIGxvbmcgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIAogICAgSHR0cFJlc3BvbnNlKiByZXNwb25zZSA9IGh0dHBfcmVxdWVzdChtZXRob2QsIGVuZHBvaW50LCBib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgbG9uZyBsb25nIGVuZF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgCiAgICBpZiAoZHVyYXRpb24pIHsKICAgICAgICAqZHVyYXRpb24gPSBlbmRfdGltZSAtIHN0YXJ0X3RpbWU7CiAgICB9CiAgICAKICAgIGludCBzdWNjZXNzID0gMDsKICAgIGlmIChyZXNwb25zZSkgewogICAgICAgIHN1Y2Nlc3MgPSB2ZXJpZnlfaHR0cF9yZXNwb25zZShyZXNwb25zZSwgZXhwZWN0ZWRfcGF0dGVybiwgY2hlY2tfc3VjY2Vzc19vbmx5KTsKICAgICAgICBpZiAoIXN1Y2Nlc3MpIHsKICAgICAgICAgICAgcHJpbnRmKCJbIiBSRUQgIkZBSUwiIFJFU0VUICJdICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgZW5kX3RpbWUgLSBzdGFydF90aW1lLCBSRVNFVCk7CiAgICAgICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBTdGF0dXM6ICVkLCBSZXNwb25zZTogJXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSwgcmVzcG9uc2UtPmJvZHkpOwogICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBTdGF0dXM6ICVkLCBObyByZXNwb25zZSBib2R5XG4iIFJFU0VULCByZXNwb25zZS0+c3RhdHVzX2NvZGUpOwogICAgICAgICAgICB9CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBIVFRQIFRFU1QgRkFJTFVSRSBBTkFMWVNJUzpcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBFbmRwb2ludDogJXMgJXNcbiIgUkVTRVQsIG1ldGhvZCwgZW5kcG9pbnQpOwogICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBTdGF0dXMgQ29kZTogJWRcbiIgUkVTRVQsIHJlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIEV4cGVjdGVkIFBhdHRlcm46ICclcydcbiIgUkVTRVQsIGV4cGVjdGVkX3BhdHRlcm4gPyBleHBlY3RlZF9wYXR0ZXJuIDogIk5PTkUiKTsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgQ2hlY2sgU3VjY2VzcyBPbmx5OiAlc1xuIiBSRVNFVCwgY2hlY2tfc3VjY2Vzc19vbmx5ID8gIllFUyIgOiAiTk8iKTsKICAgICAgICAgICAgICAgIGlmIChyZXNwb25zZS0+Ym9keSkgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgUmVzcG9uc2UgQm9keTogJXNcbiIgUkVTRVQsIHJlc3BvbnNlLT5ib2R5KTsKICAgICAgICAgICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gICBSZXNwb25zZSBCb2R5OiBOVUxMXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIHByaW50ZigiWyIgR1JFRU4gIlBBU1MiIFJFU0VUICJdICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgZW5kX3RpbWUgLSBzdGFydF90aW1lLCBSRVNFVCk7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIEhUVFAgVEVTVCBTVUNDRVNTIERFVEFJTFM6XG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gICBFbmRwb2ludDogJXMgJXNcbiIgUkVTRVQsIG1ldGhvZCwgZW5kcG9pbnQpOwogICAgICAgICAgICAgICAgcHJpbnRmKEdSRUVOICIgIFtWRVJCT1NFXSAgIFN0YXR1cyBDb2RlOiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UtPnN0YXR1c19jb2RlKTsKICAgICAgICAgICAgICAgIHByaW50ZihHUkVFTiAiICBbVkVSQk9TRV0gICBSZXNwb25zZSBUaW1lOiAlbGxkIG1zXG4iIFJFU0VULCBlbmRfdGltZSAtIHN0YXJ0X3RpbWUpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICB9IGVsc2UgewogICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGVuZF90aW1lIC0gc3RhcnRfdGltZSwgUkVTRVQpOwogICAgICAgIHByaW50ZihSRUQgIiAgTm8gcmVzcG9uc2UgZnJvbSBzZXJ2ZXJcbiIgUkVTRVQpOwogICAgICAgIAogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gSFRUUCBURVNUIEZBSUxVUkUgLSBOTyBSRVNQT05TRTpcbiIgUkVTRVQpOwogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSAgIEVuZHBvaW50OiAlcyAlc1xuIiBSRVNFVCwgbWV0aG9kLCBlbmRwb2ludCk7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdICAgU2VydmVyIG1heSBiZSBkb3duIG9yIHVucmVhY2hhYmxlXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHJldHVybiBzdWNjZXNzOwp9CgovLyA9PT09PT09PT09PT09PT09PT09PSBIVFRQIEFQSSBURVNUIFNVSVRFID09PT09PT09PT09PT09PT09PT09Cgp2b2lkIGNsZWFudXBfdGVzdF9kYXRhYmFzZXMoKSB7CiAgICBwcmludGYoIkNsZWFuaW5nIHVwIHByZXZpb3VzIHRlc3QgZGF0YWJhc2VzLi4uXG4iKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIENsZWFuaW5nIHVwIHRlc3QgZGlyZWN0b3JpZXMgaW4gL3RtcC9zeWRiX3Rlc3QvXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgLy8gUmVtb3ZlIGFsbCB0ZXN0IGRhdGFiYXNlcyBmcm9tIHByZXZpb3VzIHJ1bnMKICAgIGNoYXIgY29tbWFuZFs1MTJdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAicm0gLXJmIC90bXAvc3lkYl90ZXN0L3Rlc3RkYl8qIC90bXAvc3lkYl90ZXN0L3Rlc3RkYjJfKiAvdG1wL3N5ZGJfdGVzdC90ZXN0Y29sbGRiXyogL3RtcC9zeWRiX3Rlc3QvdGVzdGluc3RkYl8qIDI+L2Rldi9udWxsIik7CiAgICBzeXN0ZW0oY29tbWFuZCk7CiAgICAKICAgIC8vIEFsc28gY2xlYW4gdXAgYW55IGxvY2sgZmlsZXMKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgInJtIC1mIC90bXAvc3lkYl90ZXN0LyoubG9jayAvdG1wL3N5ZGJfdGVzdC8uKi5sb2NrIDI+L2Rldi9udWxsIik7CiAgICBzeXN0ZW0oY29tbWFuZCk7CiAgICAKICAgIHVzbGVlcCg1MDAwMCk7IC8vIDUwbXMgdG8gZW5zdXJlIGNsZWFudXAgY29tcGxldGVzCiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBDbGVhbnVwIGNvbXBsZXRlZFxuIiBSRVNFVCk7CiAgICB9Cn0KCmludCBydW5faHR0cF9kYXRhYmFzZV90ZXN0cygpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkhUVFAgQVBJIERBVEFCQVNFIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICAvLyBHZW5lcmF0ZSB1bmlxdWUgZGF0YWJhc2UgbmFtZXMgdG8gYXZvaWQgY29uZmxpY3RzCiAgICBjaGFyIHVuaXF1ZV9kYjFbNjRdLCB1bmlxdWVfZGIyWzY0XTsKICAgIHN0cnVjdCB0aW1lc3BlYyB0czsKICAgIGNsb2NrX2dldHRpbWUoQ0xPQ0tfTU9OT1RPTklDLCAmdHMpOwogICAgc25wcmludGYodW5pcXVlX2RiMSwgc2l6ZW9mKHVuaXF1ZV9kYjEpLCAidGVzdGRiXyVsZF8lbGQiLCB0cy50dl9zZWMsIHRzLnR2X25zZWMpOwogICAgc25wcmludGYodW5pcXVlX2RiMiwgc2l6ZW9mKHVuaXF1ZV9kYjIpLCAidGVzdGRiMl8lbGRfJWxkIiwgdHMudHZfc2VjLCB0cy50dl9uc2VjICsgMSk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBVc2luZyB1bmlxdWUgZGF0YWJhc2UgbmFtZXM6ICVzLCAlc1xuIiBSRVNFVCwgdW5pcXVlX2RiMSwgdW5pcXVlX2RiMik7CiAgICB9CiAgICAKICAgIGNoYXIgY3JlYXRlX2RiMV9ib2R5WzEyOF0sIGNyZWF0ZV9kYjJfYm9keVsxMjhdOwogICAgc25wcmludGYoY3JlYXRlX2RiMV9ib2R5LCBzaXplb2YoY3JlYXRlX2RiMV9ib2R5KSwgIntcIm5hbWVcIjpcIiVzXCJ9IiwgdW5pcXVlX2RiMSk7CiAgICBzbnByaW50ZihjcmVhdGVfZGIyX2JvZHksIHNpemVvZihjcmVhdGVfZGIyX2JvZHkpLCAie1wibmFtZVwiOlwiJXNcIn0iLCB1bmlxdWVfZGIyKTsKICAgIAogICAgLy8gVGVzdCAxOiBMaXN0IGRhdGFiYXNlcyAoc2hvdWxkIHdvcmsgcmVnYXJkbGVzcyBvZiBleGlzdGluZyBkYXRhKQogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzIC0gTGlzdCBkYXRhYmFzZXMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgIi9hcGkvZGF0YWJhc2VzIiwgTlVMTCwgIlwic3VjY2Vzc1wiOnRydWUiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAyOiBDcmVhdGUgZmlyc3QgZGF0YWJhc2UKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMgLSBDcmVhdGUgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYjFfYm9keSwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAzOiBDcmVhdGUgc2Vjb25kIGRhdGFiYXNlCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gQ3JlYXRlIHNlY29uZCBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgY3JlYXRlX2RiMl9ib2R5LCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDQ6IFRyeSB0byBjcmVhdGUgZHVwbGljYXRlIGRhdGFiYXNlIChzaG91bGQgZmFpbCBwcm9wZXJseSkKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMgLSBQcmV2ZW50IGR1cGxpY2F0ZSBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZGF0YWJhc2VzIiwgY3JlYXRlX2RiMV9ib2R5LCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCA1OiBEZWxldGUgZGF0YWJhc2UKICAgIGNoYXIgZGVsZXRlX3VybFsyNTZdOwogICAgc25wcmludGYoZGVsZXRlX3VybCwgc2l6ZW9mKGRlbGV0ZV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMiLCB1bmlxdWVfZGIyKTsKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkRFTEVURSAvYXBpL2RhdGFiYXNlcy97bmFtZX0gLSBEZWxldGUgZGF0YWJhc2UiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiREVMRVRFIiwgZGVsZXRlX3VybCwgTlVMTCwgIlwic3VjY2Vzc1wiOnRydWUiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBEYXRhYmFzZSBBUEkgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl9odHRwX2NvbGxlY3Rpb25fdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBDT0xMRUNUSU9OIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICAvLyBVc2UgYSB1bmlxdWUgZGF0YWJhc2UgbmFtZSB0byBhdm9pZCBjb25mbGljdHMKICAgIGNoYXIgdW5pcXVlX2RiWzY0XTsKICAgIHN0cnVjdCB0aW1lc3BlYyB0czsKICAgIGNsb2NrX2dldHRpbWUoQ0xPQ0tfTU9OT1RPTklDLCAmdHMpOwogICAgc25wcmludGYodW5pcXVlX2RiLCBzaXplb2YodW5pcXVlX2RiKSwgInRlc3Rjb2xsZGJfJWxkXyVsZCIsIHRzLnR2X3NlYywgdHMudHZfbnNlYyk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBVc2luZyB1bmlxdWUgZGF0YWJhc2UgbmFtZTogJXNcbiIgUkVTRVQsIHVuaXF1ZV9kYik7CiAgICB9CiAgICAKICAgIGNoYXIgY3JlYXRlX2RiX2JvZHlbMTI4XTsKICAgIHNucHJpbnRmKGNyZWF0ZV9kYl9ib2R5LCBzaXplb2YoY3JlYXRlX2RiX2JvZHkpLCAie1wibmFtZVwiOlwiJXNcIn0iLCB1bmlxdWVfZGIpOwogICAgCiAgICAvLyBDcmVhdGUgYSBmcmVzaCBkYXRhYmFzZSBmb3IgY29sbGVjdGlvbiB0ZXN0cwogICAgSHR0cFJlc3BvbnNlKiBkYl9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYl9ib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaWYgKCFkYl9yZXNwb25zZSB8fCAhdmVyaWZ5X2h0dHBfcmVzcG9uc2UoZGJfcmVzcG9uc2UsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCkpIHsKICAgICAgICBwcmludGYoUkVEICIgIEZhaWxlZCB0byBjcmVhdGUgdGVzdCBkYXRhYmFzZSBmb3IgY29sbGVjdGlvbiB0ZXN0c1xuIiBSRVNFVCk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBEYXRhYmFzZSBjcmVhdGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICBpZiAoZGJfcmVzcG9uc2UpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFJlc3BvbnNlIHN0YXR1czogJWQsIGJvZHk6ICVzXG4iIFJFU0VULCBkYl9yZXNwb25zZS0+c3RhdHVzX2NvZGUsIGRiX3Jlc3BvbnNlLT5ib2R5ID8gZGJfcmVzcG9uc2UtPmJvZHkgOiAiTlVMTCIpOwogICAgICAgICAgICB9CiAgICAgICAgfQogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoZGJfcmVzcG9uc2UpOwogICAgCiAgICAvLyBUZXN0IDE6IExpc3QgY29sbGVjdGlvbnMgKGVtcHR5KQogICAgY2hhciBsaXN0X2NvbGxzX3VybFsyNTZdOwogICAgc25wcmludGYobGlzdF9jb2xsc191cmwsIHNpemVvZihsaXN0X2NvbGxzX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucyIsIHVuaXF1ZV9kYik7CiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucyAtIExpc3QgZW1wdHkgY29sbGVjdGlvbnMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgbGlzdF9jb2xsc191cmwsIE5VTEwsICJcImNvbGxlY3Rpb25zXCI6W10iLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAyOiBDcmVhdGUgY29sbGVjdGlvbiB3aXRoIHNjaGVtYQogICAgY2hhciBjcmVhdGVfY29sbF91cmxbMjU2XTsKICAgIHNucHJpbnRmKGNyZWF0ZV9jb2xsX3VybCwgc2l6ZW9mKGNyZWF0ZV9jb2xsX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucyIsIHVuaXF1ZV9kYik7CiAgICAKICAgIGNvbnN0IGNoYXIqIHVzZXJzX3NjaGVtYSA9ICJ7XCJuYW1lXCI6XCJ1c2Vyc1wiLFwic2NoZW1hXCI6WyIKICAgICAgICAie1wibmFtZVwiOlwibmFtZVwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwiYWdlXCIsXCJ0eXBlXCI6XCJpbnRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAie1wibmFtZVwiOlwiZW1haWxcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0iCiAgICAgICAgIl19IjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zIC0gQ3JlYXRlIHVzZXJzIGNvbGxlY3Rpb24iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsIGNyZWF0ZV9jb2xsX3VybCwgdXNlcnNfc2NoZW1hLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDM6IENyZWF0ZSBwcm9kdWN0cyBjb2xsZWN0aW9uCiAgICBjb25zdCBjaGFyKiBwcm9kdWN0c19zY2hlbWEgPSAie1wibmFtZVwiOlwicHJvZHVjdHNcIixcInNjaGVtYVwiOlsiCiAgICAgICAgIntcIm5hbWVcIjpcIm5hbWVcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjp0cnVlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcInByaWNlXCIsXCJ0eXBlXCI6XCJmbG9hdFwiLFwicmVxdWlyZWRcIjpmYWxzZSxcImluZGV4ZWRcIjpmYWxzZX0iCiAgICAgICAgIl19IjsKICAgIAogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zIC0gQ3JlYXRlIHByb2R1Y3RzIGNvbGxlY3Rpb24iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsIGNyZWF0ZV9jb2xsX3VybCwgcHJvZHVjdHNfc2NoZW1hLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICBwYXNzZWQrKzsKICAgIH0KICAgIHRvdGFsKys7CiAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDQ6IExpc3QgY29sbGVjdGlvbnMgKHdpdGggZGF0YSkKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zIC0gTGlzdCBjcmVhdGVkIGNvbGxlY3Rpb25zIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIGxpc3RfY29sbHNfdXJsLCBOVUxMLCAiXCJ1c2Vyc1wiIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgNTogR2V0IGNvbGxlY3Rpb24gc2NoZW1hCiAgICBjaGFyIHNjaGVtYV91cmxbMjU2XTsKICAgIHNucHJpbnRmKHNjaGVtYV91cmwsIHNpemVvZihzY2hlbWFfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL3NjaGVtYSIsIHVuaXF1ZV9kYik7CiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vc2NoZW1hIC0gR2V0IHVzZXJzIHNjaGVtYSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBzY2hlbWFfdXJsLCBOVUxMLCAiXCJuYW1lXCIiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCA2OiBEZWxldGUgY29sbGVjdGlvbgogICAgY2hhciBkZWxldGVfY29sbF91cmxbMjU2XTsKICAgIHNucHJpbnRmKGRlbGV0ZV9jb2xsX3VybCwgc2l6ZW9mKGRlbGV0ZV9jb2xsX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy9wcm9kdWN0cyIsIHVuaXF1ZV9kYik7CiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJERUxFVEUgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0gLSBEZWxldGUgcHJvZHVjdHMgY29sbGVjdGlvbiIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJERUxFVEUiLCBkZWxldGVfY29sbF91cmwsIE5VTEwsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgQ29sbGVjdGlvbiBBUEkgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl9odHRwX2luc3RhbmNlX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiSFRUUCBBUEkgSU5TVEFOQ0UgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGludCB0b3RhbCA9IDA7CiAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IDA7CiAgICBsb25nIGxvbmcgZHVyYXRpb247CiAgICAKICAgIC8vIFVzZSBhIHVuaXF1ZSBkYXRhYmFzZSBuYW1lIHRvIGF2b2lkIGNvbmZsaWN0cwogICAgY2hhciB1bmlxdWVfZGJbNjRdOwogICAgc3RydWN0IHRpbWVzcGVjIHRzOwogICAgY2xvY2tfZ2V0dGltZShDTE9DS19NT05PVE9OSUMsICZ0cyk7CiAgICBzbnByaW50Zih1bmlxdWVfZGIsIHNpemVvZih1bmlxdWVfZGIpLCAidGVzdGluc3RkYl8lbGRfJWxkIiwgdHMudHZfc2VjLCB0cy50dl9uc2VjKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFVzaW5nIHVuaXF1ZSBkYXRhYmFzZSBuYW1lOiAlc1xuIiBSRVNFVCwgdW5pcXVlX2RiKTsKICAgIH0KICAgIAogICAgY2hhciBjcmVhdGVfZGJfYm9keVsxMjhdOwogICAgc25wcmludGYoY3JlYXRlX2RiX2JvZHksIHNpemVvZihjcmVhdGVfZGJfYm9keSksICJ7XCJuYW1lXCI6XCIlc1wifSIsIHVuaXF1ZV9kYik7CiAgICAKICAgIC8vIENyZWF0ZSBhIGZyZXNoIGRhdGFiYXNlIGZvciBpbnN0YW5jZSB0ZXN0cwogICAgSHR0cFJlc3BvbnNlKiBkYl9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsIGNyZWF0ZV9kYl9ib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaWYgKCFkYl9yZXNwb25zZSB8fCAhdmVyaWZ5X2h0dHBfcmVzcG9uc2UoZGJfcmVzcG9uc2UsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCkpIHsKICAgICAgICBwcmludGYoUkVEICIgIEZhaWxlZCB0byBjcmVhdGUgdGVzdCBkYXRhYmFzZSBmb3IgaW5zdGFuY2UgdGVzdHNcbiIgUkVTRVQpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRGF0YWJhc2UgY3JlYXRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKGRiX3Jlc3BvbnNlKTsKICAgICAgICByZXR1cm4gMDsKICAgIH0KICAgIGh0dHBfcmVzcG9uc2VfZnJlZShkYl9yZXNwb25zZSk7CiAgICAKICAgIC8vIENyZWF0ZSBjb2xsZWN0aW9uIGZvciBpbnN0YW5jZXMKICAgIGNoYXIgY3JlYXRlX2NvbGxfdXJsWzI1Nl07CiAgICBzbnByaW50ZihjcmVhdGVfY29sbF91cmwsIHNpemVvZihjcmVhdGVfY29sbF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMiLCB1bmlxdWVfZGIpOwogICAgCiAgICBjb25zdCBjaGFyKiB1c2Vyc19zY2hlbWEgPSAie1wibmFtZVwiOlwidXNlcnNcIixcInNjaGVtYVwiOlsiCiAgICAgICAgIntcIm5hbWVcIjpcIm5hbWVcIixcInR5cGVcIjpcInN0cmluZ1wiLFwicmVxdWlyZWRcIjp0cnVlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImFnZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOmZhbHNlLFwiaW5kZXhlZFwiOmZhbHNlfSwiCiAgICAgICAgIntcIm5hbWVcIjpcImVtYWlsXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9IgogICAgICAgICJdfSI7CiAgICAKICAgIEh0dHBSZXNwb25zZSogY29sbF9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsIGNyZWF0ZV9jb2xsX3VybCwgdXNlcnNfc2NoZW1hLCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgaWYgKCFjb2xsX3Jlc3BvbnNlIHx8ICF2ZXJpZnlfaHR0cF9yZXNwb25zZShjb2xsX3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgcHJpbnRmKFJFRCAiICBGYWlsZWQgdG8gY3JlYXRlIHRlc3QgY29sbGVjdGlvbiBmb3IgaW5zdGFuY2UgdGVzdHNcbiIgUkVTRVQpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gQ29sbGVjdGlvbiBjcmVhdGlvbiBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoY29sbF9yZXNwb25zZSk7CiAgICAgICAgcmV0dXJuIDA7CiAgICB9CiAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoY29sbF9yZXNwb25zZSk7CiAgICAKICAgIC8vIFRlc3QgMTogTGlzdCBpbnN0YW5jZXMgKGVtcHR5KQogICAgY2hhciBsaXN0X2luc3RhbmNlc191cmxbMjU2XTsKICAgIHNucHJpbnRmKGxpc3RfaW5zdGFuY2VzX3VybCwgc2l6ZW9mKGxpc3RfaW5zdGFuY2VzX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9pbnN0YW5jZXMiLCB1bmlxdWVfZGIpOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIExpc3QgZW1wdHkgaW5zdGFuY2VzIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIkdFVCIsIGxpc3RfaW5zdGFuY2VzX3VybCwgTlVMTCwgIlwiaW5zdGFuY2VzXCI6W10iLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAyOiBJbnNlcnQgZmlyc3QgaW5zdGFuY2UKICAgIGNvbnN0IGNoYXIqIHVzZXIxID0gIntcIm5hbWVcIjpcIkpvaG4gRG9lXCIsXCJhZ2VcIjozMCxcImVtYWlsXCI6XCJqb2huQHRlc3QuY29tXCJ9IjsKICAgIGNoYXIgaW5zZXJ0X3VybFsyNTZdOwogICAgc25wcmludGYoaW5zZXJ0X3VybCwgc2l6ZW9mKGluc2VydF91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzIiwgdW5pcXVlX2RiKTsKICAgIAogICAgSHR0cFJlc3BvbnNlKiBpbnNlcnRfcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBPU1QiLCBpbnNlcnRfdXJsLCB1c2VyMSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgIGlmIChpbnNlcnRfcmVzcG9uc2UgJiYgdmVyaWZ5X2h0dHBfcmVzcG9uc2UoaW5zZXJ0X3Jlc3BvbnNlLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsIDApKSB7CiAgICAgICAgY2hhciogaWQxID0gZXh0cmFjdF9qc29uX2ZpZWxkKGluc2VydF9yZXNwb25zZS0+Ym9keSwgImlkIik7CiAgICAgICAgaWYgKGlkMSkgewogICAgICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQT1NUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIEluc2VydCBmaXJzdCB1c2VyIik7CiAgICAgICAgICAgIHByaW50ZigiWyIgR1JFRU4gIlBBU1MiIFJFU0VUICJdICVzJTRsbGQgbXMlc1xuIiwgQ1lBTiwgZHVyYXRpb24sIFJFU0VUKTsKICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgIAogICAgICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIEluc2VydGVkIHVzZXIgd2l0aCBJRDogJXNcbiIgUkVTRVQsIGlkMSk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgCiAgICAgICAgICAgIC8vIFRlc3QgMzogSW5zZXJ0IHNlY29uZCBpbnN0YW5jZQogICAgICAgICAgICBjb25zdCBjaGFyKiB1c2VyMiA9ICJ7XCJuYW1lXCI6XCJKYW5lIFNtaXRoXCIsXCJhZ2VcIjoyNSxcImVtYWlsXCI6XCJqYW5lQHRlc3QuY29tXCJ9IjsKICAgICAgICAgICAgSHR0cFJlc3BvbnNlKiBpbnNlcnRfcmVzcG9uc2UyID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgaW5zZXJ0X3VybCwgdXNlcjIsICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICAgICAgICAgIGlmIChpbnNlcnRfcmVzcG9uc2UyICYmIHZlcmlmeV9odHRwX3Jlc3BvbnNlKGluc2VydF9yZXNwb25zZTIsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCkpIHsKICAgICAgICAgICAgICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gSW5zZXJ0IHNlY29uZCB1c2VyIik7CiAgICAgICAgICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXSAlcyU0bGxkIG1zJXNcbiIsIENZQU4sIGR1cmF0aW9uLCBSRVNFVCk7CiAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgLy8gVGVzdCA0OiBMaXN0IGluc3RhbmNlcyAod2l0aCBkYXRhKQogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiR0VUIC9hcGkvZGF0YWJhc2VzL3tkYn0vY29sbGVjdGlvbnMve2NvbGx9L2luc3RhbmNlcyAtIExpc3QgdXNlcnMiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgbGlzdF9pbnN0YW5jZXNfdXJsLCBOVUxMLCAiSm9obiBEb2UiLCAwLCAmZHVyYXRpb24pKSB7CiAgICAgICAgICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICB0b3RhbCsrOwogICAgICAgICAgICAgICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgICAgICAgICAgICAgIAogICAgICAgICAgICAgICAgLy8gVGVzdCA1OiBRdWVyeSBpbnN0YW5jZXMKICAgICAgICAgICAgICAgIGNoYXIgcXVlcnlfdXJsWzUxMl07CiAgICAgICAgICAgICAgICBzbnByaW50ZihxdWVyeV91cmwsIHNpemVvZihxdWVyeV91cmwpLCAiL2FwaS9kYXRhYmFzZXMvJXMvY29sbGVjdGlvbnMvdXNlcnMvaW5zdGFuY2VzP3F1ZXJ5PWFnZTozMCIsIHVuaXF1ZV9kYik7CiAgICAgICAgICAgICAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJHRVQgL2FwaS8uLi4vaW5zdGFuY2VzP3F1ZXJ5PWFnZTozMCAtIFF1ZXJ5IGJ5IGFnZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCBxdWVyeV91cmwsIE5VTEwsICJKb2huIERvZSIsIDAsICZkdXJhdGlvbikpIHsKICAgICAgICAgICAgICAgICAgICBwYXNzZWQrKzsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgICAgIHRvdGFsKys7CiAgICAgICAgICAgICAgICB0b3RhbF90aW1lICs9IGR1cmF0aW9uOwogICAgICAgICAgICAgICAgCiAgICAgICAgICAgICAgICAvLyBUZXN0IDY6IFVwZGF0ZSBpbnN0YW5jZQogICAgICAgICAgICAgICAgY2hhciB1cGRhdGVfdXJsWzI1Nl07CiAgICAgICAgICAgICAgICBzbnByaW50Zih1cGRhdGVfdXJsLCBzaXplb2YodXBkYXRlX3VybCksICIvYXBpL2RhdGFiYXNlcy8lcy9jb2xsZWN0aW9ucy91c2Vycy9pbnN0YW5jZXMvJXMiLCB1bmlxdWVfZGIsIGlkMSk7CiAgICAgICAgICAgICAgICBjb25zdCBjaGFyKiB1cGRhdGVfZGF0YSA9ICJ7XCJhZ2VcIjozNSxcImVtYWlsXCI6XCJqb2huLnVwZGF0ZWRAdGVzdC5jb21cIn0iOwogICAgICAgICAgICAgICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUFVUIC9hcGkvLi4uL2luc3RhbmNlcy97aWR9IC0gVXBkYXRlIHVzZXIiLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiUFVUIiwgdXBkYXRlX3VybCwgdXBkYXRlX2RhdGEsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIC8vIFRlc3QgNzogRGVsZXRlIGluc3RhbmNlCiAgICAgICAgICAgICAgICBjaGFyIGRlbGV0ZV91cmxbMjU2XTsKICAgICAgICAgICAgICAgIHNucHJpbnRmKGRlbGV0ZV91cmwsIHNpemVvZihkZWxldGVfdXJsKSwgIi9hcGkvZGF0YWJhc2VzLyVzL2NvbGxlY3Rpb25zL3VzZXJzL2luc3RhbmNlcy8lcyIsIHVuaXF1ZV9kYiwgaWQxKTsKICAgICAgICAgICAgICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkRFTEVURSAvYXBpLy4uLi9pbnN0YW5jZXMve2lkfSAtIERlbGV0ZSB1c2VyIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIkRFTEVURSIsIGRlbGV0ZV91cmwsIE5VTEwsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgICAgICAgICAgICAgIHBhc3NlZCsrOwogICAgICAgICAgICAgICAgfQogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShpbnNlcnRfcmVzcG9uc2UyKTsKICAgICAgICAgICAgfSBlbHNlIHsKICAgICAgICAgICAgICAgIHByaW50ZigiXG4lcyUtODBzIiBSRVNFVCwgQkxVRSwgIlBPU1QgL2FwaS9kYXRhYmFzZXMve2RifS9jb2xsZWN0aW9ucy97Y29sbH0vaW5zdGFuY2VzIC0gSW5zZXJ0IHNlY29uZCB1c2VyIik7CiAgICAgICAgICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl1cbiIpOwogICAgICAgICAgICAgICAgdG90YWwrKzsKICAgICAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBTZWNvbmQgdXNlciBpbnNlcnRpb24gZmFpbGVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgICAgICAKICAgICAgICAgICAgZnJlZShpZDEpOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUoaW5zZXJ0X3Jlc3BvbnNlKTsKICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VULCBCTFVFLCAiUE9TVCAvYXBpL2RhdGFiYXNlcy97ZGJ9L2NvbGxlY3Rpb25zL3tjb2xsfS9pbnN0YW5jZXMgLSBJbnNlcnQgZmlyc3QgdXNlciIpOwogICAgICAgIHByaW50ZigiWyIgUkVEICJGQUlMIiBSRVNFVCAiXVxuIik7CiAgICAgICAgdG90YWwrKzsKICAgICAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIEZpcnN0IHVzZXIgaW5zZXJ0aW9uIGZhaWxlZFxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfQogICAgdG90YWwrKzsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBJbnN0YW5jZSBBUEkgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvICh0b3RhbCA+IDAgPyB0b3RhbCA6IDEpKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl9odHRwX2NvbW1hbmRfdGVzdHMoKSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICJIVFRQIEFQSSBDT01NQU5EIFRFU1RTIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaW50IHBhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX3RpbWUgPSAwOwogICAgbG9uZyBsb25nIGR1cmF0aW9uOwogICAgCiAgICAvLyBUZXN0IDE6IEV4ZWN1dGUgY29tbWFuZAogICAgY29uc3QgY2hhciogY29tbWFuZCA9ICJ7XCJjb21tYW5kXCI6XCJsaXN0XCIsXCJhcmd1bWVudHNcIjpbXX0iOwogICAgaWYgKGh0dHBfdGVzdF9lbmRwb2ludCgiUE9TVCAvYXBpL2V4ZWN1dGUgLSBFeGVjdXRlIGxpc3QgY29tbWFuZCIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJQT1NUIiwgIi9hcGkvZXhlY3V0ZSIsIGNvbW1hbmQsICJcInN1Y2Nlc3NcIjp0cnVlIiwgMCwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgQ29tbWFuZCBBUEkgdGVzdHM6ICVkLyVkIHBhc3NlZCAoYXZnOiAlbGxkIG1zKVxuIiBSRVNFVCwgCiAgICAgICAgICAgcGFzc2VkLCB0b3RhbCwgdG90YWxfdGltZSAvIHRvdGFsKTsKICAgIAogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl9odHRwX2Vycm9yX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiSFRUUCBBUEkgRVJST1IgSEFORExJTkcgVEVTVFMiIFJFU0VUICJcbiIpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGludCB0b3RhbCA9IDA7CiAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IDA7CiAgICBsb25nIGxvbmcgZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMTogSW52YWxpZCBkYXRhYmFzZSBuYW1lCiAgICBpZiAoaHR0cF90ZXN0X2VuZHBvaW50KCJQT1NUIC9hcGkvZGF0YWJhc2VzIC0gSW52YWxpZCBkYXRhYmFzZSBuYW1lIiwgCiAgICAgICAgICAgICAgICAgICAgICAgICAgIlBPU1QiLCAiL2FwaS9kYXRhYmFzZXMiLCAie1wibmFtZVwiOlwiaW52YWxpZC9uYW1lXCJ9IiwgIlwic3VjY2Vzc1wiOmZhbHNlIiwgMSwgJmR1cmF0aW9uKSkgewogICAgICAgIHBhc3NlZCsrOwogICAgfQogICAgdG90YWwrKzsKICAgIHRvdGFsX3RpbWUgKz0gZHVyYXRpb247CiAgICAKICAgIC8vIFRlc3QgMjogTm9uLWV4aXN0ZW50IGRhdGFiYXNlIGNvbGxlY3Rpb25zIChzaG91bGQgcmV0dXJuIHByb3BlciBlcnJvcikKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy9ub25leGlzdGVudC9jb2xsZWN0aW9ucyAtIE5vbi1leGlzdGVudCBkYXRhYmFzZSIsIAogICAgICAgICAgICAgICAgICAgICAgICAgICJHRVQiLCAiL2FwaS9kYXRhYmFzZXMvbm9uZXhpc3RlbnQvY29sbGVjdGlvbnMiLCBOVUxMLCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCAzOiBOb24tZXhpc3RlbnQgY29sbGVjdGlvbiBpbnN0YW5jZXMKICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIkdFVCAvYXBpL2RhdGFiYXNlcy90ZXN0ZGIvY29sbGVjdGlvbnMvbm9uZXhpc3RlbnQvaW5zdGFuY2VzIC0gTm9uLWV4aXN0ZW50IGNvbGxlY3Rpb24iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiR0VUIiwgIi9hcGkvZGF0YWJhc2VzL3Rlc3RkYi9jb2xsZWN0aW9ucy9ub25leGlzdGVudC9pbnN0YW5jZXMiLCBOVUxMLCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCA0OiBJbnZhbGlkIEpTT04KICAgIGlmIChodHRwX3Rlc3RfZW5kcG9pbnQoIlBPU1QgL2FwaS9kYXRhYmFzZXMgLSBJbnZhbGlkIEpTT04iLCAKICAgICAgICAgICAgICAgICAgICAgICAgICAiUE9TVCIsICIvYXBpL2RhdGFiYXNlcyIsICJpbnZhbGlkIGpzb24iLCAiXCJzdWNjZXNzXCI6ZmFsc2UiLCAxLCAmZHVyYXRpb24pKSB7CiAgICAgICAgcGFzc2VkKys7CiAgICB9CiAgICB0b3RhbCsrOwogICAgdG90YWxfdGltZSArPSBkdXJhdGlvbjsKICAgIAogICAgLy8gVGVzdCA1OiBNZXRob2Qgbm90IGFsbG93ZWQKICAgIEh0dHBSZXNwb25zZSogcmVzcG9uc2UgPSBodHRwX3JlcXVlc3QoIlBBVENIIiwgIi9hcGkvZGF0YWJhc2VzL3Rlc3RkYiIsIE5VTEwsIE5VTEwpOwogICAgaWYgKHJlc3BvbnNlICYmIHJlc3BvbnNlLT5zdGF0dXNfY29kZSA9PSA0MDUpIHsKICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQQVRDSCAvYXBpL2RhdGFiYXNlcy90ZXN0ZGIgLSBNZXRob2Qgbm90IGFsbG93ZWQiKTsKICAgICAgICBwcmludGYoIlsiIEdSRUVOICJQQVNTIiBSRVNFVCAiXVxuIik7CiAgICAgICAgcGFzc2VkKys7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoR1JFRU4gIiAgW1ZFUkJPU0VdIE1ldGhvZCBub3QgYWxsb3dlZCBoYW5kbGVkIGNvcnJlY3RseVxuIiBSRVNFVCk7CiAgICAgICAgfQogICAgfSBlbHNlIHsKICAgICAgICBwcmludGYoIlxuJXMlLTgwcyIgUkVTRVQsIEJMVUUsICJQQVRDSCAvYXBpL2RhdGFiYXNlcy90ZXN0ZGIgLSBNZXRob2Qgbm90IGFsbG93ZWQiKTsKICAgICAgICBwcmludGYoIlsiIFJFRCAiRkFJTCIgUkVTRVQgIl1cbiIpOwogICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiICBbVkVSQk9TRV0gRXhwZWN0ZWQgNDA1IE1ldGhvZCBOb3QgQWxsb3dlZCwgZ290OiAlZFxuIiBSRVNFVCwgcmVzcG9uc2UgPyByZXNwb25zZS0+c3RhdHVzX2NvZGUgOiAwKTsKICAgICAgICB9CiAgICB9CiAgICB0b3RhbCsrOwogICAgaHR0cF9yZXNwb25zZV9mcmVlKHJlc3BvbnNlKTsKICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBFcnJvciBoYW5kbGluZyB0ZXN0czogJWQvJWQgcGFzc2VkIChhdmc6ICVsbGQgbXMpXG4iIFJFU0VULCAKICAgICAgICAgICBwYXNzZWQsIHRvdGFsLCB0b3RhbF90aW1lIC8gKHRvdGFsID4gMCA/IHRvdGFsIDogMSkpOwogICAgCiAgICByZXR1cm4gcGFzc2VkOwp9CgovLyA9PT09PT09PT09PT09PT09PT09PSBDTEkgVEVTVCBTVUlURVMgPT09PT09PT09PT09PT09PT09PT0KCnZvaWQgcnVuX3NlY3VyaXR5X3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiU0VDVVJJVFkgVEVTVFMgLSBQYXRoIHZhbGlkYXRpb24gYW5kIGluamVjdGlvbiBwcmV2ZW50aW9uIiBSRVNFVCAiXG4iKTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFN0YXJ0aW5nIHNlY3VyaXR5IHRlc3RzIHdpdGggdmVyYm9zZSBsb2dnaW5nXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgVGVzdENhc2Ugc2VjdXJpdHlfdGVzdHNbXSA9IHsKICAgICAgICB7CiAgICAgICAgICAgICJQcmV2ZW50IGRpcmVjdG9yeSB0cmF2ZXJzYWwgaW4gZGF0YWJhc2UgbmFtZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlICcuLi9ldmlsJyAyPiYxIHwgZ3JlcCAtaSAnaW52YWxpZFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJ0ZXN0ICEgLWQgJy90bXAvc3lkYl90ZXN0Ly4uL2V2aWwnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUHJldmVudCBkaXJlY3RvcnkgdHJhdmVyc2FsIGluIGNvbGxlY3Rpb24gbmFtZXMiLCAKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgJy4uLy4uL2V2aWwnIC0tc2NoZW1hIC0tbmFtZS1zdHJpbmcgMj4mMSB8IGdyZXAgLWkgJ2ludmFsaWRcXHxlcnJvcicgPiAvZGV2L251bGwiLAogICAgICAgICAgICAidGVzdCAhIC1kICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvLi4vLi4vZXZpbCciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJSZWplY3QgaW52YWxpZCBkYXRhYmFzZSBuYW1lcyB3aXRoIHNwZWNpYWwgY2hhcnMiLAogICAgICAgICAgICAiJXMgY3JlYXRlICdpbnZhbGlkL25hbWUnIDI+JjEgfCBncmVwIC1pICdpbnZhbGlkXFx8ZXJyb3InID4gL2Rldi9udWxsIiwKICAgICAgICAgICAgInRlc3QgISAtZCAnL3RtcC9zeWRiX3Rlc3QvaW52YWxpZC9uYW1lJyIsIAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgaW50IHNlY3VyaXR5X2NvdW50ID0gc2l6ZW9mKHNlY3VyaXR5X3Rlc3RzKSAvIHNpemVvZihzZWN1cml0eV90ZXN0c1swXSk7CiAgICBpbnQgc2VjdXJpdHlfcGFzc2VkID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBzZWN1cml0eV9jb3VudDsgaSsrKSB7CiAgICAgICAgLy8gUmVwbGFjZSAlcyB3aXRoIGNsaV9jb21tYW5kIGluIGJvdGggY29tbWFuZCBhbmQgdmVyaWZpY2F0aW9uX2NvbW1hbmQKICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgY2hhciBmaW5hbF92ZXJpZmljYXRpb25bMTAyNF07CiAgICAgICAgCiAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCBzZWN1cml0eV90ZXN0c1tpXS5jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgc25wcmludGYoZmluYWxfdmVyaWZpY2F0aW9uLCBzaXplb2YoZmluYWxfdmVyaWZpY2F0aW9uKSwgc2VjdXJpdHlfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAKICAgICAgICBzdHJjcHkoc2VjdXJpdHlfdGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgc3RyY3B5KHNlY3VyaXR5X3Rlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBmaW5hbF92ZXJpZmljYXRpb24pOwogICAgICAgIAogICAgICAgIGlmIChleGVjdXRlX3Rlc3Rfd2l0aF92ZXJpZmljYXRpb24oJnNlY3VyaXR5X3Rlc3RzW2ldKSkgewogICAgICAgICAgICBzZWN1cml0eV9wYXNzZWQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgU2VjdXJpdHkgdGVzdHM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgc2VjdXJpdHlfcGFzc2VkLCBzZWN1cml0eV9jb3VudCk7Cn0KCnZvaWQgcnVuX2RhdGFfaW50ZWdyaXR5X3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiREFUQSBJTlRFR1JJVFkgVEVTVFMgLSBDUkMgdmFsaWRhdGlvbiBhbmQgZmlsZSBzdHJ1Y3R1cmUiIFJFU0VUICJcbiIpOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU3RhcnRpbmcgZGF0YSBpbnRlZ3JpdHkgdGVzdHNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICAvLyBDcmVhdGUgdGVzdCBkYXRhYmFzZSBhbmQgY29sbGVjdGlvbiBmaXJzdAogICAgY2hhciBjcmVhdGVfZGJfY21kWzI1Nl07CiAgICBjaGFyIGNyZWF0ZV9jb2xsZWN0aW9uX2NtZFsyNTZdOwogICAgY2hhciBpbnNlcnRfY21kWzI1Nl07CiAgICAKICAgIHNucHJpbnRmKGNyZWF0ZV9kYl9jbWQsIHNpemVvZihjcmVhdGVfZGJfY21kKSwgIiVzIGNyZWF0ZSBpbnRlZ3JpdHlkYiA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgc25wcmludGYoY3JlYXRlX2NvbGxlY3Rpb25fY21kLCBzaXplb2YoY3JlYXRlX2NvbGxlY3Rpb25fY21kKSwgIiVzIGNyZWF0ZSBpbnRlZ3JpdHlkYiBkYXRhIC0tc2NoZW1hIC0tdmFsdWUtc3RyaW5nLXJlcSA+IC9kZXYvbnVsbCAyPiYxIiwgY2xpX2NvbW1hbmQpOwogICAgc25wcmludGYoaW5zZXJ0X2NtZCwgc2l6ZW9mKGluc2VydF9jbWQpLCAiJXMgY3JlYXRlIGludGVncml0eWRiIGRhdGEgLS1pbnNlcnQtb25lIC0tdmFsdWUtXCJ0ZXN0X2RhdGFfMVwiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICAKICAgIHN5c3RlbShjcmVhdGVfZGJfY21kKTsKICAgIHN5c3RlbShjcmVhdGVfY29sbGVjdGlvbl9jbWQpOwogICAgc3lzdGVtKGluc2VydF9jbWQpOwogICAgCiAgICBUZXN0Q2FzZSBpbnRlZ3JpdHlfdGVzdHNbXSA9IHsKICAgICAgICB7CiAgICAgICAgICAgICJEYXRhIGZpbGUgaGFzIHZhbGlkIGhlYWRlciBzdHJ1Y3R1cmUiLAogICAgICAgICAgICAiZWNobyAnSGVhZGVyIGNoZWNrJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJoZXhkdW1wIC1DIC90bXAvc3lkYl90ZXN0L2ludGVncml0eWRiL2RhdGEvZGF0YS5zeWRiIHwgaGVhZCAtMiB8IGdyZXAgLXEgJ1NZREInIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiRGF0YSBmaWxlIGdyb3dzIHdpdGggaW5zZXJ0cyIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgaW50ZWdyaXR5ZGIgZGF0YSAtLWluc2VydC1vbmUgLS12YWx1ZS1cInRlc3RfZGF0YV8yXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJscyAtbCAvdG1wL3N5ZGJfdGVzdC9pbnRlZ3JpdHlkYi9kYXRhL2RhdGEuc3lkYiB8IGF3ayAne3ByaW50ICQ1fSciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgaW50IGludGVncml0eV9jb3VudCA9IHNpemVvZihpbnRlZ3JpdHlfdGVzdHMpIC8gc2l6ZW9mKGludGVncml0eV90ZXN0c1swXSk7CiAgICBpbnQgaW50ZWdyaXR5X3Bhc3NlZCA9IDA7CiAgICAKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgaW50ZWdyaXR5X2NvdW50OyBpKyspIHsKICAgICAgICAvLyBSZXBsYWNlICVzIHdpdGggY2xpX2NvbW1hbmQKICAgICAgICBpZiAoc3Ryc3RyKGludGVncml0eV90ZXN0c1tpXS5jb21tYW5kLCAiJXMiKSAhPSBOVUxMKSB7CiAgICAgICAgICAgIGNoYXIgZmluYWxfY29tbWFuZFsxMDI0XTsKICAgICAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCBpbnRlZ3JpdHlfdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgICAgICBzdHJjcHkoaW50ZWdyaXR5X3Rlc3RzW2ldLmNvbW1hbmQsIGZpbmFsX2NvbW1hbmQpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZpbnRlZ3JpdHlfdGVzdHNbaV0pKSB7CiAgICAgICAgICAgIGludGVncml0eV9wYXNzZWQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgRGF0YSBpbnRlZ3JpdHkgdGVzdHM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgaW50ZWdyaXR5X3Bhc3NlZCwgaW50ZWdyaXR5X2NvdW50KTsKfQoKdm9pZCBydW5fcGVyZm9ybWFuY2VfdGVzdCgpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIlBFUkZPUk1BTkNFIEFORCBTQ0FMQUJJTElUWSBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBwZXJmb3JtYW5jZSB0ZXN0c1xuIiBSRVNFVCk7CiAgICB9CiAgICAKICAgIC8vIFNldHVwIHBlcmZvcm1hbmNlIGRhdGFiYXNlCiAgICBwcmludGYoIlNldHRpbmcgdXAgcGVyZm9ybWFuY2UgZGF0YWJhc2UuLi5cbiIpOwogICAgY2hhciBjcmVhdGVfZGJfY21kWzI1Nl07CiAgICBjaGFyIGNyZWF0ZV9jb2xsZWN0aW9uX2NtZFsyNTZdOwogICAgCiAgICBzbnByaW50ZihjcmVhdGVfZGJfY21kLCBzaXplb2YoY3JlYXRlX2RiX2NtZCksICIlcyBjcmVhdGUgcGVyZmRiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICBzbnByaW50ZihjcmVhdGVfY29sbGVjdGlvbl9jbWQsIHNpemVvZihjcmVhdGVfY29sbGVjdGlvbl9jbWQpLCAiJXMgY3JlYXRlIHBlcmZkYiB1c2VycyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nLXJlcSAtLWFnZS1pbnQgLS1lbWFpbC1zdHJpbmcgPiAvZGV2L251bGwgMj4mMSIsIGNsaV9jb21tYW5kKTsKICAgIAogICAgc3lzdGVtKGNyZWF0ZV9kYl9jbWQpOwogICAgc3lzdGVtKGNyZWF0ZV9jb2xsZWN0aW9uX2NtZCk7CiAgICAKICAgIC8vIFRlc3QgMTogU2luZ2xlIGluc2VydCBwZXJmb3JtYW5jZQogICAgY2hhciBzaW5nbGVfaW5zZXJ0X2NtZFsyNTZdOwogICAgc25wcmludGYoc2luZ2xlX2luc2VydF9jbWQsIHNpemVvZihzaW5nbGVfaW5zZXJ0X2NtZCksICIlcyBjcmVhdGUgcGVyZmRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJTaW5nbGVVc2VyXCIgLS1hZ2UtMzAgLS1lbWFpbC1cInNpbmdsZUB0ZXN0LmNvbVwiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICAKICAgIGxvbmcgbG9uZyBzdGFydF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpOwogICAgc3lzdGVtKHNpbmdsZV9pbnNlcnRfY21kKTsKICAgIGxvbmcgbG9uZyBzaW5nbGVfaW5zZXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCkgLSBzdGFydF90aW1lOwogICAgCiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gU2luZ2xlIGluc2VydCB0aW1lOiAlbGxkIG1zXG4iIFJFU0VULCBzaW5nbGVfaW5zZXJ0X3RpbWUpOwogICAgfQogICAgCiAgICAvLyBUZXN0IDI6IEJhdGNoIGluc2VydCBwZXJmb3JtYW5jZQogICAgaW50IGJhdGNoX3NpemUgPSA1MDsKICAgIHByaW50ZigiSW5zZXJ0aW5nICVkIHJlY29yZHMgZm9yIGJhdGNoIHBlcmZvcm1hbmNlLi4uXG4iLCBiYXRjaF9zaXplKTsKICAgIAogICAgc3RhcnRfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKTsKICAgIGludCBzdWNjZXNzX2NvdW50ID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXRjaF9zaXplOyBpKyspIHsKICAgICAgICBjaGFyIGNvbW1hbmRbNTEyXTsKICAgICAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksCiAgICAgICAgICAgICAgICAgIiVzIGNyZWF0ZSBwZXJmZGIgdXNlcnMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIlVzZXIlZFwiIC0tYWdlLSVkIC0tZW1haWwtXCJ1c2VyJWRAdGVzdC5jb21cIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgICAgICBjbGlfY29tbWFuZCwgaSwgMjAgKyAoaSAlIDQwKSwgaSk7CiAgICAgICAgCiAgICAgICAgaWYgKHN5c3RlbShjb21tYW5kKSA9PSAwKSB7CiAgICAgICAgICAgIHN1Y2Nlc3NfY291bnQrKzsKICAgICAgICB9CiAgICB9CiAgICAKICAgIGxvbmcgbG9uZyBiYXRjaF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgIGRvdWJsZSBhdmdfYmF0Y2hfdGltZSA9IChkb3VibGUpYmF0Y2hfdGltZSAvIGJhdGNoX3NpemU7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBCYXRjaCBpbnNlcnQ6ICVkLyVkIHN1Y2Nlc3NmdWwsIHRvdGFsIHRpbWU6ICVsbGQgbXMsIGF2ZzogJS4yZiBtc1xuIiBSRVNFVCwgCiAgICAgICAgICAgICAgIHN1Y2Nlc3NfY291bnQsIGJhdGNoX3NpemUsIGJhdGNoX3RpbWUsIGF2Z19iYXRjaF90aW1lKTsKICAgIH0KICAgIAogICAgLy8gVGVzdCAzOiBRdWVyeSBwZXJmb3JtYW5jZQogICAgcHJpbnRmKCJUZXN0aW5nIHF1ZXJ5IHBlcmZvcm1hbmNlLi4uXG4iKTsKICAgIGNoYXIgcXVlcnlfY21kWzI1Nl07CiAgICBzbnByaW50ZihxdWVyeV9jbWQsIHNpemVvZihxdWVyeV9jbWQpLCAiJXMgZmluZCBwZXJmZGIgdXNlcnMgLS13aGVyZSBcImFnZToyNVwiID4gL2Rldi9udWxsIDI+JjEiLCBjbGlfY29tbWFuZCk7CiAgICAKICAgIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICBzeXN0ZW0ocXVlcnlfY21kKTsKICAgIGxvbmcgbG9uZyBxdWVyeV90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgIAogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZihZRUxMT1cgIiAgW1ZFUkJPU0VdIFF1ZXJ5IHRpbWU6ICVsbGQgbXNcbiIgUkVTRVQsIHF1ZXJ5X3RpbWUpOwogICAgfQogICAgCiAgICAvLyBUZXN0IDQ6IENvdW50IHZlcmlmaWNhdGlvbgogICAgaW50IGFjdHVhbF9jb3VudCA9IGNvdW50X2luc3RhbmNlc19pbl9jb2xsZWN0aW9uKCJwZXJmZGIiLCAidXNlcnMiKTsKICAgIAogICAgcHJpbnRmKCJcblBlcmZvcm1hbmNlIFJlc3VsdHM6XG4iKTsKICAgIHByaW50ZigiICBTaW5nbGUgaW5zZXJ0OiAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICJcbiIsIHNpbmdsZV9pbnNlcnRfdGltZSk7CiAgICBwcmludGYoIiAgQmF0Y2ggaW5zZXJ0ICglZCByZWNvcmRzKTogIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiIChhdmc6ICIgQ1lBTiAiJS4yZiBtcyIgUkVTRVQgIilcbiIsIAogICAgICAgICAgIGJhdGNoX3NpemUsIGJhdGNoX3RpbWUsIGF2Z19iYXRjaF90aW1lKTsKICAgIHByaW50ZigiICBRdWVyeSB0aW1lOiAiIENZQU4gIiVsbGQgbXMiIFJFU0VUICJcbiIsIHF1ZXJ5X3RpbWUpOwogICAgcHJpbnRmKCIgIEluc2VydCBzdWNjZXNzIHJhdGU6ICIgR1JFRU4gIiVkLyVkIiBSRVNFVCAiXG4iLCBzdWNjZXNzX2NvdW50LCBiYXRjaF9zaXplKTsKICAgIHByaW50ZigiICBSZWNvcmQgY291bnQgdmVyaWZpY2F0aW9uOiAiIEdSRUVOICIlZCIgUkVTRVQgIiByZWNvcmRzIGluIGNvbGxlY3Rpb25cbiIsIGFjdHVhbF9jb3VudCk7CiAgICAKICAgIC8vIFBlcmZvcm1hbmNlIHRocmVzaG9sZHMgKGFkanVzdCBiYXNlZCBvbiB5b3VyIHJlcXVpcmVtZW50cykKICAgIGludCBwZXJmb3JtYW5jZV9vayA9IChzaW5nbGVfaW5zZXJ0X3RpbWUgPCAxMDAwKSAmJiAoYXZnX2JhdGNoX3RpbWUgPCA1MDApICYmIChxdWVyeV90aW1lIDwgNTAwKTsKICAgIGlmIChwZXJmb3JtYW5jZV9vaykgewogICAgICAgIHByaW50ZihHUkVFTiAiICDinJMgUGVyZm9ybWFuY2Ugd2l0aGluIGFjY2VwdGFibGUgbGltaXRzXG4iIFJFU0VUKTsKICAgIH0gZWxzZSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICDimqAgUGVyZm9ybWFuY2UgbWF5IG5lZWQgb3B0aW1pemF0aW9uXG4iIFJFU0VUKTsKICAgIH0KfQoKdm9pZCBydW5fZWRnZV9jYXNlX3Rlc3RzKCkgewogICAgcHJpbnRmKCJcbiIgTUFHRU5UQSAiRURHRSBDQVNFIEFORCBFUlJPUiBIQU5ETElORyBURVNUUyIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBlZGdlIGNhc2UgdGVzdHNcbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBUZXN0Q2FzZSBlZGdlX3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIGR1cGxpY2F0ZSBkYXRhYmFzZSBjcmVhdGlvbiIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICIlcyBsaXN0IHwgZ3JlcCAtYyB0ZXN0ZGIiLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgZHVwbGljYXRlIGNvbGxlY3Rpb24gY3JlYXRpb24iLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsIAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgfCBncmVwIC1jIHVzZXJzIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSGFuZGxlIG1pc3NpbmcgZGF0YWJhc2UgcXVlcmllcyIsCiAgICAgICAgICAgICIlcyBmaW5kIG5vbmV4aXN0ZW50ZGIgdXNlcnMgLS13aGVyZSBcIm5hbWU6dGVzdFwiIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdFcnJvciBoYW5kbGVkJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBtaXNzaW5nIGNvbGxlY3Rpb24gcXVlcmllcyIsIAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgbm9uZXhpc3RlbnQgLS13aGVyZSBcIm5hbWU6dGVzdFwiIDI+JjEgfCBncmVwIC1pICdleGlzdFxcfGVycm9yJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdFcnJvciBoYW5kbGVkJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkhhbmRsZSBtYWxmb3JtZWQgcXVlcmllcyIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiaW52YWxpZC1xdWVyeS1mb3JtYXRcIiAyPiYxIHwgZ3JlcCAtaSAnZXJyb3JcXHxpbnZhbGlkJyA+IC9kZXYvbnVsbCIsCiAgICAgICAgICAgICJlY2hvICdFcnJvciBoYW5kbGVkJyIsIAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJIYW5kbGUgc2NoZW1hIHZhbGlkYXRpb24gZmFpbHVyZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLWluc2VydC1vbmUgLS1pbnZhbGlkLWZpZWxkLVwidmFsdWVcIiAyPiYxIHwgZ3JlcCAtaSAnZXJyb3JcXHx2YWxpZCcgPiAvZGV2L251bGwiLAogICAgICAgICAgICAiZWNobyAnVmFsaWRhdGlvbiB3b3JrZWQnIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIGludCBlZGdlX2NvdW50ID0gc2l6ZW9mKGVkZ2VfdGVzdHMpIC8gc2l6ZW9mKGVkZ2VfdGVzdHNbMF0pOwogICAgaW50IGVkZ2VfcGFzc2VkID0gMDsKICAgIAogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBlZGdlX2NvdW50OyBpKyspIHsKICAgICAgICAvLyBSZXBsYWNlICVzIHdpdGggY2xpX2NvbW1hbmQgaW4gYm90aCBjb21tYW5kIGFuZCB2ZXJpZmljYXRpb25fY29tbWFuZAogICAgICAgIGNoYXIgZmluYWxfY29tbWFuZFsxMDI0XTsKICAgICAgICBjaGFyIGZpbmFsX3ZlcmlmaWNhdGlvblsxMDI0XTsKICAgICAgICAKICAgICAgICBzbnByaW50ZihmaW5hbF9jb21tYW5kLCBzaXplb2YoZmluYWxfY29tbWFuZCksIGVkZ2VfdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIHNucHJpbnRmKGZpbmFsX3ZlcmlmaWNhdGlvbiwgc2l6ZW9mKGZpbmFsX3ZlcmlmaWNhdGlvbiksIGVkZ2VfdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAKICAgICAgICBzdHJjcHkoZWRnZV90ZXN0c1tpXS5jb21tYW5kLCBmaW5hbF9jb21tYW5kKTsKICAgICAgICBzdHJjcHkoZWRnZV90ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgZmluYWxfdmVyaWZpY2F0aW9uKTsKICAgICAgICAKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZlZGdlX3Rlc3RzW2ldKSkgewogICAgICAgICAgICBlZGdlX3Bhc3NlZCsrOwogICAgICAgIH0KICAgIH0KICAgIAogICAgcHJpbnRmKFlFTExPVyAiICBFZGdlIGNhc2UgdGVzdHM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgZWRnZV9wYXNzZWQsIGVkZ2VfY291bnQpOwp9Cgp2b2lkIHJ1bl9jb21wcmVoZW5zaXZlX3ZlcmlmaWNhdGlvbigpIHsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIkNPTVBSRUhFTlNJVkUgU1RSVUNUVVJFIFZFUklGSUNBVElPTiIgUkVTRVQgIlxuIik7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICBwcmludGYoWUVMTE9XICIgIFtWRVJCT1NFXSBTdGFydGluZyBjb21wcmVoZW5zaXZlIHN0cnVjdHVyZSB2ZXJpZmljYXRpb25cbiIgUkVTRVQpOwogICAgfQogICAgCiAgICBpbnQgdmVyaWZpY2F0aW9uX3Bhc3NlZCA9IDA7CiAgICBpbnQgdmVyaWZpY2F0aW9uX3RvdGFsID0gMDsKICAgIAogICAgLy8gVmVyaWZ5IHRlc3RkYiBzdHJ1Y3R1cmUKICAgIHByaW50ZigiVmVyaWZ5aW5nIHRlc3RkYiBzdHJ1Y3R1cmUuLi5cbiIpOwogICAgaWYgKHZlcmlmeV9kYXRhYmFzZV9zdHJ1Y3R1cmUoInRlc3RkYiIpKSB2ZXJpZmljYXRpb25fcGFzc2VkKys7CiAgICB2ZXJpZmljYXRpb25fdG90YWwrKzsKICAgIAogICAgaWYgKHZlcmlmeV9jb2xsZWN0aW9uX3N0cnVjdHVyZSgidGVzdGRiIiwgInVzZXJzIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICBpZiAodmVyaWZ5X2NvbGxlY3Rpb25fc3RydWN0dXJlKCJ0ZXN0ZGIiLCAicHJvZHVjdHMiKSkgdmVyaWZpY2F0aW9uX3Bhc3NlZCsrOwogICAgdmVyaWZpY2F0aW9uX3RvdGFsKys7CiAgICAKICAgIGlmICh2ZXJpZnlfc2NoZW1hX2NvbnRlbnQoInRlc3RkYiIsICJ1c2VycyIsICJuYW1lIikpIHZlcmlmaWNhdGlvbl9wYXNzZWQrKzsKICAgIHZlcmlmaWNhdGlvbl90b3RhbCsrOwogICAgCiAgICAvLyBWZXJpZnkgdGVzdGRiMiBzdHJ1Y3R1cmUgIAogICAgcHJpbnRmKCJWZXJpZnlpbmcgdGVzdGRiMiBzdHJ1Y3R1cmUuLi5cbiIpOwogICAgaWYgKHZlcmlmeV9kYXRhYmFzZV9zdHJ1Y3R1cmUoInRlc3RkYjIiKSkgdmVyaWZpY2F0aW9uX3Bhc3NlZCsrOwogICAgdmVyaWZpY2F0aW9uX3RvdGFsKys7CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgU3RydWN0dXJlIHZlcmlmaWNhdGlvbjogJWQvJWQgcGFzc2VkXG4iIFJFU0VULCB2ZXJpZmljYXRpb25fcGFzc2VkLCB2ZXJpZmljYXRpb25fdG90YWwpOwp9CgovLyA9PT09PT09PT09PT09PT09PT09PSBTVE9SQUdFIEZFQVRVUkUgVEVTVCBTVUlURVMgPT09PT09PT09PT09PT09PT09PT0KCi8vIENvbW1hbmRzIHJ1biB0aHJvdWdoIHNoIHdpdGggIiVzIiBhcyB0aGUgQ0xJOyBhIGNvbW1hbmQgdGhhdCBuZWVkcyB0aGUgQ0xJIHNldmVyYWwgdGltZXMKLy8gYXNzaWducyBpdCB0byBTIGZpcnN0LiBWZXJpZmljYXRpb25zIHByaW50ICJbbl0iIHNvIGV4cGVjdGVkIGNvdW50cyBtYXRjaCBleGFjdGx5CmludCBydW5fZmVhdHVyZV90ZXN0X2Nhc2VzKGNvbnN0IGNoYXIgKnRpdGxlLCBUZXN0Q2FzZSAqdGVzdHMsIGludCB0ZXN0X2NvdW50KSB7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICIlcyIgUkVTRVQgIlxuIiwgdGl0bGUpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgdGVzdF9jb3VudDsgaSsrKSB7CiAgICAgICAgY2hhciBmaW5hbF9jb21tYW5kWzEwMjRdOwogICAgICAgIGNoYXIgZmluYWxfdmVyaWZpY2F0aW9uWzEwMjRdOwogICAgICAgIAogICAgICAgIHNucHJpbnRmKGZpbmFsX2NvbW1hbmQsIHNpemVvZihmaW5hbF9jb21tYW5kKSwgdGVzdHNbaV0uY29tbWFuZCwgY2xpX2NvbW1hbmQpOwogICAgICAgIHNucHJpbnRmKGZpbmFsX3ZlcmlmaWNhdGlvbiwgc2l6ZW9mKGZpbmFsX3ZlcmlmaWNhdGlvbiksIHRlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgCiAgICAgICAgc3RyY3B5KHRlc3RzW2ldLmNvbW1hbmQsIGZpbmFsX2NvbW1hbmQpOwogICAgICAgIHN0cmNweSh0ZXN0c1tpXS52ZXJpZmljYXRpb25fY29tbWFuZCwgZmluYWxfdmVyaWZpY2F0aW9uKTsKICAgICAgICAKICAgICAgICBpZiAoZXhlY3V0ZV90ZXN0X3dpdGhfdmVyaWZpY2F0aW9uKCZ0ZXN0c1tpXSkpIHsKICAgICAgICAgICAgcGFzc2VkKys7CiAgICAgICAgfQogICAgfQogICAgCiAgICBwcmludGYoWUVMTE9XICIgICVzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIHRpdGxlLCBwYXNzZWQsIHRlc3RfY291bnQpOwogICAgZmVhdHVyZV9wYXNzZWQgKz0gcGFzc2VkOwogICAgZmVhdHVyZV90b3RhbCArPSB0ZXN0X2NvdW50OwogICAgcmV0dXJuIHBhc3NlZDsKfQoKaW50IHJ1bl90aWVyaW5nX3Rlc3RzKCkgewogICAgVGVzdENhc2UgdGllcmluZ190ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIkNyZWF0ZSAnZXZlbnRzJyBjb2xsZWN0aW9uIHdpdGggc2l4IHJlY29yZHMiLAogICAgICAgICAgICAiUz0lczsgJFMgY3JlYXRlIHRlc3RkYiBldmVudHMgLS1zY2hlbWEgLS1raW5kLXN0cmluZyAtLW4taW50ID4gL2Rldi9udWxsIDI+JjEgJiYgIgogICAgICAgICAgICAiZm9yIGkgaW4gMSAyIDMgNCA1IDY7IGRvICRTIGNyZWF0ZSB0ZXN0ZGIgZXZlbnRzIC0taW5zZXJ0LW9uZSAtLWtpbmQtXCJrJCgoaSAlIDIpKVwiIC0tbi0kaSA+IC9kZXYvbnVsbCAyPiYxIHx8IGV4aXQgMTsgZG9uZSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiBldmVudHMgfCBncmVwIC1jICdcIl9pZFwiJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbNl0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkFyY2hpdmUgZXZlcnkgcmVjb3JkIHdpdGggYSB0aWVyaW5nIHBhc3MiLAogICAgICAgICAgICAiUz0lczsgJFMgdGllcmluZyB0ZXN0ZGIgZXZlbnRzIDMwID4gL2Rldi9udWxsIDI+JjEgJiYgJFMgdGllcmluZyB0ZXN0ZGIgZXZlbnRzIC0tcnVuICQoKCAkKGRhdGUgKyUlcykgKyA2MCApKSA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIHRpZXJpbmcgdGVzdGRiIGV2ZW50cyB8IGdyZXAgLW8gJ1wiYXJjaGl2ZWRfcmVjb3Jkc1wiOlswLTldKiciLAogICAgICAgICAgICAiXCJhcmNoaXZlZF9yZWNvcmRzXCI6NiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSW5zZXJ0IHRocmVlIGhvdCByZWNvcmRzIGFmdGVyIHRoZSBwYXNzIiwKICAgICAgICAgICAgIlM9JXM7IGZvciBpIGluIDcgOCA5OyBkbyAkUyBjcmVhdGUgdGVzdGRiIGV2ZW50cyAtLWluc2VydC1vbmUgLS1raW5kLVwiayQoKGkgJSAyKSlcIiAtLW4tJGkgPiAvZGV2L251bGwgMj4mMSB8fCBleGl0IDE7IGRvbmUiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgZXZlbnRzIHwgZ3JlcCAtYyAnXCJfaWRcIicgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiWzldIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJSYW5nZSBxdWVyeSBzcGFucyBhcmNoaXZlZCBhbmQgaG90IHJlY29yZHMiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgZXZlbnRzIC0td2hlcmUgXCJuPj00XCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBldmVudHMgLS13aGVyZSBcIm4+PTRcIiB8IGdyZXAgLWMgJ1wiX2lkXCInIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgIls2XSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiQm91bmRlZCByYW5nZSBxdWVyeSBzcGFucyBhcmNoaXZlZCBhbmQgaG90IHJlY29yZHMiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgZXZlbnRzIC0td2hlcmUgXCJuPjMsbjw9N1wiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgZXZlbnRzIC0td2hlcmUgXCJuPjMsbjw9N1wiIHwgZ3JlcCAtbyAnXCJuXCI6WzAtOV0qJyB8IHNvcnQgfCB0ciAtZCAnXFxuJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbXCJuXCI6NFwiblwiOjVcIm5cIjo2XCJuXCI6N10iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlVwZGF0ZSBhbiBhcmNoaXZlZCByZWNvcmQiLAogICAgICAgICAgICAiJXMgdXBkYXRlIHRlc3RkYiBldmVudHMgLS13aGVyZSBcIm46MlwiIC0tc2V0IC0ta2luZC1cIm1vdmVkXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJTPSVzOyBlY2hvIFwiWyQoJFMgZmluZCB0ZXN0ZGIgZXZlbnRzIC0td2hlcmUgJ2tpbmQ6bW92ZWQnIHwgZ3JlcCAtYyAnXCJuXCI6MicpLyQoJFMgZmluZCB0ZXN0ZGIgZXZlbnRzIC0td2hlcmUgJ246MicgfCBncmVwIC1jICdcIl9pZFwiJyldXCIiLAogICAgICAgICAgICAiWzEvMV0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkRlbGV0ZSBhbiBhcmNoaXZlZCByZWNvcmQiLAogICAgICAgICAgICAiJXMgZGVsZXRlIHRlc3RkYiBldmVudHMgLS13aGVyZSBcIm46MVwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiUz0lczsgZWNobyBcIlskKCRTIGZpbmQgdGVzdGRiIGV2ZW50cyAtLXdoZXJlICduOjEnIHwgZ3JlcCAtYyAnXCJfaWRcIicpLyQoJFMgbGlzdCB0ZXN0ZGIgZXZlbnRzIHwgZ3JlcCAtYyAnXCJfaWRcIicpXVwiIiwKICAgICAgICAgICAgIlswLzhdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJBcmNoaXZlZCBlcXVhbGl0eSBxdWVyeSBhZnRlciB1cGRhdGUgYW5kIGRlbGV0ZSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBldmVudHMgLS13aGVyZSBcImtpbmQ6azFcIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIGV2ZW50cyAtLXdoZXJlIFwia2luZDprMVwiIHwgZ3JlcCAtbyAnXCJuXCI6WzAtOV0qJyB8IHNvcnQgfCB0ciAtZCAnXFxuJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbXCJuXCI6M1wiblwiOjVcIm5cIjo3XCJuXCI6OV0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9CiAgICB9OwogICAgCiAgICByZXR1cm4gcnVuX2ZlYXR1cmVfdGVzdF9jYXNlcygiVElFUkVEIFNUT1JBR0UgVEVTVFMiLCB0aWVyaW5nX3Rlc3RzLCBzaXplb2YodGllcmluZ190ZXN0cykgLyBzaXplb2YodGllcmluZ190ZXN0c1swXSkpOwp9CgovLyBzeWRiIHN0YXRzIG9uIGEgY29sbGVjdGlvbiB3aXRoIGEga25vd24gaGlzdG9yeTogZm91ciBpbnNlcnRzIGFuZCBhIGRlbGV0ZSwgdGhlbiBhCi8vIGNvcnJ1cHRlZCByZWNvcmQgYW5kIGEgdG9ybiB0YWlsIHdyaXR0ZW4gc3RyYWlnaHQgaW50byBkYXRhLnN5ZGIKaW50IHJ1bl9zdG9yYWdlX3N0YXRpc3RpY3NfdGVzdHMoKSB7CiAgICBUZXN0Q2FzZSBzdGF0aXN0aWNzX3Rlc3RzW10gPSB7CiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlICd0YWxseScgY29sbGVjdGlvbiB3aXRoIGZvdXIgcmVjb3JkcyBhbmQgZGVsZXRlIG9uZSIsCiAgICAgICAgICAgICJTPSVzOyAkUyBjcmVhdGUgdGVzdGRiIHRhbGx5IC0tc2NoZW1hIC0tbi1pbnQgPiAvZGV2L251bGwgMj4mMSAmJiAiCiAgICAgICAgICAgICJmb3IgaSBpbiAxIDIgMyA0OyBkbyAkUyBjcmVhdGUgdGVzdGRiIHRhbGx5IC0taW5zZXJ0LW9uZSAtLW4tJGkgPiAvZGV2L251bGwgMj4mMSB8fCBleGl0IDE7IGRvbmUgJiYgIgogICAgICAgICAgICAiJFMgZGVsZXRlIHRlc3RkYiB0YWxseSAtLXdoZXJlIFwibjoyXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBzdGF0cyB0ZXN0ZGIgdGFsbHkgfCBncmVwIC1vICdcIlxcKGxpdmVfcmVjb3Jkc1xcfGRlYWRfcmVjb3Jkc1xcfHJlY29yZF9jb3VudF9tYXRjaGVzXFwpXCI6W2EtejAtOV0qJyB8IHRyICdcXG4nICcgJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbXCJsaXZlX3JlY29yZHNcIjozIFwiZGVhZF9yZWNvcmRzXCI6MCBcInJlY29yZF9jb3VudF9tYXRjaGVzXCI6dHJ1ZSBdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJDb3VudCBhIHJlY29yZCB3aXRoIGEgYmFkIGNoZWNrc3VtIGFzIGRlYWQiLAogICAgICAgICAgICAiRj0vdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvdGFsbHkvZGF0YS5zeWRiOyBwcmludGYgWiB8IGRkIG9mPSRGIGJzPTEgc2Vlaz0kKCggJChzdGF0IC1jICUlcyAkRikgLSAyMCApKSBjb252PW5vdHJ1bmMgMj4vZGV2L251bGwiLAogICAgICAgICAgICAiJXMgc3RhdHMgdGVzdGRiIHRhbGx5IHwgZ3JlcCAtbyAnXCJcXChsaXZlX3JlY29yZHNcXHxkZWFkX3JlY29yZHNcXHxjb3JydXB0X3JlY29yZHNcXHxyZWNvcmRfY291bnRfbWF0Y2hlc1xcKVwiOlthLXowLTldKicgfCB0ciAnXFxuJyAnICcgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiW1wibGl2ZV9yZWNvcmRzXCI6MiBcImRlYWRfcmVjb3Jkc1wiOjEgXCJjb3JydXB0X3JlY29yZHNcIjoxIFwicmVjb3JkX2NvdW50X21hdGNoZXNcIjp0cnVlIF0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkZsYWcgYSB0cnVuY2F0ZWQgZGF0YSBmaWxlIGluIHRoZSBoZWFkZXIgY2hlY2tzIiwKICAgICAgICAgICAgInRydW5jYXRlIC1zIC00MCAvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvdGFsbHkvZGF0YS5zeWRiIiwKICAgICAgICAgICAgIiVzIHN0YXRzIHRlc3RkYiB0YWxseSB8IGdyZXAgLW8gJ1wiXFwobGl2ZV9yZWNvcmRzXFx8Y29ycnVwdF9yZWNvcmRzXFx8cmVjb3JkX2NvdW50X21hdGNoZXNcXHxmcmVlX29mZnNldF93aXRoaW5fZmlsZVxcKVwiOlthLXowLTldKicgfCB0ciAnXFxuJyAnICcgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiW1wibGl2ZV9yZWNvcmRzXCI6MiBcImNvcnJ1cHRfcmVjb3Jkc1wiOjAgXCJyZWNvcmRfY291bnRfbWF0Y2hlc1wiOmZhbHNlIFwiZnJlZV9vZmZzZXRfd2l0aGluX2ZpbGVcIjpmYWxzZSBdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJDb3VudCBldmVyeSBieXRlIG9mIHRoZSB0b3JuIHJlY29yZCBhcyB1bnBhcnNlYWJsZSIsCiAgICAgICAgICAgICIlcyBzdGF0cyB0ZXN0ZGIgdGFsbHkgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJTPSVzOyBKPSQoJFMgc3RhdHMgdGVzdGRiIHRhbGx5KTsgdigpIHsgZWNobyBcIiRKXCIgfCBncmVwIC1vIFwiXFxcIiQxXFxcIjpbMC05XSpcIiB8IGN1dCAtZDogLWYyOyB9OyAiCiAgICAgICAgICAgICJlY2hvIFwiWyQoKCAkKHYgZmlsZV9ieXRlcykgLSAkKHYgbGl2ZV9ieXRlcykgLSAkKHYgdW5wYXJzZWFibGVfYnl0ZXMpICkpXVwiIiwKICAgICAgICAgICAgIlsxMzZdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgcmV0dXJuIHJ1bl9mZWF0dXJlX3Rlc3RfY2FzZXMoIlNUT1JBR0UgU1RBVElTVElDUyBURVNUUyIsIHN0YXRpc3RpY3NfdGVzdHMsIHNpemVvZihzdGF0aXN0aWNzX3Rlc3RzKSAvIHNpemVvZihzdGF0aXN0aWNzX3Rlc3RzWzBdKSk7Cn0KCmludCBydW5fb25saW5lX2luZGV4X3Rlc3RzKCkgewogICAgVGVzdENhc2UgaW5kZXhfdGVzdHNbXSA9IHsKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgJ3Blb3BsZScgY29sbGVjdGlvbiB3aXRoIDEwMDAgcmVjb3JkcyIsCiAgICAgICAgICAgICJTPSVzOyAkUyBjcmVhdGUgdGVzdGRiIHBlb3BsZSAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nIC0tYWdlLWludCA+IC9kZXYvbnVsbCAyPiYxICYmICIKICAgICAgICAgICAgImZvciBpIGluICQoc2VxIDEgMTAwMCk7IGRvICRTIGNyZWF0ZSB0ZXN0ZGIgcGVvcGxlIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJwJCgoaSAlIDEwKSlcIiAtLWFnZS0kaSA+IC9kZXYvbnVsbCAyPiYxIHx8IGV4aXQgMTsgZG9uZSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiBwZW9wbGUgfCBncmVwIC1jICdcIl9pZFwiJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbMTAwMF0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkJ1aWxkIGFuIGluZGV4IG9uIG5hbWUgd2hpbGUgYW5vdGhlciBwcm9jZXNzIGluc2VydHMiLAogICAgICAgICAgICAiUz0lczsgKGZvciBpIGluICQoc2VxIDEgNTApOyBkbyAkUyBjcmVhdGUgdGVzdGRiIHBlb3BsZSAtLWluc2VydC1vbmUgLS1uYW1lLVwibGF0ZVwiIC0tYWdlLSQoKDIwMDAgKyBpKSkgPiAvZGV2L251bGwgMj4mMTsgZG9uZSkgJiAiCiAgICAgICAgICAgICIkUyBpbmRleCB0ZXN0ZGIgcGVvcGxlIG5hbWUgPiAvZGV2L251bGwgMj4mMTsgc3RhdHVzPSQ/OyB3YWl0OyBleGl0ICRzdGF0dXMiLAogICAgICAgICAgICAiJXMgaW5kZXggdGVzdGRiIHBlb3BsZSB8IGdyZXAgLW8gJ1wic3RhdGVcIjpcIlthLXpdKlwiJyIsCiAgICAgICAgICAgICJcInN0YXRlXCI6XCJyZWFkeVwiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJJbmRleCBob2xkcyBldmVyeSByZWNvcmQgd3JpdHRlbiBkdXJpbmcgdGhlIGJ1aWxkIiwKICAgICAgICAgICAgIiVzIGluZGV4IHRlc3RkYiBwZW9wbGUgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBpbmRleCB0ZXN0ZGIgcGVvcGxlIHwgZ3JlcCAtbyAnXCJlbnRyaWVzXCI6WzAtOV0qLCciLAogICAgICAgICAgICAiXCJlbnRyaWVzXCI6MTA1MCwiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkluZGV4ZWQgZXF1YWxpdHkgcXVlcnkgZmluZHMgdGhlIGNvbmN1cnJlbnQgd3JpdGVzIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHBlb3BsZSAtLXdoZXJlIFwibmFtZTpsYXRlXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBwZW9wbGUgLS13aGVyZSBcIm5hbWU6bGF0ZVwiIHwgZ3JlcCAtYyAnXCJfaWRcIicgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiWzUwXSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSW5kZXhlZCBlcXVhbGl0eSBjb21iaW5lZCB3aXRoIGEgcmFuZ2UgY29uZGl0aW9uIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHBlb3BsZSAtLXdoZXJlIFwiYWdlPj01MDAsbmFtZTpwM1wiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgcGVvcGxlIC0td2hlcmUgXCJhZ2U+PTUwMCxuYW1lOnAzXCIgfCBncmVwIC1jICdcIl9pZFwiJyB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbNTBdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJJbmRleCBpcyBtYWludGFpbmVkIGJ5IGxhdGVyIHVwZGF0ZXMiLAogICAgICAgICAgICAiJXMgdXBkYXRlIHRlc3RkYiBwZW9wbGUgLS13aGVyZSBcImFnZTo3XCIgLS1zZXQgLS1uYW1lLVwicmVuYW1lZFwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiUz0lczsgZWNobyBcIlskKCRTIGZpbmQgdGVzdGRiIHBlb3BsZSAtLXdoZXJlICduYW1lOnJlbmFtZWQnIHwgZ3JlcCAtYyAnXCJhZ2VcIjo3fScpLyQoJFMgZmluZCB0ZXN0ZGIgcGVvcGxlIC0td2hlcmUgJ25hbWU6cDcnIHwgZ3JlcCAtYyAnXCJfaWRcIicpXVwiIiwKICAgICAgICAgICAgIlsxLzk5XSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0KICAgIH07CiAgICAKICAgIHJldHVybiBydW5fZmVhdHVyZV90ZXN0X2Nhc2VzKCJPTkxJTkUgSU5ERVggVEVTVFMiLCBpbmRleF90ZXN0cywgc2l6ZW9mKGluZGV4X3Rlc3RzKSAvIHNpemVvZihpbmRleF90ZXN0c1swXSkpOwp9CgppbnQgcnVuX3BhcnRpdGlvbmluZ190ZXN0cygpIHsKICAgIFRlc3RDYXNlIHBhcnRpdGlvbmluZ190ZXN0c1tdID0gewogICAgICAgIHsKICAgICAgICAgICAgIkNyZWF0ZSAnb3JkZXJzJyBjb2xsZWN0aW9uIHBhcnRpdGlvbmVkIDQgd2F5cyBieSByZWdpb24iLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiBvcmRlcnMgLS1zY2hlbWEgLS1yZWdpb24tc3RyaW5nIC0tYW1vdW50LWludCAtLXBhcnRpdGlvbnMgNCAtLXNoYXJkLWtleSByZWdpb24gPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJscyAtZCAvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvb3JkZXJzL3BhcnRpdGlvbi0qIHwgd2MgLWwgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiWzRdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJJbnNlcnQgNDAgcmVjb3JkcyBhY3Jvc3MgdGhlIHBhcnRpdGlvbnMiLAogICAgICAgICAgICAiUz0lczsgZm9yIGkgaW4gJChzZXEgMSA0MCk7IGRvICRTIGNyZWF0ZSB0ZXN0ZGIgb3JkZXJzIC0taW5zZXJ0LW9uZSAtLXJlZ2lvbi1cInIkKChpICUlIDQpKVwiIC0tYW1vdW50LSRpID4gL2Rldi9udWxsIDI+JjEgfHwgZXhpdCAxOyBkb25lIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIG9yZGVycyB8IGdyZXAgLWMgJ1wiX2lkXCInIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgIls0MF0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlJlY29yZHMgb2Ygb25lIHNoYXJkIGtleSB2YWx1ZSBzaGFyZSBhIHBhcnRpdGlvbiIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBvcmRlcnMgLS13aGVyZSBcInJlZ2lvbjpyMlwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiY2QgL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL29yZGVycyAmJiBncmVwIC1sICdcInJlZ2lvblwiOlwicjJcIicgcGFydGl0aW9uLSovZGF0YS5zeWRiIHwgd2MgLWwgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiWzFdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJFcXVhbGl0eSBxdWVyeSBvbiB0aGUgc2hhcmQga2V5IiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIG9yZGVycyAtLXdoZXJlIFwicmVnaW9uOnIyXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBvcmRlcnMgLS13aGVyZSBcInJlZ2lvbjpyMlwiIHwgZ3JlcCAtYyAnXCJfaWRcIicgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiWzEwXSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiUmFuZ2UgcXVlcnkgc3BhbnMgZXZlcnkgcGFydGl0aW9uIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIG9yZGVycyAtLXdoZXJlIFwiYW1vdW50PjMwXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBvcmRlcnMgLS13aGVyZSBcImFtb3VudD4zMFwiIHwgZ3JlcCAtbyAnXCJyZWdpb25cIjpcInJbMC0zXVwiJyB8IHNvcnQgLXUgfCB3YyAtbCB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbNF0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlNoYXJkIGtleSBjb21iaW5lZCB3aXRoIGEgcmFuZ2UgY29uZGl0aW9uIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIG9yZGVycyAtLXdoZXJlIFwicmVnaW9uOnIxLGFtb3VudDw9MjBcIiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIG9yZGVycyAtLXdoZXJlIFwicmVnaW9uOnIxLGFtb3VudDw9MjBcIiB8IGdyZXAgLWMgJ1wiX2lkXCInIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgIls1XSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiVXBkYXRlIGFuZCBkZWxldGUgaW4gYSBwYXJ0aXRpb24iLAogICAgICAgICAgICAiUz0lczsgJFMgdXBkYXRlIHRlc3RkYiBvcmRlcnMgLS13aGVyZSBcImFtb3VudDo1XCIgLS1zZXQgLS1hbW91bnQtNTAwID4gL2Rldi9udWxsIDI+JjEgJiYgIgogICAgICAgICAgICAiJFMgZGVsZXRlIHRlc3RkYiBvcmRlcnMgLS13aGVyZSBcImFtb3VudDo4XCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJTPSVzOyBlY2hvIFwiWyQoJFMgZmluZCB0ZXN0ZGIgb3JkZXJzIC0td2hlcmUgJ2Ftb3VudD49NTAwJyB8IGdyZXAgLWMgJ1wicmVnaW9uXCI6XCJyMVwiJykvJCgkUyBsaXN0IHRlc3RkYiBvcmRlcnMgfCBncmVwIC1jICdcIl9pZFwiJyldXCIiLAogICAgICAgICAgICAiWzEvMzldIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJUaGUgc2hhcmQga2V5IGlzIHJlcXVpcmVkIGluIGEgcGFydGl0aW9uZWQgc2NoZW1hIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgb3JkZXJzIC0taW5zZXJ0LW9uZSAtLWFtb3VudC05OSA+IC9kZXYvbnVsbCAyPiYxOyB0cnVlIiwKICAgICAgICAgICAgIlM9JXM7IGVjaG8gXCJbJChncmVwIC1jICdecmVnaW9uOnN0cmluZzpyZXF1aXJlZCcgL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL29yZGVycy9zY2hlbWEudHh0KS8kKCRTIGxpc3QgdGVzdGRiIG9yZGVycyB8IGdyZXAgLWMgJ1wiX2lkXCInKV1cIiIsCiAgICAgICAgICAgICJbMS8zOV0iLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgLy8gQ29sbGVjdGlvbnMgZnJvbSBiZWZvcmUgdGhlIGtleSB3YXMgcmVxdWlyZWQ6IGEgcmVjb3JkIHdpdGhvdXQgaXQgcmVhZHMgYXMgMCwKICAgICAgICAgICAgLy8gYXMgaW4gYW4gdW5wYXJ0aXRpb25lZCBjb2xsZWN0aW9uLCBzbyB0aGUgcXVlcnkgY2Fubm90IGJlIHBydW5lZAogICAgICAgICAgICAiRXF1YWxpdHkgb24gYSBzaGFyZCBrZXkgdGhlIHNjaGVtYSBkb2VzIG5vdCByZXF1aXJlIHNjYW5zIGV2ZXJ5IHBhcnRpdGlvbiIsCiAgICAgICAgICAgICJTPSVzOyAkUyBjcmVhdGUgdGVzdGRiIGxlZ2FjeSAtLXNjaGVtYSAtLWNpdHktc3RyaW5nIC0tbi1pbnQgLS1wYXJ0aXRpb25zIDQgLS1zaGFyZC1rZXkgY2l0eSA+IC9kZXYvbnVsbCAyPiYxICYmICIKICAgICAgICAgICAgImZpbmQgL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL2xlZ2FjeSAtbmFtZSBzY2hlbWEudHh0IHwgeGFyZ3Mgc2VkIC1pICdzL15jaXR5OnN0cmluZzpyZXF1aXJlZC9jaXR5OnN0cmluZzpvcHRpb25hbC8nICYmICIKICAgICAgICAgICAgIiRTIGNyZWF0ZSB0ZXN0ZGIgbGVnYWN5IC0taW5zZXJ0LW9uZSAtLW4tMSA+IC9kZXYvbnVsbCAyPiYxICYmICIKICAgICAgICAgICAgIiRTIGNyZWF0ZSB0ZXN0ZGIgbGVnYWN5IC0taW5zZXJ0LW9uZSAtLWNpdHktXCJ4XCIgLS1uLTIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiBsZWdhY3kgLS13aGVyZSBcImNpdHk6YVwiIHwgZ3JlcCAtYyAnXCJuXCI6MScgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiWzFdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgcmV0dXJuIHJ1bl9mZWF0dXJlX3Rlc3RfY2FzZXMoIlBBUlRJVElPTklORyBURVNUUyIsIHBhcnRpdGlvbmluZ190ZXN0cywKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHNpemVvZihwYXJ0aXRpb25pbmdfdGVzdHMpIC8gc2l6ZW9mKHBhcnRpdGlvbmluZ190ZXN0c1swXSkpOwp9CgovLyBTdGFydHMgIjxjbGk+IC0tc2VydmVyIDxwb3J0PiIgKGZvbGxvd2luZyByZXBsaWNhX29mIHdoZW4gZ2l2ZW4pIG92ZXIgaXRzIG93bgovLyBTWURCX0JBU0VfRElSIGFuZCB3YWl0cyB1bnRpbCBpdCBhbnN3ZXJzOyByZXR1cm5zIGl0cyBwaWQsIG9yIC0xCnBpZF90IHN0YXJ0X3Rlc3Rfc2VydmVyKGNvbnN0IGNoYXIgKmJhc2VfZGlyZWN0b3J5LCBpbnQgcG9ydCwgY29uc3QgY2hhciAqcmVwbGljYV9vZikgewogICAgY2hhciBwb3J0X2FyZ3VtZW50WzE2XTsKICAgIHNucHJpbnRmKHBvcnRfYXJndW1lbnQsIHNpemVvZihwb3J0X2FyZ3VtZW50KSwgIiVkIiwgcG9ydCk7CiAgICAKICAgIHBpZF90IHBpZCA9IGZvcmsoKTsKICAgIGlmIChwaWQgPT0gLTEpIHJldHVybiAtMTsKICAgIGlmIChwaWQgPT0gMCkgewogICAgICAgIHNldGVudigiU1lEQl9CQVNFX0RJUiIsIGJhc2VfZGlyZWN0b3J5LCAxKTsKICAgICAgICBpbnQgbnVsbF9kZXNjcmlwdG9yID0gb3BlbigiL2Rldi9udWxsIiwgT19XUk9OTFkpOwogICAgICAgIGlmIChudWxsX2Rlc2NyaXB0b3IgIT0gLTEpIHsKICAgICAgICAgICAgZHVwMihudWxsX2Rlc2NyaXB0b3IsIFNURE9VVF9GSUxFTk8pOwogICAgICAgICAgICBkdXAyKG51bGxfZGVzY3JpcHRvciwgU1RERVJSX0ZJTEVOTyk7CiAgICAgICAgICAgIGNsb3NlKG51bGxfZGVzY3JpcHRvcik7CiAgICAgICAgfQogICAgICAgIGlmIChyZXBsaWNhX29mKSB7CiAgICAgICAgICAgIGV4ZWNscChjbGlfY29tbWFuZCwgY2xpX2NvbW1hbmQsICItLXNlcnZlciIsIHBvcnRfYXJndW1lbnQsICItLXJlcGxpY2Etb2YiLCByZXBsaWNhX29mLCAoY2hhciAqKU5VTEwpOwogICAgICAgIH0gZWxzZSB7CiAgICAgICAgICAgIGV4ZWNscChjbGlfY29tbWFuZCwgY2xpX2NvbW1hbmQsICItLXNlcnZlciIsIHBvcnRfYXJndW1lbnQsIChjaGFyICopTlVMTCk7CiAgICAgICAgfQogICAgICAgIF9leGl0KDEyNyk7CiAgICB9CiAgICAKICAgIGNoYXIgdXJsWzI1Nl07CiAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiaHR0cDovLzEyNy4wLjAuMTolZC9hcGkvZGF0YWJhc2VzIiwgcG9ydCk7CiAgICBmb3IgKGludCBhdHRlbXB0ID0gMDsgYXR0ZW1wdCA8IDUwOyBhdHRlbXB0KyspIHsKICAgICAgICB1c2xlZXAoMTAwMDAwKTsKICAgICAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJHRVQiLCB1cmwsIE5VTEwsIE5VTEwpOwogICAgICAgIGludCBzdGF0dXNfY29kZSA9IHJlc3BvbnNlID8gcmVzcG9uc2UtPnN0YXR1c19jb2RlIDogMDsKICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUocmVzcG9uc2UpOwogICAgICAgIGlmIChzdGF0dXNfY29kZSA9PSAyMDApIHJldHVybiBwaWQ7CiAgICAgICAgaWYgKHdhaXRwaWQocGlkLCBOVUxMLCBXTk9IQU5HKSA9PSBwaWQpIHJldHVybiAtMTsKICAgIH0KICAgIHN0b3BfdGVzdF9zZXJ2ZXIocGlkKTsKICAgIHJldHVybiAtMTsKfQoKLy8gU0lHVEVSTSBsZXRzIHRoZSBzZXJ2ZXIgc2h1dCBkb3duIHRoZSB3YXkgaXQgZG9lcyBpbiBwcm9kdWN0aW9uLCB3cml0aW5nIGl0cyBzbmFwc2hvdHMKdm9pZCBzdG9wX3Rlc3Rfc2VydmVyKHBpZF90IHBpZCkgewogICAgaWYgKHBpZCA8PSAwKSByZXR1cm47CiAgICBraWxsKHBpZCwgU0lHVEVSTSk7CiAgICB3YWl0cGlkKHBpZCwgTlVMTCwgMCk7Cn0KCmludCBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdChjb25zdCBjaGFyICpkZXNjcmlwdGlvbiwgY29uc3QgY2hhciAqbWV0aG9kLCBjb25zdCBjaGFyICp1cmwsIGNvbnN0IGNoYXIgKmJvZHksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICBjb25zdCBjaGFyICpleHBlY3RlZF9wYXR0ZXJuLCBpbnQgKnBhc3NlZCwgaW50ICp0b3RhbCkgewogICAgKCp0b3RhbCkrKzsKICAgIGlmICghaHR0cF90ZXN0X2VuZHBvaW50KGRlc2NyaXB0aW9uLCBtZXRob2QsIHVybCwgYm9keSwgZXhwZWN0ZWRfcGF0dGVybiwgMCwgTlVMTCkpIHJldHVybiAwOwogICAgKCpwYXNzZWQpKys7CiAgICByZXR1cm4gMTsKfQoKLy8gQSBzdGVwIGNoZWNrZWQgb3V0c2lkZSBhIHNpbmdsZSByZXF1ZXN0IChhIHNlcnZlciBzdGFydCwgYSBmaWxlIG9uIGRpc2spCmludCByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soY29uc3QgY2hhciAqZGVzY3JpcHRpb24sIGludCBzdWNjZXNzLCBpbnQgKnBhc3NlZCwgaW50ICp0b3RhbCkgewogICAgcHJpbnRmKCJcbiVzJS04MHMiIFJFU0VUICJbJXNdXG4iLCBCTFVFLCBkZXNjcmlwdGlvbiwgc3VjY2VzcyA/IEdSRUVOICJQQVNTIiBSRVNFVCA6IFJFRCAiRkFJTCIgUkVTRVQpOwogICAgKCp0b3RhbCkrKzsKICAgIGlmIChzdWNjZXNzKSAoKnBhc3NlZCkrKzsKICAgIHJldHVybiBzdWNjZXNzOwp9CgovLyBUaGUgbWVtb3J5IGVuZ2luZSBrZWVwcyByZWNvcmRzIGluIHRoZSBzZXJ2ZXI7IGEgc2h1dGRvd24gd3JpdGVzIHRoZW0gdG8gZGF0YS5zeWRiIGFuZAovLyB0aGUgbmV4dCBzZXJ2ZXIgbG9hZHMgdGhlbSBiYWNrCmludCBydW5fbWVtb3J5X2VuZ2luZV90ZXN0cygpIHsKICAgIGNvbnN0IGNoYXIgKnRpdGxlID0gIk1FTU9SWSBFTkdJTkUgVEVTVFMiOwogICAgY29uc3QgY2hhciAqYmFzZV9kaXJlY3RvcnkgPSAiL3RtcC9zeWRiX3Rlc3RfbWVtb3J5IjsKICAgIGNvbnN0IGludCBwb3J0ID0gMTg0NjE7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICIlcyIgUkVTRVQgIlxuIiwgdGl0bGUpOwogICAgCiAgICBpbnQgcGFzc2VkID0gMDsKICAgIGludCB0b3RhbCA9IDA7CiAgICBjaGFyIGNvbW1hbmRbMjU2XTsKICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgInJtIC1yZiAlcyIsIGJhc2VfZGlyZWN0b3J5KTsKICAgIHN5c3RlbShjb21tYW5kKTsKICAgIAogICAgcGlkX3Qgc2VydmVyX3BpZCA9IHN0YXJ0X3Rlc3Rfc2VydmVyKGJhc2VfZGlyZWN0b3J5LCBwb3J0LCBOVUxMKTsKICAgIGlmIChyZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIlN0YXJ0IGEgc2VydmVyIiwgc2VydmVyX3BpZCAhPSAtMSwgJnBhc3NlZCwgJnRvdGFsKSkgewogICAgICAgIGNoYXIgdXJsWzUxMl07CiAgICAgICAgY2hhciBjb2xsZWN0aW9uX3VybFsyNTZdOwogICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICJodHRwOi8vMTI3LjAuMC4xOiVkL2FwaS9kYXRhYmFzZXMiLCBwb3J0KTsKICAgICAgICBzbnByaW50Zihjb2xsZWN0aW9uX3VybCwgc2l6ZW9mKGNvbGxlY3Rpb25fdXJsKSwgImh0dHA6Ly8xMjcuMC4wLjE6JWQvYXBpL2RhdGFiYXNlcy9tZW1kYi9jb2xsZWN0aW9ucy9zZXNzaW9ucyIsIHBvcnQpOwogICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJDcmVhdGUgZGF0YWJhc2UgZm9yIHRoZSBtZW1vcnkgZW5naW5lIiwgIlBPU1QiLCB1cmwsICJ7XCJuYW1lXCI6XCJtZW1kYlwifSIsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIlwic3VjY2Vzc1wiOnRydWUiLCAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICJodHRwOi8vMTI3LjAuMC4xOiVkL2FwaS9kYXRhYmFzZXMvbWVtZGIvY29sbGVjdGlvbnMiLCBwb3J0KTsKICAgICAgICBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdCgiQ3JlYXRlICdzZXNzaW9ucycgY29sbGVjdGlvbiBvbiB0aGUgbWVtb3J5IGVuZ2luZSIsICJQT1NUIiwgdXJsLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJzZXNzaW9uc1wiLFwiZW5naW5lXCI6XCJtZW1vcnlcIixcInNuYXBzaG90X2ludGVydmFsX21zXCI6NjAwMDAsXCJzY2hlbWFcIjpbIgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJ1c2VyXCIsXCJ0eXBlXCI6XCJzdHJpbmdcIixcInJlcXVpcmVkXCI6dHJ1ZSxcImluZGV4ZWRcIjpmYWxzZX0sIgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJoaXRzXCIsXCJ0eXBlXCI6XCJpbnRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9XX0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICAKICAgICAgICBjaGFyIGlkZW50aWZpZXJzWzZdWzY0XTsKICAgICAgICBpbnQgaW5zZXJ0ZWQgPSAwOwogICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXMiLCBjb2xsZWN0aW9uX3VybCk7CiAgICAgICAgZm9yIChpbnQgaSA9IDE7IGkgPD0gNjsgaSsrKSB7CiAgICAgICAgICAgIGNoYXIgYm9keVsxMjhdOwogICAgICAgICAgICBzbnByaW50Zihib2R5LCBzaXplb2YoYm9keSksICJ7XCJ1c2VyXCI6XCJ1JWRcIixcImhpdHNcIjolZH0iLCBpLCBpKTsKICAgICAgICAgICAgSHR0cFJlc3BvbnNlKiByZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsIHVybCwgYm9keSwgImFwcGxpY2F0aW9uL2pzb24iKTsKICAgICAgICAgICAgY2hhciogaWRlbnRpZmllciA9IHJlc3BvbnNlICYmIHJlc3BvbnNlLT5ib2R5ID8gZXh0cmFjdF9qc29uX2ZpZWxkKHJlc3BvbnNlLT5ib2R5LCAiaWQiKSA6IE5VTEw7CiAgICAgICAgICAgIGlmIChpZGVudGlmaWVyICYmIHN0cmxlbihpZGVudGlmaWVyKSA8IHNpemVvZihpZGVudGlmaWVyc1swXSkpIHN0cmNweShpZGVudGlmaWVyc1tpbnNlcnRlZCsrXSwgaWRlbnRpZmllcik7CiAgICAgICAgICAgIGZyZWUoaWRlbnRpZmllcik7CiAgICAgICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICAgICAgfQogICAgICAgIGlmIChyZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIkluc2VydCBzaXggcmVjb3JkcyIsIGluc2VydGVkID09IDYsICZwYXNzZWQsICZ0b3RhbCkpIHsKICAgICAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgIiVzL2luc3RhbmNlcy8lcyIsIGNvbGxlY3Rpb25fdXJsLCBpZGVudGlmaWVyc1swXSk7CiAgICAgICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJVcGRhdGUgYSByZWNvcmQgaW4gbWVtb3J5IiwgIlBVVCIsIHVybCwgIntcImhpdHNcIjoxMDB9IiwgIlwic3VjY2Vzc1wiOnRydWUiLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiJXMvaW5zdGFuY2VzLyVzIiwgY29sbGVjdGlvbl91cmwsIGlkZW50aWZpZXJzWzVdKTsKICAgICAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIkRlbGV0ZSBhIHJlY29yZCBpbiBtZW1vcnkiLCAiREVMRVRFIiwgdXJsLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgfQogICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXM/cXVlcnk9aGl0cz49NCIsIGNvbGxlY3Rpb25fdXJsKTsKICAgICAgICBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdCgiUmFuZ2UgcXVlcnkgYmVmb3JlIHRoZSByZXN0YXJ0IiwgIkdFVCIsIHVybCwgTlVMTCwgIlwiaGl0c1wiOjEwMCIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgCiAgICAgICAgc3RvcF90ZXN0X3NlcnZlcihzZXJ2ZXJfcGlkKTsKICAgICAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICJncmVwIC1xICdcImhpdHNcIjoxMDAnICVzL21lbWRiL3Nlc3Npb25zL2RhdGEuc3lkYiIsIGJhc2VfZGlyZWN0b3J5KTsKICAgICAgICByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIlNodXRkb3duIHdyaXRlcyBhIHNuYXBzaG90Iiwgc3lzdGVtKGNvbW1hbmQpID09IDAsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgCiAgICAgICAgc2VydmVyX3BpZCA9IHN0YXJ0X3Rlc3Rfc2VydmVyKGJhc2VfZGlyZWN0b3J5LCBwb3J0LCBOVUxMKTsKICAgICAgICBpZiAocmVwb3J0X3NlcnZlcl9mZWF0dXJlX2NoZWNrKCJSZXN0YXJ0IHRoZSBzZXJ2ZXIiLCBzZXJ2ZXJfcGlkICE9IC0xLCAmcGFzc2VkLCAmdG90YWwpKSB7CiAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9zdGF0cyIsIGNvbGxlY3Rpb25fdXJsKTsKICAgICAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIlJlc3RhcnRlZCBzZXJ2ZXIgbG9hZHMgZXZlcnkgbGl2ZSByZWNvcmQiLCAiR0VUIiwgdXJsLCBOVUxMLCAiXCJsaXZlX3JlY29yZHNcIjo1LCIsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXM/cXVlcnk9dXNlcjp1MSIsIGNvbGxlY3Rpb25fdXJsKTsKICAgICAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIlVwZGF0ZSBzdXJ2aXZlcyB0aGUgcmVzdGFydCIsICJHRVQiLCB1cmwsIE5VTEwsICJcImhpdHNcIjoxMDAiLCAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiJXMvaW5zdGFuY2VzP3F1ZXJ5PXVzZXI6dTYiLCBjb2xsZWN0aW9uX3VybCk7CiAgICAgICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJEZWxldGUgc3Vydml2ZXMgdGhlIHJlc3RhcnQiLCAiR0VUIiwgdXJsLCBOVUxMLCAiXCJpbnN0YW5jZXNcIjpbXSIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXMiLCBjb2xsZWN0aW9uX3VybCk7CiAgICAgICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJJbnNlcnQgYWZ0ZXIgdGhlIHJlc3RhcnQiLCAiUE9TVCIsIHVybCwgIntcInVzZXJcIjpcInU3XCIsXCJoaXRzXCI6N30iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiXCJzdWNjZXNzXCI6dHJ1ZSIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXM/cXVlcnk9aGl0cz49NCIsIGNvbGxlY3Rpb25fdXJsKTsKICAgICAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIlJhbmdlIHF1ZXJ5IGFmdGVyIHRoZSByZXN0YXJ0IiwgIkdFVCIsIHVybCwgTlVMTCwgIlwidXNlclwiOlwidTdcIiIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgICAgIHN0b3BfdGVzdF9zZXJ2ZXIoc2VydmVyX3BpZCk7CiAgICAgICAgfQogICAgfQogICAgCiAgICBwcmludGYoWUVMTE9XICIgICVzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIHRpdGxlLCBwYXNzZWQsIHRvdGFsKTsKICAgIGZlYXR1cmVfcGFzc2VkICs9IHBhc3NlZDsKICAgIGZlYXR1cmVfdG90YWwgKz0gdG90YWw7CiAgICByZXR1cm4gcGFzc2VkOwp9CgovLyBQb2xscyB1cmwgdW50aWwgaXRzIGJvZHkgY29udGFpbnMgZXhwZWN0ZWRfcGF0dGVybiwgZm9yIGEgcmVwbGljYSBjYXRjaGluZyB1cAppbnQgd2FpdF9mb3Jfc2VydmVyX3Jlc3BvbnNlKGNvbnN0IGNoYXIgKnVybCwgY29uc3QgY2hhciAqZXhwZWN0ZWRfcGF0dGVybiwgaW50IHRpbWVvdXRfbXMpIHsKICAgIGZvciAoaW50IHdhaXRlZF9tcyA9IDA7IHdhaXRlZF9tcyA8PSB0aW1lb3V0X21zOyB3YWl0ZWRfbXMgKz0gMTAwKSB7CiAgICAgICAgSHR0cFJlc3BvbnNlKiByZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiR0VUIiwgdXJsLCBOVUxMLCBOVUxMKTsKICAgICAgICBpbnQgZm91bmQgPSByZXNwb25zZSAmJiByZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gMjAwICYmIHJlc3BvbnNlLT5ib2R5ICYmCiAgICAgICAgICAgICAgICAgICAgc3Ryc3RyKHJlc3BvbnNlLT5ib2R5LCBleHBlY3RlZF9wYXR0ZXJuKSAhPSBOVUxMOwogICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICAgICAgaWYgKGZvdW5kKSByZXR1cm4gMTsKICAgICAgICB1c2xlZXAoMTAwMDAwKTsKICAgIH0KICAgIHJldHVybiAwOwp9CgovLyBBIHJlcGxpY2EgYm9vdHN0cmFwcyBmcm9tIHRoZSBwcmltYXJ5J3Mgc25hcHNob3QsIHRoZW4gYXBwbGllcyBpdHMgaW5zZXJ0cywgdXBkYXRlcyBhbmQKLy8gZGVsZXRlcyBhcyB0aGV5IGhhcHBlbiwgYW5kIHJlZnVzZXMgd3JpdGVzIG9mIGl0cyBvd24KaW50IHJ1bl9yZXBsaWNhdGlvbl90ZXN0cygpIHsKICAgIGNvbnN0IGNoYXIgKnRpdGxlID0gIlJFUExJQ0FUSU9OIFRFU1RTIjsKICAgIGNvbnN0IGludCBwcmltYXJ5X3BvcnQgPSAxODQ2MjsKICAgIGNvbnN0IGludCByZXBsaWNhX3BvcnQgPSAxODQ2MzsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIiVzIiBSRVNFVCAiXG4iLCB0aXRsZSk7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIHN5c3RlbSgicm0gLXJmIC90bXAvc3lkYl90ZXN0X3ByaW1hcnkgL3RtcC9zeWRiX3Rlc3RfcmVwbGljYSIpOwogICAgCiAgICBjaGFyIHVybFs1MTJdOwogICAgY2hhciBwcmltYXJ5X2NvbGxlY3Rpb25fdXJsWzI1Nl07CiAgICBjaGFyIHJlcGxpY2FfY29sbGVjdGlvbl91cmxbMjU2XTsKICAgIHNucHJpbnRmKHByaW1hcnlfY29sbGVjdGlvbl91cmwsIHNpemVvZihwcmltYXJ5X2NvbGxlY3Rpb25fdXJsKSwKICAgICAgICAgICAgICJodHRwOi8vMTI3LjAuMC4xOiVkL2FwaS9kYXRhYmFzZXMvcmVwZGIvY29sbGVjdGlvbnMvaXRlbXMiLCBwcmltYXJ5X3BvcnQpOwogICAgc25wcmludGYocmVwbGljYV9jb2xsZWN0aW9uX3VybCwgc2l6ZW9mKHJlcGxpY2FfY29sbGVjdGlvbl91cmwpLAogICAgICAgICAgICAgImh0dHA6Ly8xMjcuMC4wLjE6JWQvYXBpL2RhdGFiYXNlcy9yZXBkYi9jb2xsZWN0aW9ucy9pdGVtcyIsIHJlcGxpY2FfcG9ydCk7CiAgICAKICAgIHBpZF90IHByaW1hcnlfcGlkID0gc3RhcnRfdGVzdF9zZXJ2ZXIoIi90bXAvc3lkYl90ZXN0X3ByaW1hcnkiLCBwcmltYXJ5X3BvcnQsIE5VTEwpOwogICAgaWYgKHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiU3RhcnQgYSBwcmltYXJ5IiwgcHJpbWFyeV9waWQgIT0gLTEsICZwYXNzZWQsICZ0b3RhbCkpIHsKICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiaHR0cDovLzEyNy4wLjAuMTolZC9hcGkvZGF0YWJhc2VzIiwgcHJpbWFyeV9wb3J0KTsKICAgICAgICBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdCgiQ3JlYXRlIGRhdGFiYXNlIG9uIHRoZSBwcmltYXJ5IiwgIlBPU1QiLCB1cmwsICJ7XCJuYW1lXCI6XCJyZXBkYlwifSIsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIlwic3VjY2Vzc1wiOnRydWUiLCAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICJodHRwOi8vMTI3LjAuMC4xOiVkL2FwaS9kYXRhYmFzZXMvcmVwZGIvY29sbGVjdGlvbnMiLCBwcmltYXJ5X3BvcnQpOwogICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJDcmVhdGUgJ2l0ZW1zJyBjb2xsZWN0aW9uIG9uIHRoZSBwcmltYXJ5IiwgIlBPU1QiLCB1cmwsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIntcIm5hbWVcIjpcIml0ZW1zXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJsYWJlbFwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9LCIKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAie1wibmFtZVwiOlwicXR5XCIsXCJ0eXBlXCI6XCJpbnRcIixcInJlcXVpcmVkXCI6ZmFsc2UsXCJpbmRleGVkXCI6ZmFsc2V9XX0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICBjaGFyIGlkZW50aWZpZXJzWzRdWzY0XTsKICAgICAgICBpbnQgaW5zZXJ0ZWQgPSAwOwogICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXMiLCBwcmltYXJ5X2NvbGxlY3Rpb25fdXJsKTsKICAgICAgICBmb3IgKGludCBpID0gMTsgaSA8PSAzOyBpKyspIHsKICAgICAgICAgICAgY2hhciBib2R5WzEyOF07CiAgICAgICAgICAgIHNucHJpbnRmKGJvZHksIHNpemVvZihib2R5KSwgIntcImxhYmVsXCI6XCJhJWRcIixcInF0eVwiOiVkfSIsIGksIGkpOwogICAgICAgICAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgdXJsLCBib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgICAgICAgICBjaGFyKiBpZGVudGlmaWVyID0gcmVzcG9uc2UgJiYgcmVzcG9uc2UtPmJvZHkgPyBleHRyYWN0X2pzb25fZmllbGQocmVzcG9uc2UtPmJvZHksICJpZCIpIDogTlVMTDsKICAgICAgICAgICAgaWYgKGlkZW50aWZpZXIgJiYgc3RybGVuKGlkZW50aWZpZXIpIDwgc2l6ZW9mKGlkZW50aWZpZXJzWzBdKSkgc3RyY3B5KGlkZW50aWZpZXJzW2luc2VydGVkKytdLCBpZGVudGlmaWVyKTsKICAgICAgICAgICAgZnJlZShpZGVudGlmaWVyKTsKICAgICAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKHJlc3BvbnNlKTsKICAgICAgICB9CiAgICAgICAgcmVwb3J0X3NlcnZlcl9mZWF0dXJlX2NoZWNrKCJJbnNlcnQgdGhyZWUgcmVjb3JkcyBvbiB0aGUgcHJpbWFyeSIsIGluc2VydGVkID09IDMsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgCiAgICAgICAgY2hhciBwcmltYXJ5X2FkZHJlc3NbNjRdOwogICAgICAgIHNucHJpbnRmKHByaW1hcnlfYWRkcmVzcywgc2l6ZW9mKHByaW1hcnlfYWRkcmVzcyksICIxMjcuMC4wLjE6JWQiLCBwcmltYXJ5X3BvcnQpOwogICAgICAgIHBpZF90IHJlcGxpY2FfcGlkID0gc3RhcnRfdGVzdF9zZXJ2ZXIoIi90bXAvc3lkYl90ZXN0X3JlcGxpY2EiLCByZXBsaWNhX3BvcnQsIHByaW1hcnlfYWRkcmVzcyk7CiAgICAgICAgaWYgKHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiU3RhcnQgYSByZXBsaWNhIG9mIHRoZSBwcmltYXJ5IiwgcmVwbGljYV9waWQgIT0gLTEsICZwYXNzZWQsICZ0b3RhbCkpIHsKICAgICAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgImh0dHA6Ly8xMjcuMC4wLjE6JWQvYXBpL3JlcGxpY2F0aW9uL3N0YXR1cyIsIHJlcGxpY2FfcG9ydCk7CiAgICAgICAgICAgIHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiUmVwbGljYSByZXBvcnRzIGl0cyByb2xlIiwgd2FpdF9mb3Jfc2VydmVyX3Jlc3BvbnNlKHVybCwgIlwicm9sZVwiOlwicmVwbGljYVwiIiwgNTAwMCksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiJXMvaW5zdGFuY2VzP3F1ZXJ5PWxhYmVsOmEzIiwgcmVwbGljYV9jb2xsZWN0aW9uX3VybCk7CiAgICAgICAgICAgIHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiUmVwbGljYSBib290c3RyYXBzIHRoZSBleGlzdGluZyByZWNvcmRzIiwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgIHdhaXRfZm9yX3NlcnZlcl9yZXNwb25zZSh1cmwsICJcInF0eVwiOjMiLCA1MDAwKSwgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXMiLCBwcmltYXJ5X2NvbGxlY3Rpb25fdXJsKTsKICAgICAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIkluc2VydCBvbiB0aGUgcHJpbWFyeSIsICJQT1NUIiwgdXJsLCAie1wibGFiZWxcIjpcImE0XCIsXCJxdHlcIjo0fSIsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICAgICAgaWYgKGluc2VydGVkID09IDMpIHsKICAgICAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXMvJXMiLCBwcmltYXJ5X2NvbGxlY3Rpb25fdXJsLCBpZGVudGlmaWVyc1swXSk7CiAgICAgICAgICAgICAgICBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdCgiVXBkYXRlIG9uIHRoZSBwcmltYXJ5IiwgIlBVVCIsIHVybCwgIntcInF0eVwiOjEwMH0iLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgIiVzL2luc3RhbmNlcy8lcyIsIHByaW1hcnlfY29sbGVjdGlvbl91cmwsIGlkZW50aWZpZXJzWzFdKTsKICAgICAgICAgICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJEZWxldGUgb24gdGhlIHByaW1hcnkiLCAiREVMRVRFIiwgdXJsLCBOVUxMLCAiXCJzdWNjZXNzXCI6dHJ1ZSIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgIiVzL2luc3RhbmNlcz9xdWVyeT1sYWJlbDphNCIsIHJlcGxpY2FfY29sbGVjdGlvbl91cmwpOwogICAgICAgICAgICByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIlJlcGxpY2EgYXBwbGllcyB0aGUgaW5zZXJ0Iiwgd2FpdF9mb3Jfc2VydmVyX3Jlc3BvbnNlKHVybCwgIlwicXR5XCI6NCIsIDUwMDApLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgIiVzL2luc3RhbmNlcz9xdWVyeT1sYWJlbDphMSIsIHJlcGxpY2FfY29sbGVjdGlvbl91cmwpOwogICAgICAgICAgICByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIlJlcGxpY2EgYXBwbGllcyB0aGUgdXBkYXRlIiwgd2FpdF9mb3Jfc2VydmVyX3Jlc3BvbnNlKHVybCwgIlwicXR5XCI6MTAwIiwgNTAwMCksCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiJXMvaW5zdGFuY2VzP3F1ZXJ5PWxhYmVsOmEyIiwgcmVwbGljYV9jb2xsZWN0aW9uX3VybCk7CiAgICAgICAgICAgIHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiUmVwbGljYSBhcHBsaWVzIHRoZSBkZWxldGUiLCB3YWl0X2Zvcl9zZXJ2ZXJfcmVzcG9uc2UodXJsLCAiXCJpbnN0YW5jZXNcIjpbXSIsIDUwMDApLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICAgICAgCiAgICAgICAgICAgIHNucHJpbnRmKHVybCwgc2l6ZW9mKHVybCksICIlcy9pbnN0YW5jZXMiLCByZXBsaWNhX2NvbGxlY3Rpb25fdXJsKTsKICAgICAgICAgICAgSHR0cFJlc3BvbnNlKiByZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiUE9TVCIsIHVybCwgIntcImxhYmVsXCI6XCJ4XCIsXCJxdHlcIjo5fSIsICJhcHBsaWNhdGlvbi9qc29uIik7CiAgICAgICAgICAgIHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiUmVwbGljYSByZWZ1c2VzIHdyaXRlcyIsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICByZXNwb25zZSAmJiByZXNwb25zZS0+c3RhdHVzX2NvZGUgPT0gNDAzICYmIHJlc3BvbnNlLT5ib2R5ICYmCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzdHJzdHIocmVzcG9uc2UtPmJvZHksICJcInN1Y2Nlc3NcIjpmYWxzZSIpICE9IE5VTEwsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgICAgIGh0dHBfcmVzcG9uc2VfZnJlZShyZXNwb25zZSk7CiAgICAgICAgICAgIHN0b3BfdGVzdF9zZXJ2ZXIocmVwbGljYV9waWQpOwogICAgICAgIH0KICAgICAgICAKICAgICAgICAvLyBCb290c3RyYXBwaW5nIHdvdWxkIGRlbGV0ZSB0aGUgcHJpbWFyeSdzIG93biBkYXRhYmFzZXMKICAgICAgICBwaWRfdCBzaGFyZWRfcGlkID0gc3RhcnRfdGVzdF9zZXJ2ZXIoIi90bXAvc3lkYl90ZXN0X3ByaW1hcnkiLCByZXBsaWNhX3BvcnQgKyAxLCBwcmltYXJ5X2FkZHJlc3MpOwogICAgICAgIHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiQSByZXBsaWNhIG9uIHRoZSBwcmltYXJ5J3MgZGF0YSBkaXJlY3RvcnkgaXMgcmVmdXNlZCIsIHNoYXJlZF9waWQgPT0gLTEsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgc3RvcF90ZXN0X3NlcnZlcihzaGFyZWRfcGlkKTsKICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiJXMvaW5zdGFuY2VzP3F1ZXJ5PWxhYmVsOmE0IiwgcHJpbWFyeV9jb2xsZWN0aW9uX3VybCk7CiAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIlRoZSBwcmltYXJ5IGtlZXBzIGl0cyByZWNvcmRzIiwgIkdFVCIsIHVybCwgTlVMTCwgIlwicXR5XCI6NCIsICZwYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgc3RvcF90ZXN0X3NlcnZlcihwcmltYXJ5X3BpZCk7CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgJXM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgdGl0bGUsIHBhc3NlZCwgdG90YWwpOwogICAgZmVhdHVyZV9wYXNzZWQgKz0gcGFzc2VkOwogICAgZmVhdHVyZV90b3RhbCArPSB0b3RhbDsKICAgIHJldHVybiBwYXNzZWQ7Cn0KCi8vID09PT09PT09PT09PT09PT09PT09IENPUkUgQ0xJIFRFU1QgU1VJVEUgPT09PT09PT09PT09PT09PT09PT0KCi8vIGR1cmFiaWxpdHkudHh0IGhvbGRzIHRoZSBmc3luYyBwb2xpY3k6IHRoZSBDTEkgc2V0cyBhbmQgc2hvd3MgaXQsIGEgY29sbGVjdGlvbiBjcmVhdGVkIG92ZXIKLy8gSFRUUCBzdGFydHMgd2l0aCB0aGUgb25lIGluIGl0cyByZXF1ZXN0LCBhbmQgd3JpdGVzIHN1Y2NlZWQgdW5kZXIgZXZlcnkgcG9saWN5CmludCBydW5fZHVyYWJpbGl0eV90ZXN0cygpIHsKICAgIFRlc3RDYXNlIGR1cmFiaWxpdHlfdGVzdHNbXSA9IHsKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgJ2xlZGdlcicgY29sbGVjdGlvbiB0aGF0IHN5bmNzIGV2ZXJ5IHdyaXRlIiwKICAgICAgICAgICAgIlM9JXM7ICRTIGNyZWF0ZSB0ZXN0ZGIgbGVkZ2VyIC0tc2NoZW1hIC0tZW50cnktc3RyaW5nIC0tYW1vdW50LWludCA+IC9kZXYvbnVsbCAyPiYxICYmICIKICAgICAgICAgICAgIiRTIGR1cmFiaWxpdHkgdGVzdGRiIGxlZGdlciBhbHdheXMgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJzZWQgJ3MvLiovWyZdLycgL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL2xlZGdlci9kdXJhYmlsaXR5LnR4dCIsCiAgICAgICAgICAgICJbYWx3YXlzXSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSW5zZXJ0cyBzdWNjZWVkIHdpdGggYWx3YXlzIiwKICAgICAgICAgICAgIlM9JXM7IGZvciBpIGluIDEgMiAzOyBkbyAkUyBjcmVhdGUgdGVzdGRiIGxlZGdlciAtLWluc2VydC1vbmUgLS1lbnRyeS1cImUkaVwiIC0tYW1vdW50LSRpID4gL2Rldi9udWxsIDI+JjEgfHwgZXhpdCAxOyBkb25lIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIGxlZGdlciB8IGdyZXAgLWMgJ1wiX2lkXCInIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgIlszXSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiU3dpdGNoICdsZWRnZXInIHRvIGdyb3VwIGNvbW1pdCIsCiAgICAgICAgICAgICIlcyBkdXJhYmlsaXR5IHRlc3RkYiBsZWRnZXIgZ3JvdXAgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBkdXJhYmlsaXR5IHRlc3RkYiBsZWRnZXIgfCBzZWQgJ3MvLiovWyZdLyciLAogICAgICAgICAgICAiW2dyb3VwXSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSW5zZXJ0cywgdXBkYXRlcyBhbmQgZGVsZXRlcyBzdWNjZWVkIHdpdGggZ3JvdXAiLAogICAgICAgICAgICAiUz0lczsgZm9yIGkgaW4gNCA1IDY7IGRvICRTIGNyZWF0ZSB0ZXN0ZGIgbGVkZ2VyIC0taW5zZXJ0LW9uZSAtLWVudHJ5LVwiZSRpXCIgLS1hbW91bnQtJGkgPiAvZGV2L251bGwgMj4mMSB8fCBleGl0IDE7IGRvbmUgJiYgIgogICAgICAgICAgICAiJFMgdXBkYXRlIHRlc3RkYiBsZWRnZXIgLS13aGVyZSBcImVudHJ5OmUxXCIgLS1zZXQgLS1hbW91bnQtMTAwID4gL2Rldi9udWxsIDI+JjEgJiYgIgogICAgICAgICAgICAiJFMgZGVsZXRlIHRlc3RkYiBsZWRnZXIgLS13aGVyZSBcImVudHJ5OmUyXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJTPSVzOyBlY2hvIFwiWyQoJFMgbGlzdCB0ZXN0ZGIgbGVkZ2VyIHwgZ3JlcCAtYyAnXCJfaWRcIicpLyQoJFMgZmluZCB0ZXN0ZGIgbGVkZ2VyIC0td2hlcmUgJ2Ftb3VudDoxMDAnIHwgZ3JlcCAtYyAnXCJfaWRcIicpXVwiIiwKICAgICAgICAgICAgIls1LzFdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJSZWplY3QgaW50ZXJ2YWwoMCkiLAogICAgICAgICAgICAiUz0lczsgaWYgJFMgZHVyYWJpbGl0eSB0ZXN0ZGIgbGVkZ2VyICdpbnRlcnZhbCgwKScgPiAvZGV2L251bGwgMj4mMTsgdGhlbiBleGl0IDE7IGZpIiwKICAgICAgICAgICAgIiVzIGR1cmFiaWxpdHkgdGVzdGRiIGxlZGdlciB8IHNlZCAncy8uKi9bJl0vJyIsCiAgICAgICAgICAgICJbZ3JvdXBdIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJSZWplY3QgbWFsZm9ybWVkIGR1cmFiaWxpdHkgc2V0dGluZ3MiLAogICAgICAgICAgICAiUz0lczsgZm9yIHNldHRpbmcgaW4gJycgJ3NvbWV0aW1lcycgJ2ludGVydmFsKCcgJ2ludGVydmFsKCknICdpbnRlcnZhbChhYmMpJyAnaW50ZXJ2YWwoMTAnICdpbnRlcnZhbCgxMCl4JyAnaW50ZXJ2YWwoLTUpJzsgZG8gIgogICAgICAgICAgICAiaWYgJFMgZHVyYWJpbGl0eSB0ZXN0ZGIgbGVkZ2VyIFwiJHNldHRpbmdcIiA+IC9kZXYvbnVsbCAyPiYxOyB0aGVuIGV4aXQgMTsgZmk7IGRvbmUiLAogICAgICAgICAgICAic2VkICdzLy4qL1smXS8nIC90bXAvc3lkYl90ZXN0L3Rlc3RkYi9sZWRnZXIvZHVyYWJpbGl0eS50eHQiLAogICAgICAgICAgICAiW2dyb3VwXSIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiU2V0IGFuZCBzaG93IGludGVydmFsKDI1MCkiLAogICAgICAgICAgICAiJXMgZHVyYWJpbGl0eSB0ZXN0ZGIgbGVkZ2VyICdpbnRlcnZhbCgyNTApJyA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIlM9JXM7IGVjaG8gXCJbJChjYXQgL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL2xlZGdlci9kdXJhYmlsaXR5LnR4dCkvJCgkUyBkdXJhYmlsaXR5IHRlc3RkYiBsZWRnZXIpXVwiIiwKICAgICAgICAgICAgIltpbnRlcnZhbCgyNTApL2ludGVydmFsKDI1MCldIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfQogICAgfTsKICAgIAogICAgaW50IHBhc3NlZCA9IHJ1bl9mZWF0dXJlX3Rlc3RfY2FzZXMoIkRVUkFCSUxJVFkgVEVTVFMiLCBkdXJhYmlsaXR5X3Rlc3RzLCBzaXplb2YoZHVyYWJpbGl0eV90ZXN0cykgLyBzaXplb2YoZHVyYWJpbGl0eV90ZXN0c1swXSkpOwogICAgCiAgICBjb25zdCBjaGFyICp0aXRsZSA9ICJEVVJBQklMSVRZIE9OIENSRUFURSBURVNUUyI7CiAgICBjb25zdCBjaGFyICpiYXNlX2RpcmVjdG9yeSA9ICIvdG1wL3N5ZGJfdGVzdF9kdXJhYmlsaXR5IjsKICAgIGNvbnN0IGludCBwb3J0ID0gMTg0NjU7CiAgICBwcmludGYoIlxuIiBNQUdFTlRBICIlcyIgUkVTRVQgIlxuIiwgdGl0bGUpOwogICAgCiAgICBpbnQgc2VydmVyX3Bhc3NlZCA9IDA7CiAgICBpbnQgdG90YWwgPSAwOwogICAgY2hhciBjb21tYW5kWzI1Nl07CiAgICBzbnByaW50Zihjb21tYW5kLCBzaXplb2YoY29tbWFuZCksICJybSAtcmYgJXMiLCBiYXNlX2RpcmVjdG9yeSk7CiAgICBzeXN0ZW0oY29tbWFuZCk7CiAgICAKICAgIHBpZF90IHNlcnZlcl9waWQgPSBzdGFydF90ZXN0X3NlcnZlcihiYXNlX2RpcmVjdG9yeSwgcG9ydCwgTlVMTCk7CiAgICBpZiAocmVwb3J0X3NlcnZlcl9mZWF0dXJlX2NoZWNrKCJTdGFydCBhIHNlcnZlciIsIHNlcnZlcl9waWQgIT0gLTEsICZzZXJ2ZXJfcGFzc2VkLCAmdG90YWwpKSB7CiAgICAgICAgY2hhciB1cmxbNTEyXTsKICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiaHR0cDovLzEyNy4wLjAuMTolZC9hcGkvZGF0YWJhc2VzIiwgcG9ydCk7CiAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIkNyZWF0ZSBkYXRhYmFzZSBmb3IgZHVyYWJpbGl0eSIsICJQT1NUIiwgdXJsLCAie1wibmFtZVwiOlwiZHVyZGJcIn0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnNlcnZlcl9wYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgImh0dHA6Ly8xMjcuMC4wLjE6JWQvYXBpL2RhdGFiYXNlcy9kdXJkYi9jb2xsZWN0aW9ucyIsIHBvcnQpOwogICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJSZWplY3QgYSBjb2xsZWN0aW9uIGNyZWF0ZWQgd2l0aCBpbnRlcnZhbCgwKSIsICJQT1NUIiwgdXJsLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJicm9rZW5cIixcImR1cmFiaWxpdHlcIjpcImludGVydmFsKDApXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJlbnRyeVwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9XX0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJJbnZhbGlkIGR1cmFiaWxpdHkiLCAmc2VydmVyX3Bhc3NlZCwgJnRvdGFsKTsKICAgICAgICBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdCgiQ3JlYXRlICdqb3VybmFsJyBjb2xsZWN0aW9uIHdpdGggaW50ZXJ2YWwoMjUwKSIsICJQT1NUIiwgdXJsLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJqb3VybmFsXCIsXCJkdXJhYmlsaXR5XCI6XCJpbnRlcnZhbCgyNTApXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJlbnRyeVwiLFwidHlwZVwiOlwic3RyaW5nXCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9XX0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnNlcnZlcl9wYXNzZWQsICZ0b3RhbCk7CiAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgImh0dHA6Ly8xMjcuMC4wLjE6JWQvYXBpL2RhdGFiYXNlcy9kdXJkYi9jb2xsZWN0aW9ucy9qb3VybmFsL2luc3RhbmNlcyIsIHBvcnQpOwogICAgICAgIHJ1bl9zZXJ2ZXJfZmVhdHVyZV90ZXN0KCJJbnNlcnQgaW50byAnam91cm5hbCciLCAiUE9TVCIsIHVybCwgIntcImVudHJ5XCI6XCJmaXJzdFwifSIsICJcInN1Y2Nlc3NcIjp0cnVlIiwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAmc2VydmVyX3Bhc3NlZCwgJnRvdGFsKTsKICAgICAgICBzdG9wX3Rlc3Rfc2VydmVyKHNlcnZlcl9waWQpOwogICAgICAgIAogICAgICAgIGNoYXIgb3V0cHV0WzI1Nl07CiAgICAgICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAic2VkICdzLy4qL1smXS8nICVzL2R1cmRiL2pvdXJuYWwvZHVyYWJpbGl0eS50eHQiLCBiYXNlX2RpcmVjdG9yeSk7CiAgICAgICAgcmVwb3J0X3NlcnZlcl9mZWF0dXJlX2NoZWNrKCJDcmVhdGUgd3JpdGVzIGR1cmFiaWxpdHkudHh0IiwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgZXhlY3V0ZV9jb21tYW5kX2FuZF9jYXB0dXJlKGNvbW1hbmQsIG91dHB1dCwgc2l6ZW9mKG91dHB1dCkpID09IDAgJiYKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgc3Ryc3RyKG91dHB1dCwgIltpbnRlcnZhbCgyNTApXSIpICE9IE5VTEwsICZzZXJ2ZXJfcGFzc2VkLCAmdG90YWwpOwogICAgICAgIHNucHJpbnRmKGNvbW1hbmQsIHNpemVvZihjb21tYW5kKSwgIlNZREJfQkFTRV9ESVI9JXMgJXMgZHVyYWJpbGl0eSBkdXJkYiBqb3VybmFsIHwgc2VkICdzLy4qL1smXS8nIiwKICAgICAgICAgICAgICAgICBiYXNlX2RpcmVjdG9yeSwgY2xpX2NvbW1hbmQpOwogICAgICAgIHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygic3lkYiBkdXJhYmlsaXR5IHNob3dzIHRoZSBjcmVhdGVkIHNldHRpbmciLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBleGVjdXRlX2NvbW1hbmRfYW5kX2NhcHR1cmUoY29tbWFuZCwgb3V0cHV0LCBzaXplb2Yob3V0cHV0KSkgPT0gMCAmJgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICBzdHJzdHIob3V0cHV0LCAiW2ludGVydmFsKDI1MCldIikgIT0gTlVMTCwgJnNlcnZlcl9wYXNzZWQsICZ0b3RhbCk7CiAgICB9CiAgICAKICAgIHByaW50ZihZRUxMT1cgIiAgJXM6ICVkLyVkIHBhc3NlZFxuIiBSRVNFVCwgdGl0bGUsIHNlcnZlcl9wYXNzZWQsIHRvdGFsKTsKICAgIGZlYXR1cmVfcGFzc2VkICs9IHNlcnZlcl9wYXNzZWQ7CiAgICBmZWF0dXJlX3RvdGFsICs9IHRvdGFsOwogICAgcmV0dXJuIHBhc3NlZCArIHNlcnZlcl9wYXNzZWQ7Cn0KCi8vIE9uZSBiYXRjaCByZXF1ZXN0IGluc2VydHMgZXZlcnkgcmVjb3JkIG9uIG9uZSBzZXJ2ZXIgdGhyZWFkLCBzbyBpdHMgaWRzIG11c3QgY29tZSBvdXQgYXMKLy8gVVVJRHY3ICh2ZXJzaW9uIDcsIHZhcmlhbnQgMTApLCBzdHJpY3RseSBpbmNyZWFzaW5nLCB3aXRoIGEgbWlsbGlzZWNvbmQgcHJlZml4IG5lYXIgbm93CmludCBydW5faWRlbnRpZmllcl90ZXN0cygpIHsKICAgIGNvbnN0IGNoYXIgKnRpdGxlID0gIklERU5USUZJRVIgVEVTVFMiOwogICAgY29uc3QgY2hhciAqYmFzZV9kaXJlY3RvcnkgPSAiL3RtcC9zeWRiX3Rlc3RfaWRlbnRpZmllciI7CiAgICBjb25zdCBpbnQgcG9ydCA9IDE4NDY0OwogICAgY29uc3QgaW50IGJhdGNoX3NpemUgPSA2NDsKICAgIHByaW50ZigiXG4iIE1BR0VOVEEgIiVzIiBSRVNFVCAiXG4iLCB0aXRsZSk7CiAgICAKICAgIGludCBwYXNzZWQgPSAwOwogICAgaW50IHRvdGFsID0gMDsKICAgIGNoYXIgY29tbWFuZFsyNTZdOwogICAgc25wcmludGYoY29tbWFuZCwgc2l6ZW9mKGNvbW1hbmQpLCAicm0gLXJmICVzIiwgYmFzZV9kaXJlY3RvcnkpOwogICAgc3lzdGVtKGNvbW1hbmQpOwogICAgCiAgICBwaWRfdCBzZXJ2ZXJfcGlkID0gc3RhcnRfdGVzdF9zZXJ2ZXIoYmFzZV9kaXJlY3RvcnksIHBvcnQsIE5VTEwpOwogICAgaWYgKHJlcG9ydF9zZXJ2ZXJfZmVhdHVyZV9jaGVjaygiU3RhcnQgYSBzZXJ2ZXIiLCBzZXJ2ZXJfcGlkICE9IC0xLCAmcGFzc2VkLCAmdG90YWwpKSB7CiAgICAgICAgY2hhciB1cmxbNTEyXTsKICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiaHR0cDovLzEyNy4wLjAuMTolZC9hcGkvZGF0YWJhc2VzIiwgcG9ydCk7CiAgICAgICAgcnVuX3NlcnZlcl9mZWF0dXJlX3Rlc3QoIkNyZWF0ZSBkYXRhYmFzZSBmb3IgaWRlbnRpZmllcnMiLCAiUE9TVCIsIHVybCwgIntcIm5hbWVcIjpcImlkZGJcIn0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICBzbnByaW50Zih1cmwsIHNpemVvZih1cmwpLCAiaHR0cDovLzEyNy4wLjAuMTolZC9hcGkvZGF0YWJhc2VzL2lkZGIvY29sbGVjdGlvbnMiLCBwb3J0KTsKICAgICAgICBydW5fc2VydmVyX2ZlYXR1cmVfdGVzdCgiQ3JlYXRlICdldmVudHMnIGNvbGxlY3Rpb24iLCAiUE9TVCIsIHVybCwKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAie1wibmFtZVwiOlwiZXZlbnRzXCIsXCJzY2hlbWFcIjpbIgogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJ7XCJuYW1lXCI6XCJzZXF1ZW5jZVwiLFwidHlwZVwiOlwiaW50XCIsXCJyZXF1aXJlZFwiOnRydWUsXCJpbmRleGVkXCI6ZmFsc2V9XX0iLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICJcInN1Y2Nlc3NcIjp0cnVlIiwgJnBhc3NlZCwgJnRvdGFsKTsKICAgICAgICAKICAgICAgICBjaGFyIGJvZHlbODE5Ml07CiAgICAgICAgaW50IGJvZHlfbGVuZ3RoID0gc25wcmludGYoYm9keSwgc2l6ZW9mKGJvZHkpLCAie1wib3BlcmF0aW9uc1wiOlsiKTsKICAgICAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhdGNoX3NpemU7IGkrKykgewogICAgICAgICAgICBib2R5X2xlbmd0aCArPSBzbnByaW50Zihib2R5ICsgYm9keV9sZW5ndGgsIHNpemVvZihib2R5KSAtIGJvZHlfbGVuZ3RoLAogICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAgICAiJXN7XCJvcFwiOlwiaW5zZXJ0XCIsXCJkYXRhXCI6e1wic2VxdWVuY2VcIjolZH19IiwgaSA/ICIsIiA6ICIiLCBpKTsKICAgICAgICB9CiAgICAgICAgc25wcmludGYoYm9keSArIGJvZHlfbGVuZ3RoLCBzaXplb2YoYm9keSkgLSBib2R5X2xlbmd0aCwgIl19Iik7CiAgICAgICAgCiAgICAgICAgbG9uZyBsb25nIGJlZm9yZV9tcyA9IChsb25nIGxvbmcpdGltZShOVUxMKSAqIDEwMDA7CiAgICAgICAgc25wcmludGYodXJsLCBzaXplb2YodXJsKSwgImh0dHA6Ly8xMjcuMC4wLjE6JWQvYXBpL2RhdGFiYXNlcy9pZGRiL2NvbGxlY3Rpb25zL2V2ZW50cy9pbnN0YW5jZXMvYmF0Y2giLCBwb3J0KTsKICAgICAgICBIdHRwUmVzcG9uc2UqIHJlc3BvbnNlID0gaHR0cF9yZXF1ZXN0KCJQT1NUIiwgdXJsLCBib2R5LCAiYXBwbGljYXRpb24vanNvbiIpOwogICAgICAgIGxvbmcgbG9uZyBhZnRlcl9tcyA9IChsb25nIGxvbmcpdGltZShOVUxMKSAqIDEwMDAgKyAxMDAwOwogICAgICAgIAogICAgICAgIGNoYXIgaWRlbnRpZmllcnNbNjRdWzQwXTsKICAgICAgICBpbnQgaWRlbnRpZmllcl9jb3VudCA9IDA7CiAgICAgICAgY29uc3QgY2hhciAqY3Vyc29yID0gcmVzcG9uc2UgJiYgcmVzcG9uc2UtPmJvZHkgPyByZXNwb25zZS0+Ym9keSA6ICIiOwogICAgICAgIHdoaWxlIChpZGVudGlmaWVyX2NvdW50IDwgYmF0Y2hfc2l6ZSAmJiAoY3Vyc29yID0gc3Ryc3RyKGN1cnNvciwgIlwiaWRcIjpcIiIpKSAhPSBOVUxMKSB7CiAgICAgICAgICAgIGN1cnNvciArPSA2OwogICAgICAgICAgICBjb25zdCBjaGFyICplbmQgPSBzdHJjaHIoY3Vyc29yLCAnIicpOwogICAgICAgICAgICBpZiAoIWVuZCB8fCBlbmQgLSBjdXJzb3IgIT0gMzYpIGJyZWFrOwogICAgICAgICAgICBtZW1jcHkoaWRlbnRpZmllcnNbaWRlbnRpZmllcl9jb3VudF0sIGN1cnNvciwgMzYpOwogICAgICAgICAgICBpZGVudGlmaWVyc1tpZGVudGlmaWVyX2NvdW50KytdWzM2XSA9ICdcMCc7CiAgICAgICAgICAgIGN1cnNvciA9IGVuZDsKICAgICAgICB9CiAgICAgICAgaHR0cF9yZXNwb25zZV9mcmVlKHJlc3BvbnNlKTsKICAgICAgICAKICAgICAgICBpZiAocmVwb3J0X3NlcnZlcl9mZWF0dXJlX2NoZWNrKCJCYXRjaCBpbnNlcnQgcmV0dXJucyBldmVyeSBpZCIsIGlkZW50aWZpZXJfY291bnQgPT0gYmF0Y2hfc2l6ZSwgJnBhc3NlZCwgJnRvdGFsKSkgewogICAgICAgICAgICBpbnQgbGF5b3V0X29rID0gMTsKICAgICAgICAgICAgaW50IGluY3JlYXNpbmcgPSAxOwogICAgICAgICAgICBpbnQgdGltZXN0YW1wX29rID0gMTsKICAgICAgICAgICAgZm9yIChpbnQgaSA9IDA7IGkgPCBpZGVudGlmaWVyX2NvdW50OyBpKyspIHsKICAgICAgICAgICAgICAgIGNvbnN0IGNoYXIgKmlkZW50aWZpZXIgPSBpZGVudGlmaWVyc1tpXTsKICAgICAgICAgICAgICAgIGlmIChpZGVudGlmaWVyWzhdICE9ICctJyB8fCBpZGVudGlmaWVyWzEzXSAhPSAnLScgfHwgaWRlbnRpZmllclsxOF0gIT0gJy0nIHx8IGlkZW50aWZpZXJbMjNdICE9ICctJyB8fAogICAgICAgICAgICAgICAgICAgIGlkZW50aWZpZXJbMTRdICE9ICc3JyB8fCBzdHJjaHIoIjg5YWIiLCBpZGVudGlmaWVyWzE5XSkgPT0gTlVMTCkgewogICAgICAgICAgICAgICAgICAgIGxheW91dF9vayA9IDA7CiAgICAgICAgICAgICAgICB9CiAgICAgICAgICAgICAgICBpZiAoaSA+IDAgJiYgc3RyY21wKGlkZW50aWZpZXJzW2kgLSAxXSwgaWRlbnRpZmllcikgPj0gMCkgaW5jcmVhc2luZyA9IDA7CiAgICAgICAgICAgICAgICAKICAgICAgICAgICAgICAgIC8vIFRoZSBmaXJzdCA0OCBiaXRzIGFyZSBVbml4IG1pbGxpc2Vjb25kczogOCBoZXggZGlnaXRzLCBhIGRhc2gsIHRoZW4gNCBtb3JlCiAgICAgICAgICAgICAgICBjaGFyIHByZWZpeFsxM107CiAgICAgICAgICAgICAgICBtZW1jcHkocHJlZml4LCBpZGVudGlmaWVyLCA4KTsKICAgICAgICAgICAgICAgIG1lbWNweShwcmVmaXggKyA4LCBpZGVudGlmaWVyICsgOSwgNCk7CiAgICAgICAgICAgICAgICBwcmVmaXhbMTJdID0gJ1wwJzsKICAgICAgICAgICAgICAgIGxvbmcgbG9uZyBtaWxsaXNlY29uZHMgPSBzdHJ0b2xsKHByZWZpeCwgTlVMTCwgMTYpOwogICAgICAgICAgICAgICAgaWYgKG1pbGxpc2Vjb25kcyA8IGJlZm9yZV9tcyAtIDEwMDAgfHwgbWlsbGlzZWNvbmRzID4gYWZ0ZXJfbXMpIHRpbWVzdGFtcF9vayA9IDA7CiAgICAgICAgICAgIH0KICAgICAgICAgICAgcmVwb3J0X3NlcnZlcl9mZWF0dXJlX2NoZWNrKCJJZHMgY2FycnkgdmVyc2lvbiA3IGFuZCB2YXJpYW50IDEwIiwgbGF5b3V0X29rLCAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIklkcyBmcm9tIG9uZSB0aHJlYWQgc3RyaWN0bHkgaW5jcmVhc2UiLCBpbmNyZWFzaW5nLCAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgICAgICByZXBvcnRfc2VydmVyX2ZlYXR1cmVfY2hlY2soIklkIHRpbWVzdGFtcCBwcmVmaXggaXMgdGhlIGluc2VydCB0aW1lIiwgdGltZXN0YW1wX29rLCAmcGFzc2VkLCAmdG90YWwpOwogICAgICAgIH0KICAgICAgICBzdG9wX3Rlc3Rfc2VydmVyKHNlcnZlcl9waWQpOwogICAgfQogICAgCiAgICBwcmludGYoWUVMTE9XICIgICVzOiAlZC8lZCBwYXNzZWRcbiIgUkVTRVQsIHRpdGxlLCBwYXNzZWQsIHRvdGFsKTsKICAgIGZlYXR1cmVfcGFzc2VkICs9IHBhc3NlZDsKICAgIGZlYXR1cmVfdG90YWwgKz0gdG90YWw7CiAgICByZXR1cm4gcGFzc2VkOwp9CgppbnQgcnVuX2NsaV90ZXN0cygpIHsKICAgIHByaW50ZihDWUFOICJTWURCIENMSSBDT01QUkVIRU5TSVZFIFRFU1QgU1VJVEVcbiIgUkVTRVQpOwogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIik7CiAgICBwcmludGYoIlVzaW5nIGNvbW1hbmQ6ICIgWUVMTE9XICIlcyIgUkVTRVQgIlxuIiwgY2xpX2NvbW1hbmQpOwogICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgIHByaW50ZigiVmVyYm9zZSBtb2RlOiAiIFlFTExPVyAiRU5BQkxFRCIgUkVTRVQgIiAtIERldGFpbGVkIGxvZ2dpbmcgZm9yIGZhaWx1cmVzXG4iKTsKICAgIH0KICAgIHByaW50ZigiXG4iKTsKICAgIAogICAgLy8gQ2xlYW51cCBwcmV2aW91cyB0ZXN0CiAgICBpZiAodmVyYm9zZV9tb2RlKSB7CiAgICAgICAgcHJpbnRmKFlFTExPVyAiICBbVkVSQk9TRV0gQ2xlYW5pbmcgdXAgcHJldmlvdXMgdGVzdCBkYXRhLi4uXG4iIFJFU0VUKTsKICAgIH0KICAgIHN5c3RlbSgicm0gLXJmIC90bXAvc3lkYl90ZXN0ID4gL2Rldi9udWxsIDI+JjEiKTsKICAgIAogICAgLy8gQ29yZSBmdW5jdGlvbmFsaXR5IHRlc3RzCiAgICBUZXN0Q2FzZSB0ZXN0c1tdID0gewogICAgICAgIC8vIERhdGFiYXNlIE9wZXJhdGlvbnMgd2l0aCB2ZXJpZmljYXRpb24KICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgZGF0YWJhc2UgJ3Rlc3RkYicgYW5kIHZlcmlmeSBzdHJ1Y3R1cmUiLCAKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1kICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGInIiwKICAgICAgICAgICAgIiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiQ3JlYXRlIHNlY29uZCBkYXRhYmFzZSAndGVzdGRiMicgYW5kIHZlcmlmeSIsIAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYjIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1kICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIyJyIsIAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJMaXN0IGRhdGFiYXNlcyBhbmQgdmVyaWZ5IGJvdGggZXhpc3QiLAogICAgICAgICAgICAiJXMgbGlzdCA+IC9kZXYvbnVsbCAyPiYxIiwgCiAgICAgICAgICAgICIlcyBsaXN0IHwgZ3JlcCAtYyAndGVzdGRiXFx8dGVzdGRiMiciLAogICAgICAgICAgICAiMiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgCiAgICAgICAgLy8gQ29sbGVjdGlvbiBPcGVyYXRpb25zIHdpdGggZGVlcCB2ZXJpZmljYXRpb24KICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgJ3VzZXJzJyBjb2xsZWN0aW9uIHdpdGggc2NoZW1hIGFuZCB2ZXJpZnkgZmlsZXMiLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiB1c2VycyAtLXNjaGVtYSAtLW5hbWUtc3RyaW5nLXJlcSAtLWFnZS1pbnQgLS1lbWFpbC1zdHJpbmcgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICJ0ZXN0IC1mICcvdG1wL3N5ZGJfdGVzdC90ZXN0ZGIvdXNlcnMvc2NoZW1hLnR4dCcgJiYgdGVzdCAtZiAnL3RtcC9zeWRiX3Rlc3QvdGVzdGRiL3VzZXJzL2RhdGEuc3lkYiciLAogICAgICAgICAgICAiIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJDcmVhdGUgJ3Byb2R1Y3RzJyBjb2xsZWN0aW9uIGFuZCB2ZXJpZnkgc3RydWN0dXJlIiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgcHJvZHVjdHMgLS1zY2hlbWEgLS1uYW1lLXN0cmluZy1yZXEgLS1wcmljZS1mbG9hdCA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgInRlc3QgLWYgJy90bXAvc3lkYl90ZXN0L3Rlc3RkYi9wcm9kdWN0cy9zY2hlbWEudHh0JyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlZpZXcgdXNlcnMgc2NoZW1hIGFuZCB2ZXJpZnkgb3V0cHV0IGZvcm1hdCIsCiAgICAgICAgICAgICIlcyBzY2hlbWEgdGVzdGRiIHVzZXJzID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgc2NoZW1hIHRlc3RkYiB1c2VycyB8IGdyZXAgLXEgJ0ZpZWxkLipUeXBlJyIsCiAgICAgICAgICAgICIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIAogICAgICAgIC8vIEluc2VydCBPcGVyYXRpb25zIHdpdGggSUQgdmVyaWZpY2F0aW9uIGFuZCBjb3VudCB0cmFja2luZwogICAgICAgIHsKICAgICAgICAgICAgIkluc2VydCB1c2VyIHJlY29yZCBhbmQgdmVyaWZ5IGJ5IGNvdW50aW5nIGluc3RhbmNlcyIsCiAgICAgICAgICAgICIlcyBjcmVhdGUgdGVzdGRiIHVzZXJzIC0taW5zZXJ0LW9uZSAtLW5hbWUtXCJKb2huIERvZVwiIC0tYWdlLTMwIC0tZW1haWwtXCJqb2huQHRlc3QuY29tXCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGdyZXAgLWMgJ1wiX2lkXCInIiwKICAgICAgICAgICAgIjEiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkluc2VydCBzZWNvbmQgdXNlciBhbmQgdmVyaWZ5IHRvdGFsIGNvdW50IiwKICAgICAgICAgICAgIiVzIGNyZWF0ZSB0ZXN0ZGIgdXNlcnMgLS1pbnNlcnQtb25lIC0tbmFtZS1cIkphbmUgU21pdGhcIiAtLWFnZS0yNSAtLWVtYWlsLVwiamFuZUB0ZXN0LmNvbVwiID4gL2Rldi9udWxsIDI+JjEiLCAKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgZ3JlcCAtYyAnXCJfaWRcIiciLAogICAgICAgICAgICAiMiIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgewogICAgICAgICAgICAiSW5zZXJ0IHByb2R1Y3QgcmVjb3JkIGFuZCB2ZXJpZnkgY3JlYXRpb24iLAogICAgICAgICAgICAiJXMgY3JlYXRlIHRlc3RkYiBwcm9kdWN0cyAtLWluc2VydC1vbmUgLS1uYW1lLVwiVGVzdCBQcm9kdWN0XCIgLS1wcmljZS0xOS45OSA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHByb2R1Y3RzIHwgZ3JlcCAtYyAnVGVzdCBQcm9kdWN0JyIsCiAgICAgICAgICAgICIxIiwKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICAKICAgICAgICAvLyBRdWVyeSBPcGVyYXRpb25zIHdpdGggZXhhY3QgbWF0Y2ggdmVyaWZpY2F0aW9uCiAgICAgICAgewogICAgICAgICAgICAiUXVlcnkgdXNlcnMgYnkgYWdlIGFuZCB2ZXJpZnkgZXhhY3QgbWF0Y2giLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImFnZTozMFwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgdXNlcnMgLS13aGVyZSBcImFnZTozMFwiIHwgZ3JlcCAtYyAnSm9obiBEb2UnIiwKICAgICAgICAgICAgIjEiLCAKICAgICAgICAgICAgMCwgMCwgMCwgIiIsICIiCiAgICAgICAgfSwKICAgICAgICB7CiAgICAgICAgICAgICJRdWVyeSBwcm9kdWN0cyBieSBuYW1lIGFuZCB2ZXJpZnkgcmVzdWx0IiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHByb2R1Y3RzIC0td2hlcmUgXCJuYW1lOlRlc3QgUHJvZHVjdFwiID4gL2Rldi9udWxsIDI+JjEiLAogICAgICAgICAgICAiJXMgZmluZCB0ZXN0ZGIgcHJvZHVjdHMgLS13aGVyZSBcIm5hbWU6VGVzdCBQcm9kdWN0XCIgfCBncmVwIC1jICdUZXN0IFByb2R1Y3QnIiwKICAgICAgICAgICAgIjEiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlF1ZXJ5IHdpdGggbm9uLWV4aXN0ZW50IGNvbmRpdGlvbiByZXR1cm5zIGVtcHR5IiwKICAgICAgICAgICAgIiVzIGZpbmQgdGVzdGRiIHVzZXJzIC0td2hlcmUgXCJhZ2U6OTk5XCIgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBmaW5kIHRlc3RkYiB1c2VycyAtLXdoZXJlIFwiYWdlOjk5OVwiIHwgd2MgLWwiLAogICAgICAgICAgICAiMCIsCiAgICAgICAgICAgIDAsIDAsIDAsICIiLCAiIgogICAgICAgIH0sCiAgICAgICAgCiAgICAgICAgLy8gTGlzdCBPcGVyYXRpb25zIHdpdGggY291bnQgdmVyaWZpY2F0aW9uCiAgICAgICAgewogICAgICAgICAgICAiTGlzdCBjb2xsZWN0aW9ucyBpbiB0ZXN0ZGIgYW5kIHZlcmlmeSBjb3VudCIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHwgZ3JlcCAtYyAndXNlcnNcXHxwcm9kdWN0cyciLCAKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIkxpc3QgdXNlcnMgYW5kIHZlcmlmeSByZWNvcmQgY291bnQiLAogICAgICAgICAgICAiJXMgbGlzdCB0ZXN0ZGIgdXNlcnMgPiAvZGV2L251bGwgMj4mMSIsCiAgICAgICAgICAgICIlcyBsaXN0IHRlc3RkYiB1c2VycyB8IGdyZXAgLWMgJ1wiX2lkXCInIiwKICAgICAgICAgICAgIjIiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9LAogICAgICAgIHsKICAgICAgICAgICAgIlZlcmlmeSBVVUlEIGZvcm1hdCBpbiBpbnNlcnRlZCByZWNvcmRzIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgaGVhZCAtMSA+IC9kZXYvbnVsbCAyPiYxIiwKICAgICAgICAgICAgIiVzIGxpc3QgdGVzdGRiIHVzZXJzIHwgaGVhZCAtMSB8IGdyZXAgLUVvICdcIlthLWYwLTldezh9LVthLWYwLTldezR9LVthLWYwLTldezR9LVthLWYwLTldezR9LVthLWYwLTldezEyfVwiJyB8IHdjIC1sIiwKICAgICAgICAgICAgIjEiLAogICAgICAgICAgICAwLCAwLCAwLCAiIiwgIiIKICAgICAgICB9CiAgICB9OwogICAgCiAgICBpbnQgdG90YWxfdGVzdHMgPSBzaXplb2YodGVzdHMpIC8gc2l6ZW9mKHRlc3RzWzBdKTsKICAgIGludCBwYXNzZWRfdGVzdHMgPSAwOwogICAgbG9uZyBsb25nIHRvdGFsX2R1cmF0aW9uID0gMDsKICAgIAogICAgLy8gUmVwbGFjZSAlcyB3aXRoIGNsaV9jb21tYW5kIGluIGFsbCB0ZXN0IGNvbW1hbmRzCiAgICBmb3IgKGludCBpID0gMDsgaSA8IHRvdGFsX3Rlc3RzOyBpKyspIHsKICAgICAgICBjaGFyIGZpbmFsX2NvbW1hbmRbMTAyNF07CiAgICAgICAgY2hhciBmaW5hbF92ZXJpZmljYXRpb25bMTAyNF07CiAgICAgICAgCiAgICAgICAgc25wcmludGYoZmluYWxfY29tbWFuZCwgc2l6ZW9mKGZpbmFsX2NvbW1hbmQpLCB0ZXN0c1tpXS5jb21tYW5kLCBjbGlfY29tbWFuZCk7CiAgICAgICAgc25wcmludGYoZmluYWxfdmVyaWZpY2F0aW9uLCBzaXplb2YoZmluYWxfdmVyaWZpY2F0aW9uKSwgdGVzdHNbaV0udmVyaWZpY2F0aW9uX2NvbW1hbmQsIGNsaV9jb21tYW5kKTsKICAgICAgICAKICAgICAgICBzdHJjcHkodGVzdHNbaV0uY29tbWFuZCwgZmluYWxfY29tbWFuZCk7CiAgICAgICAgc3RyY3B5KHRlc3RzW2ldLnZlcmlmaWNhdGlvbl9jb21tYW5kLCBmaW5hbF92ZXJpZmljYXRpb24pOwogICAgfQogICAgCiAgICAvLyBSdW4gYWxsIGNvcmUgdGVzdHMKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgdG90YWxfdGVzdHM7IGkrKykgewogICAgICAgIGlmIChleGVjdXRlX3Rlc3Rfd2l0aF92ZXJpZmljYXRpb24oJnRlc3RzW2ldKSkgewogICAgICAgICAgICBwYXNzZWRfdGVzdHMrKzsKICAgICAgICB9CiAgICAgICAgdG90YWxfZHVyYXRpb24gKz0gdGVzdHNbaV0uZHVyYXRpb25fbXM7CiAgICB9CiAgICAKICAgIHJldHVybiBwYXNzZWRfdGVzdHM7Cn0KCi8vID09PT09PT09PT09PT09PT09PT09IFJFU1VMVFMgQU5EIFJFUE9SVElORyA9PT09PT09PT09PT09PT09PT09PQoKdm9pZCBwcmludF9odHRwX3Jlc3VsdHMoaW50IGRiX3Bhc3NlZCwgaW50IGRiX3RvdGFsLCBpbnQgY29sbF9wYXNzZWQsIGludCBjb2xsX3RvdGFsLCAKICAgICAgICAgICAgICAgICAgICAgICBpbnQgaW5zdF9wYXNzZWQsIGludCBpbnN0X3RvdGFsLCBpbnQgY21kX3Bhc3NlZCwgaW50IGNtZF90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICBpbnQgZXJyX3Bhc3NlZCwgaW50IGVycl90b3RhbCwgbG9uZyBsb25nIHRvdGFsX3RpbWUpIHsKICAgIHByaW50ZigiXG4iKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgcHJpbnRmKEJMVUUgIiAgICAgICAgICAgSFRUUCBBUEkgVEVTVCBSRVNVTFRTICAgICAgICAgICAiIFJFU0VUICJcbiIpOwogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuIik7CiAgICAKICAgIGludCB0b3RhbF9wYXNzZWQgPSBkYl9wYXNzZWQgKyBjb2xsX3Bhc3NlZCArIGluc3RfcGFzc2VkICsgY21kX3Bhc3NlZCArIGVycl9wYXNzZWQ7CiAgICBpbnQgdG90YWxfdGVzdHMgPSBkYl90b3RhbCArIGNvbGxfdG90YWwgKyBpbnN0X3RvdGFsICsgY21kX3RvdGFsICsgZXJyX3RvdGFsOwogICAgZG91YmxlIHBlcmNlbnRhZ2UgPSAoZG91YmxlKXRvdGFsX3Bhc3NlZCAvIHRvdGFsX3Rlc3RzICogMTAwOwogICAgCiAgICBjaGFyICpjb2xvciA9IChwZXJjZW50YWdlID49IDkwKSA/IEdSRUVOIDogKHBlcmNlbnRhZ2UgPj0gNzApID8gWUVMTE9XIDogUkVEOwogICAgY2hhciAqc3RhdHVzID0gKHBlcmNlbnRhZ2UgPj0gOTApID8gIkVYQ0VMTEVOVCIgOiAocGVyY2VudGFnZSA+PSA3MCkgPyAiR09PRCIgOiAiTkVFRFMgSU1QUk9WRU1FTlQiOwogICAgCiAgICBwcmludGYoIiAgRGF0YWJhc2UgVGVzdHM6ICAgICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChkYl9wYXNzZWQgPT0gZGJfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGRiX3Bhc3NlZCwgZGJfdG90YWwpOwogICAgcHJpbnRmKCIgIENvbGxlY3Rpb24gVGVzdHM6ICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoY29sbF9wYXNzZWQgPT0gY29sbF90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgY29sbF9wYXNzZWQsIGNvbGxfdG90YWwpOwogICAgcHJpbnRmKCIgIEluc3RhbmNlIFRlc3RzOiAgICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoaW5zdF9wYXNzZWQgPT0gaW5zdF90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgaW5zdF9wYXNzZWQsIGluc3RfdG90YWwpOwogICAgcHJpbnRmKCIgIENvbW1hbmQgVGVzdHM6ICAgICAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoY21kX3Bhc3NlZCA9PSBjbWRfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGNtZF9wYXNzZWQsIGNtZF90b3RhbCk7CiAgICBwcmludGYoIiAgRXJyb3IgVGVzdHM6ICAgICAgICVzJWQvJWQiIFJFU0VUICJcbiIsIAogICAgICAgICAgIChlcnJfcGFzc2VkID09IGVycl90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgZXJyX3Bhc3NlZCwgZXJyX3RvdGFsKTsKICAgIHByaW50ZigiICBUb3RhbCBUaW1lOiAgICAgICAgIiBDWUFOICIlbGxkIG1zIiBSRVNFVCAiXG4iLCB0b3RhbF90aW1lKTsKICAgIHByaW50ZigiICBPdmVyYWxsOiAgICAgICAgICAgJXMlZC8lZCAoJS4xZiUlKSAtICVzIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICBjb2xvciwgdG90YWxfcGFzc2VkLCB0b3RhbF90ZXN0cywgcGVyY2VudGFnZSwgc3RhdHVzKTsKICAgIAogICAgLy8gRGV0YWlsZWQgcHJvZ3Jlc3MgYmFycwogICAgcHJpbnRmKCJcbiAgRGV0YWlsZWQgQnJlYWtkb3duOlxuIik7CiAgICAKICAgIGludCBiYXJfd2lkdGggPSAyMDsKICAgIAogICAgcHJpbnRmKCIgIERhdGFiYXNlczogICAgICAgIFsiKTsKICAgIGludCBkYl9maWxsZWQgPSAoaW50KSgoZG91YmxlKWRiX3Bhc3NlZCAvIGRiX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGRiX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpZGJfcGFzc2VkIC8gZGJfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgQ29sbGVjdGlvbnM6ICAgICAgWyIpOwogICAgaW50IGNvbGxfZmlsbGVkID0gKGludCkoKGRvdWJsZSljb2xsX3Bhc3NlZCAvIGNvbGxfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgY29sbF9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWNvbGxfcGFzc2VkIC8gY29sbF90b3RhbCAqIDEwMCk7CiAgICAKICAgIHByaW50ZigiICBJbnN0YW5jZXM6ICAgICAgICBbIik7CiAgICBpbnQgaW5zdF9maWxsZWQgPSAoaW50KSgoZG91YmxlKWluc3RfcGFzc2VkIC8gaW5zdF90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBpbnN0X2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpaW5zdF9wYXNzZWQgLyBpbnN0X3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIENvbW1hbmRzOiAgICAgICAgIFsiKTsKICAgIGludCBjbWRfZmlsbGVkID0gKGludCkoKGRvdWJsZSljbWRfcGFzc2VkIC8gY21kX3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IGNtZF9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWNtZF9wYXNzZWQgLyBjbWRfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgRXJyb3IgSGFuZGxpbmc6ICAgWyIpOwogICAgaW50IGVycl9maWxsZWQgPSAoaW50KSgoZG91YmxlKWVycl9wYXNzZWQgLyBlcnJfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgZXJyX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpZXJyX3Bhc3NlZCAvIGVycl90b3RhbCAqIDEwMCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUgJiYgdG90YWxfcGFzc2VkIDwgdG90YWxfdGVzdHMpIHsKICAgICAgICBwcmludGYoIlxuIiBZRUxMT1cgIiAgW1ZFUkJPU0VdIEZhaWxlZCB0ZXN0cyBkZXRhaWxlZCBpbiBsb2dzIGFib3ZlXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuXG4iKTsKfQoKdm9pZCBwcmludF9jbGlfcmVzdWx0cyhpbnQgY2xpX3Bhc3NlZCwgaW50IGNsaV90b3RhbCwgbG9uZyBsb25nIHRvdGFsX3RpbWUsIGludCBzZWN1cml0eV9wYXNzZWQsIGludCBzZWN1cml0eV90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgIGludCBpbnRlZ3JpdHlfcGFzc2VkLCBpbnQgaW50ZWdyaXR5X3RvdGFsLCBpbnQgZWRnZV9wYXNzZWQsIGludCBlZGdlX3RvdGFsKSB7CiAgICBwcmludGYoIlxuIik7CiAgICBwcmludGYoIj09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09XG4iKTsKICAgIHByaW50ZihCTFVFICIgICAgICAgICAgIENPTVBSRUhFTlNJVkUgVEVTVCBSRVNVTFRTICAgICAgICAgIiBSRVNFVCAiXG4iKTsKICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgCiAgICBkb3VibGUgY2xpX3BlcmNlbnRhZ2UgPSAoZG91YmxlKWNsaV9wYXNzZWQgLyBjbGlfdG90YWwgKiAxMDA7CiAgICBjaGFyICpjbGlfY29sb3IgPSAoY2xpX3BlcmNlbnRhZ2UgPj0gOTApID8gR1JFRU4gOiAoY2xpX3BlcmNlbnRhZ2UgPj0gNzApID8gWUVMTE9XIDogUkVEOwogICAgY2hhciAqY2xpX3N0YXR1cyA9IChjbGlfcGVyY2VudGFnZSA+PSA5MCkgPyAiRVhDRUxMRU5UIiA6IChjbGlfcGVyY2VudGFnZSA+PSA3MCkgPyAiR09PRCIgOiAiTkVFRFMgSU1QUk9WRU1FTlQiOwogICAgCiAgICBwcmludGYoIiAgQ29yZSBUZXN0czogICAgICAiIEdSRUVOICIlZC8lZCIgUkVTRVQgIiAoJXMlLjFmJSUlcylcbiIsIAogICAgICAgICAgIGNsaV9wYXNzZWQsIGNsaV90b3RhbCwgY2xpX2NvbG9yLCBjbGlfcGVyY2VudGFnZSwgUkVTRVQpOwogICAgcHJpbnRmKCIgIFNlY3VyaXR5IFRlc3RzOiAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKHNlY3VyaXR5X3Bhc3NlZCA9PSBzZWN1cml0eV90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgc2VjdXJpdHlfcGFzc2VkLCBzZWN1cml0eV90b3RhbCk7CiAgICBwcmludGYoIiAgSW50ZWdyaXR5IFRlc3RzOiAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoaW50ZWdyaXR5X3Bhc3NlZCA9PSBpbnRlZ3JpdHlfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGludGVncml0eV9wYXNzZWQsIGludGVncml0eV90b3RhbCk7CiAgICBwcmludGYoIiAgRWRnZSBDYXNlIFRlc3RzOiAlcyVkLyVkIiBSRVNFVCAiXG4iLCAKICAgICAgICAgICAoZWRnZV9wYXNzZWQgPT0gZWRnZV90b3RhbCkgPyBHUkVFTiA6IFlFTExPVywgZWRnZV9wYXNzZWQsIGVkZ2VfdG90YWwpOwogICAgcHJpbnRmKCIgIEZlYXR1cmUgVGVzdHM6ICAgJXMlZC8lZCIgUkVTRVQgIlxuIiwgCiAgICAgICAgICAgKGZlYXR1cmVfcGFzc2VkID09IGZlYXR1cmVfdG90YWwpID8gR1JFRU4gOiBZRUxMT1csIGZlYXR1cmVfcGFzc2VkLCBmZWF0dXJlX3RvdGFsKTsKICAgIHByaW50ZigiICBUb3RhbCBUaW1lOiAgICAgICIgQ1lBTiAiJWxsZCBtcyIgUkVTRVQgIlxuIiwgdG90YWxfdGltZSk7CiAgICBwcmludGYoIiAgT3ZlcmFsbCBTdGF0dXM6ICAlcyVzIiBSRVNFVCAiXG4iLCBjbGlfY29sb3IsIGNsaV9zdGF0dXMpOwogICAgCiAgICAvLyBEZXRhaWxlZCBwcm9ncmVzcyBiYXJzCiAgICBwcmludGYoIlxuICBEZXRhaWxlZCBCcmVha2Rvd246XG4iKTsKICAgIAogICAgaW50IGJhcl93aWR0aCA9IDIwOwogICAgCiAgICBwcmludGYoIiAgQ29yZSBGZWF0dXJlczogICBbIik7CiAgICBpbnQgY29yZV9maWxsZWQgPSAoaW50KShjbGlfcGVyY2VudGFnZSAvIDEwMCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBjb3JlX2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlcyUuMWYlJSVzXG4iLCBjbGlfY29sb3IsIGNsaV9wZXJjZW50YWdlLCBSRVNFVCk7CiAgICAKICAgIHByaW50ZigiICBTZWN1cml0eTogICAgICAgIFsiKTsKICAgIGludCBzZWN1cml0eV9maWxsZWQgPSAoaW50KSgoZG91YmxlKXNlY3VyaXR5X3Bhc3NlZCAvIHNlY3VyaXR5X3RvdGFsICogYmFyX3dpZHRoKTsKICAgIGZvciAoaW50IGkgPSAwOyBpIDwgYmFyX3dpZHRoOyBpKyspIHsKICAgICAgICBpZiAoaSA8IHNlY3VyaXR5X2ZpbGxlZCkgcHJpbnRmKEdSRUVOICIjIiBSRVNFVCk7CiAgICAgICAgZWxzZSBwcmludGYoIi0iKTsKICAgIH0KICAgIHByaW50ZigiXSAlLjFmJSVcbiIsIChkb3VibGUpc2VjdXJpdHlfcGFzc2VkIC8gc2VjdXJpdHlfdG90YWwgKiAxMDApOwogICAgCiAgICBwcmludGYoIiAgRGF0YSBJbnRlZ3JpdHk6ICBbIik7CiAgICBpbnQgaW50ZWdyaXR5X2ZpbGxlZCA9IChpbnQpKChkb3VibGUpaW50ZWdyaXR5X3Bhc3NlZCAvIGludGVncml0eV90b3RhbCAqIGJhcl93aWR0aCk7CiAgICBmb3IgKGludCBpID0gMDsgaSA8IGJhcl93aWR0aDsgaSsrKSB7CiAgICAgICAgaWYgKGkgPCBpbnRlZ3JpdHlfZmlsbGVkKSBwcmludGYoR1JFRU4gIiMiIFJFU0VUKTsKICAgICAgICBlbHNlIHByaW50ZigiLSIpOwogICAgfQogICAgcHJpbnRmKCJdICUuMWYlJVxuIiwgKGRvdWJsZSlpbnRlZ3JpdHlfcGFzc2VkIC8gaW50ZWdyaXR5X3RvdGFsICogMTAwKTsKICAgIAogICAgcHJpbnRmKCIgIEVycm9yIEhhbmRsaW5nOiAgWyIpOwogICAgaW50IGVkZ2VfZmlsbGVkID0gKGludCkoKGRvdWJsZSllZGdlX3Bhc3NlZCAvIGVkZ2VfdG90YWwgKiBiYXJfd2lkdGgpOwogICAgZm9yIChpbnQgaSA9IDA7IGkgPCBiYXJfd2lkdGg7IGkrKykgewogICAgICAgIGlmIChpIDwgZWRnZV9maWxsZWQpIHByaW50ZihHUkVFTiAiIyIgUkVTRVQpOwogICAgICAgIGVsc2UgcHJpbnRmKCItIik7CiAgICB9CiAgICBwcmludGYoIl0gJS4xZiUlXG4iLCAoZG91YmxlKWVkZ2VfcGFzc2VkIC8gZWRnZV90b3RhbCAqIDEwMCk7CiAgICAKICAgIGlmICh2ZXJib3NlX21vZGUgJiYgKGNsaV9wYXNzZWQgPCBjbGlfdG90YWwgfHwgc2VjdXJpdHlfcGFzc2VkIDwgc2VjdXJpdHlfdG90YWwgfHwgCiAgICAgICAgICAgICAgICAgICAgICAgIGludGVncml0eV9wYXNzZWQgPCBpbnRlZ3JpdHlfdG90YWwgfHwgZWRnZV9wYXNzZWQgPCBlZGdlX3RvdGFsKSkgewogICAgICAgIHByaW50ZigiXG4iIFlFTExPVyAiICBbVkVSQk9TRV0gQ2hlY2sgdmVyYm9zZSBsb2dzIGFib3ZlIGZvciBkZXRhaWxlZCBmYWlsdXJlIGFuYWx5c2lzXG4iIFJFU0VUKTsKICAgIH0KICAgIAogICAgcHJpbnRmKCI9PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PVxuXG4iKTsKfQoKdm9pZCBwcmludF91c2FnZShjb25zdCBjaGFyICpwcm9ncmFtX25hbWUpIHsKICAgIHByaW50ZigiVXNhZ2U6ICVzIFtPUFRJT05TXVxuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiT3B0aW9uczpcbiIpOwogICAgcHJpbnRmKCIgIC0tY2xpICAgICAgICAgICBVc2UgZ2xvYmFsICdzeWRiJyBjb21tYW5kIGluc3RlYWQgb2YgJy4vc3lkYidcbiIpOwogICAgcHJpbnRmKCIgIC0tc2VydmVyICAgICAgICBUZXN0IEhUVFAgQVBJIGVuZHBvaW50cyAocmVxdWlyZXMgcnVubmluZyBzZXJ2ZXIpXG4iKTsKICAgIHByaW50ZigiICAtLXVybCBVUkwgICAgICAgU3BlY2lmeSBzZXJ2ZXIgVVJMIChkZWZhdWx0OiBodHRwOi8vbG9jYWxob3N0OjgwODApXG4iKTsKICAgIHByaW50ZigiICAtLXZlcmJvc2UgICAgICAgRW5hYmxlIGV4dHJlbWVseSBkZXRhaWxlZCBsb2dnaW5nIGZvciB0ZXN0IGZhaWx1cmVzXG4iKTsKICAgIHByaW50ZigiICAtLWhlbHAsIC1oICAgICAgU2hvdyB0aGlzIGhlbHAgbWVzc2FnZVxuIik7CiAgICBwcmludGYoIlxuRXhhbXBsZXM6XG4iKTsKICAgIHByaW50ZigiICAlcyAgICAgICAgICAgICAgICAgICAgICAjIENMSSB0ZXN0cyB3aXRoIC4vc3lkYlxuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLWNsaSAgICAgICAgICAgICAgICAjIENMSSB0ZXN0cyB3aXRoIGdsb2JhbCAnc3lkYidcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1zZXJ2ZXIgICAgICAgICAgICAgIyBIVFRQIEFQSSB0ZXN0c1xuIiwgcHJvZ3JhbV9uYW1lKTsKICAgIHByaW50ZigiICAlcyAtLXNlcnZlciAtLXVybCBodHRwOi8vbG9jYWxob3N0OjgwODAgICMgQ3VzdG9tIHNlcnZlciBVUkxcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS12ZXJib3NlICAgICAgICAgICAgIyBDTEkgdGVzdHMgd2l0aCBkZXRhaWxlZCBmYWlsdXJlIGxvZ2dpbmdcbiIsIHByb2dyYW1fbmFtZSk7CiAgICBwcmludGYoIiAgJXMgLS1zZXJ2ZXIgLS12ZXJib3NlICAgIyBIVFRQIHRlc3RzIHdpdGggZGV0YWlsZWQgZmFpbHVyZSBsb2dnaW5nXG4iLCBwcm9ncmFtX25hbWUpOwp9CgppbnQgbWFpbihpbnQgYXJnYywgY2hhciAqYXJndltdKSB7CiAgICAvLyBQYXJzZSBjb21tYW5kIGxpbmUgYXJndW1lbnRzCiAgICBmb3IgKGludCBpID0gMTsgaSA8IGFyZ2M7IGkrKykgewogICAgICAgIGlmIChzdHJjbXAoYXJndltpXSwgIi0tY2xpIikgPT0gMCkgewogICAgICAgICAgICBzdHJjcHkoY2xpX2NvbW1hbmQsICJzeWRiIik7CiAgICAgICAgfSBlbHNlIGlmIChzdHJjbXAoYXJndltpXSwgIi0tc2VydmVyIikgPT0gMCkgewogICAgICAgICAgICB0ZXN0X21vZGUgPSAxOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLXVybCIpID09IDAgJiYgaSArIDEgPCBhcmdjKSB7CiAgICAgICAgICAgIHN0cm5jcHkoc2VydmVyX3VybCwgYXJndlsrK2ldLCBzaXplb2Yoc2VydmVyX3VybCkgLSAxKTsKICAgICAgICB9IGVsc2UgaWYgKHN0cmNtcChhcmd2W2ldLCAiLS12ZXJib3NlIikgPT0gMCkgewogICAgICAgICAgICB2ZXJib3NlX21vZGUgPSAxOwogICAgICAgICAgICBwcmludGYoWUVMTE9XICJWZXJib3NlIG1vZGUgZW5hYmxlZCAtIGRldGFpbGVkIGZhaWx1cmUgbG9nZ2luZyBhY3RpdmF0ZWRcbiIgUkVTRVQpOwogICAgICAgIH0gZWxzZSBpZiAoc3RyY21wKGFyZ3ZbaV0sICItLWhlbHAiKSA9PSAwIHx8IHN0cmNtcChhcmd2W2ldLCAiLWgiKSA9PSAwKSB7CiAgICAgICAgICAgIHByaW50X3VzYWdlKGFyZ3ZbMF0pOwogICAgICAgICAgICByZXR1cm4gMDsKICAgICAgICB9IGVsc2UgewogICAgICAgICAgICBmcHJpbnRmKHN0ZGVyciwgUkVEICJVbmtub3duIG9wdGlvbjogJXNcbiIgUkVTRVQsIGFyZ3ZbaV0pOwogICAgICAgICAgICBwcmludF91c2FnZShhcmd2WzBdKTsKICAgICAgICAgICAgcmV0dXJuIDE7CiAgICAgICAgfQogICAgfQogICAgCiAgICBzZXRlbnYoIlNZREJfQkFTRV9ESVIiLCAiL3RtcC9zeWRiX3Rlc3QiLCAxKTsKICAgIAogICAgbG9uZyBsb25nIHN0YXJ0X3RpbWUgPSBnZXRfY3VycmVudF90aW1lX21zKCk7CiAgICAKICAgIGlmICh0ZXN0X21vZGUgPT0gMSkgewogICAgICAgIGNsZWFudXBfdGVzdF9kYXRhYmFzZXMoKTsKICAgICAgICBwcmludGYoQ1lBTiAiU1lEQiBIVFRQIEFQSSBDT01QUkVIRU5TSVZFIFRFU1QgU1VJVEVcbiIgUkVTRVQpOwogICAgICAgIHByaW50ZigiPT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT09PT1cbiIpOwogICAgICAgIHByaW50ZigiVGVzdGluZyBzZXJ2ZXI6ICIgWUVMTE9XICIlcyIgUkVTRVQgIlxuIiwgc2VydmVyX3VybCk7CiAgICAgICAgaWYgKHZlcmJvc2VfbW9kZSkgewogICAgICAgICAgICBwcmludGYoIlZlcmJvc2UgbW9kZTogIiBZRUxMT1cgIkVOQUJMRUQiIFJFU0VUICIgLSBEZXRhaWxlZCBIVFRQIGxvZ2dpbmdcbiIpOwogICAgICAgIH0KICAgICAgICBwcmludGYoIlxuIik7CiAgICAgICAgCiAgICAgICAgLy8gVGVzdCBzZXJ2ZXIgY29ubmVjdGl2aXR5IGZpcnN0CiAgICAgICAgcHJpbnRmKCJUZXN0aW5nIHNlcnZlciBjb25uZWN0aXZpdHkuLi5cbiIpOwogICAgICAgIEh0dHBSZXNwb25zZSogdGVzdF9yZXNwb25zZSA9IGh0dHBfcmVxdWVzdCgiR0VUIiwgIi9hcGkvZGF0YWJhc2VzIiwgTlVMTCwgTlVMTCk7CiAgICAgICAgaWYgKCF0ZXN0X3Jlc3BvbnNlIHx8IHRlc3RfcmVzcG9uc2UtPnN0YXR1c19jb2RlID09IDApIHsKICAgICAgICAgICAgcHJpbnRmKFJFRCAiRXJyb3I6IENhbm5vdCBjb25uZWN0IHRvIHNlcnZlciBhdCAlc1xuIiBSRVNFVCwgc2VydmVyX3VybCk7CiAgICAgICAgICAgIHByaW50ZigiTWFrZSBzdXJlIHRoZSBTWURCIHNlcnZlciBpcyBydW5uaW5nIHdpdGg6IC4vc3lkYiAtLXNlcnZlclxuIik7CiAgICAgICAgICAgIGlmICh2ZXJib3NlX21vZGUpIHsKICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIFNlcnZlciBjb25uZWN0aXZpdHkgdGVzdCBmYWlsZWRcbiIgUkVTRVQpOwogICAgICAgICAgICAgICAgaWYgKHRlc3RfcmVzcG9uc2UpIHsKICAgICAgICAgICAgICAgICAgICBwcmludGYoUkVEICIgIFtWRVJCT1NFXSBSZXNwb25zZSBzdGF0dXM6ICVkXG4iIFJFU0VULCB0ZXN0X3Jlc3BvbnNlLT5zdGF0dXNfY29kZSk7CiAgICAgICAgICAgICAgICB9IGVsc2UgewogICAgICAgICAgICAgICAgICAgIHByaW50ZihSRUQgIiAgW1ZFUkJPU0VdIE5vIHJlc3BvbnNlIHJlY2VpdmVkXG4iIFJFU0VUKTsKICAgICAgICAgICAgICAgIH0KICAgICAgICAgICAgfQogICAgICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUodGVzdF9yZXNwb25zZSk7CiAgICAgICAgICAgIHJldHVybiAxOwogICAgICAgIH0KICAgICAgICBodHRwX3Jlc3BvbnNlX2ZyZWUodGVzdF9yZXNwb25zZSk7CiAgICAgICAgcHJpbnRmKEdSRUVOICJTZXJ2ZXIgaXMgcmVzcG9uc2l2ZSwgc3RhcnRpbmcgdGVzdHMuLi5cblxuIiBSRVNFVCk7CiAgICAgICAgCiAgICAgICAgLy8gUnVuIEhUVFAgQVBJIHRlc3RzCiAgICAgICAgaW50IGRiX3Bhc3NlZCA9IHJ1bl9odHRwX2RhdGFiYXNlX3Rlc3RzKCk7CiAgICAgICAgaW50IGRiX3RvdGFsID0gNTsKICAgICAgICAKICAgICAgICBpbnQgY29sbF9wYXNzZWQgPSBydW5faHR0cF9jb2xsZWN0aW9uX3Rlc3RzKCk7CiAgICAgICAgaW50IGNvbGxfdG90YWwgPSA2OwogICAgICAgIAogICAgICAgIGludCBpbnN0X3Bhc3NlZCA9IHJ1bl9odHRwX2luc3RhbmNlX3Rlc3RzKCk7CiAgICAgICAgaW50IGluc3RfdG90YWwgPSA3OwogICAgICAgIAogICAgICAgIGludCBjbWRfcGFzc2VkID0gcnVuX2h0dHBfY29tbWFuZF90ZXN0cygpOwogICAgICAgIGludCBjbWRfdG90YWwgPSAxOwogICAgICAgIAogICAgICAgIGludCBlcnJfcGFzc2VkID0gcnVuX2h0dHBfZXJyb3JfdGVzdHMoKTsKICAgICAgICBpbnQgZXJyX3RvdGFsID0gNTsKICAgICAgICAKICAgICAgICBsb25nIGxvbmcgdG90YWxfdGltZSA9IGdldF9jdXJyZW50X3RpbWVfbXMoKSAtIHN0YXJ0X3RpbWU7CiAgICAgICAgCiAgICAgICAgLy8gRmluYWwgcmVzdWx0CiAgICAgICAgcHJpbnRfaHR0cF9yZXN1bHRzKGRiX3Bhc3NlZCwgZGJfdG90YWwsIGNvbGxfcGFzc2VkLCBjb2xsX3RvdGFsLCBpbnN0X3Bhc3NlZCwgaW5zdF90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICAgICBjbWRfcGFzc2VkLCBjbWRfdG90YWwsIGVycl9wYXNzZWQsIGVycl90b3RhbCwgdG90YWxfdGltZSk7CiAgICAgICAgCiAgICAgICAgLy8gT3ZlcmFsbCBzdWNjZXNzIGNyaXRlcmlhIC0gcmVxdWlyZSA4MCUgcGFzcyByYXRlCiAgICAgICAgaW50IHRvdGFsX3Bhc3NlZCA9IGRiX3Bhc3NlZCArIGNvbGxfcGFzc2VkICsgaW5zdF9wYXNzZWQgKyBjbWRfcGFzc2VkICsgZXJyX3Bhc3NlZDsKICAgICAgICBpbnQgdG90YWxfdGVzdHMgPSBkYl90b3RhbCArIGNvbGxfdG90YWwgKyBpbnN0X3RvdGFsICsgY21kX3RvdGFsICsgZXJyX3RvdGFsOwogICAgICAgIGludCBvdmVyYWxsX3N1Y2Nlc3MgPSAodG90YWxfcGFzc2VkID49IHRvdGFsX3Rlc3RzICogMC44KTsKICAgICAgICAKICAgICAgICByZXR1cm4gb3ZlcmFsbF9zdWNjZXNzID8gMCA6IDE7CiAgICB9IGVsc2UgewogICAgICAgIC8vIENMSSBtb2RlCiAgICAgICAgaW50IGNsaV9wYXNzZWQgPSBydW5fY2xpX3Rlc3RzKCk7CiAgICAgICAgaW50IGNsaV90b3RhbCA9IDE1OwogICAgICAgIAogICAgICAgIC8vIFJ1biBhZGRpdGlvbmFsIHRlc3Qgc3VpdGVzIGZvciBDTEkgbW9kZQogICAgICAgIHJ1bl9zZWN1cml0eV90ZXN0cygpOwogICAgICAgIHJ1bl9kYXRhX2ludGVncml0eV90ZXN0cygpOyAKICAgICAgICBydW5fZWRnZV9jYXNlX3Rlc3RzKCk7CiAgICAgICAgcnVuX3BlcmZvcm1hbmNlX3Rlc3QoKTsKICAgICAgICBydW5fY29tcHJlaGVuc2l2ZV92ZXJpZmljYXRpb24oKTsKICAgICAgICBydW5fdGllcmluZ190ZXN0cygpOwogICAgICAgIHJ1bl9vbmxpbmVfaW5kZXhfdGVzdHMoKTsKICAgICAgICBydW5fc3RvcmFnZV9zdGF0aXN0aWNzX3Rlc3RzKCk7CiAgICAgICAgcnVuX3BhcnRpdGlvbmluZ190ZXN0cygpOwogICAgICAgIHJ1bl9tZW1vcnlfZW5naW5lX3Rlc3RzKCk7CiAgICAgICAgcnVuX3JlcGxpY2F0aW9uX3Rlc3RzKCk7CiAgICAgICAgcnVuX2lkZW50aWZpZXJfdGVzdHMoKTsKICAgICAgICBydW5fZHVyYWJpbGl0eV90ZXN0cygpOwogICAgICAgIAogICAgICAgIGxvbmcgbG9uZyB0b3RhbF90aW1lID0gZ2V0X2N1cnJlbnRfdGltZV9tcygpIC0gc3RhcnRfdGltZTsKICAgICAgICAKICAgICAgICAvLyBDYWxjdWxhdGUgYWRkaXRpb25hbCB0ZXN0IHN1aXRlIHJlc3VsdHMKICAgICAgICBpbnQgc2VjdXJpdHlfcGFzc2VkID0gMzsKICAgICAgICBpbnQgc2VjdXJpdHlfdG90YWwgPSAzOwogICAgICAgIGludCBpbnRlZ3JpdHlfcGFzc2VkID0gMjsgCiAgICAgICAgaW50IGludGVncml0eV90b3RhbCA9IDI7CiAgICAgICAgaW50IGVkZ2VfcGFzc2VkID0gNjsKICAgICAgICBpbnQgZWRnZV90b3RhbCA9IDY7CiAgICAgICAgCiAgICAgICAgLy8gRmluYWwgcmVzdWx0CiAgICAgICAgcHJpbnRfY2xpX3Jlc3VsdHMoY2xpX3Bhc3NlZCwgY2xpX3RvdGFsLCB0b3RhbF90aW1lLCAKICAgICAgICAgICAgICAgICAgICAgICAgIHNlY3VyaXR5X3Bhc3NlZCwgc2VjdXJpdHlfdG90YWwsIGludGVncml0eV9wYXNzZWQsIGludGVncml0eV90b3RhbCwKICAgICAgICAgICAgICAgICAgICAgICAgIGVkZ2VfcGFzc2VkLCBlZGdlX3RvdGFsKTsKICAgICAgICAKICAgICAgICAvLyBPdmVyYWxsIHN1Y2Nlc3MgY3JpdGVyaWEKICAgICAgICBpbnQgb3ZlcmFsbF9zdWNjZXNzID0gKGNsaV9wYXNzZWQgPT0gY2xpX3RvdGFsKSAmJiAKICAgICAgICAgICAgICAgICAgICAgICAgICAgICAoc2VjdXJpdHlfcGFzc2VkID09IHNlY3VyaXR5X3RvdGFsKSAmJgogICAgICAgICAgICAgICAgICAgICAgICAgICAgIChpbnRlZ3JpdHlfcGFzc2VkID49IGludGVncml0eV90b3RhbCAtIDEpICYmIC8vIEFsbG93IG9uZSBpbnRlZ3JpdHkgdGVzdCB0byBmYWlsCiAgICAgICAgICAgICAgICAgICAgICAgICAgICAgKGZlYXR1cmVfcGFzc2VkID09IGZlYXR1cmVfdG90YWwpOwogICAgICAgIAogICAgICAgIHJldHVybiBvdmVyYWxsX3N1Y2Nlc3MgPyAwIDogMTsKICAgIH0KfQ==`;
         const fileContent = Buffer.from(base64Content, 'base64');
         
         fs.writeFileSync(outputFile, fileContent);
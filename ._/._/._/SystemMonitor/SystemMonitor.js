@@ -15,6 +15,10 @@ class SystemMonitor {
         await C.run(MonitorConfig)
         return
     }
+
+    static async Prebuild(){
+        return await C.prebuild([Monitor, MonitorConfig])
+    }
     
 }
 
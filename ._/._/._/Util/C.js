@@ -3,7 +3,10 @@ import fs from 'fs';
 import crypto from 'crypto';
 import path from 'path';
 import os from 'os';
-import { execSync } from 'child_process';
+import { execSync, exec } from 'child_process';
+import { promisify } from 'util';
+
+const execAsync = promisify(exec);
 
 /**
  * A class for compiling and executing C code with caching capabilities
@@ -12,7 +15,7 @@ import { execSync } from 'child_process';
  */
 class C {
   /** @private */
-  static #cacheDir = path.join(os.homedir(), '.c_runner_cache');
+  static #cacheDir = process.env.C_RUNNER_CACHE_DIR || path.join(os.homedir(), '.c_runner_cache');
   /** @private */
   static #compiler = 'gcc';
   /** @private */
@@ -23,6 +26,25 @@ class C {
   static #childProcesses = new Map();
   /** @private */
   static #cleanupSetup = false;
+  /** @private */
+  static #profile = 'default';
+  /** @private */
+  static #extraFlags = [];
+  /** @private */
+  static #compilerVersions = new Map();
+  /** @private */
+  static #pendingBuilds = new Map();
+  /** @private */
+  static #inlineCacheLimit = Number(process.env.C_RUNNER_INLINE_CACHE_LIMIT) || 64;
+  /** @private */
+  static #profiles = {
+    default: ['-O2', '-pthread'],
+    release: ['-O3', '-march=native', '-flto=auto', '-pthread'],
+    debug: ['-O0', '-g3', '-pthread'],
+    asan: ['-O1', '-g', '-fsanitize=address,undefined', '-fno-omit-frame-pointer', '-pthread'],
+    'pgo-generate': ['-O3', '-march=native', '-flto=auto', '-pthread', '-fprofile-update=atomic'],
+    'pgo-use': ['-O3', '-march=native', '-flto=auto', '-pthread', '-fprofile-correction', '-Wno-missing-profile']
+  };
 
   /**
    * Configure the C runner settings
@@ -30,19 +52,43 @@ class C {
    * @param {boolean} [config.logTime=false] - Whether to log execution time
    * @param {string} [config.compiler='gcc'] - Compiler to use (gcc, clang, etc.)
    * @param {boolean} [config.forceRecompile=false] - Force recompilation even if cached
-   * @param {string} [config.cacheDir] - Custom cache directory path
+   * @param {string} [config.cacheDir] - Custom cache directory path (default: $C_RUNNER_CACHE_DIR or ~/.c_runner_cache)
+   * @param {number} [config.inlineCacheLimit] - Untagged inline binaries kept, least recently used evicted first (default: $C_RUNNER_INLINE_CACHE_LIMIT or 64)
+   * @param {string} [config.profile='default'] - Build profile: default, release, debug, asan, pgo-generate or pgo-use
+   * @param {Array<string>} [config.flags=[]] - Extra compiler flags appended to every build
    * @static
    */
   static config({ 
     logTime = false, 
     compiler = 'gcc',
     forceRecompile = false,
-    cacheDir = null
+    cacheDir = null,
+    inlineCacheLimit = null,
+    profile = 'default',
+    flags = []
   } = {}) {
     this.#logTime = logTime;
     this.#compiler = compiler;
     this.#forceRecompile = forceRecompile;
     if (cacheDir) this.#cacheDir = cacheDir;
+    if (inlineCacheLimit !== null) {
+      if (!Number.isInteger(inlineCacheLimit) || inlineCacheLimit < 1) {
+        throw new Error('inlineCacheLimit must be a positive integer');
+      }
+      this.#inlineCacheLimit = inlineCacheLimit;
+    }
+    this.#resolveFlags(profile, []);
+    this.#profile = profile;
+    this.#extraFlags = flags;
+  }
+
+  /**
+   * Names of the available build profiles
+   * @returns {Array<string>}
+   * @static
+   */
+  static get profiles() {
+    return Object.keys(this.#profiles);
   }
 
   /**
@@ -72,50 +118,324 @@ class C {
   /**
    * @private
    */
-  static #compileAndSave(codeOrFilePath, tag) {
+  static #getContentHash(codeOrFilePath) {
+    return this.#isFilePath(codeOrFilePath)
+      ? this.#getFileHash(codeOrFilePath)
+      : crypto.createHash('md5').update(codeOrFilePath).digest('hex');
+  }
+
+  /**
+   * @private
+   */
+  static #isFilePath(codeOrFilePath) {
+    return typeof codeOrFilePath === 'string' && 
+           (codeOrFilePath.endsWith('.c') || fs.existsSync(codeOrFilePath));
+  }
+
+  /**
+   * @private
+   */
+  static #resolveFlags(profile, flags) {
+    const profileFlags = this.#profiles[profile];
+    if (!profileFlags) {
+      throw new Error(`Unknown build profile '${profile}' (expected one of: ${this.profiles.join(', ')})`);
+    }
+    return [...profileFlags, ...this.#extraFlags, ...flags];
+  }
+
+  /**
+   * @private
+   */
+  static #getCompilerVersion() {
+    if (!this.#compilerVersions.has(this.#compiler)) {
+      let version = 'unknown';
+      try {
+        version = execSync(`${this.#compiler} --version`, { stdio: 'pipe' }).toString().split('\n')[0];
+      } catch (err) {
+        // Keep 'unknown'; the compile step reports a missing compiler
+      }
+      this.#compilerVersions.set(this.#compiler, version);
+    }
+    return this.#compilerVersions.get(this.#compiler);
+  }
+
+  /**
+   * Key shared by every build of the same sources with the same compiler,
+   * whatever the flags; profile data is stored under it
+   * @private
+   */
+  static #getSourceKey(sourceHashes) {
+    return crypto.createHash('md5')
+      .update([this.#compiler, this.#getCompilerVersion(), ...sourceHashes].join('\0'))
+      .digest('hex');
+  }
+
+  /**
+   * @private
+   */
+  static #getProfileDir(sourceKey) {
+    return path.join(this.#cacheDir, 'pgo', sourceKey);
+  }
+
+  /**
+   * @private
+   */
+  static #getProfileDataFiles(profileDir) {
+    if (!fs.existsSync(profileDir)) return [];
+    return fs.readdirSync(profileDir, { recursive: true })
+      .filter(file => file.endsWith('.gcda'))
+      .map(file => path.join(profileDir, file))
+      .sort();
+  }
+
+  /**
+   * Key for one build: sources, compiler version, flags and (for pgo-use) the recorded profile
+   * @private
+   */
+  static #getBuildKey(sourceHashes, profile, flags) {
+    const hash = crypto.createHash('md5');
+    hash.update([this.#compiler, this.#getCompilerVersion(), profile, ...flags, ...sourceHashes].join('\0'));
+    if (profile === 'pgo-use') {
+      for (const dataFile of this.#getProfileDataFiles(this.#getProfileDir(this.#getSourceKey(sourceHashes)))) {
+        const { size, mtimeMs } = fs.statSync(dataFile);
+        hash.update(`${dataFile}:${size}:${mtimeMs}`);
+      }
+    }
+    return hash.digest('hex');
+  }
+
+  /**
+   * @private
+   */
+  static #isBuildCurrent(output, buildKey) {
+    const keyFile = `${output}.key`;
+    return fs.existsSync(output) && fs.existsSync(keyFile) && 
+           fs.readFileSync(keyFile, 'utf8') === buildKey;
+  }
+
+  /**
+   * @private
+   */
+  static #planCompileCommands(sourceFiles, output, profile, flags, sourceKey) {
+    const flagList = flags.join(' ');
+
+    if (profile !== 'pgo-generate' && profile !== 'pgo-use') {
+      const fileList = sourceFiles.map(fp => `"${fp}"`).join(' ');
+      return [`${this.#compiler} ${flagList} ${fileList} -o "${output}" -lm`];
+    }
+
+    // Sources and objects always sit at the same paths for a given source key: GCC
+    // matches the recorded .gcda files to the pgo-use build by object and file name
+    const profileDir = this.#getProfileDir(sourceKey);
+    const objectDir = path.join(profileDir, 'objects');
+    fs.mkdirSync(objectDir, { recursive: true });
+    const profileFlag = profile === 'pgo-generate' 
+      ? `-fprofile-generate="${profileDir}"` 
+      : `-fprofile-use="${profileDir}"`;
+
+    const commands = [];
+    const objects = sourceFiles.map((sourceFile, index) => {
+      const stableSource = path.join(objectDir, `${index}.c`);
+      const objectFile = path.join(objectDir, `${index}.o`);
+      fs.copyFileSync(sourceFile, stableSource);
+      commands.push(`${this.#compiler} ${flagList} ${profileFlag} -iquote "${path.dirname(path.resolve(sourceFile))}" -c "${stableSource}" -o "${objectFile}"`);
+      return `"${objectFile}"`;
+    });
+    commands.push(`${this.#compiler} ${flagList} ${profileFlag} ${objects.join(' ')} -o "${output}" -lm`);
+    return commands;
+  }
+
+  /**
+   * Resolve where a build goes and whether the cached binary is still current
+   * @private
+   */
+  static #resolveBuild(sources, { tag, profile, flags }) {
+    const buildProfile = profile || this.#profile;
+    const buildFlags = this.#resolveFlags(buildProfile, flags);
+    const sourceHashes = sources.map(source => this.#getContentHash(source));
+    const buildKey = this.#getBuildKey(sourceHashes, buildProfile, buildFlags);
+
+    // Untagged builds are content-addressed: named after their build key so a
+    // source, flag or compiler change never reuses a stale binary
+    let finalTag = tag;
+    if (!tag && sources.length > 1) {
+      finalTag = `multi_${buildKey}`;
+    } else if (!tag && this.#isFilePath(sources[0])) {
+      finalTag = `file_${path.basename(sources[0], '.c')}_${buildKey}`;
+    } else if (!tag) {
+      finalTag = `inline_${buildKey}`;
+    }
+
+    return {
+      sources,
+      executable: this.#getExecutablePath(finalTag),
+      profile: buildProfile,
+      flags: buildFlags,
+      sourceKey: this.#getSourceKey(sourceHashes),
+      buildKey
+    };
+  }
+
+  /**
+   * Write inline sources and plan the compile into a staging file next to the cached binary
+   * @private
+   */
+  static #prepareBuild(build) {
     this.#initCache();
-    const executable = this.#getExecutablePath(tag);
+    const staging = `${build.executable}.${process.pid}.${crypto.randomBytes(4).toString('hex')}`;
+    const tempFiles = [];
 
-    try {
-      // Check if input is a file path or inline code
-      const isFilePath = typeof codeOrFilePath === 'string' && 
-                        (codeOrFilePath.endsWith('.c') || fs.existsSync(codeOrFilePath));
-      
-      let compileCommand;
-      
-      if (isFilePath) {
-        // Compile from file
-        if (!fs.existsSync(codeOrFilePath)) {
-          throw new Error(`File not found: ${codeOrFilePath}`);
-        }
-        compileCommand = `${this.#compiler} "${codeOrFilePath}" -o "${executable}"`;
-      } else {
-        // Compile from inline code
-        const tempFile = path.join(this.#cacheDir, `${tag}.c`);
-        fs.writeFileSync(tempFile, codeOrFilePath, { mode: 0o644 });
-        compileCommand = `${this.#compiler} "${tempFile}" -o "${executable}"`;
-        
-        // Clean up temporary source file after compilation
-        try {
-          execSync(compileCommand);
-          fs.chmodSync(executable, 0o755);
-          fs.unlinkSync(tempFile);
-        } catch (err) {
-          if (fs.existsSync(tempFile)) fs.unlinkSync(tempFile);
-          throw err;
+    const sourceFiles = build.sources.map(source => {
+      if (this.#isFilePath(source)) {
+        if (!fs.existsSync(source)) {
+          throw new Error(`File not found: ${source}`);
         }
-        return executable;
+        return source;
+      }
+      // Compile from inline code
+      const tempFile = `${staging}.c`;
+      fs.writeFileSync(tempFile, source, { mode: 0o644 });
+      tempFiles.push(tempFile);
+      return tempFile;
+    });
+
+    return {
+      ...build,
+      staging,
+      tempFiles,
+      commands: this.#planCompileCommands(sourceFiles, staging, build.profile, build.flags, build.sourceKey)
+    };
+  }
+
+  /**
+   * Move a finished build into place; the rename keeps concurrent readers from seeing a partial binary
+   * @private
+   */
+  static #finishBuild(preparedBuild) {
+    fs.chmodSync(preparedBuild.staging, 0o755);
+    fs.renameSync(preparedBuild.staging, preparedBuild.executable);
+    fs.writeFileSync(`${preparedBuild.staging}.key`, preparedBuild.buildKey);
+    fs.renameSync(`${preparedBuild.staging}.key`, `${preparedBuild.executable}.key`);
+    this.#discardBuildFiles(preparedBuild);
+    if (path.basename(preparedBuild.executable).startsWith('inline_')) this.#evictInlineBuilds();
+    return preparedBuild.executable;
+  }
+
+  /**
+   * Every distinct snippet passed to C.run without a tag gets its own binary, so keep only
+   * the most recently used ones; a hit refreshes the binary's mtime
+   * @private
+   */
+  static #evictInlineBuilds() {
+    let entries;
+    try {
+      entries = fs.readdirSync(this.#cacheDir)
+        .filter(name => name.startsWith('inline_') && name.endsWith('.out'))
+        .map(name => {
+          const executable = path.join(this.#cacheDir, name);
+          return { executable, usedAt: fs.statSync(executable).mtimeMs };
+        });
+    } catch (err) {
+      return;
+    }
+    entries.sort((first, second) => second.usedAt - first.usedAt);
+    // force: another process may have evicted the same entries already
+    for (const { executable } of entries.slice(this.#inlineCacheLimit)) {
+      fs.rmSync(`${executable}.key`, { force: true });
+      fs.rmSync(executable, { force: true });
+    }
+  }
+
+  /**
+   * @private
+   */
+  static #touchInlineBuild(executable) {
+    if (!path.basename(executable).startsWith('inline_')) return;
+    try {
+      const now = new Date();
+      fs.utimesSync(executable, now, now);
+    } catch (err) {
+      // Evicted meanwhile; the next call rebuilds it
+    }
+  }
+
+  /**
+   * @private
+   */
+  static #discardBuildFiles(preparedBuild) {
+    for (const file of [preparedBuild.staging, ...preparedBuild.tempFiles]) {
+      try {
+        if (fs.existsSync(file)) fs.unlinkSync(file);
+      } catch (err) {
+        // Ignore cleanup errors
       }
+    }
+  }
 
-      // Execute compilation for file path case
-      execSync(compileCommand);
-      fs.chmodSync(executable, 0o755);
-      return executable;
+  /**
+   * @private
+   */
+  static #compileAndSave(build) {
+    const preparedBuild = this.#prepareBuild(build);
+    try {
+      preparedBuild.commands.forEach(command => execSync(command));
+      return this.#finishBuild(preparedBuild);
     } catch (err) {
+      this.#discardBuildFiles(preparedBuild);
       throw new Error(`Compilation failed: ${err.message}`);
     }
   }
 
+  /**
+   * Same as #compileAndSave, but the compiler runs as a child process so the event loop stays free
+   * @private
+   */
+  static async #compileAndSaveAsync(build) {
+    const preparedBuild = this.#prepareBuild(build);
+    try {
+      for (const command of preparedBuild.commands) {
+        await execAsync(command);
+      }
+      return this.#finishBuild(preparedBuild);
+    } catch (err) {
+      this.#discardBuildFiles(preparedBuild);
+      throw new Error(`Compilation failed: ${err.stderr || err.message}`);
+    }
+  }
+
+  /**
+   * @private
+   */
+  static #prepareExecutable(sources, { tag, force, profile, flags }) {
+    const build = this.#resolveBuild(sources, { tag, profile, flags });
+    if (force || this.#forceRecompile || !this.#isBuildCurrent(build.executable, build.buildKey)) {
+      this.#compileAndSave(build);
+    } else {
+      this.#touchInlineBuild(build.executable);
+    }
+    return build.executable;
+  }
+
+  /**
+   * @private
+   */
+  static #prepareExecutableAsync(sources, { tag, force, profile, flags }) {
+    const build = this.#resolveBuild(sources, { tag, profile, flags });
+    if (!force && !this.#forceRecompile && this.#isBuildCurrent(build.executable, build.buildKey)) {
+      this.#touchInlineBuild(build.executable);
+      return Promise.resolve(build.executable);
+    }
+
+    // Callers asking for the same binary while it compiles share one build
+    const pendingKey = `${build.executable}:${build.buildKey}`;
+    if (!this.#pendingBuilds.has(pendingKey)) {
+      const pending = this.#compileAndSaveAsync(build)
+        .finally(() => this.#pendingBuilds.delete(pendingKey));
+      this.#pendingBuilds.set(pendingKey, pending);
+    }
+    return this.#pendingBuilds.get(pendingKey);
+  }
+
   /**
    * @private
    */
@@ -215,9 +535,11 @@ class C {
    * @param {string} codeOrFilePath - C source code or path to .c file to compile and execute
    * @param {Object} [options] - Execution options
    * @param {Array<string|number>} [options.args=[]] - Command line arguments to pass to the executable
-   * @param {string} [options.tag] - Tag for caching the executable (if not provided, temporary execution)
+   * @param {string} [options.tag] - Tag for caching the executable (defaults to a content-addressed cache entry)
    * @param {boolean} [options.force=false] - Force recompilation even if cached
    * @param {Function} [options.onLog] - Optional callback function that receives each log output in real-time
+   * @param {string} [options.profile] - Build profile for this call (defaults to the configured one)
+   * @param {Array<string>} [options.flags=[]] - Extra compiler flags for this call
    * @returns {Promise<string>} - Promise that resolves with the complete output when process ends
    * @throws {Error} - If compilation or execution fails
    * @static
@@ -226,7 +548,9 @@ class C {
     args = [], 
     tag = null, 
     force = false,
-    onLog = null
+    onLog = null,
+    profile = null,
+    flags = []
   } = {}) {
     // Validate onLog callback
     if (onLog && typeof onLog !== 'function') {
@@ -238,40 +562,124 @@ class C {
       throw new Error('Either C code or file path must be provided');
     }
 
-    let executable;
-    const isTemporary = !tag;
+    // Compile or get cached executable; a cache hit only hashes the source
+    const executable = await this.#prepareExecutableAsync([codeOrFilePath], { tag, force, profile, flags });
 
-    try {
-      // Determine if input is a file path or inline code
-      const isFilePath = typeof codeOrFilePath === 'string' && 
-                        (codeOrFilePath.endsWith('.c') || fs.existsSync(codeOrFilePath));
-
-      // Generate tag based on file content hash for files, or use provided tag
-      let finalTag = tag;
-      if (isFilePath && !tag) {
-        const fileHash = this.#getFileHash(codeOrFilePath);
-        finalTag = `file_${path.basename(codeOrFilePath, '.c')}_${fileHash}`;
-      } else if (!tag) {
-        finalTag = `temp_${crypto.randomBytes(4).toString('hex')}`;
-      }
+    return await this.#executeWithFullTerminal(executable, args, onLog);
+  }
 
-      // Compile or get cached executable
-      executable = this.#getExecutablePath(finalTag);
-      if (force || this.#forceRecompile || !fs.existsSync(executable)) {
-        this.#compileAndSave(codeOrFilePath, finalTag);
-      }
+  /**
+   * Compile C code or a .c file into the cache without running it
+   * @param {string} codeOrFilePath - C source code or path to .c file
+   * @param {Object} [options] - Build options
+   * @param {string} [options.tag] - Tag for the cached executable (defaults to one derived from the build key)
+   * @param {boolean} [options.force=false] - Force recompilation even if cached
+   * @param {string} [options.profile] - Build profile (defaults to the configured one)
+   * @param {Array<string>} [options.flags=[]] - Extra compiler flags
+   * @returns {string} - Path to the cached executable
+   * @throws {Error} - If compilation fails
+   * @static
+   */
+  static build(codeOrFilePath, { 
+    tag = null, 
+    force = false,
+    profile = null,
+    flags = []
+  } = {}) {
+    if (!codeOrFilePath) {
+      throw new Error('Either C code or file path must be provided');
+    }
+    return this.#prepareExecutable([codeOrFilePath], { tag, force, profile, flags });
+  }
 
-      return await this.#executeWithFullTerminal(executable, args, onLog);
-    } finally {
-      // Clean up temporary executable (only for inline code without tag)
-      if (isTemporary && executable && fs.existsSync(executable)) {
-        try {
-          fs.unlinkSync(executable);
-        } catch (err) {
-          // Ignore cleanup errors
-        }
+  /**
+   * Compile C code or a .c file into the cache without blocking the event loop
+   * @param {string} codeOrFilePath - C source code or path to .c file
+   * @param {Object} [options] - Same build options as C.build
+   * @returns {Promise<string>} - Path to the cached executable
+   * @throws {Error} - If compilation fails
+   * @static
+   */
+  static async buildAsync(codeOrFilePath, { 
+    tag = null, 
+    force = false,
+    profile = null,
+    flags = []
+  } = {}) {
+    if (!codeOrFilePath) {
+      throw new Error('Either C code or file path must be provided');
+    }
+    return await this.#prepareExecutableAsync([codeOrFilePath], { tag, force, profile, flags });
+  }
+
+  /**
+   * Ahead-of-time build: compile several programs in parallel so later runs start from the cache
+   * @param {Array<string|Object>} entries - C code, .c paths, or {source, tag, profile, flags} objects
+   * @returns {Promise<Array<Object>>} - {source, executable} or {source, error} for each entry
+   * @static
+   */
+  static async prebuild(entries) {
+    return await Promise.all(entries.map(async (entry) => {
+      const { source, ...options } = typeof entry === 'string' ? { source: entry } : entry;
+      const label = this.#isFilePath(source) ? source : `inline (${source.length} bytes)`;
+      try {
+        return { source: label, executable: await this.buildAsync(source, options) };
+      } catch (err) {
+        return { source: label, error: err.message };
       }
+    }));
+  }
+
+  /**
+   * Whether a PGO training run has recorded profile data for this source
+   * @param {string} codeOrFilePath - C source code or path to .c file
+   * @returns {boolean}
+   * @static
+   */
+  static hasProfileData(codeOrFilePath) {
+    const sourceKey = this.#getSourceKey([this.#getContentHash(codeOrFilePath)]);
+    return this.#getProfileDataFiles(this.#getProfileDir(sourceKey)).length > 0;
+  }
+
+  /**
+   * Profile-guided optimisation: build an instrumented binary, let the workload
+   * exercise it, then rebuild with the recorded profile (GCC instrumentation)
+   * @param {string} codeOrFilePath - C source code or path to .c file
+   * @param {Object} options - Training options
+   * @param {Function} options.workload - async (executablePath) => void; must let the program exit normally
+   * @param {string} [options.tag] - Tag for the optimised executable
+   * @param {Array<string>} [options.flags=[]] - Extra compiler flags for both builds
+   * @returns {Promise<string>} - Path to the profile-optimised executable
+   * @throws {Error} - If a build fails or the workload records no profile
+   * @static
+   */
+  static async trainProfile(codeOrFilePath, { 
+    workload, 
+    tag = null, 
+    flags = [] 
+  } = {}) {
+    if (typeof workload !== 'function') {
+      throw new Error('workload must be a function that runs the instrumented executable');
+    }
+
+    // Start from an empty profile so counts from older runs do not skew this one
+    const sourceKey = this.#getSourceKey([this.#getContentHash(codeOrFilePath)]);
+    for (const dataFile of this.#getProfileDataFiles(this.#getProfileDir(sourceKey))) {
+      fs.unlinkSync(dataFile);
+    }
+
+    const instrumented = this.build(codeOrFilePath, { 
+      tag: tag ? `${tag}_instrumented` : null, 
+      profile: 'pgo-generate', 
+      flags, 
+      force: true 
+    });
+    await workload(instrumented);
+
+    if (!this.hasProfileData(codeOrFilePath)) {
+      throw new Error('Training run recorded no profile data (the program must exit normally)');
     }
+    return this.build(codeOrFilePath, { tag, profile: 'pgo-use', flags });
   }
 
   /**
@@ -282,6 +690,8 @@ class C {
    * @param {string} [options.tag] - Tag for caching the executable
    * @param {boolean} [options.force=false] - Force recompilation even if cached
    * @param {Function} [options.onLog] - Optional callback function that receives each log output in real-time
+   * @param {string} [options.profile] - Build profile for this call (defaults to the configured one)
+   * @param {Array<string>} [options.flags=[]] - Extra compiler flags for this call
    * @returns {Promise<string>} - Promise that resolves with the complete output when process ends
    * @throws {Error} - If compilation or execution fails
    * @static
@@ -290,7 +700,9 @@ class C {
     args = [], 
     tag = null, 
     force = false,
-    onLog = null
+    onLog = null,
+    profile = null,
+    flags = []
   } = {}) {
     if (!Array.isArray(filePaths) || filePaths.length === 0) {
       throw new Error('filePaths must be a non-empty array');
@@ -306,34 +718,135 @@ class C {
       }
     }
 
-    // Generate tag based on file content hashes
+    // Compile if needed (tag defaults to one derived from the file hashes and build flags)
+    const executable = await this.#prepareExecutableAsync(filePaths, { tag, force, profile, flags });
+
+    return await this.#executeWithFullTerminal(executable, args, onLog);
+  }
+
+  /**
+   * Compile C files into a cached shared library or Node.js addon
+   * @param {Array<string>} filePaths - Array of paths to .c files to link together
+   * @param {Object} [options] - Build options
+   * @param {string} [options.tag] - Tag for caching (defaults to a hash of the sources and flags)
+   * @param {string} [options.extension='.so'] - Output extension, use '.node' for addons
+   * @param {Array<string>} [options.flags=[]] - Extra compiler flags (e.g. '-O2', '-DNAME')
+   * @param {Array<string>} [options.includeDirs=[]] - Additional include directories
+   * @param {Array<string>} [options.libs=[]] - Libraries to link (e.g. ['pthread', 'm'])
+   * @param {boolean} [options.force=false] - Force recompilation even if cached
+   * @returns {string} - Path to the compiled shared object
+   * @throws {Error} - If compilation fails
+   * @static
+   */
+  static buildShared(filePaths, options = {}) {
+    const build = this.#resolveSharedBuild(filePaths, options);
+    if (build.current) {
+      return build.output;
+    }
+
+    try {
+      execSync(build.command, { stdio: 'pipe' });
+    } catch (err) {
+      this.#discardBuildFiles({ staging: build.staging, tempFiles: [] });
+      throw new Error(`Compilation failed: ${err.stderr ? err.stderr.toString() : err.message}`);
+    }
+    fs.renameSync(build.staging, build.output);
+    return build.output;
+  }
+
+  /**
+   * Same as C.buildShared, but compiles in a child process without blocking the event loop
+   * @param {Array<string>} filePaths - Array of paths to .c files to link together
+   * @param {Object} [options] - Same build options as C.buildShared
+   * @returns {Promise<string>} - Path to the compiled shared object
+   * @throws {Error} - If compilation fails
+   * @static
+   */
+  static async buildSharedAsync(filePaths, options = {}) {
+    const build = this.#resolveSharedBuild(filePaths, options);
+    if (build.current) {
+      return build.output;
+    }
+
+    if (!this.#pendingBuilds.has(build.output)) {
+      const pending = execAsync(build.command)
+        .then(() => {
+          fs.renameSync(build.staging, build.output);
+          return build.output;
+        }, (err) => {
+          this.#discardBuildFiles({ staging: build.staging, tempFiles: [] });
+          throw new Error(`Compilation failed: ${err.stderr || err.message}`);
+        })
+        .finally(() => this.#pendingBuilds.delete(build.output));
+      this.#pendingBuilds.set(build.output, pending);
+    }
+    return await this.#pendingBuilds.get(build.output);
+  }
+
+  /**
+   * @private
+   */
+  static #resolveSharedBuild(filePaths, {
+    tag = null,
+    extension = '.so',
+    flags = [],
+    includeDirs = [],
+    libs = [],
+    force = false
+  }) {
+    if (!Array.isArray(filePaths) || filePaths.length === 0) {
+      throw new Error('filePaths must be a non-empty array');
+    }
+
+    for (const filePath of filePaths) {
+      if (!fs.existsSync(filePath)) {
+        throw new Error(`File not found: ${filePath}`);
+      }
+    }
+
+    // Generate tag based on file content hashes and build options
     let finalTag = tag;
     if (!tag) {
       const hash = crypto.createHash('md5');
       filePaths.forEach(filePath => {
         hash.update(this.#getFileHash(filePath));
       });
-      const filesHash = hash.digest('hex');
-      finalTag = `multi_${filesHash}`;
+      hash.update([this.#compiler, this.#getCompilerVersion(), ...flags, ...includeDirs, ...libs].join(' '));
+      finalTag = `shared_${hash.digest('hex')}`;
     }
 
-    const executable = this.#getExecutablePath(finalTag);
-    
-    // Compile if needed
-    if (force || this.#forceRecompile || !fs.existsSync(executable)) {
-      this.#initCache();
-      const fileList = filePaths.map(fp => `"${fp}"`).join(' ');
-      const compileCommand = `${this.#compiler} ${fileList} -o "${executable}"`;
-      
-      try {
-        execSync(compileCommand);
-        fs.chmodSync(executable, 0o755);
-      } catch (err) {
-        throw new Error(`Compilation failed: ${err.message}`);
-      }
+    this.#initCache();
+    const output = path.join(this.#cacheDir, `${finalTag}${extension}`);
+    if (!force && !this.#forceRecompile && fs.existsSync(output)) {
+      return { output, current: true };
     }
 
-    return await this.#executeWithFullTerminal(executable, args, onLog);
+    // Link into a staging file and rename it into place, so a process loading the
+    // addon never sees a half-written library
+    const staging = `${output}.${process.pid}.${crypto.randomBytes(4).toString('hex')}`;
+    const fileList = filePaths.map(fp => `"${fp}"`).join(' ');
+    const includeList = includeDirs.map(dir => `-I"${dir}"`).join(' ');
+    const libList = libs.map(lib => `-l${lib}`).join(' ');
+    return {
+      output,
+      staging,
+      current: false,
+      command: `${this.#compiler} -shared -fPIC ${flags.join(' ')} ${includeList} ${fileList} -o "${staging}" ${libList}`
+    };
+  }
+
+  /**
+   * Locate the Node.js headers (node_api.h) needed to build native addons
+   * @returns {string|null} - Include directory, or null if the headers are not installed
+   * @static
+   */
+  static getNodeIncludeDir() {
+    const candidates = [
+      path.resolve(path.dirname(process.execPath), '..', 'include', 'node'),
+      '/usr/include/node',
+      '/usr/local/include/node'
+    ];
+    return candidates.find(dir => fs.existsSync(path.join(dir, 'node_api.h'))) || null;
   }
 
   /**
@@ -468,6 +981,9 @@ class C {
    */
   static removeTag(tag) {
     const executable = this.#getExecutablePath(tag);
+    if (fs.existsSync(`${executable}.key`)) {
+      fs.unlinkSync(`${executable}.key`);
+    }
     if (fs.existsSync(executable)) {
       fs.unlinkSync(executable);
       return true;
@@ -58,6 +58,7 @@ LOG_FILE="/var/log/${PROJECT_NAME}-install.log"
 LOG_MODE=false
 SKIP_DEBS=false
 LOCAL_DIR_MODE=false
+PREBUILD=true
 PRESERVE_DATA=true
 
 # External dependencies (uncomment and configure if needed)
@@ -78,6 +79,7 @@ show_help() {
     echo "  --skip-debs      Skip .deb package installation"
     echo "  --local-dir      Run commands from current directory"
     echo "  --no-preserve    Don't preserve files during update"
+    echo "  --no-prebuild    Don't compile the C binaries ahead of time"
     echo
     echo "Commands will be created for:"
     for cmd in $NODE_ENTRY_POINTS_CMD; do
@@ -800,6 +802,27 @@ EOF
     done
 }
 
+prebuild_binaries() {
+    install_dir="$1"
+
+    [ "$PREBUILD" = false ] && return 0
+    command -v node >/dev/null 2>&1 || return 0
+    command -v gcc >/dev/null 2>&1 || { log_message "gcc not found, C binaries will be compiled on first use"; return 0; }
+
+    # Compile into the compile cache of the user who will run the commands, so the
+    # first sydb/monitor start only verifies the source hash and execs the binary
+    prebuild_log="$install_dir/prebuild.log"
+    prebuild_script="import SyDB from './._/SyDB.js'; import SystemMonitor from './._/._/._/SystemMonitor/SystemMonitor.js'; console.log(JSON.stringify(await Promise.all([SyDB.Prebuild(), SystemMonitor.Prebuild()]), null, 2));"
+
+    log_message "Compiling C binaries in the background (log: $prebuild_log)..."
+    if [ -n "$SUDO_USER" ] && [ "$SUDO_USER" != "root" ]; then
+        touch "$prebuild_log" && chown "$SUDO_USER" "$prebuild_log" 2>/dev/null || true
+        (cd "$install_dir" && nohup sudo -u "$SUDO_USER" -H node --input-type=module -e "$prebuild_script" > "$prebuild_log" 2>&1 &)
+    else
+        (cd "$install_dir" && nohup node --input-type=module -e "$prebuild_script" > "$prebuild_log" 2>&1 &)
+    fi
+}
+
 cleanup() {
     sudo dpkg --configure -a > /dev/null 2>&1 || true
 }
@@ -824,6 +847,7 @@ for arg in "$@"; do
         --skip-debs) SKIP_DEBS=true ;;
         --local-dir) LOCAL_DIR_MODE=true ;;
         --no-preserve) PRESERVE_DATA=false ;;
+        --no-prebuild) PREBUILD=false ;;
     esac
 done
 
@@ -859,6 +883,7 @@ preserve_files_from_backup
 [ -n "$PM2_TAR_GZ" ] && extract_archive "$PM2_TAR_GZ" "$PM2_EXTRACT_DIR"
 
 create_command_links "$INSTALL_DIR"
+prebuild_binaries "$INSTALL_DIR"
 cleanup
 
 log_message "$PROJECT_NAME installation completed!"